@@ -0,0 +1,107 @@
+#pragma once
+
+/**
+ * @file
+ * @brief Utilities for benchmarking.
+ *
+ * Monotonic timing and adaptive repetition of measured code.
+ * Formatted reporting of timings and throughput.
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief Minimum duration in seconds of a single measurement.
+ */
+#define lluna_BenchmarkHelper_MinimumDuration 0.25
+
+/**
+ * @brief Function measured by a benchmark.
+ *
+ * Should run the measured code the given number of times.
+ */
+typedef void (*lluna_BenchmarkHelper_Function)(void* Context, unsigned long long Iterations);
+
+/**
+ * @brief Sink for benchmark results, keeping the compiler from removing measured code.
+ */
+static volatile unsigned long long lluna_BenchmarkHelper_Sink;
+
+/**
+ * @brief Returns the current monotonic time in seconds.
+ *
+ * @return Time in seconds.
+ */
+static double lluna_BenchmarkHelper_Now()
+{
+        struct timespec Time;
+        clock_gettime(CLOCK_MONOTONIC, &Time);
+
+        return (double)Time.tv_sec + (double)Time.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Measures the average duration of one iteration of a function.
+ *
+ * Doubles the number of iterations until a run lasts at least lluna_BenchmarkHelper_MinimumDuration.
+ *
+ * @param Function Function to measure.
+ * @param Context Context passed to the function.
+ * @return Seconds per iteration.
+ */
+static double lluna_BenchmarkHelper_Measure(lluna_BenchmarkHelper_Function Function, void* Context)
+{
+        unsigned long long Iterations = 1;
+        for (;;)
+        {
+                double Start = lluna_BenchmarkHelper_Now();
+                Function(Context, Iterations);
+                double Elapsed = lluna_BenchmarkHelper_Now() - Start;
+
+                if (Elapsed >= lluna_BenchmarkHelper_MinimumDuration)
+                {
+                        return Elapsed / (double)Iterations;
+                }
+                Iterations *= 2;
+        }
+}
+
+/**
+ * @brief Prints the throughput of processing a number of bytes.
+ *
+ * @param Name Name of the benchmark.
+ * @param Bytes Bytes processed per iteration.
+ * @param Seconds Seconds per iteration.
+ */
+#define lluna_BenchmarkHelper_ReportThroughput(Name, Bytes, Seconds) \
+do \
+{ \
+        printf("%-24s %12llu B %12.2f ns %10.2f GB/s\n", \
+                Name, \
+                (unsigned long long)(Bytes), \
+                (Seconds) * 1e9, \
+                (double)(Bytes) / (Seconds) * 1e-9 \
+        ); \
+} while (0);
+
+/**
+ * @brief Prints the rate of performing a number of operations.
+ *
+ * @param Name Name of the benchmark.
+ * @param Operations Operations performed per iteration.
+ * @param Seconds Seconds per iteration.
+ */
+#define lluna_BenchmarkHelper_ReportRate(Name, Operations, Seconds) \
+do \
+{ \
+        printf("%-24s %12llu ops %12.2f ns/op %10.2f Mops/s\n", \
+                Name, \
+                (unsigned long long)(Operations), \
+                (Seconds) * 1e9 / (double)(Operations), \
+                (double)(Operations) / (Seconds) * 1e-6 \
+        ); \
+} while (0);
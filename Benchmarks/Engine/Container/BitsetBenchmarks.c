@@ -0,0 +1,121 @@
+#include <BenchmarkHelper.h>
+
+#include <Engine/Container/Public/Bitset.h>
+
+#include <stdlib.h>
+
+#define FlagCount (1024 * 1024)
+
+struct MaskContext
+{
+        boolean* LeftFlags;
+        boolean* RightFlags;
+        struct lluna_Container_Bitset* Left;
+        struct lluna_Container_Bitset* Right;
+        struct lluna_Container_Bitset* Result;
+};
+
+// Intersects two masks and counts the matches, as a query for entities with two components would.
+static void QueryFlags(void* Context, unsigned long long Iterations)
+{
+        struct MaskContext* Input = (struct MaskContext*)Context;
+        uint64 Matches = 0;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                for (uint64 Index = 0; Index < FlagCount; ++Index)
+                {
+                        Matches += Input->LeftFlags[Index] & Input->RightFlags[Index];
+                }
+        }
+        lluna_BenchmarkHelper_Sink = Matches;
+}
+
+static void QueryBitset(void* Context, unsigned long long Iterations)
+{
+        struct MaskContext* Input = (struct MaskContext*)Context;
+        uint64 Matches = 0;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                lluna_Container_Bitset_ResetAll(Input->Result);
+                lluna_Container_Bitset_Or(Input->Result, Input->Left);
+                lluna_Container_Bitset_And(Input->Result, Input->Right);
+                Matches += lluna_Container_Bitset_PopCount(Input->Result);
+        }
+        lluna_BenchmarkHelper_Sink = Matches;
+}
+
+// Visits every match of a sparse mask.
+static void IterateFlags(void* Context, unsigned long long Iterations)
+{
+        struct MaskContext* Input = (struct MaskContext*)Context;
+        uint64 Sum = 0;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                for (uint64 Index = 0; Index < FlagCount; ++Index)
+                {
+                        if (Input->LeftFlags[Index] && Input->RightFlags[Index])
+                        {
+                                Sum += Index;
+                        }
+                }
+        }
+        lluna_BenchmarkHelper_Sink = Sum;
+}
+
+static void IterateBitset(void* Context, unsigned long long Iterations)
+{
+        struct MaskContext* Input = (struct MaskContext*)Context;
+        uint64 Sum = 0;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                uint64 Index;
+                struct lluna_Container_Bitset_Iterator Iterator = lluna_Container_Bitset_Begin(Input->Result);
+                while (lluna_Container_Bitset_Next(&Iterator, &Index))
+                {
+                        Sum += Index;
+                }
+        }
+        lluna_BenchmarkHelper_Sink = Sum;
+}
+
+int main(int argc, const char* argv[])
+{
+        struct MaskContext Context;
+        Context.LeftFlags = malloc(FlagCount * sizeof(boolean));
+        Context.RightFlags = malloc(FlagCount * sizeof(boolean));
+        Context.Left = lluna_Container_Bitset_Create(FlagCount);
+        Context.Right = lluna_Container_Bitset_Create(FlagCount);
+        Context.Result = lluna_Container_Bitset_Create(FlagCount);
+
+        uint64 State = 0x9E3779B97F4A7C15ULL;
+        for (uint64 Index = 0; Index < FlagCount; ++Index)
+        {
+                State ^= State << 13;
+                State ^= State >> 7;
+                State ^= State << 17;
+
+                Context.LeftFlags[Index] = State % 4 == 0;
+                Context.RightFlags[Index] = (State >> 8) % 8 == 0;
+                if (Context.LeftFlags[Index])
+                {
+                        lluna_Container_Bitset_Set(Context.Left, Index);
+                }
+                if (Context.RightFlags[Index])
+                {
+                        lluna_Container_Bitset_Set(Context.Right, Index);
+                }
+        }
+
+        lluna_BenchmarkHelper_ReportRate("Query_Flags", FlagCount, lluna_BenchmarkHelper_Measure(QueryFlags, &Context));
+        lluna_BenchmarkHelper_ReportRate("Query_Bitset", FlagCount, lluna_BenchmarkHelper_Measure(QueryBitset, &Context));
+        lluna_BenchmarkHelper_ReportRate("Iterate_Flags", FlagCount, lluna_BenchmarkHelper_Measure(IterateFlags, &Context));
+        lluna_BenchmarkHelper_ReportRate("Iterate_Bitset", FlagCount, lluna_BenchmarkHelper_Measure(IterateBitset, &Context));
+
+        lluna_Container_Bitset_Destroy(Context.Result);
+        lluna_Container_Bitset_Destroy(Context.Right);
+        lluna_Container_Bitset_Destroy(Context.Left);
+        free(Context.RightFlags);
+        free(Context.LeftFlags);
+
+        return EXIT_SUCCESS;
+}
@@ -0,0 +1,122 @@
+#include <BenchmarkHelper.h>
+
+#include <Engine/Container/Public/ConcurrentHashMap.h>
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define KeyCount (64 * 1024)
+#define OperationsPerThread 4096
+#define MaximumThreadCount 64
+
+struct MapContext
+{
+        struct lluna_Container_ConcurrentHashMap* Map;
+        pthread_mutex_t* Mutex;
+        uint32 ThreadCount;
+        uint32 WritePercent;
+        unsigned long long Iterations;
+};
+
+struct Worker
+{
+        struct MapContext* Context;
+        uint64 RandomState;
+        uint64 Found;
+};
+
+// Writes replace values, so the number of entries and the table stay the same across runs.
+static void* Work(void* Argument)
+{
+        struct Worker* Worker = Argument;
+        struct MapContext* Context = Worker->Context;
+        for (unsigned long long Iteration = 0; Iteration < Context->Iterations; ++Iteration)
+        {
+                for (uint32 Operation = 0; Operation < OperationsPerThread; ++Operation)
+                {
+                        Worker->RandomState ^= Worker->RandomState << 13;
+                        Worker->RandomState ^= Worker->RandomState >> 7;
+                        Worker->RandomState ^= Worker->RandomState << 17;
+                        uint64 Key = 1 + Worker->RandomState % KeyCount;
+                        boolean Write = (Worker->RandomState >> 32) % 100 < Context->WritePercent;
+
+                        if (Context->Mutex)
+                        {
+                                pthread_mutex_lock(Context->Mutex);
+                        }
+                        if (Write)
+                        {
+                                lluna_Container_ConcurrentHashMap_Insert(Context->Map, Key, (void*)(uintptr_t)(Key * 8));
+                        }
+                        else
+                        {
+                                Worker->Found += lluna_Container_ConcurrentHashMap_Find(Context->Map, Key) != NULL;
+                        }
+                        if (Context->Mutex)
+                        {
+                                pthread_mutex_unlock(Context->Mutex);
+                        }
+                }
+        }
+
+        return NULL;
+}
+
+static void Operate(void* Argument, unsigned long long Iterations)
+{
+        struct MapContext* Context = Argument;
+        struct Worker Workers[MaximumThreadCount];
+        pthread_t Threads[MaximumThreadCount];
+
+        Context->Iterations = Iterations;
+        for (uint32 Index = 0; Index < Context->ThreadCount; ++Index)
+        {
+                Workers[Index] = (struct Worker){ Context, 0x9E3779B97F4A7C15ULL * (Index + 1), 0 };
+                pthread_create(&Threads[Index], NULL, Work, &Workers[Index]);
+        }
+
+        uint64 Found = 0;
+        for (uint32 Index = 0; Index < Context->ThreadCount; ++Index)
+        {
+                pthread_join(Threads[Index], NULL);
+                Found += Workers[Index].Found;
+        }
+        lluna_BenchmarkHelper_Sink = Found;
+}
+
+int main(int argc, const char* argv[])
+{
+        static const uint32 WritePercents[] = { 0, 10, 50 };
+        pthread_mutex_t Mutex = PTHREAD_MUTEX_INITIALIZER;
+
+        struct MapContext Context;
+        Context.Map = lluna_Container_ConcurrentHashMap_Create(KeyCount);
+        for (uint64 Key = 1; Key <= KeyCount; ++Key)
+        {
+                lluna_Container_ConcurrentHashMap_Insert(Context.Map, Key, (void*)(uintptr_t)(Key * 8));
+        }
+
+        // The same map behind a single mutex stands in for wrapping a single-threaded map.
+        for (uint32 Ratio = 0; Ratio < 3; ++Ratio)
+        {
+                for (uint32 ThreadCount = 1; ThreadCount <= MaximumThreadCount; ThreadCount *= 2)
+                {
+                        char Name[64];
+                        Context.ThreadCount = ThreadCount;
+                        Context.WritePercent = WritePercents[Ratio];
+
+                        Context.Mutex = &Mutex;
+                        snprintf(Name, sizeof(Name), "Mutex_W%u_T%u", WritePercents[Ratio], ThreadCount);
+                        lluna_BenchmarkHelper_ReportRate(Name, ThreadCount * OperationsPerThread, lluna_BenchmarkHelper_Measure(Operate, &Context));
+
+                        Context.Mutex = NULL;
+                        snprintf(Name, sizeof(Name), "Striped_W%u_T%u", WritePercents[Ratio], ThreadCount);
+                        lluna_BenchmarkHelper_ReportRate(Name, ThreadCount * OperationsPerThread, lluna_BenchmarkHelper_Measure(Operate, &Context));
+                }
+        }
+
+        lluna_Container_ConcurrentHashMap_Destroy(Context.Map);
+
+        return EXIT_SUCCESS;
+}
@@ -0,0 +1,114 @@
+#include <BenchmarkHelper.h>
+
+#include <Engine/Container/Public/FlatMap.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define LookupCount 4096
+
+struct LookupContext
+{
+        struct lluna_Container_FlatMap* Plain;
+        struct lluna_Container_FlatMap* Eytzinger;
+        uint64 Lookups[LookupCount];
+};
+
+static int CompareKeys(const void* Left, const void* Right)
+{
+        uint64 LeftKey = *(const uint64*)Left;
+        uint64 RightKey = *(const uint64*)Right;
+
+        return (LeftKey > RightKey) - (LeftKey < RightKey);
+}
+
+static void Bsearch(void* Context, unsigned long long Iterations)
+{
+        struct LookupContext* Input = (struct LookupContext*)Context;
+        uint64 Count = lluna_Container_FlatMap_Count(Input->Plain);
+        uint64 Found = 0;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                for (uint32 Index = 0; Index < LookupCount; ++Index)
+                {
+                        Found += bsearch(&Input->Lookups[Index], Input->Plain->Keys->Data, Count, sizeof(uint64), CompareKeys) != NULL;
+                }
+        }
+        lluna_BenchmarkHelper_Sink = Found;
+}
+
+static void BinarySearch(void* Context, unsigned long long Iterations)
+{
+        struct LookupContext* Input = (struct LookupContext*)Context;
+        uint64 Found = 0;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                for (uint32 Index = 0; Index < LookupCount; ++Index)
+                {
+                        Found += lluna_Container_FlatMap_Contains(Input->Plain, Input->Lookups[Index]);
+                }
+        }
+        lluna_BenchmarkHelper_Sink = Found;
+}
+
+static void EytzingerSearch(void* Context, unsigned long long Iterations)
+{
+        struct LookupContext* Input = (struct LookupContext*)Context;
+        uint64 Found = 0;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                for (uint32 Index = 0; Index < LookupCount; ++Index)
+                {
+                        Found += lluna_Container_FlatMap_Contains(Input->Eytzinger, Input->Lookups[Index]);
+                }
+        }
+        lluna_BenchmarkHelper_Sink = Found;
+}
+
+static void Run(struct LookupContext* Context, uint64 Count)
+{
+        Context->Plain = lluna_Container_FlatMap_Create(Count, 0);
+        Context->Eytzinger = lluna_Container_FlatMap_Create(Count, 0);
+
+        // Even keys are in the map, so about half of the lookups miss.
+        uint64 State = 0x9E3779B97F4A7C15ULL;
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                lluna_Container_FlatMap_Stage(Context->Plain, Index * 2, NULL);
+                lluna_Container_FlatMap_Stage(Context->Eytzinger, Index * 2, NULL);
+        }
+        for (uint32 Index = 0; Index < LookupCount; ++Index)
+        {
+                State ^= State << 13;
+                State ^= State >> 7;
+                State ^= State << 17;
+                Context->Lookups[Index] = State % (Count * 2);
+        }
+
+        lluna_Container_FlatMap_Freeze(Context->Plain, false);
+        lluna_Container_FlatMap_Freeze(Context->Eytzinger, true);
+
+        char Name[64];
+        snprintf(Name, sizeof(Name), "Bsearch_%llu", (unsigned long long)Count);
+        lluna_BenchmarkHelper_ReportRate(Name, LookupCount, lluna_BenchmarkHelper_Measure(Bsearch, Context));
+        snprintf(Name, sizeof(Name), "FlatMap_Binary_%llu", (unsigned long long)Count);
+        lluna_BenchmarkHelper_ReportRate(Name, LookupCount, lluna_BenchmarkHelper_Measure(BinarySearch, Context));
+        snprintf(Name, sizeof(Name), "FlatMap_Eytzinger_%llu", (unsigned long long)Count);
+        lluna_BenchmarkHelper_ReportRate(Name, LookupCount, lluna_BenchmarkHelper_Measure(EytzingerSearch, Context));
+
+        lluna_Container_FlatMap_Destroy(Context->Eytzinger);
+        lluna_Container_FlatMap_Destroy(Context->Plain);
+}
+
+int main(int argc, const char* argv[])
+{
+        struct LookupContext* Context = malloc(sizeof(struct LookupContext));
+
+        Run(Context, 1024);
+        Run(Context, 64 * 1024);
+        Run(Context, 1024 * 1024);
+
+        free(Context);
+
+        return EXIT_SUCCESS;
+}
@@ -0,0 +1,148 @@
+#include <BenchmarkHelper.h>
+
+#include <Engine/Container/Public/RadixTree.h>
+#include <Engine/Container/Public/RedBlackTree.h>
+#include <Engine/Container/Public/String.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LookupCount 4096
+
+struct Path
+{
+        struct lluna_Container_String* Text;
+        struct lluna_Container_RedBlackTree_Node Node;
+};
+
+struct LookupContext
+{
+        struct lluna_Container_RedBlackTree* Sorted;
+        struct lluna_Container_RadixTree* Radix;
+        struct lluna_Core_Types_Text Lookups[LookupCount];
+};
+
+static void InsertPath(struct lluna_Container_RedBlackTree* Tree, struct Path* Path)
+{
+        lluna_Container_RedBlackTree_InitializeNode(&Path->Node);
+
+        struct lluna_Container_RedBlackTree_Node** Link = &Tree->Root;
+        struct lluna_Container_RedBlackTree_Node* Parent = NULL;
+        while (*Link)
+        {
+                Parent = *Link;
+                if (lluna_Container_String_Compare(Path->Text, lluna_Macros_ContainerOf(*Link, struct Path, Node)->Text) < 0)
+                {
+                        Link = &((*Link)->Left);
+                }
+                else
+                {
+                        Link = &((*Link)->Right);
+                }
+        }
+
+        lluna_Container_RedBlackTree_Link(&Path->Node, Parent, Link);
+        lluna_Container_RedBlackTree_InsertFixup(Tree, &Path->Node);
+}
+
+static void RedBlackTreeSearch(void* Context, unsigned long long Iterations)
+{
+        struct LookupContext* Input = (struct LookupContext*)Context;
+        uint64 Found = 0;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                for (uint32 Index = 0; Index < LookupCount; ++Index)
+                {
+                        struct lluna_Container_RedBlackTree_Node* Node = Input->Sorted->Root;
+                        while (Node)
+                        {
+                                int32 Order = lluna_Container_String_CompareText(lluna_Macros_ContainerOf(Node, struct Path, Node)->Text, Input->Lookups[Index]);
+                                if (Order == 0)
+                                {
+                                        ++Found;
+                                        break;
+                                }
+                                Node = Order > 0 ? Node->Left : Node->Right;
+                        }
+                }
+        }
+        lluna_BenchmarkHelper_Sink = Found;
+}
+
+static void RadixTreeSearch(void* Context, unsigned long long Iterations)
+{
+        struct LookupContext* Input = (struct LookupContext*)Context;
+        uint64 Found = 0;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                for (uint32 Index = 0; Index < LookupCount; ++Index)
+                {
+                        Found += lluna_Container_RadixTree_Find(Input->Radix, Input->Lookups[Index]) != NULL;
+                }
+        }
+        lluna_BenchmarkHelper_Sink = Found;
+}
+
+static void Run(struct LookupContext* Context, uint64 Count)
+{
+        static const char* Directories[] = { "Textures/Terrain", "Textures/Characters", "Meshes/Props", "Meshes/Characters", "Sounds/Ambient", "Materials" };
+
+        // Asset paths sharing long directory prefixes, about half of the lookups miss on their last characters.
+        struct Path* Paths = malloc(Count * sizeof(struct Path));
+        char** Names = malloc(Count * sizeof(char*));
+        Context->Sorted = lluna_Container_RedBlackTree_Create();
+        Context->Radix = lluna_Container_RadixTree_Create();
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                char Name[96];
+                int Length = snprintf(Name, sizeof(Name), "Assets/%s/Asset%06llu.bin", Directories[Index % 6], (unsigned long long)(Index * 2));
+                Names[Index] = malloc(Length + 1);
+                memcpy(Names[Index], Name, Length + 1);
+
+                Paths[Index].Text = lluna_Container_String_CreateFromText((struct lluna_Core_Types_Text){ Names[Index], (uint64)Length + 1 });
+                InsertPath(Context->Sorted, &Paths[Index]);
+                lluna_Container_RadixTree_Insert(Context->Radix, (struct lluna_Core_Types_Text){ Names[Index], (uint64)Length }, &Paths[Index]);
+        }
+
+        static char Lookups[LookupCount][96];
+        uint64 State = 0x9E3779B97F4A7C15ULL;
+        for (uint32 Index = 0; Index < LookupCount; ++Index)
+        {
+                State ^= State << 13;
+                State ^= State >> 7;
+                State ^= State << 17;
+                uint64 Number = State % (Count * 2);
+                int Length = snprintf(Lookups[Index], sizeof(Lookups[Index]), "Assets/%s/Asset%06llu.bin", Directories[Number / 2 % 6], (unsigned long long)Number);
+                Context->Lookups[Index] = (struct lluna_Core_Types_Text){ Lookups[Index], (uint64)Length + 1 };
+        }
+
+        char Name[64];
+        snprintf(Name, sizeof(Name), "RedBlackTree_%llu", (unsigned long long)Count);
+        lluna_BenchmarkHelper_ReportRate(Name, LookupCount, lluna_BenchmarkHelper_Measure(RedBlackTreeSearch, Context));
+        snprintf(Name, sizeof(Name), "RadixTree_%llu", (unsigned long long)Count);
+        lluna_BenchmarkHelper_ReportRate(Name, LookupCount, lluna_BenchmarkHelper_Measure(RadixTreeSearch, Context));
+
+        lluna_Container_RadixTree_Destroy(Context->Radix);
+        lluna_Container_RedBlackTree_Destroy(Context->Sorted);
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                lluna_Container_String_Destroy(Paths[Index].Text);
+                free(Names[Index]);
+        }
+        free(Names);
+        free(Paths);
+}
+
+int main(int argc, const char* argv[])
+{
+        struct LookupContext* Context = malloc(sizeof(struct LookupContext));
+
+        Run(Context, 1024);
+        Run(Context, 64 * 1024);
+        Run(Context, 1024 * 1024);
+
+        free(Context);
+
+        return EXIT_SUCCESS;
+}
@@ -0,0 +1,197 @@
+#include <BenchmarkHelper.h>
+
+#include <Engine/Container/Public/RedBlackTree.h>
+
+#include <pthread.h>
+#include <stdio.h>
+
+#define NodeCount 4096
+#define WalkLength 8
+#define OperationsPerThread 4096
+#define MaximumThreadCount 16
+
+struct Holder
+{
+        uint32 Key;
+
+        struct lluna_Container_RedBlackTree_Node RedBlackTree;
+};
+
+struct TreeContext
+{
+        struct lluna_Container_RedBlackTree* Tree;
+        struct lluna_Core_Epoch* Epoch;
+        pthread_rwlock_t* Lock;
+        uint32 ThreadCount;
+        unsigned long long Iterations;
+};
+
+struct Worker
+{
+        struct TreeContext* Context;
+        uint64 RandomState;
+        uint64 Sum;
+};
+
+static uint32 KeyOf(struct lluna_Container_RedBlackTree_Node* Node)
+{
+        return lluna_Macros_ContainerOf(Node, struct Holder, RedBlackTree)->Key;
+}
+
+static int32 CompareKey(void* Context, struct lluna_Container_RedBlackTree_Node* Node)
+{
+        uint32 Key = *(uint32*)Context;
+        return KeyOf(Node) < Key ? -1 : KeyOf(Node) > Key;
+}
+
+static void Insert(struct lluna_Container_RedBlackTree* Tree, struct Holder* Holder)
+{
+        lluna_Container_RedBlackTree_InitializeNode(&Holder->RedBlackTree);
+
+        struct lluna_Container_RedBlackTree_Node** Link = &Tree->Root;
+        struct lluna_Container_RedBlackTree_Node* Parent = NULL;
+        while (*Link)
+        {
+                Parent = *Link;
+                Link = Holder->Key < KeyOf(Parent) ? &Parent->Left : &Parent->Right;
+        }
+
+        lluna_Container_RedBlackTree_Link(&Holder->RedBlackTree, Parent, Link);
+        lluna_Container_RedBlackTree_InsertFixup(Tree, &Holder->RedBlackTree);
+}
+
+// Finds the first node not below the key by descending the tree, then walks a few nodes from it.
+static uint64 WalkTree(struct lluna_Container_RedBlackTree* Tree, uint32 Key)
+{
+        struct lluna_Container_RedBlackTree_Node* Node = Tree->Root;
+        struct lluna_Container_RedBlackTree_Node* Found = NULL;
+        while (Node)
+        {
+                if (KeyOf(Node) < Key)
+                {
+                        Node = Node->Right;
+                }
+                else
+                {
+                        Found = Node;
+                        Node = Node->Left;
+                }
+        }
+
+        uint64 Sum = 0;
+        for (uint32 Step = 0; Step < WalkLength && Found; ++Step)
+        {
+                Sum += KeyOf(Found);
+                Found = lluna_Container_RedBlackTree_Next(Found);
+        }
+
+        return Sum;
+}
+
+static uint64 WalkSnapshot(struct lluna_Container_RedBlackTree_Snapshot* Snapshot, uint32 Key)
+{
+        uint64 First = lluna_Container_RedBlackTree_LowerBound(Snapshot, CompareKey, &Key);
+
+        uint64 Sum = 0;
+        for (uint64 Index = First; Index < Snapshot->Count && Index < First + WalkLength; ++Index)
+        {
+                Sum += KeyOf(Snapshot->Nodes[Index]);
+        }
+
+        return Sum;
+}
+
+static void* Work(void* Argument)
+{
+        struct Worker* Worker = Argument;
+        struct TreeContext* Context = Worker->Context;
+        struct lluna_Core_Epoch_Participant Participant;
+        lluna_Core_Epoch_Register(Context->Epoch, &Participant);
+
+        for (unsigned long long Iteration = 0; Iteration < Context->Iterations; ++Iteration)
+        {
+                for (uint32 Operation = 0; Operation < OperationsPerThread; ++Operation)
+                {
+                        Worker->RandomState ^= Worker->RandomState << 13;
+                        Worker->RandomState ^= Worker->RandomState >> 7;
+                        Worker->RandomState ^= Worker->RandomState << 17;
+                        uint32 Key = Worker->RandomState % (NodeCount * 2);
+
+                        if (Context->Lock)
+                        {
+                                pthread_rwlock_rdlock(Context->Lock);
+                                Worker->Sum += WalkTree(Context->Tree, Key);
+                                pthread_rwlock_unlock(Context->Lock);
+                        }
+                        else
+                        {
+                                lluna_Core_Epoch_Enter(&Participant);
+                                Worker->Sum += WalkSnapshot(lluna_Container_RedBlackTree_Acquire(Context->Tree), Key);
+                                lluna_Core_Epoch_Leave(&Participant);
+                        }
+                }
+        }
+
+        lluna_Core_Epoch_Unregister(&Participant);
+
+        return NULL;
+}
+
+static void Read(void* Argument, unsigned long long Iterations)
+{
+        struct TreeContext* Context = Argument;
+        struct Worker Workers[MaximumThreadCount];
+        pthread_t Threads[MaximumThreadCount];
+
+        Context->Iterations = Iterations;
+        for (uint32 Index = 0; Index < Context->ThreadCount; ++Index)
+        {
+                Workers[Index] = (struct Worker){ Context, 0x9E3779B97F4A7C15ULL * (Index + 1), 0 };
+                pthread_create(&Threads[Index], NULL, Work, &Workers[Index]);
+        }
+
+        uint64 Sum = 0;
+        for (uint32 Index = 0; Index < Context->ThreadCount; ++Index)
+        {
+                pthread_join(Threads[Index], NULL);
+                Sum += Workers[Index].Sum;
+        }
+        lluna_BenchmarkHelper_Sink = Sum;
+}
+
+int main(int argc, const char* argv[])
+{
+        pthread_rwlock_t Lock = PTHREAD_RWLOCK_INITIALIZER;
+        struct Holder* Holders = malloc(NodeCount * sizeof(struct Holder));
+
+        struct TreeContext Context;
+        Context.Tree = lluna_Container_RedBlackTree_Create();
+        Context.Epoch = lluna_Core_Epoch_Create();
+        for (uint32 Index = 0; Index < NodeCount; ++Index)
+        {
+                // Odd keys, so half of the searches miss.
+                Holders[Index].Key = (Index * 2654435761u) % NodeCount * 2 + 1;
+                Insert(Context.Tree, &Holders[Index]);
+        }
+        lluna_Container_RedBlackTree_Publish(Context.Tree, Context.Epoch);
+
+        for (uint32 ThreadCount = 1; ThreadCount <= MaximumThreadCount; ThreadCount *= 2)
+        {
+                char Name[64];
+                Context.ThreadCount = ThreadCount;
+
+                Context.Lock = &Lock;
+                snprintf(Name, sizeof(Name), "RwLock_T%u", ThreadCount);
+                lluna_BenchmarkHelper_ReportRate(Name, ThreadCount * OperationsPerThread, lluna_BenchmarkHelper_Measure(Read, &Context));
+
+                Context.Lock = NULL;
+                snprintf(Name, sizeof(Name), "Snapshot_T%u", ThreadCount);
+                lluna_BenchmarkHelper_ReportRate(Name, ThreadCount * OperationsPerThread, lluna_BenchmarkHelper_Measure(Read, &Context));
+        }
+
+        lluna_Container_RedBlackTree_Destroy(Context.Tree);
+        lluna_Core_Epoch_Destroy(Context.Epoch);
+        free(Holders);
+
+        return EXIT_SUCCESS;
+}
@@ -0,0 +1,160 @@
+#include <BenchmarkHelper.h>
+
+#include <Engine/Container/Public/Sort.h>
+
+#include <string.h>
+
+#define ElementCount (1024 * 1024)
+
+// Render queue entry: a sort key with the index of the draw it belongs to.
+struct Draw
+{
+        uint64 Key;
+        uint64 Index;
+};
+
+#define DrawLess(Left, Right) ((Left)->Key < (Right)->Key)
+
+lluna_Container_Sort_Define(SortUint32, uint32, lluna_Container_Sort_LessValue)
+lluna_Container_Sort_Define(SortDraws, struct Draw, DrawLess)
+
+struct SortContext
+{
+        struct lluna_Container_DynamicArray* Shuffled;
+        struct lluna_Container_DynamicArray* Array;
+        struct lluna_Container_DynamicArray* Scratch;
+};
+
+static int CompareUint32(const void* Left, const void* Right)
+{
+        uint32 LeftValue = *(const uint32*)Left;
+        uint32 RightValue = *(const uint32*)Right;
+
+        return (LeftValue > RightValue) - (LeftValue < RightValue);
+}
+
+static int CompareDraws(const void* Left, const void* Right)
+{
+        uint64 LeftKey = ((const struct Draw*)Left)->Key;
+        uint64 RightKey = ((const struct Draw*)Right)->Key;
+
+        return (LeftKey > RightKey) - (LeftKey < RightKey);
+}
+
+static void Reset(struct SortContext* Input)
+{
+        memcpy(Input->Array->Data, Input->Shuffled->Data, Input->Shuffled->Offset);
+}
+
+static void QsortUint32(void* Context, unsigned long long Iterations)
+{
+        struct SortContext* Input = (struct SortContext*)Context;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                Reset(Input);
+                qsort(Input->Array->Data, ElementCount, sizeof(uint32), CompareUint32);
+        }
+        lluna_BenchmarkHelper_Sink = *(uint32*)Input->Array->Data;
+}
+
+static void PdqsortUint32(void* Context, unsigned long long Iterations)
+{
+        struct SortContext* Input = (struct SortContext*)Context;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                Reset(Input);
+                SortUint32(Input->Array);
+        }
+        lluna_BenchmarkHelper_Sink = *(uint32*)Input->Array->Data;
+}
+
+static void RadixUint32(void* Context, unsigned long long Iterations)
+{
+        struct SortContext* Input = (struct SortContext*)Context;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                Reset(Input);
+                lluna_Container_Sort_Radix32(Input->Array, Input->Scratch);
+        }
+        lluna_BenchmarkHelper_Sink = *(uint32*)Input->Array->Data;
+}
+
+static void QsortDraws(void* Context, unsigned long long Iterations)
+{
+        struct SortContext* Input = (struct SortContext*)Context;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                Reset(Input);
+                qsort(Input->Array->Data, ElementCount, sizeof(struct Draw), CompareDraws);
+        }
+        lluna_BenchmarkHelper_Sink = ((struct Draw*)Input->Array->Data)->Index;
+}
+
+static void PdqsortDraws(void* Context, unsigned long long Iterations)
+{
+        struct SortContext* Input = (struct SortContext*)Context;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                Reset(Input);
+                SortDraws(Input->Array);
+        }
+        lluna_BenchmarkHelper_Sink = ((struct Draw*)Input->Array->Data)->Index;
+}
+
+static void RadixDraws(void* Context, unsigned long long Iterations)
+{
+        struct SortContext* Input = (struct SortContext*)Context;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                Reset(Input);
+                lluna_Container_Sort_RadixKey64(Input->Array, 0, Input->Scratch);
+        }
+        lluna_BenchmarkHelper_Sink = ((struct Draw*)Input->Array->Data)->Index;
+}
+
+static void Fill(struct SortContext* Context, uint32 ElementSize)
+{
+        Context->Shuffled = lluna_Container_DynamicArray_Create(ElementCount, ElementSize);
+
+        uint64 State = 0x9E3779B97F4A7C15ULL;
+        for (uint64 Index = 0; Index < ElementCount; ++Index)
+        {
+                State ^= State << 13;
+                State ^= State >> 7;
+                State ^= State << 17;
+
+                struct Draw Element = { State, Index };
+                uint32 Key = (uint32)State;
+                lluna_Container_DynamicArray_Append(Context->Shuffled, ElementSize == sizeof(uint32) ? (byte*)&Key : (byte*)&Element);
+        }
+
+        Context->Array = lluna_Container_DynamicArray_CreateFromData(Context->Shuffled->Data, Context->Shuffled->Offset, ElementSize);
+}
+
+static void Release(struct SortContext* Context)
+{
+        lluna_Container_DynamicArray_Destroy(Context->Array);
+        lluna_Container_DynamicArray_Destroy(Context->Shuffled);
+}
+
+int main(int argc, const char* argv[])
+{
+        struct SortContext Context;
+        Context.Scratch = lluna_Container_DynamicArray_Create(1, sizeof(byte));
+
+        Fill(&Context, sizeof(uint32));
+        lluna_BenchmarkHelper_ReportRate("Qsort_Uint32", ElementCount, lluna_BenchmarkHelper_Measure(QsortUint32, &Context));
+        lluna_BenchmarkHelper_ReportRate("Sort_Uint32", ElementCount, lluna_BenchmarkHelper_Measure(PdqsortUint32, &Context));
+        lluna_BenchmarkHelper_ReportRate("Sort_Radix32", ElementCount, lluna_BenchmarkHelper_Measure(RadixUint32, &Context));
+        Release(&Context);
+
+        Fill(&Context, sizeof(struct Draw));
+        lluna_BenchmarkHelper_ReportRate("Qsort_Draws", ElementCount, lluna_BenchmarkHelper_Measure(QsortDraws, &Context));
+        lluna_BenchmarkHelper_ReportRate("Sort_Draws", ElementCount, lluna_BenchmarkHelper_Measure(PdqsortDraws, &Context));
+        lluna_BenchmarkHelper_ReportRate("Sort_RadixKey64", ElementCount, lluna_BenchmarkHelper_Measure(RadixDraws, &Context));
+        Release(&Context);
+
+        lluna_Container_DynamicArray_Destroy(Context.Scratch);
+
+        return EXIT_SUCCESS;
+}
@@ -0,0 +1,118 @@
+#include <BenchmarkHelper.h>
+
+#include <Engine/Container/Public/DynamicArray.h>
+#include <Engine/Container/Public/StructOfArrays.h>
+
+#include <stddef.h>
+
+#define ParticleCount (256 * 1024)
+
+// Typical particle, of which the update below only touches positions and velocities.
+struct Particle
+{
+        float PositionX, PositionY, PositionZ;
+        float VelocityX, VelocityY, VelocityZ;
+        float Color[4];
+        float Size;
+        float Rotation;
+        float Lifetime;
+        uint32 Flags;
+};
+
+static const struct lluna_Container_StructOfArrays_Field ParticleFields[] = {
+        { sizeof(float), _Alignof(float), offsetof(struct Particle, PositionX) },
+        { sizeof(float), _Alignof(float), offsetof(struct Particle, PositionY) },
+        { sizeof(float), _Alignof(float), offsetof(struct Particle, PositionZ) },
+        { sizeof(float), _Alignof(float), offsetof(struct Particle, VelocityX) },
+        { sizeof(float), _Alignof(float), offsetof(struct Particle, VelocityY) },
+        { sizeof(float), _Alignof(float), offsetof(struct Particle, VelocityZ) },
+        { sizeof(float[4]), _Alignof(float), offsetof(struct Particle, Color) },
+        { sizeof(float), _Alignof(float), offsetof(struct Particle, Size) },
+        { sizeof(float), _Alignof(float), offsetof(struct Particle, Rotation) },
+        { sizeof(float), _Alignof(float), offsetof(struct Particle, Lifetime) },
+        { sizeof(uint32), _Alignof(uint32), offsetof(struct Particle, Flags) },
+};
+
+struct UpdateContext
+{
+        struct lluna_Container_DynamicArray* Structs;
+        struct lluna_Container_StructOfArrays* Arrays;
+};
+
+static void UpdateStructs(void* Context, unsigned long long Iterations)
+{
+        struct Particle* Particles = (struct Particle*)((struct UpdateContext*)Context)->Structs->Data;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                for (uint64 Index = 0; Index < ParticleCount; ++Index)
+                {
+                        Particles[Index].PositionX += Particles[Index].VelocityX * 0.016f;
+                        Particles[Index].PositionY += Particles[Index].VelocityY * 0.016f;
+                        Particles[Index].PositionZ += Particles[Index].VelocityZ * 0.016f;
+                }
+        }
+        lluna_BenchmarkHelper_Sink = (unsigned long long)Particles[0].PositionX;
+}
+
+static void UpdateArrays(void* Context, unsigned long long Iterations)
+{
+        struct lluna_Container_StructOfArrays* Arrays = ((struct UpdateContext*)Context)->Arrays;
+        float* Positions[3];
+        float* Velocities[3];
+        for (uint32 Axis = 0; Axis < 3; ++Axis)
+        {
+                Positions[Axis] = (float*)lluna_Container_StructOfArrays_Stream(Arrays, Axis);
+                Velocities[Axis] = (float*)lluna_Container_StructOfArrays_Stream(Arrays, 3 + Axis);
+        }
+
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                for (uint32 Axis = 0; Axis < 3; ++Axis)
+                {
+                        float* restrict Position = __builtin_assume_aligned(Positions[Axis], lluna_Container_StructOfArrays_StreamAlignment);
+                        const float* restrict Velocity = __builtin_assume_aligned(Velocities[Axis], lluna_Container_StructOfArrays_StreamAlignment);
+                        for (uint64 Index = 0; Index < ParticleCount; ++Index)
+                        {
+                                Position[Index] += Velocity[Index] * 0.016f;
+                        }
+                }
+        }
+        lluna_BenchmarkHelper_Sink = (unsigned long long)Positions[0][0];
+}
+
+static void Convert(void* Context, unsigned long long Iterations)
+{
+        struct UpdateContext* Input = (struct UpdateContext*)Context;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                lluna_Container_StructOfArrays_Clear(Input->Arrays);
+                lluna_Container_StructOfArrays_AppendStructs(Input->Arrays, Input->Structs->Data, ParticleCount, sizeof(struct Particle));
+        }
+        lluna_BenchmarkHelper_Sink = lluna_Container_StructOfArrays_Count(Input->Arrays);
+}
+
+int main(int argc, const char* argv[])
+{
+        struct UpdateContext Context;
+        Context.Structs = lluna_Container_DynamicArray_Create(ParticleCount, sizeof(struct Particle));
+        Context.Arrays = lluna_Container_StructOfArrays_Create(ParticleFields, sizeof(ParticleFields) / sizeof(ParticleFields[0]), ParticleCount);
+
+        for (uint32 Index = 0; Index < ParticleCount; ++Index)
+        {
+                struct Particle Particle = { 0 };
+                Particle.VelocityX = (float)(Index % 7);
+                Particle.VelocityY = (float)(Index % 11);
+                Particle.VelocityZ = (float)(Index % 13);
+                lluna_Container_DynamicArray_Append(Context.Structs, (byte*)&Particle);
+        }
+        lluna_Container_StructOfArrays_AppendStructs(Context.Arrays, Context.Structs->Data, ParticleCount, sizeof(struct Particle));
+
+        lluna_BenchmarkHelper_ReportRate("Update_ArrayOfStructs", ParticleCount, lluna_BenchmarkHelper_Measure(UpdateStructs, &Context));
+        lluna_BenchmarkHelper_ReportRate("Update_StructOfArrays", ParticleCount, lluna_BenchmarkHelper_Measure(UpdateArrays, &Context));
+        lluna_BenchmarkHelper_ReportThroughput("AppendStructs", (uint64)ParticleCount * sizeof(struct Particle), lluna_BenchmarkHelper_Measure(Convert, &Context));
+
+        lluna_Container_StructOfArrays_Destroy(Context.Arrays);
+        lluna_Container_DynamicArray_Destroy(Context.Structs);
+
+        return EXIT_SUCCESS;
+}
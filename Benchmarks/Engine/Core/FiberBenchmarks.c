@@ -0,0 +1,93 @@
+#include <BenchmarkHelper.h>
+
+#include <Engine/Core/Public/Fiber.h>
+
+#include <ucontext.h>
+
+struct FiberContext
+{
+        struct lluna_Core_Fiber_Pool* Pool;
+        struct lluna_Core_Fiber* Fiber;
+
+        ucontext_t Caller;
+        ucontext_t Callee;
+};
+
+static void YieldForever(void* Data)
+{
+        for (;;)
+        {
+                lluna_Core_Fiber_Yield();
+        }
+}
+
+static void Nothing(void* Data)
+{
+}
+
+// makecontext can't portably pass pointers, so the reference switch finds its context here.
+static struct FiberContext* Swapping;
+
+// Reference: the same round trip through the C library's context switch, which also saves the signal mask.
+static void SwapForever()
+{
+        for (;;)
+        {
+                swapcontext(&Swapping->Callee, &Swapping->Caller);
+        }
+}
+
+static void ResumeYield(void* Context, unsigned long long Iterations)
+{
+        struct FiberContext* Input = (struct FiberContext*)Context;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                lluna_Core_Fiber_Resume(Input->Fiber);
+        }
+}
+
+static void SwapContext(void* Context, unsigned long long Iterations)
+{
+        struct FiberContext* Input = (struct FiberContext*)Context;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                swapcontext(&Input->Caller, &Input->Callee);
+        }
+}
+
+static void CreateRun(void* Context, unsigned long long Iterations)
+{
+        struct FiberContext* Input = (struct FiberContext*)Context;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                struct lluna_Core_Fiber* Fiber = lluna_Core_Fiber_Create(Input->Pool, Nothing, NULL);
+                lluna_Core_Fiber_Resume(Fiber);
+                lluna_Core_Fiber_Destroy(Fiber);
+        }
+}
+
+int main(int argc, const char* argv[])
+{
+        static struct FiberContext Context;
+        static byte Stack[64 * 1024];
+
+        Context.Pool = lluna_Core_Fiber_CreatePool(0);
+        Context.Fiber = lluna_Core_Fiber_Create(Context.Pool, YieldForever, NULL);
+
+        Swapping = &Context;
+        getcontext(&Context.Callee);
+        Context.Callee.uc_stack.ss_sp = Stack;
+        Context.Callee.uc_stack.ss_size = sizeof(Stack);
+        Context.Callee.uc_link = NULL;
+        makecontext(&Context.Callee, SwapForever, 0);
+
+        lluna_BenchmarkHelper_ReportRate("ResumeYield", 1, lluna_BenchmarkHelper_Measure(ResumeYield, &Context));
+        lluna_BenchmarkHelper_ReportRate("SwapContext", 1, lluna_BenchmarkHelper_Measure(SwapContext, &Context));
+        lluna_BenchmarkHelper_ReportRate("CreateRun", 1, lluna_BenchmarkHelper_Measure(CreateRun, &Context));
+
+        // The yielding fiber never finishes, destroying it discards its stack.
+        lluna_Core_Fiber_Destroy(Context.Fiber);
+        lluna_Core_Fiber_DestroyPool(Context.Pool);
+
+        return EXIT_SUCCESS;
+}
@@ -0,0 +1,80 @@
+#include <BenchmarkHelper.h>
+
+#include <Engine/Core/Public/Hash.h>
+
+#include <string.h>
+
+struct HashContext
+{
+        const byte* Data;
+        uint64 Size;
+};
+
+static void HashBytes(void* Context, unsigned long long Iterations)
+{
+        struct HashContext* Hash = (struct HashContext*)Context;
+
+        uint64 Result = 0;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                // Chaining the seed keeps iterations from overlapping, so small sizes measure latency.
+                Result = lluna_Core_Hash_Bytes(Hash->Data, Hash->Size, Result);
+        }
+        lluna_BenchmarkHelper_Sink = Result;
+}
+
+static void HashStreaming(void* Context, unsigned long long Iterations)
+{
+        struct HashContext* Hash = (struct HashContext*)Context;
+
+        uint64 Result = 0;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                struct lluna_Core_Hash_State State;
+                lluna_Core_Hash_Initialize(&State, Result);
+
+                // Feed in chunks typical of reading from a file.
+                for (uint64 Offset = 0; Offset < Hash->Size; Offset += 4096)
+                {
+                        lluna_Core_Hash_Update(&State, Hash->Data + Offset, Hash->Size - Offset < 4096 ? Hash->Size - Offset : 4096);
+                }
+                Result = lluna_Core_Hash_Digest(&State);
+        }
+        lluna_BenchmarkHelper_Sink = Result;
+}
+
+static void Crc32c(void* Context, unsigned long long Iterations)
+{
+        struct HashContext* Hash = (struct HashContext*)Context;
+
+        uint32 Result = 0;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                Result = lluna_Core_Hash_Crc32c(Result, Hash->Data, Hash->Size);
+        }
+        lluna_BenchmarkHelper_Sink = Result;
+}
+
+int main(int argc, const char* argv[])
+{
+        const uint64 MaximumSize = 64ULL * 1024 * 1024;
+
+        byte* Data = malloc(MaximumSize);
+        for (uint64 Index = 0; Index < MaximumSize; ++Index)
+        {
+                Data[Index] = (byte)(Index * 31 + 7);
+        }
+
+        for (uint64 Size = 8; Size <= MaximumSize; Size = Size == 8 ? 16 : Size * 4)
+        {
+                struct HashContext Context = { Data, Size };
+
+                lluna_BenchmarkHelper_ReportThroughput("Hash_Bytes", Size, lluna_BenchmarkHelper_Measure(HashBytes, &Context));
+                lluna_BenchmarkHelper_ReportThroughput("Hash_Update", Size, lluna_BenchmarkHelper_Measure(HashStreaming, &Context));
+                lluna_BenchmarkHelper_ReportThroughput("Hash_Crc32c", Size, lluna_BenchmarkHelper_Measure(Crc32c, &Context));
+        }
+
+        free(Data);
+
+        return EXIT_SUCCESS;
+}
@@ -0,0 +1,63 @@
+#include <BenchmarkHelper.h>
+
+#include <Engine/Core/Public/Memory.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// Allocations live at once per round, so both measurements reuse the same freed blocks of malloc.
+#define AllocationsPerRound 64
+#define AllocationSize 48
+
+static void Untracked(void* Context, unsigned long long Iterations)
+{
+        void* Pointers[AllocationsPerRound];
+
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                for (uint32 Index = 0; Index < AllocationsPerRound; ++Index)
+                {
+                        Pointers[Index] = malloc(AllocationSize);
+                }
+                for (uint32 Index = 0; Index < AllocationsPerRound; ++Index)
+                {
+                        free(Pointers[Index]);
+                }
+        }
+        lluna_BenchmarkHelper_Sink = (uint64)(uintptr_t)Pointers[0];
+}
+
+static void Tracked(void* Context, unsigned long long Iterations)
+{
+        uint32 Tag = *(uint32*)Context;
+        void* Pointers[AllocationsPerRound];
+
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                for (uint32 Index = 0; Index < AllocationsPerRound; ++Index)
+                {
+                        Pointers[Index] = lluna_Core_Memory_TrackedAllocate(AllocationSize, Tag);
+                }
+                for (uint32 Index = 0; Index < AllocationsPerRound; ++Index)
+                {
+                        lluna_Core_Memory_TrackedFree(Pointers[Index]);
+                }
+        }
+        lluna_BenchmarkHelper_Sink = (uint64)(uintptr_t)Pointers[0];
+}
+
+static void TrackedInScope(void* Context, unsigned long long Iterations)
+{
+        uint32 Previous = lluna_Core_Memory_EnterScope(*(uint32*)Context);
+        Tracked(&(uint32){lluna_Core_Memory_DynamicArray}, Iterations);
+        lluna_Core_Memory_LeaveScope(Previous);
+}
+
+int main(int argc, const char* argv[])
+{
+        uint32 Tag = lluna_Core_Memory_RegisterTag("Benchmarks", "Memory");
+
+        lluna_BenchmarkHelper_ReportRate("Memory_Untracked", AllocationsPerRound, lluna_BenchmarkHelper_Measure(Untracked, NULL));
+        lluna_BenchmarkHelper_ReportRate("Memory_Tracked", AllocationsPerRound, lluna_BenchmarkHelper_Measure(Tracked, &Tag));
+        lluna_BenchmarkHelper_ReportRate("Memory_TrackedInScope", AllocationsPerRound, lluna_BenchmarkHelper_Measure(TrackedInScope, &Tag));
+}
@@ -0,0 +1,91 @@
+#include <BenchmarkHelper.h>
+
+// Zones are measured as recorded, whether or not the build enables profiling.
+#if !defined(LLUNA_PROFILING)
+#define LLUNA_PROFILING
+#endif
+
+#include <Engine/Core/Public/Profiler.h>
+
+// Zones recorded between collections, leaving room in the ring so nothing is dropped.
+#define ZonesPerCollection (lluna_Core_Profiler_RingCapacity / 4)
+
+static void Now(void* Context, unsigned long long Iterations)
+{
+        uint64 Result = 0;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                Result += lluna_Core_Profiler_Now();
+        }
+        lluna_BenchmarkHelper_Sink = Result;
+}
+
+static void Zone(void* Context, unsigned long long Iterations)
+{
+        struct lluna_Core_Profiler_Capture* Capture = (struct lluna_Core_Profiler_Capture*)Context;
+
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                for (uint32 Zone = 0; Zone < ZonesPerCollection; ++Zone)
+                {
+                        lluna_Core_Profiler_Begin("Zone");
+                        lluna_Core_Profiler_End();
+                }
+                lluna_Core_Profiler_Collect(Capture);
+                lluna_Core_Profiler_ClearCapture(Capture);
+        }
+        lluna_BenchmarkHelper_Sink = Capture->Dropped;
+}
+
+static void ChromeTrace(void* Context, unsigned long long Iterations)
+{
+        struct lluna_Core_Profiler_Capture* Capture = (struct lluna_Core_Profiler_Capture*)Context;
+        struct lluna_Core_Writer* Output = lluna_Core_Writer_Create(lluna_Core_Writer_NoFile, lluna_Core_Writer_DefaultCapacity);
+
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                lluna_Core_Writer_Clear(Output);
+                lluna_Core_Profiler_WriteChromeTrace(Capture, Output);
+        }
+        lluna_BenchmarkHelper_Sink = Output->Offset;
+
+        lluna_Core_Writer_Destroy(Output);
+}
+
+static void Binary(void* Context, unsigned long long Iterations)
+{
+        struct lluna_Core_Profiler_Capture* Capture = (struct lluna_Core_Profiler_Capture*)Context;
+        struct lluna_Core_Writer* Output = lluna_Core_Writer_Create(lluna_Core_Writer_NoFile, lluna_Core_Writer_DefaultCapacity);
+
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                lluna_Core_Writer_Clear(Output);
+                lluna_Core_Profiler_WriteBinary(Capture, Output);
+        }
+        lluna_BenchmarkHelper_Sink = Output->Offset;
+
+        lluna_Core_Writer_Destroy(Output);
+}
+
+int main(int argc, const char* argv[])
+{
+        struct lluna_Core_Profiler_Capture* Capture = lluna_Core_Profiler_CreateCapture();
+
+        lluna_BenchmarkHelper_ReportRate("Profiler_Now", 1, lluna_BenchmarkHelper_Measure(Now, NULL));
+        lluna_BenchmarkHelper_ReportRate("Profiler_Zone", ZonesPerCollection, lluna_BenchmarkHelper_Measure(Zone, Capture));
+
+        for (uint32 Zone = 0; Zone < ZonesPerCollection; ++Zone)
+        {
+                lluna_Core_Profiler_Begin("Zone");
+                lluna_Core_Profiler_Count("Counter", Zone);
+                lluna_Core_Profiler_End();
+        }
+        lluna_Core_Profiler_Collect(Capture);
+
+        lluna_BenchmarkHelper_ReportRate("Profiler_ChromeTrace", Capture->Count, lluna_BenchmarkHelper_Measure(ChromeTrace, Capture));
+        lluna_BenchmarkHelper_ReportRate("Profiler_Binary", Capture->Count, lluna_BenchmarkHelper_Measure(Binary, Capture));
+
+        lluna_Core_Profiler_DestroyCapture(Capture);
+
+        return EXIT_SUCCESS;
+}
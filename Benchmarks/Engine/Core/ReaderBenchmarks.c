@@ -0,0 +1,98 @@
+#include <BenchmarkHelper.h>
+
+#include <Engine/Core/Public/Reader.h>
+
+#include <unistd.h>
+
+#define FileSize (64 * 1024 * 1024)
+
+struct ReaderContext
+{
+        FILE* File;
+};
+
+static void ReadLines(void* Context, unsigned long long Iterations)
+{
+        struct ReaderContext* Input = (struct ReaderContext*)Context;
+
+        uint64 Total = 0;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                lseek(fileno(Input->File), 0, SEEK_SET);
+
+                struct lluna_Core_Reader* Reader = lluna_Core_Reader_Create(fileno(Input->File), lluna_Core_Reader_DefaultCapacity);
+                struct lluna_Core_Types_Text Line;
+                while (lluna_Core_Reader_ReadLine(Reader, &Line))
+                {
+                        Total += Line.Size;
+                }
+                lluna_Core_Reader_Destroy(Reader);
+        }
+        lluna_BenchmarkHelper_Sink = Total;
+}
+
+static void ReadLinesMapped(void* Context, unsigned long long Iterations)
+{
+        struct ReaderContext* Input = (struct ReaderContext*)Context;
+
+        uint64 Total = 0;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                struct lluna_Core_Reader* Reader = lluna_Core_Reader_CreateMapped(fileno(Input->File));
+                struct lluna_Core_Types_Text Line;
+                while (lluna_Core_Reader_ReadLine(Reader, &Line))
+                {
+                        Total += Line.Size;
+                }
+                lluna_Core_Reader_Destroy(Reader);
+        }
+        lluna_BenchmarkHelper_Sink = Total;
+}
+
+static void ReadCharacters(void* Context, unsigned long long Iterations)
+{
+        struct ReaderContext* Input = (struct ReaderContext*)Context;
+
+        uint64 Total = 0;
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                fseek(Input->File, 0, SEEK_SET);
+
+                int32 Character;
+                while ((Character = fgetc(Input->File)) != EOF)
+                {
+                        Total += Character != '\n';
+                }
+        }
+        lluna_BenchmarkHelper_Sink = Total;
+}
+
+int main(int argc, const char* argv[])
+{
+        struct ReaderContext Context;
+        Context.File = tmpfile();
+
+        // Lines between 8 and 135 bytes, roughly the spread of a mesh file.
+        uint64 Size = 0;
+        uint32 Seed = 1;
+        while (Size < FileSize)
+        {
+                Seed = Seed * 1103515245 + 12345;
+                uint32 Length = 8 + (Seed >> 16) % 128;
+                for (uint32 Index = 0; Index < Length; ++Index)
+                {
+                        fputc('a' + Index % 26, Context.File);
+                }
+                fputc('\n', Context.File);
+                Size += Length + 1;
+        }
+        fflush(Context.File);
+
+        lluna_BenchmarkHelper_ReportThroughput("Reader_ReadLine", Size, lluna_BenchmarkHelper_Measure(ReadLines, &Context));
+        lluna_BenchmarkHelper_ReportThroughput("Reader_ReadLineMapped", Size, lluna_BenchmarkHelper_Measure(ReadLinesMapped, &Context));
+        lluna_BenchmarkHelper_ReportThroughput("Stdio_fgetc", Size, lluna_BenchmarkHelper_Measure(ReadCharacters, &Context));
+
+        fclose(Context.File);
+
+        return EXIT_SUCCESS;
+}
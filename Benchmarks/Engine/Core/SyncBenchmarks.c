@@ -0,0 +1,182 @@
+#include <BenchmarkHelper.h>
+
+#include <Engine/Core/Public/Sync.h>
+
+#include <pthread.h>
+#include <stdio.h>
+
+#define OperationsPerThread 4096
+#define MaximumThreadCount 16
+
+// Every eighth operation writes when comparing reader-writer locks.
+#define WriteInterval 8
+
+enum Primitive
+{
+        Mutex,
+        PthreadMutex,
+        RwLock,
+        PthreadRwLock,
+        Barrier,
+        PthreadBarrier
+};
+
+struct SyncContext
+{
+        enum Primitive Primitive;
+        uint32 ThreadCount;
+        unsigned long long Iterations;
+
+        struct lluna_Core_Sync_Mutex Mutex;
+        pthread_mutex_t PthreadMutex;
+        struct lluna_Core_Sync_RwLock RwLock;
+        pthread_rwlock_t PthreadRwLock;
+        struct lluna_Core_Sync_Barrier Barrier;
+        pthread_barrier_t PthreadBarrier;
+
+        // Data guarded by the locks, a short critical section touching a cache line.
+        uint64 Shared[8];
+};
+
+static void Critical(struct SyncContext* Context)
+{
+        for (uint32 Index = 0; Index < 8; ++Index)
+        {
+                ++Context->Shared[Index];
+        }
+}
+
+static uint64 Read(struct SyncContext* Context)
+{
+        uint64 Sum = 0;
+        for (uint32 Index = 0; Index < 8; ++Index)
+        {
+                Sum += Context->Shared[Index];
+        }
+
+        return Sum;
+}
+
+static void* Work(void* Argument)
+{
+        struct SyncContext* Context = Argument;
+        uint64 Sum = 0;
+
+        // Barriers synchronize far less often than locks in practice, so they are waited on once per iteration.
+        for (unsigned long long Iteration = 0; Iteration < Context->Iterations && Context->Primitive >= Barrier; ++Iteration)
+        {
+                if (Context->Primitive == Barrier)
+                {
+                        lluna_Core_Sync_WaitBarrier(&Context->Barrier);
+                }
+                else
+                {
+                        pthread_barrier_wait(&Context->PthreadBarrier);
+                }
+        }
+
+        for (unsigned long long Iteration = 0; Iteration < Context->Iterations && Context->Primitive < Barrier; ++Iteration)
+        {
+                for (uint32 Operation = 0; Operation < OperationsPerThread; ++Operation)
+                {
+                        boolean Write = Operation % WriteInterval == 0;
+                        switch (Context->Primitive)
+                        {
+                        case Mutex:
+                                lluna_Core_Sync_LockMutex(&Context->Mutex);
+                                Critical(Context);
+                                lluna_Core_Sync_UnlockMutex(&Context->Mutex);
+                                break;
+                        case PthreadMutex:
+                                pthread_mutex_lock(&Context->PthreadMutex);
+                                Critical(Context);
+                                pthread_mutex_unlock(&Context->PthreadMutex);
+                                break;
+                        case RwLock:
+                                if (Write)
+                                {
+                                        lluna_Core_Sync_WriteLock(&Context->RwLock);
+                                        Critical(Context);
+                                        lluna_Core_Sync_WriteUnlock(&Context->RwLock);
+                                }
+                                else
+                                {
+                                        lluna_Core_Sync_ReadLock(&Context->RwLock);
+                                        Sum += Read(Context);
+                                        lluna_Core_Sync_ReadUnlock(&Context->RwLock);
+                                }
+                                break;
+                        case PthreadRwLock:
+                                if (Write)
+                                {
+                                        pthread_rwlock_wrlock(&Context->PthreadRwLock);
+                                        Critical(Context);
+                                        pthread_rwlock_unlock(&Context->PthreadRwLock);
+                                }
+                                else
+                                {
+                                        pthread_rwlock_rdlock(&Context->PthreadRwLock);
+                                        Sum += Read(Context);
+                                        pthread_rwlock_unlock(&Context->PthreadRwLock);
+                                }
+                                break;
+                        default:
+                                break;
+                        }
+                }
+        }
+        lluna_BenchmarkHelper_Sink = Sum;
+
+        return NULL;
+}
+
+static void Contend(void* Argument, unsigned long long Iterations)
+{
+        struct SyncContext* Context = Argument;
+        pthread_t Threads[MaximumThreadCount];
+
+        Context->Iterations = Iterations;
+        for (uint32 Index = 0; Index < Context->ThreadCount; ++Index)
+        {
+                pthread_create(&Threads[Index], NULL, Work, Context);
+        }
+        for (uint32 Index = 0; Index < Context->ThreadCount; ++Index)
+        {
+                pthread_join(Threads[Index], NULL);
+        }
+}
+
+int main(int argc, const char* argv[])
+{
+        static const char* Names[] = { "Mutex", "PthreadMutex", "RwLock", "PthreadRwLock", "Barrier", "PthreadBarrier" };
+
+        struct SyncContext Context = { 0 };
+        lluna_Core_Sync_InitializeMutex(&Context.Mutex);
+        pthread_mutex_init(&Context.PthreadMutex, NULL);
+        lluna_Core_Sync_InitializeRwLock(&Context.RwLock);
+        pthread_rwlock_init(&Context.PthreadRwLock, NULL);
+
+        for (uint32 ThreadCount = 1; ThreadCount <= MaximumThreadCount; ThreadCount *= 2)
+        {
+                Context.ThreadCount = ThreadCount;
+                lluna_Core_Sync_InitializeBarrier(&Context.Barrier, ThreadCount);
+                pthread_barrier_init(&Context.PthreadBarrier, NULL, ThreadCount);
+
+                for (enum Primitive Primitive = Mutex; Primitive <= PthreadBarrier; ++Primitive)
+                {
+                        char Name[64];
+                        snprintf(Name, sizeof(Name), "%s_T%u", Names[Primitive], ThreadCount);
+
+                        Context.Primitive = Primitive;
+                        uint64 Operations = Primitive >= Barrier ? ThreadCount : ThreadCount * OperationsPerThread;
+                        lluna_BenchmarkHelper_ReportRate(Name, Operations, lluna_BenchmarkHelper_Measure(Contend, &Context));
+                }
+
+                pthread_barrier_destroy(&Context.PthreadBarrier);
+        }
+
+        pthread_rwlock_destroy(&Context.PthreadRwLock);
+        pthread_mutex_destroy(&Context.PthreadMutex);
+
+        return EXIT_SUCCESS;
+}
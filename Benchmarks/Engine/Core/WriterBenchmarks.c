@@ -0,0 +1,81 @@
+#include <BenchmarkHelper.h>
+
+#include <Engine/Core/Public/Macros.h>
+#include <Engine/Core/Public/Writer.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#define LineCount 100000
+
+struct WriterContext
+{
+        int32 FileDescriptor;
+        FILE* File;
+};
+
+static void WriteFormat(void* Context, unsigned long long Iterations)
+{
+        struct WriterContext* Output = (struct WriterContext*)Context;
+
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                struct lluna_Core_Writer* Writer = lluna_Core_Writer_Create(Output->FileDescriptor, lluna_Core_Writer_DefaultCapacity);
+                for (int32 Line = 0; Line < LineCount; ++Line)
+                {
+                        lluna_Core_Writer_Format(Writer, lluna_Macros_Text("v %f %f %f\n"), Line * 0.5f, Line * 0.25f, Line * 0.125f);
+                }
+                lluna_Core_Writer_Destroy(Writer);
+        }
+}
+
+static void WriteFields(void* Context, unsigned long long Iterations)
+{
+        struct WriterContext* Output = (struct WriterContext*)Context;
+
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                struct lluna_Core_Writer* Writer = lluna_Core_Writer_Create(Output->FileDescriptor, lluna_Core_Writer_DefaultCapacity);
+                for (int32 Line = 0; Line < LineCount; ++Line)
+                {
+                        lluna_Core_Writer_WriteText(Writer, lluna_Macros_Text("f "));
+                        lluna_Core_Writer_WriteInt64(Writer, Line);
+                        lluna_Core_Writer_WriteCharacter(Writer, ' ');
+                        lluna_Core_Writer_WriteInt64(Writer, Line + 1);
+                        lluna_Core_Writer_WriteCharacter(Writer, ' ');
+                        lluna_Core_Writer_WriteInt64(Writer, Line + 2);
+                        lluna_Core_Writer_WriteCharacter(Writer, '\n');
+                }
+                lluna_Core_Writer_Destroy(Writer);
+        }
+}
+
+static void StdioFields(void* Context, unsigned long long Iterations)
+{
+        struct WriterContext* Output = (struct WriterContext*)Context;
+
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                for (int32 Line = 0; Line < LineCount; ++Line)
+                {
+                        fprintf(Output->File, "f %d %d %d\n", Line, Line + 1, Line + 2);
+                }
+                fflush(Output->File);
+        }
+}
+
+int main(int argc, const char* argv[])
+{
+        struct WriterContext Context;
+        Context.FileDescriptor = open("/dev/null", O_WRONLY);
+        Context.File = fdopen(dup(Context.FileDescriptor), "w");
+
+        lluna_BenchmarkHelper_ReportRate("Writer_Format", LineCount, lluna_BenchmarkHelper_Measure(WriteFormat, &Context));
+        lluna_BenchmarkHelper_ReportRate("Writer_Fields", LineCount, lluna_BenchmarkHelper_Measure(WriteFields, &Context));
+        lluna_BenchmarkHelper_ReportRate("Stdio_Fields", LineCount, lluna_BenchmarkHelper_Measure(StdioFields, &Context));
+
+        fclose(Context.File);
+        close(Context.FileDescriptor);
+
+        return EXIT_SUCCESS;
+}
@@ -0,0 +1,87 @@
+#include <BenchmarkHelper.h>
+
+#include <Engine/Jobs/Public/Graph.h>
+
+#define SystemCount 64
+#define ComponentCount 16
+#define EntityCount 1024
+
+// Every system reads two component arrays and writes a third, like the systems of a frame.
+struct System
+{
+        float* Inputs[2];
+        float* Output;
+};
+
+struct GraphContext
+{
+        struct lluna_Jobs_Scheduler* Scheduler;
+        struct lluna_Jobs_Graph* Graph;
+};
+
+static float Components[ComponentCount][EntityCount];
+static struct System Systems[SystemCount];
+
+static void Update(void* Data)
+{
+        struct System* System = Data;
+        for (uint32 Entity = 0; Entity < EntityCount; ++Entity)
+        {
+                System->Output[Entity] = System->Output[Entity] * 0.5f + System->Inputs[0][Entity] * System->Inputs[1][Entity];
+        }
+}
+
+static void RunFrames(void* Context, unsigned long long Iterations)
+{
+        struct GraphContext* Input = (struct GraphContext*)Context;
+
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                lluna_Jobs_Graph_Run(Input->Graph, Input->Scheduler);
+        }
+        lluna_BenchmarkHelper_Sink = (unsigned long long)Components[0][0];
+}
+
+static void Measure(struct GraphContext* Context, uint32 WorkerCount, const char* Name)
+{
+        Context->Scheduler = lluna_Jobs_Scheduler_Create(WorkerCount);
+
+        lluna_BenchmarkHelper_ReportRate(Name, SystemCount, lluna_BenchmarkHelper_Measure(RunFrames, Context));
+
+        lluna_Jobs_Scheduler_Destroy(Context->Scheduler);
+}
+
+int main(int argc, const char* argv[])
+{
+        struct GraphContext Context;
+        Context.Graph = lluna_Jobs_Graph_Create();
+
+        uint32 Seed = 1;
+        for (uint32 Index = 0; Index < SystemCount; ++Index)
+        {
+                uint32 Picks[3];
+                for (uint32 Pick = 0; Pick < 3; ++Pick)
+                {
+                        Seed = Seed * 1103515245 + 12345;
+                        Picks[Pick] = (Seed >> 16) % ComponentCount;
+                }
+
+                Systems[Index].Inputs[0] = Components[Picks[0]];
+                Systems[Index].Inputs[1] = Components[Picks[1]];
+                Systems[Index].Output = Components[Picks[2]];
+
+                uint32 Task = lluna_Jobs_Graph_AddTask(Context.Graph, Update, &Systems[Index], EntityCount);
+                lluna_Jobs_Graph_Read(Context.Graph, Task, Systems[Index].Inputs[0]);
+                lluna_Jobs_Graph_Read(Context.Graph, Task, Systems[Index].Inputs[1]);
+                lluna_Jobs_Graph_Write(Context.Graph, Task, Systems[Index].Output);
+        }
+        lluna_Jobs_Graph_Compile(Context.Graph);
+
+        // One worker is the serial baseline, the default count uses every online core.
+        Measure(&Context, 1, "Graph_Run_SingleWorker");
+        Measure(&Context, 0, "Graph_Run");
+
+        lluna_Jobs_Graph_Destroy(Context.Graph);
+
+        return EXIT_SUCCESS;
+}
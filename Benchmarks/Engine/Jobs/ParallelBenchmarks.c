@@ -0,0 +1,100 @@
+#include <BenchmarkHelper.h>
+
+#include <Engine/Jobs/Public/Parallel.h>
+
+#include <string.h>
+
+#define EntityCount (256 * 1024)
+
+struct Entity
+{
+        float Position[3];
+        float Velocity[3];
+        uint32 Key;
+        uint32 Padding;
+};
+
+struct ParallelContext
+{
+        struct lluna_Jobs_Scheduler* Scheduler;
+        struct lluna_Container_DynamicArray* Entities;
+        struct lluna_Container_DynamicArray* Shuffled;
+};
+
+static void Integrate(void* Context, byte* Elements, uint64 Index, uint64 Count)
+{
+        struct Entity* Entities = (struct Entity*)Elements;
+        for (uint64 Offset = 0; Offset < Count; ++Offset)
+        {
+                for (uint32 Axis = 0; Axis < 3; ++Axis)
+                {
+                        Entities[Offset].Velocity[Axis] *= 0.999f;
+                        Entities[Offset].Position[Axis] += Entities[Offset].Velocity[Axis] * (1.0f / 60.0f);
+                }
+        }
+}
+
+static int32 CompareKeys(void* Context, const byte* Left, const byte* Right)
+{
+        uint32 LeftKey = ((const struct Entity*)Left)->Key;
+        uint32 RightKey = ((const struct Entity*)Right)->Key;
+
+        return (LeftKey > RightKey) - (LeftKey < RightKey);
+}
+
+static void Update(void* Context, unsigned long long Iterations)
+{
+        struct ParallelContext* Input = (struct ParallelContext*)Context;
+
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                lluna_Jobs_Parallel_For(Input->Scheduler, Input->Entities, 4096, Integrate, NULL);
+        }
+        lluna_BenchmarkHelper_Sink = (unsigned long long)((struct Entity*)Input->Entities->Data)->Position[0];
+}
+
+static void Sort(void* Context, unsigned long long Iterations)
+{
+        struct ParallelContext* Input = (struct ParallelContext*)Context;
+
+        for (unsigned long long Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+                memcpy(Input->Entities->Data, Input->Shuffled->Data, Input->Shuffled->Offset);
+                lluna_Jobs_Parallel_Sort(Input->Scheduler, Input->Entities, 0, CompareKeys, NULL);
+        }
+        lluna_BenchmarkHelper_Sink = ((struct Entity*)Input->Entities->Data)->Key;
+}
+
+static void Measure(struct ParallelContext* Context, uint32 WorkerCount, const char* UpdateName, const char* SortName)
+{
+        Context->Scheduler = lluna_Jobs_Scheduler_Create(WorkerCount);
+
+        lluna_BenchmarkHelper_ReportRate(UpdateName, EntityCount, lluna_BenchmarkHelper_Measure(Update, Context));
+        lluna_BenchmarkHelper_ReportRate(SortName, EntityCount, lluna_BenchmarkHelper_Measure(Sort, Context));
+
+        lluna_Jobs_Scheduler_Destroy(Context->Scheduler);
+}
+
+int main(int argc, const char* argv[])
+{
+        struct ParallelContext Context;
+        Context.Shuffled = lluna_Container_DynamicArray_Create(EntityCount, sizeof(struct Entity));
+
+        uint32 Seed = 1;
+        for (uint32 Index = 0; Index < EntityCount; ++Index)
+        {
+                Seed = Seed * 1103515245 + 12345;
+                struct Entity Element = { { 0.0f, 0.0f, 0.0f }, { 1.0f, 2.0f, 3.0f }, Seed, 0 };
+                lluna_Container_DynamicArray_Append(Context.Shuffled, (byte*)&Element);
+        }
+        Context.Entities = lluna_Container_DynamicArray_CreateFromData(Context.Shuffled->Data, Context.Shuffled->Offset, sizeof(struct Entity));
+
+        // One worker is the serial baseline, the default count uses every online core.
+        Measure(&Context, 1, "Parallel_For_SingleWorker", "Parallel_Sort_SingleWorker");
+        Measure(&Context, 0, "Parallel_For", "Parallel_Sort");
+
+        lluna_Container_DynamicArray_Destroy(Context.Entities);
+        lluna_Container_DynamicArray_Destroy(Context.Shuffled);
+
+        return EXIT_SUCCESS;
+}
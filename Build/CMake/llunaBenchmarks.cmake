@@ -0,0 +1,5 @@
+macro(lluna_benchmark benchmark_name source_path)
+        add_executable(${benchmark_name} ${source_path})
+        target_include_directories(${benchmark_name} PRIVATE ${CMAKE_SOURCE_DIR}/Source ${CMAKE_SOURCE_DIR}/Benchmarks)
+        target_link_libraries(${benchmark_name} lluna)
+endmacro(lluna_benchmark benchmark_name source_path)
@@ -0,0 +1,381 @@
+#include <Engine/Container/Public/Bitset.h>
+
+#include <Engine/Core/Public/Cpu.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HAS_X86_INTRINSICS
+#include <immintrin.h>
+#endif
+
+#define WordBits 64
+
+typedef void (*OperationFunction)(uint64* Destination, const uint64* Source, uint64 Count);
+typedef uint64 (*PopCountFunction)(const uint64* Words, uint64 Count);
+typedef uint64 (*FindNonZeroFunction)(const uint64* Words, uint64 Index, uint64 Count);
+
+static uint64 WordCount(uint64 Count)
+{
+        return (Count + WordBits - 1) / WordBits;
+}
+
+// Clears the bits of the last word past the end, which every operation relies on.
+static void ClearTail(struct lluna_Container_Bitset* Handle)
+{
+        uint32 Used = Handle->Count % WordBits;
+        if (Used != 0)
+        {
+                Handle->Words[Handle->Count / WordBits] &= (1ULL << Used) - 1;
+        }
+}
+
+#define And(Left, Right) ((Left) & (Right))
+#define Or(Left, Right) ((Left) | (Right))
+#define AndNot(Left, Right) ((Left) & ~(Right))
+#define Xor(Left, Right) ((Left) ^ (Right))
+
+#define DefineScalarOperation(Name) \
+        static void Name##Scalar(uint64* Destination, const uint64* Source, uint64 Count) \
+        { \
+                for (uint64 Index = 0; Index < Count; ++Index) \
+                { \
+                        Destination[Index] = Name(Destination[Index], Source[Index]); \
+                } \
+        }
+
+DefineScalarOperation(And)
+DefineScalarOperation(Or)
+DefineScalarOperation(AndNot)
+DefineScalarOperation(Xor)
+
+static uint64 PopCountScalar(const uint64* Words, uint64 Count)
+{
+        uint64 Total = 0;
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                Total += (uint64)__builtin_popcountll(Words[Index]);
+        }
+
+        return Total;
+}
+
+#ifdef HAS_X86_INTRINSICS
+
+#define AndVector(Left, Right) _mm256_and_si256(Left, Right)
+#define OrVector(Left, Right) _mm256_or_si256(Left, Right)
+#define AndNotVector(Left, Right) _mm256_andnot_si256(Right, Left)
+#define XorVector(Left, Right) _mm256_xor_si256(Left, Right)
+
+// Two vectors per iteration, so each one combines a whole cache line.
+#define DefineAvx2Operation(Name) \
+        __attribute__((target("avx2"))) \
+        static void Name##Avx2(uint64* Destination, const uint64* Source, uint64 Count) \
+        { \
+                uint64 Index = 0; \
+                for (; Index + 8 <= Count; Index += 8) \
+                { \
+                        __m256i Low = _mm256_loadu_si256((const __m256i*)(Destination + Index)); \
+                        __m256i High = _mm256_loadu_si256((const __m256i*)(Destination + Index + 4)); \
+                        Low = Name##Vector(Low, _mm256_loadu_si256((const __m256i*)(Source + Index))); \
+                        High = Name##Vector(High, _mm256_loadu_si256((const __m256i*)(Source + Index + 4))); \
+                        _mm256_storeu_si256((__m256i*)(Destination + Index), Low); \
+                        _mm256_storeu_si256((__m256i*)(Destination + Index + 4), High); \
+                } \
+                for (; Index < Count; ++Index) \
+                { \
+                        Destination[Index] = Name(Destination[Index], Source[Index]); \
+                } \
+        }
+
+DefineAvx2Operation(And)
+DefineAvx2Operation(Or)
+DefineAvx2Operation(AndNot)
+DefineAvx2Operation(Xor)
+
+__attribute__((target("popcnt")))
+static uint64 PopCountPopcnt(const uint64* Words, uint64 Count)
+{
+        uint64 Total = 0;
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                Total += (uint64)__builtin_popcountll(Words[Index]);
+        }
+
+        return Total;
+}
+
+// Looks up the count of each nibble with a shuffle and sums the bytes every iteration, after Muła et al.
+__attribute__((target("avx2")))
+static uint64 PopCountAvx2(const uint64* Words, uint64 Count)
+{
+        const __m256i Lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i LowMask = _mm256_set1_epi8(0x0F);
+
+        __m256i Totals = _mm256_setzero_si256();
+        uint64 Index = 0;
+        for (; Index + 4 <= Count; Index += 4)
+        {
+                __m256i Value = _mm256_loadu_si256((const __m256i*)(Words + Index));
+                __m256i Low = _mm256_shuffle_epi8(Lookup, _mm256_and_si256(Value, LowMask));
+                __m256i High = _mm256_shuffle_epi8(Lookup, _mm256_and_si256(_mm256_srli_epi16(Value, 4), LowMask));
+                Totals = _mm256_add_epi64(Totals, _mm256_sad_epu8(_mm256_add_epi8(Low, High), _mm256_setzero_si256()));
+        }
+
+        uint64 Lanes[4];
+        _mm256_storeu_si256((__m256i*)Lanes, Totals);
+
+        uint64 Total = Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3];
+        for (; Index < Count; ++Index)
+        {
+                Total += (uint64)__builtin_popcountll(Words[Index]);
+        }
+
+        return Total;
+}
+
+// Skips four empty words at a time.
+__attribute__((target("avx2")))
+static uint64 FindNonZeroAvx2(const uint64* Words, uint64 Index, uint64 Count)
+{
+        for (; Index + 4 <= Count; Index += 4)
+        {
+                __m256i Value = _mm256_loadu_si256((const __m256i*)(Words + Index));
+                if (!_mm256_testz_si256(Value, Value))
+                {
+                        break;
+                }
+        }
+        for (; Index < Count && Words[Index] == 0; ++Index)
+        {
+        }
+
+        return Index;
+}
+
+#define Avx2Kernel(Name) { lluna_Core_Cpu_Avx2, (lluna_Core_Cpu_Function)Name##Avx2 },
+
+#else
+
+#define Avx2Kernel(Name)
+
+#endif
+
+static uint64 FindNonZeroScalar(const uint64* Words, uint64 Index, uint64 Count)
+{
+        for (; Index < Count && Words[Index] == 0; ++Index)
+        {
+        }
+
+        return Index;
+}
+
+static PopCountFunction ResolvePopCount()
+{
+        static const struct lluna_Core_Cpu_Kernel Kernels[] = {
+#ifdef HAS_X86_INTRINSICS
+                { lluna_Core_Cpu_Avx2, (lluna_Core_Cpu_Function)PopCountAvx2 },
+                { lluna_Core_Cpu_Popcnt, (lluna_Core_Cpu_Function)PopCountPopcnt },
+#endif
+                { 0, (lluna_Core_Cpu_Function)PopCountScalar },
+        };
+
+        return (PopCountFunction)lluna_Core_Cpu_Dispatch(Kernels, sizeof(Kernels) / sizeof(Kernels[0]));
+}
+
+// Kernels with an AVX2 and a scalar implementation get a dispatch table like the population count.
+#define DefineResolve(Type, Name) \
+        static Type Resolve##Name() \
+        { \
+                static const struct lluna_Core_Cpu_Kernel Kernels[] = { \
+                        Avx2Kernel(Name) \
+                        { 0, (lluna_Core_Cpu_Function)Name##Scalar }, \
+                }; \
+                \
+                return (Type)lluna_Core_Cpu_Dispatch(Kernels, sizeof(Kernels) / sizeof(Kernels[0])); \
+        }
+
+DefineResolve(OperationFunction, And)
+DefineResolve(OperationFunction, Or)
+DefineResolve(OperationFunction, AndNot)
+DefineResolve(OperationFunction, Xor)
+DefineResolve(FindNonZeroFunction, FindNonZero)
+
+struct lluna_Container_Bitset* lluna_Container_Bitset_Create(uint64 Count)
+{
+        uint64 Words = WordCount(Count);
+
+        struct lluna_Container_Bitset* Handle = malloc(sizeof(struct lluna_Container_Bitset));
+        Handle->Words = calloc(Words > 0 ? Words : 1, sizeof(uint64));
+        Handle->Count = Count;
+
+        return Handle;
+}
+
+void lluna_Container_Bitset_Destroy(struct lluna_Container_Bitset* Handle)
+{
+        free(Handle->Words);
+        free(Handle);
+}
+
+uint64 lluna_Container_Bitset_Count(struct lluna_Container_Bitset* Handle)
+{
+        return Handle->Count;
+}
+
+void lluna_Container_Bitset_Resize(struct lluna_Container_Bitset* Handle, uint64 Count)
+{
+        uint64 OldWords = WordCount(Handle->Count);
+        uint64 NewWords = WordCount(Count);
+
+        if (NewWords != OldWords)
+        {
+                Handle->Words = realloc(Handle->Words, (NewWords > 0 ? NewWords : 1) * sizeof(uint64));
+        }
+        if (NewWords > OldWords)
+        {
+                memset(Handle->Words + OldWords, 0, (NewWords - OldWords) * sizeof(uint64));
+        }
+
+        Handle->Count = Count;
+        ClearTail(Handle);
+}
+
+boolean lluna_Container_Bitset_Test(struct lluna_Container_Bitset* Handle, uint64 Index)
+{
+        return (Handle->Words[Index / WordBits] >> (Index % WordBits)) & 1;
+}
+
+void lluna_Container_Bitset_Set(struct lluna_Container_Bitset* Handle, uint64 Index)
+{
+        Handle->Words[Index / WordBits] |= 1ULL << (Index % WordBits);
+}
+
+void lluna_Container_Bitset_Reset(struct lluna_Container_Bitset* Handle, uint64 Index)
+{
+        Handle->Words[Index / WordBits] &= ~(1ULL << (Index % WordBits));
+}
+
+void lluna_Container_Bitset_SetAll(struct lluna_Container_Bitset* Handle)
+{
+        memset(Handle->Words, 0xFF, WordCount(Handle->Count) * sizeof(uint64));
+        ClearTail(Handle);
+}
+
+void lluna_Container_Bitset_ResetAll(struct lluna_Container_Bitset* Handle)
+{
+        memset(Handle->Words, 0, WordCount(Handle->Count) * sizeof(uint64));
+}
+
+void lluna_Container_Bitset_And(struct lluna_Container_Bitset* Destination, const struct lluna_Container_Bitset* Source)
+{
+        static OperationFunction Function = NULL;
+        if (!Function)
+        {
+                Function = ResolveAnd();
+        }
+
+        Function(Destination->Words, Source->Words, WordCount(Destination->Count));
+}
+
+void lluna_Container_Bitset_Or(struct lluna_Container_Bitset* Destination, const struct lluna_Container_Bitset* Source)
+{
+        static OperationFunction Function = NULL;
+        if (!Function)
+        {
+                Function = ResolveOr();
+        }
+
+        Function(Destination->Words, Source->Words, WordCount(Destination->Count));
+}
+
+void lluna_Container_Bitset_AndNot(struct lluna_Container_Bitset* Destination, const struct lluna_Container_Bitset* Source)
+{
+        static OperationFunction Function = NULL;
+        if (!Function)
+        {
+                Function = ResolveAndNot();
+        }
+
+        Function(Destination->Words, Source->Words, WordCount(Destination->Count));
+}
+
+void lluna_Container_Bitset_Xor(struct lluna_Container_Bitset* Destination, const struct lluna_Container_Bitset* Source)
+{
+        static OperationFunction Function = NULL;
+        if (!Function)
+        {
+                Function = ResolveXor();
+        }
+
+        Function(Destination->Words, Source->Words, WordCount(Destination->Count));
+}
+
+uint64 lluna_Container_Bitset_PopCount(struct lluna_Container_Bitset* Handle)
+{
+        static PopCountFunction Function = NULL;
+        if (!Function)
+        {
+                Function = ResolvePopCount();
+        }
+
+        return Function(Handle->Words, WordCount(Handle->Count));
+}
+
+uint64 lluna_Container_Bitset_FindFirstSet(struct lluna_Container_Bitset* Handle, uint64 Start)
+{
+        if (Start >= Handle->Count)
+        {
+                return Handle->Count;
+        }
+
+        uint64 Index = Start / WordBits;
+        uint64 Word = Handle->Words[Index] & (~0ULL << (Start % WordBits));
+        if (Word != 0)
+        {
+                return Index * WordBits + (uint64)__builtin_ctzll(Word);
+        }
+
+        static FindNonZeroFunction FindNonZero = NULL;
+        if (!FindNonZero)
+        {
+                FindNonZero = ResolveFindNonZero();
+        }
+
+        uint64 Words = WordCount(Handle->Count);
+        Index = FindNonZero(Handle->Words, Index + 1, Words);
+
+        return Index < Words ? Index * WordBits + (uint64)__builtin_ctzll(Handle->Words[Index]) : Handle->Count;
+}
+
+struct lluna_Container_Bitset_Iterator lluna_Container_Bitset_Begin(struct lluna_Container_Bitset* Handle)
+{
+        struct lluna_Container_Bitset_Iterator Iterator;
+        Iterator.Words = Handle->Words;
+        Iterator.WordCount = WordCount(Handle->Count);
+        Iterator.WordIndex = 0;
+        Iterator.Remaining = Iterator.WordCount > 0 ? Handle->Words[0] : 0;
+
+        return Iterator;
+}
+
+boolean lluna_Container_Bitset_Next(struct lluna_Container_Bitset_Iterator* Iterator, uint64* Index)
+{
+        while (Iterator->Remaining == 0)
+        {
+                if (++Iterator->WordIndex >= Iterator->WordCount)
+                {
+                        Iterator->WordIndex = Iterator->WordCount;
+                        return false;
+                }
+                Iterator->Remaining = Iterator->Words[Iterator->WordIndex];
+        }
+
+        *Index = Iterator->WordIndex * WordBits + (uint64)__builtin_ctzll(Iterator->Remaining);
+
+        // Clears the lowest set bit.
+        Iterator->Remaining &= Iterator->Remaining - 1;
+
+        return true;
+}
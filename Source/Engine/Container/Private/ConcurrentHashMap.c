@@ -0,0 +1,405 @@
+#include <Engine/Container/Public/ConcurrentHashMap.h>
+
+#include <Engine/Core/Public/Atomics.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+// Smallest table, large enough that every stripe claiming a slot past the threshold at once can't fill it.
+#define MinimumCapacity 256
+
+// Slots of the previous table moved by each write while resizing.
+#define MigrationChunk 256
+
+// Rounds of spinning on a lock that only pause the core before yielding it.
+#define PauseLimit 16
+
+#define StripeAlignment 64
+
+struct Slot
+{
+        uint64 Key;
+        void* Value;
+};
+
+struct lluna_Container_ConcurrentHashMap_Table
+{
+        uint64 Capacity;
+        uint32 Shift;
+
+        uint64 Used;
+        uint64 MigrationCursor;
+        uint64 Migrated;
+
+        struct lluna_Container_ConcurrentHashMap_Table* NextRetired;
+        struct Slot Slots[];
+};
+
+struct lluna_Container_ConcurrentHashMap_Stripe
+{
+        struct lluna_Core_Sync_Mutex Lock;
+        uint64 Count;
+} __attribute__((aligned(StripeAlignment)));
+
+// Marks slots of the previous table whose entry lives in the current one, only its address is used.
+static byte MovedMarker;
+#define Moved ((void*)&MovedMarker)
+
+static void Relax(uint32 Attempt)
+{
+        if (Attempt < PauseLimit)
+        {
+                lluna_Core_Atomics_Pause();
+        }
+        else
+        {
+                lluna_Core_Atomics_Yield();
+        }
+}
+
+// Slots are picked from the high bits of the product, stripes from the middle ones.
+static uint64 Hash(uint64 Key)
+{
+        return Key * 0x9E3779B97F4A7C15ULL;
+}
+
+static struct lluna_Container_ConcurrentHashMap_Stripe* StripeOf(struct lluna_Container_ConcurrentHashMap* Handle, uint64 Key)
+{
+        return &Handle->Stripes[(Hash(Key) >> 24) & (lluna_Container_ConcurrentHashMap_StripeCount - 1)];
+}
+
+static struct lluna_Container_ConcurrentHashMap_Table* CreateTable(uint64 Count)
+{
+        uint64 Capacity = MinimumCapacity;
+        while (Capacity < Count)
+        {
+                Capacity *= 2;
+        }
+
+        struct lluna_Container_ConcurrentHashMap_Table* Table = calloc(1, sizeof(struct lluna_Container_ConcurrentHashMap_Table) + Capacity * sizeof(struct Slot));
+        Table->Capacity = Capacity;
+        Table->Shift = 64 - __builtin_ctzll(Capacity);
+
+        return Table;
+}
+
+static boolean Full(struct lluna_Container_ConcurrentHashMap_Table* Table)
+{
+        return lluna_Core_Atomics_LoadUint64(&Table->Used, lluna_Core_Atomics_Relaxed) >= Table->Capacity / 2;
+}
+
+// Returns the slot of the key, or NULL if it isn't in the table.
+static struct Slot* Search(struct lluna_Container_ConcurrentHashMap_Table* Table, uint64 Key)
+{
+        uint64 Mask = Table->Capacity - 1;
+        uint64 Index = Hash(Key) >> Table->Shift;
+        for (uint64 Probe = 0; Probe < Table->Capacity; ++Probe, Index = (Index + 1) & Mask)
+        {
+                uint64 Existing = lluna_Core_Atomics_LoadUint64(&Table->Slots[Index].Key, lluna_Core_Atomics_Acquire);
+                if (Existing == Key)
+                {
+                        return &Table->Slots[Index];
+                }
+                if (Existing == 0)
+                {
+                        return NULL;
+                }
+        }
+
+        return NULL;
+}
+
+static void* Load(struct lluna_Container_ConcurrentHashMap_Table* Table, uint64 Key)
+{
+        struct Slot* Slot = Search(Table, Key);
+
+        return Slot ? lluna_Core_Atomics_LoadPointer(&Slot->Value, lluna_Core_Atomics_Acquire) : NULL;
+}
+
+// Returns the slot of the key, claiming an empty one if needed. Writers of other keys may be claiming slots too.
+static struct Slot* Claim(struct lluna_Container_ConcurrentHashMap_Table* Table, uint64 Key)
+{
+        uint64 Mask = Table->Capacity - 1;
+        uint64 Index = Hash(Key) >> Table->Shift;
+        for (uint64 Probe = 0; Probe < Table->Capacity; ++Probe, Index = (Index + 1) & Mask)
+        {
+                uint64 Existing = lluna_Core_Atomics_LoadUint64(&Table->Slots[Index].Key, lluna_Core_Atomics_Acquire);
+                if (Existing == 0 && lluna_Core_Atomics_CompareExchangeUint64(&Table->Slots[Index].Key, &Existing, Key, false,
+                                                                              lluna_Core_Atomics_AcquireRelease, lluna_Core_Atomics_Acquire))
+                {
+                        lluna_Core_Atomics_FetchAddUint64(&Table->Used, 1, lluna_Core_Atomics_Relaxed);
+                        return &Table->Slots[Index];
+                }
+                if (Existing == Key)
+                {
+                        return &Table->Slots[Index];
+                }
+        }
+
+        return NULL;
+}
+
+// Moves an entry of the previous table to the current one. The stripe of its key must be locked.
+static void MoveSlot(struct Slot* Slot, struct lluna_Container_ConcurrentHashMap_Table* Current)
+{
+        void* Value = lluna_Core_Atomics_LoadPointer(&Slot->Value, lluna_Core_Atomics_Relaxed);
+        if (Value == Moved)
+        {
+                return;
+        }
+
+        // The entry is written before it is marked, so readers seeing the mark find it in the current table.
+        if (Value)
+        {
+                lluna_Core_Atomics_StorePointer(&Claim(Current, Slot->Key)->Value, Value, lluna_Core_Atomics_Release);
+        }
+        lluna_Core_Atomics_StorePointer(&Slot->Value, Moved, lluna_Core_Atomics_Release);
+}
+
+static void BeginTableChange(struct lluna_Container_ConcurrentHashMap* Handle)
+{
+        lluna_Core_Atomics_StoreUint32(&Handle->Version, Handle->Version + 1, lluna_Core_Atomics_Relaxed);
+        lluna_Core_Atomics_Fence(lluna_Core_Atomics_Release);
+}
+
+static void EndTableChange(struct lluna_Container_ConcurrentHashMap* Handle)
+{
+        lluna_Core_Atomics_StoreUint32(&Handle->Version, Handle->Version + 1, lluna_Core_Atomics_Release);
+}
+
+static void FinishMigration(struct lluna_Container_ConcurrentHashMap* Handle, struct lluna_Container_ConcurrentHashMap_Table* Previous)
+{
+        lluna_Core_Sync_LockMutex(&Handle->ResizeLock);
+
+        BeginTableChange(Handle);
+        lluna_Core_Atomics_StorePointer(&Handle->Previous, NULL, lluna_Core_Atomics_Relaxed);
+        EndTableChange(Handle);
+
+        Previous->NextRetired = Handle->Retired;
+        Handle->Retired = Previous;
+
+        lluna_Core_Sync_UnlockMutex(&Handle->ResizeLock);
+}
+
+// Moves chunks of the previous table, all of them and waiting for other writers to finish theirs if asked to.
+static void Migrate(struct lluna_Container_ConcurrentHashMap* Handle, boolean All)
+{
+        struct lluna_Container_ConcurrentHashMap_Table* Previous = lluna_Core_Atomics_LoadPointer(&Handle->Previous, lluna_Core_Atomics_Acquire);
+        if (!Previous)
+        {
+                return;
+        }
+        struct lluna_Container_ConcurrentHashMap_Table* Current = lluna_Core_Atomics_LoadPointer(&Handle->Current, lluna_Core_Atomics_Acquire);
+
+        do
+        {
+                // A claimed chunk means the migration isn't finished, so the current table read above is its target.
+                uint64 First = lluna_Core_Atomics_FetchAddUint64(&Previous->MigrationCursor, MigrationChunk, lluna_Core_Atomics_Relaxed);
+                if (First >= Previous->Capacity)
+                {
+                        break;
+                }
+
+                uint64 Count = Previous->Capacity - First < MigrationChunk ? Previous->Capacity - First : MigrationChunk;
+                for (uint64 Index = First; Index < First + Count; ++Index)
+                {
+                        uint64 Key = lluna_Core_Atomics_LoadUint64(&Previous->Slots[Index].Key, lluna_Core_Atomics_Acquire);
+                        if (Key)
+                        {
+                                struct lluna_Container_ConcurrentHashMap_Stripe* Stripe = StripeOf(Handle, Key);
+                                lluna_Core_Sync_LockMutex(&Stripe->Lock);
+                                MoveSlot(&Previous->Slots[Index], Current);
+                                lluna_Core_Sync_UnlockMutex(&Stripe->Lock);
+                        }
+                }
+
+                if (lluna_Core_Atomics_FetchAddUint64(&Previous->Migrated, Count, lluna_Core_Atomics_AcquireRelease) + Count == Previous->Capacity)
+                {
+                        FinishMigration(Handle, Previous);
+                }
+        } while (All);
+
+        for (uint32 Attempt = 0; All && lluna_Core_Atomics_LoadPointer(&Handle->Previous, lluna_Core_Atomics_Acquire) == Previous; ++Attempt)
+        {
+                Relax(Attempt);
+        }
+}
+
+// Replaces a full current table, first finishing any migration in progress.
+static void Grow(struct lluna_Container_ConcurrentHashMap* Handle)
+{
+        Migrate(Handle, true);
+
+        lluna_Core_Sync_LockMutex(&Handle->ResizeLock);
+        for (uint32 Index = 0; Index < lluna_Container_ConcurrentHashMap_StripeCount; ++Index)
+        {
+                lluna_Core_Sync_LockMutex(&Handle->Stripes[Index].Lock);
+        }
+
+        // Another writer may have grown the table while the locks were taken.
+        struct lluna_Container_ConcurrentHashMap_Table* Current = Handle->Current;
+        if (!Handle->Previous && Full(Current))
+        {
+                uint64 Count = 0;
+                for (uint32 Index = 0; Index < lluna_Container_ConcurrentHashMap_StripeCount; ++Index)
+                {
+                        Count += Handle->Stripes[Index].Count;
+                }
+
+                struct lluna_Container_ConcurrentHashMap_Table* Grown = CreateTable(Count * 4);
+
+                // Migrating writers read the previous table first, so it is published after its target.
+                BeginTableChange(Handle);
+                lluna_Core_Atomics_StorePointer(&Handle->Current, Grown, lluna_Core_Atomics_Release);
+                lluna_Core_Atomics_StorePointer(&Handle->Previous, Current, lluna_Core_Atomics_Release);
+                EndTableChange(Handle);
+        }
+
+        for (uint32 Index = 0; Index < lluna_Container_ConcurrentHashMap_StripeCount; ++Index)
+        {
+                lluna_Core_Sync_UnlockMutex(&Handle->Stripes[Index].Lock);
+        }
+        lluna_Core_Sync_UnlockMutex(&Handle->ResizeLock);
+}
+
+// Writes the value of a key, or removes it when the value is NULL.
+static void* Write(struct lluna_Container_ConcurrentHashMap* Handle, uint64 Key, void* Value, boolean Replace)
+{
+        struct lluna_Container_ConcurrentHashMap_Stripe* Stripe = StripeOf(Handle, Key);
+        for (;;)
+        {
+                Migrate(Handle, false);
+
+                // The tables can't be swapped while a stripe is locked, at most the migration finishes.
+                lluna_Core_Sync_LockMutex(&Stripe->Lock);
+                struct lluna_Container_ConcurrentHashMap_Table* Current = lluna_Core_Atomics_LoadPointer(&Handle->Current, lluna_Core_Atomics_Acquire);
+                struct lluna_Container_ConcurrentHashMap_Table* Previous = lluna_Core_Atomics_LoadPointer(&Handle->Previous, lluna_Core_Atomics_Acquire);
+
+                if (Previous)
+                {
+                        struct Slot* Old = Search(Previous, Key);
+                        if (Old)
+                        {
+                                MoveSlot(Old, Current);
+                        }
+                }
+
+                struct Slot* Slot = Search(Current, Key);
+                if (!Slot && Value)
+                {
+                        Slot = Full(Current) ? NULL : Claim(Current, Key);
+                        if (!Slot)
+                        {
+                                lluna_Core_Sync_UnlockMutex(&Stripe->Lock);
+                                Grow(Handle);
+                                continue;
+                        }
+                }
+
+                void* Existing = Slot ? lluna_Core_Atomics_LoadPointer(&Slot->Value, lluna_Core_Atomics_Relaxed) : NULL;
+                if (Slot && (Replace || !Existing))
+                {
+                        lluna_Core_Atomics_StorePointer(&Slot->Value, Value, lluna_Core_Atomics_Release);
+                        lluna_Core_Atomics_StoreUint64(&Stripe->Count, Stripe->Count + (Value != NULL) - (Existing != NULL), lluna_Core_Atomics_Relaxed);
+                }
+                lluna_Core_Sync_UnlockMutex(&Stripe->Lock);
+
+                return Replace || Existing ? Existing : Value;
+        }
+}
+
+struct lluna_Container_ConcurrentHashMap* lluna_Container_ConcurrentHashMap_Create(uint64 InitialCount)
+{
+        struct lluna_Container_ConcurrentHashMap* Handle = malloc(sizeof(struct lluna_Container_ConcurrentHashMap));
+        Handle->Current = CreateTable(InitialCount * 2);
+        Handle->Previous = NULL;
+        Handle->Retired = NULL;
+        Handle->Version = 0;
+        lluna_Core_Sync_InitializeMutex(&Handle->ResizeLock);
+
+        uint64 StripesSize = lluna_Container_ConcurrentHashMap_StripeCount * sizeof(struct lluna_Container_ConcurrentHashMap_Stripe);
+        if (posix_memalign((void**)&Handle->Stripes, StripeAlignment, StripesSize) == 0)
+        {
+                memset(Handle->Stripes, 0, StripesSize);
+        }
+        else
+        {
+                Handle->Stripes = NULL;
+        }
+
+        return Handle;
+}
+
+void lluna_Container_ConcurrentHashMap_Destroy(struct lluna_Container_ConcurrentHashMap* Handle)
+{
+        while (Handle->Retired)
+        {
+                struct lluna_Container_ConcurrentHashMap_Table* Next = Handle->Retired->NextRetired;
+                free(Handle->Retired);
+                Handle->Retired = Next;
+        }
+
+        free(Handle->Previous);
+        free(Handle->Current);
+        free(Handle->Stripes);
+        free(Handle);
+}
+
+uint64 lluna_Container_ConcurrentHashMap_Count(struct lluna_Container_ConcurrentHashMap* Handle)
+{
+        uint64 Count = 0;
+        for (uint32 Index = 0; Index < lluna_Container_ConcurrentHashMap_StripeCount; ++Index)
+        {
+                Count += lluna_Core_Atomics_LoadUint64(&Handle->Stripes[Index].Count, lluna_Core_Atomics_Relaxed);
+        }
+
+        return Count;
+}
+
+void* lluna_Container_ConcurrentHashMap_Find(struct lluna_Container_ConcurrentHashMap* Handle, uint64 Key)
+{
+        for (uint32 Attempt = 0;; ++Attempt)
+        {
+                uint32 Version = lluna_Core_Atomics_LoadUint32(&Handle->Version, lluna_Core_Atomics_Acquire);
+                if (Version & 1)
+                {
+                        Relax(Attempt);
+                        continue;
+                }
+
+                struct lluna_Container_ConcurrentHashMap_Table* Current = lluna_Core_Atomics_LoadPointer(&Handle->Current, lluna_Core_Atomics_Acquire);
+                struct lluna_Container_ConcurrentHashMap_Table* Previous = lluna_Core_Atomics_LoadPointer(&Handle->Previous, lluna_Core_Atomics_Acquire);
+
+                // A key without a value in the current table may still be on its way from the previous one.
+                void* Value = Load(Current, Key);
+                if (!Value && Previous)
+                {
+                        Value = Load(Previous, Key);
+                        if (Value == Moved)
+                        {
+                                Value = Load(Current, Key);
+                        }
+                }
+
+                lluna_Core_Atomics_Fence(lluna_Core_Atomics_Acquire);
+                if (lluna_Core_Atomics_LoadUint32(&Handle->Version, lluna_Core_Atomics_Relaxed) == Version)
+                {
+                        return Value;
+                }
+        }
+}
+
+void* lluna_Container_ConcurrentHashMap_Insert(struct lluna_Container_ConcurrentHashMap* Handle, uint64 Key, void* Value)
+{
+        return Write(Handle, Key, Value, true);
+}
+
+void* lluna_Container_ConcurrentHashMap_FindOrInsert(struct lluna_Container_ConcurrentHashMap* Handle, uint64 Key, void* Value)
+{
+        return Write(Handle, Key, Value, false);
+}
+
+void* lluna_Container_ConcurrentHashMap_Remove(struct lluna_Container_ConcurrentHashMap* Handle, uint64 Key)
+{
+        return Write(Handle, Key, NULL, true);
+}
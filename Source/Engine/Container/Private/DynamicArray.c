@@ -1,19 +1,100 @@
 #include <Engine/Container/Public/DynamicArray.h>
 
+#include <Engine/Core/Public/Atomics.h>
+#include <Engine/Core/Public/Memory.h>
+
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 
+// Arrays sharing a buffer through lluna_Container_DynamicArray_Share count its references right before the elements,
+// so Data keeps pointing at the first element.
+struct Buffer
+{
+        uint64 References;
+        byte Data[] __attribute__((aligned(16)));
+};
+
+static struct Buffer* BufferOf(byte* Data)
+{
+        return (struct Buffer*)(Data - offsetof(struct Buffer, Data));
+}
+
+static byte* Allocate(uint64 Size)
+{
+        struct Buffer* Buffer = lluna_Core_Memory_Allocate(sizeof(struct Buffer) + Size, lluna_Core_Memory_DynamicArray);
+        Buffer->References = 1;
+
+        return Buffer->Data;
+}
+
+// A count of one can only be seen by the last reference, and the acquire pairs with the release of the others.
+static boolean Shared(byte* Data)
+{
+        return lluna_Core_Atomics_LoadUint64(&BufferOf(Data)->References, lluna_Core_Atomics_Acquire) > 1;
+}
+
+static void Release(byte* Data)
+{
+        struct Buffer* Buffer = BufferOf(Data);
+        if (!Shared(Data) || lluna_Core_Atomics_FetchSubUint64(&Buffer->References, 1, lluna_Core_Atomics_AcquireRelease) == 1)
+        {
+                lluna_Core_Memory_Free(Buffer);
+        }
+}
+
+// Gives the array a buffer of its own of the given size. Shared buffers are left alone and only the elements that fit
+// are copied out of them.
+static void Reallocate(struct lluna_Container_DynamicArray* Handle, uint64 Size)
+{
+        if (Shared(Handle->Data))
+        {
+                byte* Data = Allocate(Size);
+                memcpy(Data, Handle->Data, Handle->Offset < Size ? Handle->Offset : Size);
+                Release(Handle->Data);
+                Handle->Data = Data;
+        }
+        else
+        {
+                // TODO This could leak memory. Waiting on validation/custom allocators to fix.
+                struct Buffer* Buffer = lluna_Core_Memory_Reallocate(BufferOf(Handle->Data), sizeof(struct Buffer) + Size, lluna_Core_Memory_DynamicArray);
+                Handle->Data = Buffer->Data;
+        }
+
+        Handle->AllocatedSize = Size;
+}
+
+// Called before writing to the elements.
+static void Own(struct lluna_Container_DynamicArray* Handle)
+{
+        if (Shared(Handle->Data))
+        {
+                Reallocate(Handle, Handle->AllocatedSize);
+        }
+}
+
 static void ScaleUp(struct lluna_Container_DynamicArray* Handle)
 {
-        Handle->AllocatedSize *= lluna_Container_DynamicArray_ResizeFactor;
-        // TODO This could leak memory. Waiting on validation/custom allocators to fix.
-        Handle->Data = realloc(Handle->Data, Handle->AllocatedSize);
+        Reallocate(Handle, Handle->AllocatedSize * lluna_Container_DynamicArray_ResizeFactor);
+}
+
+// Makes room for one more element in a buffer of the array's own.
+static void Reserve(struct lluna_Container_DynamicArray* Handle)
+{
+        if (Handle->Offset + Handle->ElementSize > Handle->AllocatedSize)
+        {
+                ScaleUp(Handle);
+        }
+        else
+        {
+                Own(Handle);
+        }
 }
 
 struct lluna_Container_DynamicArray* lluna_Container_DynamicArray_Create(uint64 InitialSize, uint32 ElementSize)
 {
-        struct lluna_Container_DynamicArray* Handle = malloc(sizeof(struct lluna_Container_DynamicArray));
-        Handle->Data = malloc(InitialSize * ElementSize);
+        struct lluna_Container_DynamicArray* Handle = lluna_Core_Memory_Allocate(sizeof(struct lluna_Container_DynamicArray), lluna_Core_Memory_DynamicArray);
+        Handle->Data = Allocate(InitialSize * ElementSize);
         Handle->AllocatedSize = InitialSize * ElementSize;
         Handle->Offset = 0;
         Handle->ElementSize = ElementSize;
@@ -23,8 +104,8 @@ struct lluna_Container_DynamicArray* lluna_Container_DynamicArray_Create(uint64
 
 struct lluna_Container_DynamicArray* lluna_Container_DynamicArray_CreateFromData(byte* Data, uint64 Size, uint32 ElementSize)
 {
-        struct lluna_Container_DynamicArray* Handle = malloc(sizeof(struct lluna_Container_DynamicArray));
-        Handle->Data = malloc(Size);
+        struct lluna_Container_DynamicArray* Handle = lluna_Core_Memory_Allocate(sizeof(struct lluna_Container_DynamicArray), lluna_Core_Memory_DynamicArray);
+        Handle->Data = Allocate(Size);
         Handle->AllocatedSize = Size;
         Handle->Offset = Size;
         Handle->ElementSize = ElementSize;
@@ -34,10 +115,30 @@ struct lluna_Container_DynamicArray* lluna_Container_DynamicArray_CreateFromData
         return Handle;
 }
 
+struct lluna_Container_DynamicArray* lluna_Container_DynamicArray_Share(struct lluna_Container_DynamicArray* Handle)
+{
+        struct lluna_Container_DynamicArray* Snapshot = lluna_Core_Memory_Allocate(sizeof(struct lluna_Container_DynamicArray), lluna_Core_Memory_DynamicArray);
+        *Snapshot = *Handle;
+
+        lluna_Core_Atomics_FetchAddUint64(&BufferOf(Handle->Data)->References, 1, lluna_Core_Atomics_Relaxed);
+
+        return Snapshot;
+}
+
 void lluna_Container_DynamicArray_Destroy(struct lluna_Container_DynamicArray* Handle)
 {
-        free(Handle->Data);
-        free(Handle);
+        Release(Handle->Data);
+        lluna_Core_Memory_Free(Handle);
+}
+
+boolean lluna_Container_DynamicArray_Shared(struct lluna_Container_DynamicArray* Handle)
+{
+        return Shared(Handle->Data);
+}
+
+void lluna_Container_DynamicArray_Unshare(struct lluna_Container_DynamicArray* Handle)
+{
+        Own(Handle);
 }
 
 boolean lluna_Container_DynamicArray_Empty(struct lluna_Container_DynamicArray* Handle)
@@ -57,17 +158,13 @@ uint64 lluna_Container_DynamicArray_Capacity(struct lluna_Container_DynamicArray
 
 void lluna_Container_DynamicArray_Resize(struct lluna_Container_DynamicArray* Handle, uint64 Size)
 {
-        // TODO This could leak memory. Waiting on validation/custom allocators to fix.
-        Handle->Data = realloc(Handle->Data, Size * Handle->ElementSize);
-        Handle->AllocatedSize = Size * Handle->ElementSize;
+        Reallocate(Handle, Size * Handle->ElementSize);
         Handle->Offset = Handle->Offset > Handle->AllocatedSize ? Handle->AllocatedSize : Handle->Offset;
 }
 
 void lluna_Container_DynamicArray_Shrink(struct lluna_Container_DynamicArray* Handle)
 {
-        // TODO This could leak memory. Waiting on validation/custom allocators to fix.
-        Handle->Data = realloc(Handle->Data, Handle->Offset);
-        Handle->AllocatedSize = Handle->Offset;
+        Reallocate(Handle, Handle->Offset);
 }
 
 byte* lluna_Container_DynamicArray_First(struct lluna_Container_DynamicArray* Handle)
@@ -88,10 +185,7 @@ byte* lluna_Container_DynamicArray_Get(struct lluna_Container_DynamicArray* Hand
 
 void lluna_Container_DynamicArray_Append(struct lluna_Container_DynamicArray* Handle, byte* Data)
 {
-        if (Handle->Offset + Handle->ElementSize > Handle->AllocatedSize)
-        {
-                ScaleUp(Handle);
-        }
+        Reserve(Handle);
 
         memcpy(Handle->Data + Handle->Offset, Data, Handle->ElementSize);
         Handle->Offset += Handle->ElementSize;
@@ -99,31 +193,27 @@ void lluna_Container_DynamicArray_Append(struct lluna_Container_DynamicArray* Ha
 
 void lluna_Container_DynamicArray_Prepend(struct lluna_Container_DynamicArray* Handle, byte* Data)
 {
-        if (Handle->Offset + Handle->ElementSize > Handle->AllocatedSize)
-        {
-                ScaleUp(Handle);
-        }
+        Reserve(Handle);
 
-        memcpy(Handle->Data + Handle->ElementSize, Handle->Data, Handle->Offset);
+        memmove(Handle->Data + Handle->ElementSize, Handle->Data, Handle->Offset);
         memcpy(Handle->Data, Data, Handle->ElementSize);
         Handle->Offset += Handle->ElementSize;
 }
 
 void lluna_Container_DynamicArray_Insert(struct lluna_Container_DynamicArray* Handle, byte* Data, uint64 Index)
 {
-        if (Handle->Offset + Handle->ElementSize > Handle->AllocatedSize)
-        {
-                ScaleUp(Handle);
-        }
+        Reserve(Handle);
 
         uint64 InsertOffset = Index * Handle->ElementSize;
-        memcpy(Handle->Data + InsertOffset + Handle->ElementSize, Handle->Data + InsertOffset, Handle->Offset - InsertOffset);
+        memmove(Handle->Data + InsertOffset + Handle->ElementSize, Handle->Data + InsertOffset, Handle->Offset - InsertOffset);
         memcpy(Handle->Data + InsertOffset, Data, Handle->ElementSize);
         Handle->Offset += Handle->ElementSize;
 }
 
 void lluna_Container_DynamicArray_Remove(struct lluna_Container_DynamicArray* Handle, uint64 Index)
 {
+        Own(Handle);
+
         uint64 VictimOffset = Index * Handle->ElementSize;
         memcpy(Handle->Data + VictimOffset, Handle->Data + Handle->Offset - Handle->ElementSize, Handle->ElementSize);
         Handle->Offset -= Handle->ElementSize;
@@ -131,14 +221,18 @@ void lluna_Container_DynamicArray_Remove(struct lluna_Container_DynamicArray* Ha
 
 void lluna_Container_DynamicArray_RemoveStable(struct lluna_Container_DynamicArray* Handle, uint64 Index)
 {
+        Own(Handle);
+
         uint64 VictimOffset = Index * Handle->ElementSize;
-        memcpy(Handle->Data + VictimOffset, Handle->Data + VictimOffset + Handle->ElementSize, Handle->Offset - (VictimOffset + Handle->ElementSize));
+        memmove(Handle->Data + VictimOffset, Handle->Data + VictimOffset + Handle->ElementSize, Handle->Offset - (VictimOffset + Handle->ElementSize));
         Handle->Offset -= Handle->ElementSize;
 }
 
 void lluna_Container_DynamicArray_RemoveFirst(struct lluna_Container_DynamicArray* Handle)
 {
-        memcpy(Handle->Data, Handle->Data + Handle->ElementSize, Handle->Offset - Handle->ElementSize);
+        Own(Handle);
+
+        memmove(Handle->Data, Handle->Data + Handle->ElementSize, Handle->Offset - Handle->ElementSize);
         Handle->Offset -= Handle->ElementSize;
 }
 
@@ -147,6 +241,110 @@ void lluna_Container_DynamicArray_RemoveLast(struct lluna_Container_DynamicArray
         Handle->Offset -= Handle->ElementSize;
 }
 
+uint64 lluna_Container_DynamicArray_RemoveIf(struct lluna_Container_DynamicArray* Handle, lluna_Container_DynamicArray_PredicateFunction Predicate, void* Context)
+{
+        Own(Handle);
+
+        uint32 ElementSize = Handle->ElementSize;
+        uint64 Count = Handle->Offset / ElementSize;
+
+        uint64 Write = 0;
+        while (Write < Count && !Predicate(Context, Handle->Data + Write * ElementSize))
+        {
+                ++Write;
+        }
+
+        // Write now points at the first removed element. Each run of kept elements after it is moved down at once.
+        uint64 Read = Write + 1;
+        while (Read < Count)
+        {
+                uint64 RunStart = Read;
+                while (Read < Count && !Predicate(Context, Handle->Data + Read * ElementSize))
+                {
+                        ++Read;
+                }
+
+                memmove(Handle->Data + Write * ElementSize, Handle->Data + RunStart * ElementSize, (Read - RunStart) * ElementSize);
+                Write += Read - RunStart;
+                ++Read;
+        }
+
+        Handle->Offset = Write * ElementSize;
+
+        return Count - Write;
+}
+
+uint64 lluna_Container_DynamicArray_RemoveIfUnordered(struct lluna_Container_DynamicArray* Handle, lluna_Container_DynamicArray_PredicateFunction Predicate, void* Context)
+{
+        Own(Handle);
+
+        uint32 ElementSize = Handle->ElementSize;
+        uint64 Count = Handle->Offset / ElementSize;
+
+        // Elements before Front are kept and elements from Back onwards are removed.
+        uint64 Front = 0;
+        uint64 Back = Count;
+        while (Front < Back)
+        {
+                if (!Predicate(Context, Handle->Data + Front * ElementSize))
+                {
+                        ++Front;
+                        continue;
+                }
+
+                --Back;
+                while (Back > Front && Predicate(Context, Handle->Data + Back * ElementSize))
+                {
+                        --Back;
+                }
+
+                if (Back > Front)
+                {
+                        memcpy(Handle->Data + Front * ElementSize, Handle->Data + Back * ElementSize, ElementSize);
+                        ++Front;
+                }
+        }
+
+        Handle->Offset = Front * ElementSize;
+
+        return Count - Front;
+}
+
+void lluna_Container_DynamicArray_RemoveIndices(struct lluna_Container_DynamicArray* Handle, const uint64* Indices, uint64 Count)
+{
+        if (Count == 0)
+        {
+                return;
+        }
+
+        Own(Handle);
+
+        uint32 ElementSize = Handle->ElementSize;
+        uint64 ElementCount = Handle->Offset / ElementSize;
+
+        // Moves the run of kept elements between each pair of removed indices down over the gap.
+        uint64 Write = Indices[0];
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                uint64 RunStart = Indices[Index] + 1;
+                uint64 RunEnd = Index + 1 < Count ? Indices[Index + 1] : ElementCount;
+
+                memmove(Handle->Data + Write * ElementSize, Handle->Data + RunStart * ElementSize, (RunEnd - RunStart) * ElementSize);
+                Write += RunEnd - RunStart;
+        }
+
+        Handle->Offset = Write * ElementSize;
+}
+
+void lluna_Container_DynamicArray_RemoveIndicesUnordered(struct lluna_Container_DynamicArray* Handle, const uint64* Indices, uint64 Count)
+{
+        // From the highest index down, the last element is never one that still has to be removed.
+        for (uint64 Index = Count; Index > 0; --Index)
+        {
+                lluna_Container_DynamicArray_Remove(Handle, Indices[Index - 1]);
+        }
+}
+
 void lluna_Container_DynamicArray_Clear(struct lluna_Container_DynamicArray* Handle)
 {
         Handle->Offset = 0;
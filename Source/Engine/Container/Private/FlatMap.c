@@ -0,0 +1,338 @@
+#include <Engine/Container/Public/FlatMap.h>
+
+#include <Engine/Container/Public/Sort.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+// Eytzinger nodes are prefetched this many levels ahead. 16 keys of 8 bytes are two cache lines.
+#define PrefetchDistance 16
+
+static uint64* Keys(struct lluna_Container_FlatMap* Handle)
+{
+        return (uint64*)Handle->Keys->Data;
+}
+
+static void Reserve(struct lluna_Container_DynamicArray* Array, uint64 Count)
+{
+        uint64 Capacity = lluna_Container_DynamicArray_Capacity(Array);
+        if (Capacity < Count)
+        {
+                lluna_Container_DynamicArray_Resize(Array, Capacity * 2 > Count ? Capacity * 2 : Count);
+        }
+}
+
+static void ReleaseLayout(struct lluna_Container_FlatMap* Handle)
+{
+        free(Handle->Layout);
+        free(Handle->LayoutIndices);
+        Handle->Layout = NULL;
+        Handle->LayoutIndices = NULL;
+}
+
+// Called before changing the keys, which the layout would no longer match. Lookups fall back to binary search until
+// the map is frozen again.
+static void Thaw(struct lluna_Container_FlatMap* Handle)
+{
+        ReleaseLayout(Handle);
+        Handle->Frozen = false;
+}
+
+// Fills the implicit tree in order, so an in-order walk of the layout visits the sorted keys.
+static void BuildLayout(struct lluna_Container_FlatMap* Handle, uint64 Node, uint64 Count, uint64* Next)
+{
+        if (Node > Count)
+        {
+                return;
+        }
+
+        BuildLayout(Handle, 2 * Node, Count, Next);
+        Handle->Layout[Node] = Keys(Handle)[*Next];
+        Handle->LayoutIndices[Node] = *Next;
+        ++*Next;
+        BuildLayout(Handle, 2 * Node + 1, Count, Next);
+}
+
+struct lluna_Container_FlatMap* lluna_Container_FlatMap_Create(uint64 InitialCount, uint32 ValueSize)
+{
+        uint64 Capacity = InitialCount > 0 ? InitialCount : 1;
+
+        struct lluna_Container_FlatMap* Handle = malloc(sizeof(struct lluna_Container_FlatMap));
+        Handle->Keys = lluna_Container_DynamicArray_Create(Capacity, sizeof(uint64));
+        Handle->Values = ValueSize > 0 ? lluna_Container_DynamicArray_Create(Capacity, ValueSize) : NULL;
+        Handle->Staged = lluna_Container_DynamicArray_Create(1, sizeof(uint64) + ValueSize);
+        Handle->Layout = NULL;
+        Handle->LayoutIndices = NULL;
+        Handle->ValueSize = ValueSize;
+        Handle->Frozen = false;
+
+        return Handle;
+}
+
+void lluna_Container_FlatMap_Destroy(struct lluna_Container_FlatMap* Handle)
+{
+        ReleaseLayout(Handle);
+
+        lluna_Container_DynamicArray_Destroy(Handle->Staged);
+        if (Handle->Values)
+        {
+                lluna_Container_DynamicArray_Destroy(Handle->Values);
+        }
+        lluna_Container_DynamicArray_Destroy(Handle->Keys);
+        free(Handle);
+}
+
+uint64 lluna_Container_FlatMap_Count(struct lluna_Container_FlatMap* Handle)
+{
+        return lluna_Container_DynamicArray_Count(Handle->Keys);
+}
+
+uint64 lluna_Container_FlatMap_KeyAt(struct lluna_Container_FlatMap* Handle, uint64 Index)
+{
+        return Keys(Handle)[Index];
+}
+
+byte* lluna_Container_FlatMap_ValueAt(struct lluna_Container_FlatMap* Handle, uint64 Index)
+{
+        return Handle->Values ? lluna_Container_DynamicArray_Get(Handle->Values, Index) : NULL;
+}
+
+uint64 lluna_Container_FlatMap_LowerBound(struct lluna_Container_FlatMap* Handle, uint64 Key)
+{
+        uint64 Count = lluna_Container_FlatMap_Count(Handle);
+        if (Count == 0)
+        {
+                return 0;
+        }
+
+        // Halves the range without branching on the comparison, which compiles to a conditional move.
+        const uint64* Base = Keys(Handle);
+        while (Count > 1)
+        {
+                uint64 Half = Count / 2;
+                Base = Base[Half] < Key ? Base + Half : Base;
+                Count -= Half;
+        }
+
+        return (uint64)(Base - Keys(Handle)) + (*Base < Key);
+}
+
+uint64 lluna_Container_FlatMap_IndexOf(struct lluna_Container_FlatMap* Handle, uint64 Key)
+{
+        uint64 Count = lluna_Container_FlatMap_Count(Handle);
+
+        if (Handle->Layout)
+        {
+                uint64 Node = 1;
+                while (Node <= Count)
+                {
+                        __builtin_prefetch(Handle->Layout + Node * PrefetchDistance);
+                        Node = 2 * Node + (Handle->Layout[Node] < Key);
+                }
+
+                // Undoes the right turns taken after the last left turn, which landed on the lower bound.
+                Node >>= __builtin_ctzll(~Node) + 1;
+
+                return Node != 0 && Handle->Layout[Node] == Key ? Handle->LayoutIndices[Node] : Count;
+        }
+
+        uint64 Index = lluna_Container_FlatMap_LowerBound(Handle, Key);
+
+        return Index < Count && Keys(Handle)[Index] == Key ? Index : Count;
+}
+
+boolean lluna_Container_FlatMap_Contains(struct lluna_Container_FlatMap* Handle, uint64 Key)
+{
+        return lluna_Container_FlatMap_IndexOf(Handle, Key) < lluna_Container_FlatMap_Count(Handle);
+}
+
+byte* lluna_Container_FlatMap_Find(struct lluna_Container_FlatMap* Handle, uint64 Key)
+{
+        uint64 Index = lluna_Container_FlatMap_IndexOf(Handle, Key);
+
+        return Index < lluna_Container_FlatMap_Count(Handle) ? lluna_Container_FlatMap_ValueAt(Handle, Index) : NULL;
+}
+
+void lluna_Container_FlatMap_Insert(struct lluna_Container_FlatMap* Handle, uint64 Key, const byte* Value)
+{
+        uint64 Index = lluna_Container_FlatMap_LowerBound(Handle, Key);
+
+        if (Index < lluna_Container_FlatMap_Count(Handle) && Keys(Handle)[Index] == Key)
+        {
+                if (Handle->Values)
+                {
+                        memcpy(lluna_Container_DynamicArray_Get(Handle->Values, Index), Value, Handle->ValueSize);
+                }
+                return;
+        }
+
+        Thaw(Handle);
+        lluna_Container_DynamicArray_Insert(Handle->Keys, (byte*)&Key, Index);
+        if (Handle->Values)
+        {
+                lluna_Container_DynamicArray_Insert(Handle->Values, (byte*)Value, Index);
+        }
+}
+
+boolean lluna_Container_FlatMap_Remove(struct lluna_Container_FlatMap* Handle, uint64 Key)
+{
+        uint64 Index = lluna_Container_FlatMap_IndexOf(Handle, Key);
+        if (Index == lluna_Container_FlatMap_Count(Handle))
+        {
+                return false;
+        }
+
+        Thaw(Handle);
+        lluna_Container_DynamicArray_RemoveStable(Handle->Keys, Index);
+        if (Handle->Values)
+        {
+                lluna_Container_DynamicArray_RemoveStable(Handle->Values, Index);
+        }
+
+        return true;
+}
+
+void lluna_Container_FlatMap_Stage(struct lluna_Container_FlatMap* Handle, uint64 Key, const byte* Value)
+{
+        Thaw(Handle);
+
+        uint64 Count = lluna_Container_DynamicArray_Count(Handle->Staged);
+        Reserve(Handle->Staged, Count + 1);
+
+        byte* Entry = Handle->Staged->Data + Count * Handle->Staged->ElementSize;
+        memcpy(Entry, &Key, sizeof(uint64));
+        if (Handle->ValueSize > 0)
+        {
+                memcpy(Entry + sizeof(uint64), Value, Handle->ValueSize);
+        }
+        Handle->Staged->Offset += Handle->Staged->ElementSize;
+}
+
+void lluna_Container_FlatMap_Commit(struct lluna_Container_FlatMap* Handle)
+{
+        struct lluna_Container_DynamicArray* Staged = Handle->Staged;
+        uint64 StagedCount = lluna_Container_DynamicArray_Count(Staged);
+        if (StagedCount == 0)
+        {
+                return;
+        }
+
+        Thaw(Handle);
+
+        uint32 EntrySize = Staged->ElementSize;
+        uint32 ValueSize = Handle->ValueSize;
+
+        // The radix sort is stable, so the last staging of each key ends its run of equal keys.
+        lluna_Container_Sort_RadixKey64(Staged, 0, NULL);
+
+        uint64 UniqueCount = 0;
+        for (uint64 Index = 0; Index < StagedCount; ++Index)
+        {
+                byte* Entry = Staged->Data + Index * EntrySize;
+                if (Index + 1 < StagedCount && memcmp(Entry, Entry + EntrySize, sizeof(uint64)) == 0)
+                {
+                        continue;
+                }
+                memmove(Staged->Data + UniqueCount++ * EntrySize, Entry, EntrySize);
+        }
+
+        // Counts keys that only replace a value, to know where the merged entries end.
+        uint64 ExistingCount = lluna_Container_FlatMap_Count(Handle);
+        uint64 Replaced = 0;
+        for (uint64 Existing = 0, Incoming = 0; Existing < ExistingCount && Incoming < UniqueCount;)
+        {
+                uint64 ExistingKey = Keys(Handle)[Existing];
+                uint64 IncomingKey;
+                memcpy(&IncomingKey, Staged->Data + Incoming * EntrySize, sizeof(uint64));
+
+                Replaced += ExistingKey == IncomingKey;
+                Existing += ExistingKey <= IncomingKey;
+                Incoming += IncomingKey <= ExistingKey;
+        }
+
+        uint64 MergedCount = ExistingCount + UniqueCount - Replaced;
+        Reserve(Handle->Keys, MergedCount);
+        if (Handle->Values)
+        {
+                Reserve(Handle->Values, MergedCount);
+        }
+
+        // Merges from the back, so existing entries are moved at most once and never overwritten before being read.
+        uint64* MergedKeys = Keys(Handle);
+        byte* MergedValues = Handle->Values ? Handle->Values->Data : NULL;
+        uint64 Existing = ExistingCount;
+        uint64 Incoming = UniqueCount;
+        uint64 Output = MergedCount;
+        while (Incoming > 0)
+        {
+                const byte* Entry = Staged->Data + (Incoming - 1) * EntrySize;
+                uint64 IncomingKey;
+                memcpy(&IncomingKey, Entry, sizeof(uint64));
+
+                --Output;
+                if (Existing > 0 && MergedKeys[Existing - 1] > IncomingKey)
+                {
+                        --Existing;
+                        MergedKeys[Output] = MergedKeys[Existing];
+                        if (MergedValues)
+                        {
+                                memmove(MergedValues + Output * ValueSize, MergedValues + Existing * ValueSize, ValueSize);
+                        }
+                        continue;
+                }
+
+                if (Existing > 0 && MergedKeys[Existing - 1] == IncomingKey)
+                {
+                        --Existing;
+                }
+                MergedKeys[Output] = IncomingKey;
+                if (MergedValues)
+                {
+                        memcpy(MergedValues + Output * ValueSize, Entry + sizeof(uint64), ValueSize);
+                }
+                --Incoming;
+        }
+
+        Handle->Keys->Offset = MergedCount * sizeof(uint64);
+        if (Handle->Values)
+        {
+                Handle->Values->Offset = MergedCount * ValueSize;
+        }
+
+        lluna_Container_DynamicArray_Clear(Staged);
+}
+
+void lluna_Container_FlatMap_Freeze(struct lluna_Container_FlatMap* Handle, boolean Eytzinger)
+{
+        lluna_Container_FlatMap_Commit(Handle);
+
+        uint64 Count = lluna_Container_FlatMap_Count(Handle);
+        if (Count > 0)
+        {
+                lluna_Container_DynamicArray_Shrink(Handle->Keys);
+                if (Handle->Values)
+                {
+                        lluna_Container_DynamicArray_Shrink(Handle->Values);
+                }
+        }
+
+        // Cache line aligned, so each prefetch brings in whole nodes. Lookups fall back to binary search without it.
+        ReleaseLayout(Handle);
+        void* Layout;
+        if (Eytzinger && posix_memalign(&Layout, 64, (Count + 1) * sizeof(uint64)) == 0)
+        {
+                Handle->Layout = Layout;
+                Handle->LayoutIndices = malloc((Count + 1) * sizeof(uint64));
+                if (Handle->LayoutIndices)
+                {
+                        uint64 Next = 0;
+                        BuildLayout(Handle, 1, Count, &Next);
+                }
+                else
+                {
+                        ReleaseLayout(Handle);
+                }
+        }
+
+        Handle->Frozen = true;
+}
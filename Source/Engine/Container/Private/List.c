@@ -0,0 +1,131 @@
+#include <Engine/Container/Public/List.h>
+
+#include <stddef.h>
+
+void lluna_Container_List_Initialize(struct lluna_Container_List* Handle)
+{
+        Handle->Sentinel.Next = &Handle->Sentinel;
+        Handle->Sentinel.Previous = &Handle->Sentinel;
+}
+
+boolean lluna_Container_List_Empty(struct lluna_Container_List* Handle)
+{
+        return Handle->Sentinel.Next == &Handle->Sentinel;
+}
+
+uint64 lluna_Container_List_Count(struct lluna_Container_List* Handle)
+{
+        uint64 Count = 0;
+        struct lluna_Container_List_Node* Node;
+        lluna_Container_List_ForEach(Handle, Node)
+        {
+                ++Count;
+        }
+
+        return Count;
+}
+
+struct lluna_Container_List_Node* lluna_Container_List_First(struct lluna_Container_List* Handle)
+{
+        return lluna_Container_List_Next(Handle, &Handle->Sentinel);
+}
+
+struct lluna_Container_List_Node* lluna_Container_List_Last(struct lluna_Container_List* Handle)
+{
+        return lluna_Container_List_Previous(Handle, &Handle->Sentinel);
+}
+
+struct lluna_Container_List_Node* lluna_Container_List_Next(struct lluna_Container_List* Handle, struct lluna_Container_List_Node* Node)
+{
+        return Node->Next != &Handle->Sentinel ? Node->Next : NULL;
+}
+
+struct lluna_Container_List_Node* lluna_Container_List_Previous(struct lluna_Container_List* Handle, struct lluna_Container_List_Node* Node)
+{
+        return Node->Previous != &Handle->Sentinel ? Node->Previous : NULL;
+}
+
+void lluna_Container_List_InsertBefore(struct lluna_Container_List_Node* Position, struct lluna_Container_List_Node* Node)
+{
+        Node->Next = Position;
+        Node->Previous = Position->Previous;
+        Position->Previous->Next = Node;
+        Position->Previous = Node;
+}
+
+void lluna_Container_List_InsertAfter(struct lluna_Container_List_Node* Position, struct lluna_Container_List_Node* Node)
+{
+        lluna_Container_List_InsertBefore(Position->Next, Node);
+}
+
+void lluna_Container_List_PushFront(struct lluna_Container_List* Handle, struct lluna_Container_List_Node* Node)
+{
+        lluna_Container_List_InsertAfter(&Handle->Sentinel, Node);
+}
+
+void lluna_Container_List_PushBack(struct lluna_Container_List* Handle, struct lluna_Container_List_Node* Node)
+{
+        lluna_Container_List_InsertBefore(&Handle->Sentinel, Node);
+}
+
+void lluna_Container_List_Remove(struct lluna_Container_List_Node* Node)
+{
+        Node->Previous->Next = Node->Next;
+        Node->Next->Previous = Node->Previous;
+        Node->Next = NULL;
+        Node->Previous = NULL;
+}
+
+struct lluna_Container_List_Node* lluna_Container_List_PopFront(struct lluna_Container_List* Handle)
+{
+        struct lluna_Container_List_Node* Node = lluna_Container_List_First(Handle);
+        if (Node)
+        {
+                lluna_Container_List_Remove(Node);
+        }
+
+        return Node;
+}
+
+struct lluna_Container_List_Node* lluna_Container_List_PopBack(struct lluna_Container_List* Handle)
+{
+        struct lluna_Container_List_Node* Node = lluna_Container_List_Last(Handle);
+        if (Node)
+        {
+                lluna_Container_List_Remove(Node);
+        }
+
+        return Node;
+}
+
+void lluna_Container_List_MoveToFront(struct lluna_Container_List* Handle, struct lluna_Container_List_Node* Node)
+{
+        lluna_Container_List_Splice(Handle->Sentinel.Next, Node, Node);
+}
+
+void lluna_Container_List_Splice(struct lluna_Container_List_Node* Position, struct lluna_Container_List_Node* First, struct lluna_Container_List_Node* Last)
+{
+        if (Position == First || Position == Last->Next)
+        {
+                return;
+        }
+
+        // Closes the gap left by the range.
+        First->Previous->Next = Last->Next;
+        Last->Next->Previous = First->Previous;
+
+        First->Previous = Position->Previous;
+        Last->Next = Position;
+        Position->Previous->Next = First;
+        Position->Previous = Last;
+}
+
+void lluna_Container_List_Concatenate(struct lluna_Container_List* Destination, struct lluna_Container_List* Source)
+{
+        if (lluna_Container_List_Empty(Source))
+        {
+                return;
+        }
+
+        lluna_Container_List_Splice(&Destination->Sentinel, Source->Sentinel.Next, Source->Sentinel.Previous);
+}
@@ -0,0 +1,178 @@
+#include <Engine/Container/Public/LruCache.h>
+
+#include <stdlib.h>
+
+#define InitialBucketCount 16
+
+static struct lluna_Container_LruCache_Entry* EntryOf(struct lluna_Container_List_Node* Node)
+{
+        return lluna_Macros_ContainerOf(Node, struct lluna_Container_LruCache_Entry, Node);
+}
+
+// Fibonacci hashing, so keys that only differ in their high bits still spread over the buckets.
+static struct lluna_Container_LruCache_Entry** Bucket(struct lluna_Container_LruCache* Handle, uint64 Key)
+{
+        return &Handle->Buckets[(Key * 0x9E3779B97F4A7C15ULL) >> (64 - __builtin_ctzll(Handle->BucketCount))];
+}
+
+static void Grow(struct lluna_Container_LruCache* Handle)
+{
+        struct lluna_Container_LruCache_Entry** OldBuckets = Handle->Buckets;
+        uint64 OldCount = Handle->BucketCount;
+
+        Handle->BucketCount = OldCount * 2;
+        Handle->Buckets = calloc(Handle->BucketCount, sizeof(struct lluna_Container_LruCache_Entry*));
+
+        for (uint64 Index = 0; Index < OldCount; ++Index)
+        {
+                struct lluna_Container_LruCache_Entry* Entry = OldBuckets[Index];
+                while (Entry)
+                {
+                        struct lluna_Container_LruCache_Entry* Next = Entry->NextInBucket;
+                        struct lluna_Container_LruCache_Entry** Chain = Bucket(Handle, Entry->Key);
+                        Entry->NextInBucket = *Chain;
+                        *Chain = Entry;
+                        Entry = Next;
+                }
+        }
+
+        free(OldBuckets);
+}
+
+static void Unlink(struct lluna_Container_LruCache* Handle, struct lluna_Container_LruCache_Entry* Entry)
+{
+        struct lluna_Container_LruCache_Entry** Link = Bucket(Handle, Entry->Key);
+        while (*Link != Entry)
+        {
+                Link = &(*Link)->NextInBucket;
+        }
+        *Link = Entry->NextInBucket;
+        Entry->NextInBucket = NULL;
+
+        lluna_Container_List_Remove(&Entry->Node);
+        --Handle->Count;
+        Handle->Size -= Entry->Size;
+}
+
+static void Evict(struct lluna_Container_LruCache* Handle, struct lluna_Container_LruCache_Entry* Entry)
+{
+        Unlink(Handle, Entry);
+        if (Handle->Evict)
+        {
+                Handle->Evict(Handle->Context, Entry);
+        }
+}
+
+static void Trim(struct lluna_Container_LruCache* Handle)
+{
+        while (Handle->Size > Handle->Budget)
+        {
+                Evict(Handle, EntryOf(Handle->Entries.Sentinel.Previous));
+        }
+}
+
+struct lluna_Container_LruCache* lluna_Container_LruCache_Create(uint64 Budget, lluna_Container_LruCache_EvictFunction Evict, void* Context)
+{
+        struct lluna_Container_LruCache* Handle = malloc(sizeof(struct lluna_Container_LruCache));
+        lluna_Container_List_Initialize(&Handle->Entries);
+        Handle->Buckets = calloc(InitialBucketCount, sizeof(struct lluna_Container_LruCache_Entry*));
+        Handle->BucketCount = InitialBucketCount;
+        Handle->Count = 0;
+        Handle->Size = 0;
+        Handle->Budget = Budget;
+        Handle->Evict = Evict;
+        Handle->Context = Context;
+
+        return Handle;
+}
+
+void lluna_Container_LruCache_Destroy(struct lluna_Container_LruCache* Handle)
+{
+        lluna_Container_LruCache_Clear(Handle);
+
+        free(Handle->Buckets);
+        free(Handle);
+}
+
+uint64 lluna_Container_LruCache_Count(struct lluna_Container_LruCache* Handle)
+{
+        return Handle->Count;
+}
+
+uint64 lluna_Container_LruCache_Size(struct lluna_Container_LruCache* Handle)
+{
+        return Handle->Size;
+}
+
+struct lluna_Container_LruCache_Entry* lluna_Container_LruCache_Find(struct lluna_Container_LruCache* Handle, uint64 Key)
+{
+        struct lluna_Container_LruCache_Entry* Entry = lluna_Container_LruCache_Peek(Handle, Key);
+        if (Entry)
+        {
+                lluna_Container_LruCache_Touch(Handle, Entry);
+        }
+
+        return Entry;
+}
+
+struct lluna_Container_LruCache_Entry* lluna_Container_LruCache_Peek(struct lluna_Container_LruCache* Handle, uint64 Key)
+{
+        struct lluna_Container_LruCache_Entry* Entry = *Bucket(Handle, Key);
+        while (Entry && Entry->Key != Key)
+        {
+                Entry = Entry->NextInBucket;
+        }
+
+        return Entry;
+}
+
+void lluna_Container_LruCache_Touch(struct lluna_Container_LruCache* Handle, struct lluna_Container_LruCache_Entry* Entry)
+{
+        lluna_Container_List_MoveToFront(&Handle->Entries, &Entry->Node);
+}
+
+void lluna_Container_LruCache_Insert(struct lluna_Container_LruCache* Handle, struct lluna_Container_LruCache_Entry* Entry, uint64 Key, uint64 Size)
+{
+        struct lluna_Container_LruCache_Entry* Existing = lluna_Container_LruCache_Peek(Handle, Key);
+        if (Existing)
+        {
+                Evict(Handle, Existing);
+        }
+
+        // Keeps chains about one entry long on average.
+        if (Handle->Count >= Handle->BucketCount)
+        {
+                Grow(Handle);
+        }
+
+        struct lluna_Container_LruCache_Entry** Chain = Bucket(Handle, Key);
+        Entry->Key = Key;
+        Entry->Size = Size;
+        Entry->NextInBucket = *Chain;
+        *Chain = Entry;
+
+        lluna_Container_List_PushFront(&Handle->Entries, &Entry->Node);
+        ++Handle->Count;
+        Handle->Size += Size;
+
+        Trim(Handle);
+}
+
+void lluna_Container_LruCache_Remove(struct lluna_Container_LruCache* Handle, struct lluna_Container_LruCache_Entry* Entry)
+{
+        Unlink(Handle, Entry);
+}
+
+void lluna_Container_LruCache_SetBudget(struct lluna_Container_LruCache* Handle, uint64 Budget)
+{
+        Handle->Budget = Budget;
+        Trim(Handle);
+}
+
+void lluna_Container_LruCache_Clear(struct lluna_Container_LruCache* Handle)
+{
+        while (!lluna_Container_List_Empty(&Handle->Entries))
+        {
+                Evict(Handle, EntryOf(Handle->Entries.Sentinel.Previous));
+        }
+}
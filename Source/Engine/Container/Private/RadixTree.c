@@ -0,0 +1,826 @@
+#include <Engine/Container/Public/RadixTree.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define MaximumPrefixSize 8
+
+enum NodeType
+{
+        Node4Type,
+        Node16Type,
+        Node48Type,
+        Node256Type
+};
+
+struct Leaf
+{
+        void* Value;
+        uint64 Size;
+        byte Key[];
+};
+
+struct Node
+{
+        uint8 Type;
+        uint16 ChildCount;
+        uint32 PrefixSize;
+        byte Prefix[MaximumPrefixSize];
+
+        // Leaf of the key ending right after the prefix, if any.
+        struct Leaf* Terminal;
+};
+
+struct Node4
+{
+        struct Node Header;
+        byte Keys[4];
+        void* Children[4];
+};
+
+struct Node16
+{
+        struct Node Header;
+        byte Keys[16];
+        void* Children[16];
+};
+
+struct Node48
+{
+        struct Node Header;
+        byte Index[256];
+        void* Children[48];
+};
+
+struct Node256
+{
+        struct Node Header;
+        void* Children[256];
+};
+
+static const uint64 NodeSizes[] = { sizeof(struct Node4), sizeof(struct Node16), sizeof(struct Node48), sizeof(struct Node256) };
+
+// Children are either nodes or leaves, told apart by the lowest bit of the pointer.
+static boolean IsLeaf(const void* Pointer)
+{
+        return (uintptr_t)Pointer & 1;
+}
+
+static struct Leaf* AsLeaf(const void* Pointer)
+{
+        return (struct Leaf*)((uintptr_t)Pointer & ~(uintptr_t)1);
+}
+
+static void* TagLeaf(struct Leaf* Leaf)
+{
+        return (void*)((uintptr_t)Leaf | 1);
+}
+
+static uint64 Minimum(uint64 Left, uint64 Right)
+{
+        return Left < Right ? Left : Right;
+}
+
+static struct Leaf* CreateLeaf(const byte* Key, uint64 Size, void* Value)
+{
+        struct Leaf* Leaf = malloc(sizeof(struct Leaf) + Size);
+        Leaf->Value = Value;
+        Leaf->Size = Size;
+        memcpy(Leaf->Key, Key, Size);
+
+        return Leaf;
+}
+
+static boolean LeafMatches(const struct Leaf* Leaf, const byte* Key, uint64 Size)
+{
+        return Leaf->Size == Size && memcmp(Leaf->Key, Key, Size) == 0;
+}
+
+static boolean LeafStartsWith(const struct Leaf* Leaf, const byte* Prefix, uint64 Size)
+{
+        return Leaf->Size >= Size && memcmp(Leaf->Key, Prefix, Size) == 0;
+}
+
+static boolean LeafIsPrefixOf(const struct Leaf* Leaf, const byte* Text, uint64 Size)
+{
+        return Leaf->Size <= Size && memcmp(Leaf->Key, Text, Leaf->Size) == 0;
+}
+
+static struct Node* CreateNode(uint8 Type)
+{
+        struct Node* Node = calloc(1, NodeSizes[Type]);
+        Node->Type = Type;
+
+        return Node;
+}
+
+static void SetPrefix(struct Node* Node, const byte* Prefix, uint64 Size)
+{
+        Node->PrefixSize = (uint32)Size;
+        memcpy(Node->Prefix, Prefix, Minimum(Size, MaximumPrefixSize));
+}
+
+static byte* SortedKeys(struct Node* Node)
+{
+        return Node->Type == Node4Type ? ((struct Node4*)Node)->Keys : ((struct Node16*)Node)->Keys;
+}
+
+static void** SortedChildren(struct Node* Node)
+{
+        return Node->Type == Node4Type ? ((struct Node4*)Node)->Children : ((struct Node16*)Node)->Children;
+}
+
+static void** FindChild(struct Node* Node, byte Key)
+{
+        switch (Node->Type)
+        {
+        case Node4Type:
+        {
+                struct Node4* Four = (struct Node4*)Node;
+                for (uint32 Index = 0; Index < Node->ChildCount; ++Index)
+                {
+                        if (Four->Keys[Index] == Key)
+                        {
+                                return &Four->Children[Index];
+                        }
+                }
+                return NULL;
+        }
+        case Node16Type:
+        {
+                struct Node16* Sixteen = (struct Node16*)Node;
+#if defined(__SSE2__)
+                // Compares the key against all 16 keys at once, masking out the unused ones.
+                __m128i Matches = _mm_cmpeq_epi8(_mm_set1_epi8((char)Key), _mm_loadu_si128((const __m128i*)Sixteen->Keys));
+                uint32 Mask = (uint32)_mm_movemask_epi8(Matches) & ((1u << Node->ChildCount) - 1);
+                return Mask ? &Sixteen->Children[__builtin_ctz(Mask)] : NULL;
+#else
+                for (uint32 Index = 0; Index < Node->ChildCount; ++Index)
+                {
+                        if (Sixteen->Keys[Index] == Key)
+                        {
+                                return &Sixteen->Children[Index];
+                        }
+                }
+                return NULL;
+#endif
+        }
+        case Node48Type:
+        {
+                struct Node48* FortyEight = (struct Node48*)Node;
+                return FortyEight->Index[Key] ? &FortyEight->Children[FortyEight->Index[Key] - 1] : NULL;
+        }
+        default:
+        {
+                struct Node256* Full = (struct Node256*)Node;
+                return Full->Children[Key] ? &Full->Children[Key] : NULL;
+        }
+        }
+}
+
+// Returns the next child in key order after the cursor, or NULL after the last one.
+static void* NextChild(struct Node* Node, uint32* Cursor, byte* Key)
+{
+        switch (Node->Type)
+        {
+        case Node4Type:
+        case Node16Type:
+        {
+                if (*Cursor >= Node->ChildCount)
+                {
+                        return NULL;
+                }
+                *Key = SortedKeys(Node)[*Cursor];
+                return SortedChildren(Node)[(*Cursor)++];
+        }
+        case Node48Type:
+        {
+                struct Node48* FortyEight = (struct Node48*)Node;
+                for (; *Cursor < 256; ++*Cursor)
+                {
+                        if (FortyEight->Index[*Cursor])
+                        {
+                                *Key = (byte)*Cursor;
+                                return FortyEight->Children[FortyEight->Index[(*Cursor)++] - 1];
+                        }
+                }
+                return NULL;
+        }
+        default:
+        {
+                struct Node256* Full = (struct Node256*)Node;
+                for (; *Cursor < 256; ++*Cursor)
+                {
+                        if (Full->Children[*Cursor])
+                        {
+                                *Key = (byte)*Cursor;
+                                return Full->Children[(*Cursor)++];
+                        }
+                }
+                return NULL;
+        }
+        }
+}
+
+static void AddChild(void** Reference, struct Node* Node, byte Key, void* Child);
+
+// Moves the children to a node of another type, replacing the node.
+static struct Node* Resize(void** Reference, struct Node* Node, uint8 Type)
+{
+        struct Node* Resized = CreateNode(Type);
+        memcpy(Resized, Node, sizeof(struct Node));
+        Resized->Type = Type;
+        Resized->ChildCount = 0;
+
+        uint32 Cursor = 0;
+        byte Key;
+        void* Child;
+        while ((Child = NextChild(Node, &Cursor, &Key)))
+        {
+                AddChild(Reference, Resized, Key, Child);
+        }
+
+        free(Node);
+        *Reference = Resized;
+
+        return Resized;
+}
+
+static void AddChild(void** Reference, struct Node* Node, byte Key, void* Child)
+{
+        switch (Node->Type)
+        {
+        case Node4Type:
+        case Node16Type:
+        {
+                if (Node->ChildCount == (Node->Type == Node4Type ? 4 : 16))
+                {
+                        AddChild(Reference, Resize(Reference, Node, Node->Type + 1), Key, Child);
+                        return;
+                }
+
+                byte* Keys = SortedKeys(Node);
+                void** Children = SortedChildren(Node);
+                uint32 Position = 0;
+                while (Position < Node->ChildCount && Keys[Position] < Key)
+                {
+                        ++Position;
+                }
+                memmove(Keys + Position + 1, Keys + Position, Node->ChildCount - Position);
+                memmove(Children + Position + 1, Children + Position, (Node->ChildCount - Position) * sizeof(void*));
+                Keys[Position] = Key;
+                Children[Position] = Child;
+                break;
+        }
+        case Node48Type:
+        {
+                if (Node->ChildCount == 48)
+                {
+                        AddChild(Reference, Resize(Reference, Node, Node256Type), Key, Child);
+                        return;
+                }
+
+                struct Node48* FortyEight = (struct Node48*)Node;
+                uint32 Slot = 0;
+                while (FortyEight->Children[Slot])
+                {
+                        ++Slot;
+                }
+                FortyEight->Children[Slot] = Child;
+                FortyEight->Index[Key] = (byte)(Slot + 1);
+                break;
+        }
+        default:
+                ((struct Node256*)Node)->Children[Key] = Child;
+                break;
+        }
+
+        ++Node->ChildCount;
+}
+
+static void RemoveChild(struct Node* Node, byte Key, void** Slot)
+{
+        switch (Node->Type)
+        {
+        case Node4Type:
+        case Node16Type:
+        {
+                byte* Keys = SortedKeys(Node);
+                void** Children = SortedChildren(Node);
+                uint32 Position = (uint32)(Slot - Children);
+                memmove(Keys + Position, Keys + Position + 1, Node->ChildCount - Position - 1);
+                memmove(Children + Position, Children + Position + 1, (Node->ChildCount - Position - 1) * sizeof(void*));
+                break;
+        }
+        case Node48Type:
+                *Slot = NULL;
+                ((struct Node48*)Node)->Index[Key] = 0;
+                break;
+        default:
+                *Slot = NULL;
+                break;
+        }
+
+        --Node->ChildCount;
+}
+
+// Adds a leaf below a node whose prefix ends at the given depth.
+static void AddLeaf(void** Reference, struct Node* Node, struct Leaf* Leaf, uint64 Depth)
+{
+        if (Leaf->Size == Depth)
+        {
+                Node->Terminal = Leaf;
+        }
+        else
+        {
+                AddChild(Reference, Node, Leaf->Key[Depth], TagLeaf(Leaf));
+        }
+}
+
+static struct Leaf* FirstLeaf(void* Pointer)
+{
+        while (!IsLeaf(Pointer))
+        {
+                struct Node* Node = Pointer;
+                if (Node->Terminal)
+                {
+                        return Node->Terminal;
+                }
+
+                uint32 Cursor = 0;
+                byte Key;
+                Pointer = NextChild(Node, &Cursor, &Key);
+        }
+
+        return AsLeaf(Pointer);
+}
+
+// Only checks the stored start of the prefix, leaves are compared in full once reached.
+static boolean PrefixMatches(struct Node* Node, const byte* Key, uint64 Size, uint64 Depth)
+{
+        return Node->PrefixSize <= Size - Depth && memcmp(Node->Prefix, Key + Depth, Minimum(Node->PrefixSize, MaximumPrefixSize)) == 0;
+}
+
+// Returns the number of prefix bytes matching the key, stopping at the end of the key.
+static uint64 PrefixMismatch(struct Node* Node, const byte* Key, uint64 Size, uint64 Depth)
+{
+        uint64 Limit = Minimum(Node->PrefixSize, Size - Depth);
+        uint64 Index = 0;
+        for (; Index < Minimum(Limit, MaximumPrefixSize); ++Index)
+        {
+                if (Node->Prefix[Index] != Key[Depth + Index])
+                {
+                        return Index;
+                }
+        }
+
+        // Only the start of long prefixes is stored, but every leaf below the node has the whole prefix.
+        if (Limit > MaximumPrefixSize)
+        {
+                const struct Leaf* Leaf = FirstLeaf(Node);
+                for (; Index < Limit; ++Index)
+                {
+                        if (Leaf->Key[Depth + Index] != Key[Depth + Index])
+                        {
+                                return Index;
+                        }
+                }
+        }
+
+        return Index;
+}
+
+static void* Insert(struct lluna_Container_RadixTree* Handle, void** Reference, const byte* Key, uint64 Size, uint64 Depth, void* Value)
+{
+        if (!*Reference)
+        {
+                *Reference = TagLeaf(CreateLeaf(Key, Size, Value));
+                ++Handle->Count;
+                return NULL;
+        }
+
+        if (IsLeaf(*Reference))
+        {
+                struct Leaf* Existing = AsLeaf(*Reference);
+                if (LeafMatches(Existing, Key, Size))
+                {
+                        void* Previous = Existing->Value;
+                        Existing->Value = Value;
+                        return Previous;
+                }
+
+                // Replaces the leaf with a node branching where both keys differ.
+                uint64 Limit = Minimum(Existing->Size, Size);
+                uint64 Common = Depth;
+                while (Common < Limit && Existing->Key[Common] == Key[Common])
+                {
+                        ++Common;
+                }
+
+                struct Node* Node = CreateNode(Node4Type);
+                SetPrefix(Node, Key + Depth, Common - Depth);
+                *Reference = Node;
+                AddLeaf(Reference, Node, Existing, Common);
+                AddLeaf(Reference, Node, CreateLeaf(Key, Size, Value), Common);
+                ++Handle->Count;
+                return NULL;
+        }
+
+        struct Node* Node = *Reference;
+        if (Node->PrefixSize)
+        {
+                uint64 Matched = PrefixMismatch(Node, Key, Size, Depth);
+                if (Matched < Node->PrefixSize)
+                {
+                        // Splits the prefix where the key leaves it.
+                        struct Node* Parent = CreateNode(Node4Type);
+                        SetPrefix(Parent, Key + Depth, Matched);
+
+                        byte Branch;
+                        if (Node->PrefixSize <= MaximumPrefixSize)
+                        {
+                                Branch = Node->Prefix[Matched];
+                                Node->PrefixSize -= (uint32)Matched + 1;
+                                memmove(Node->Prefix, Node->Prefix + Matched + 1, Node->PrefixSize);
+                        }
+                        else
+                        {
+                                const struct Leaf* Leaf = FirstLeaf(Node);
+                                Branch = Leaf->Key[Depth + Matched];
+                                Node->PrefixSize -= (uint32)Matched + 1;
+                                memcpy(Node->Prefix, Leaf->Key + Depth + Matched + 1, Minimum(Node->PrefixSize, MaximumPrefixSize));
+                        }
+
+                        *Reference = Parent;
+                        AddChild(Reference, Parent, Branch, Node);
+                        AddLeaf(Reference, Parent, CreateLeaf(Key, Size, Value), Depth + Matched);
+                        ++Handle->Count;
+                        return NULL;
+                }
+
+                Depth += Node->PrefixSize;
+        }
+
+        if (Depth == Size)
+        {
+                if (Node->Terminal)
+                {
+                        void* Previous = Node->Terminal->Value;
+                        Node->Terminal->Value = Value;
+                        return Previous;
+                }
+
+                Node->Terminal = CreateLeaf(Key, Size, Value);
+                ++Handle->Count;
+                return NULL;
+        }
+
+        void** Child = FindChild(Node, Key[Depth]);
+        if (Child)
+        {
+                return Insert(Handle, Child, Key, Size, Depth + 1, Value);
+        }
+
+        AddChild(Reference, Node, Key[Depth], TagLeaf(CreateLeaf(Key, Size, Value)));
+        ++Handle->Count;
+        return NULL;
+}
+
+// Collapses nodes left with a single entry and moves sparse nodes to smaller types.
+static void Shrink(void** Reference, struct Node* Node)
+{
+        if (Node->ChildCount == 0)
+        {
+                *Reference = Node->Terminal ? TagLeaf(Node->Terminal) : NULL;
+                free(Node);
+                return;
+        }
+
+        if (Node->ChildCount == 1 && !Node->Terminal)
+        {
+                uint32 Cursor = 0;
+                byte Branch;
+                void* Child = NextChild(Node, &Cursor, &Branch);
+                if (!IsLeaf(Child))
+                {
+                        // Puts the node's prefix and the branch byte in front of the child's prefix.
+                        struct Node* Inner = Child;
+                        byte Prefix[MaximumPrefixSize] = { 0 };
+                        uint64 Stored = Minimum(Node->PrefixSize, MaximumPrefixSize);
+                        memcpy(Prefix, Node->Prefix, Stored);
+                        if (Stored < MaximumPrefixSize)
+                        {
+                                Prefix[Stored++] = Branch;
+                                memcpy(Prefix + Stored, Inner->Prefix, Minimum(Inner->PrefixSize, MaximumPrefixSize - Stored));
+                        }
+                        memcpy(Inner->Prefix, Prefix, MaximumPrefixSize);
+                        Inner->PrefixSize += Node->PrefixSize + 1;
+                }
+
+                *Reference = Child;
+                free(Node);
+                return;
+        }
+
+        // Shrinks below the capacity of the smaller type, so alternating inserts and removes don't resize every time.
+        if (Node->Type == Node256Type && Node->ChildCount <= 37)
+        {
+                Resize(Reference, Node, Node48Type);
+        }
+        else if (Node->Type == Node48Type && Node->ChildCount <= 12)
+        {
+                Resize(Reference, Node, Node16Type);
+        }
+        else if (Node->Type == Node16Type && Node->ChildCount <= 3)
+        {
+                Resize(Reference, Node, Node4Type);
+        }
+}
+
+static struct Leaf* Remove(void** Reference, const byte* Key, uint64 Size, uint64 Depth)
+{
+        if (IsLeaf(*Reference))
+        {
+                struct Leaf* Leaf = AsLeaf(*Reference);
+                if (!LeafMatches(Leaf, Key, Size))
+                {
+                        return NULL;
+                }
+
+                *Reference = NULL;
+                return Leaf;
+        }
+
+        struct Node* Node = *Reference;
+        if (PrefixMismatch(Node, Key, Size, Depth) < Node->PrefixSize)
+        {
+                return NULL;
+        }
+        Depth += Node->PrefixSize;
+
+        struct Leaf* Removed;
+        if (Depth == Size)
+        {
+                Removed = Node->Terminal;
+                if (!Removed)
+                {
+                        return NULL;
+                }
+                Node->Terminal = NULL;
+        }
+        else
+        {
+                byte Branch = Key[Depth];
+                void** Child = FindChild(Node, Branch);
+                if (!Child || !(Removed = Remove(Child, Key, Size, Depth + 1)))
+                {
+                        return NULL;
+                }
+
+                if (!*Child)
+                {
+                        RemoveChild(Node, Branch, Child);
+                }
+        }
+
+        Shrink(Reference, Node);
+
+        return Removed;
+}
+
+static boolean VisitLeaf(struct Leaf* Leaf, lluna_Container_RadixTree_VisitFunction Visit, void* Context)
+{
+        return Visit(Context, (struct lluna_Core_Types_Text){ (const char*)Leaf->Key, Leaf->Size }, Leaf->Value);
+}
+
+// Shorter keys come first, so the terminal leaf is visited before the children.
+static boolean VisitAll(void* Pointer, lluna_Container_RadixTree_VisitFunction Visit, void* Context)
+{
+        if (IsLeaf(Pointer))
+        {
+                return VisitLeaf(AsLeaf(Pointer), Visit, Context);
+        }
+
+        struct Node* Node = Pointer;
+        if (Node->Terminal && !VisitLeaf(Node->Terminal, Visit, Context))
+        {
+                return false;
+        }
+
+        uint32 Cursor = 0;
+        byte Key;
+        void* Child;
+        while ((Child = NextChild(Node, &Cursor, &Key)))
+        {
+                if (!VisitAll(Child, Visit, Context))
+                {
+                        return false;
+                }
+        }
+
+        return true;
+}
+
+static void Free(void* Pointer)
+{
+        if (IsLeaf(Pointer))
+        {
+                free(AsLeaf(Pointer));
+                return;
+        }
+
+        struct Node* Node = Pointer;
+        uint32 Cursor = 0;
+        byte Key;
+        void* Child;
+        while ((Child = NextChild(Node, &Cursor, &Key)))
+        {
+                Free(Child);
+        }
+
+        free(Node->Terminal);
+        free(Node);
+}
+
+struct lluna_Container_RadixTree* lluna_Container_RadixTree_Create()
+{
+        struct lluna_Container_RadixTree* Handle = malloc(sizeof(struct lluna_Container_RadixTree));
+        Handle->Root = NULL;
+        Handle->Count = 0;
+
+        return Handle;
+}
+
+void lluna_Container_RadixTree_Destroy(struct lluna_Container_RadixTree* Handle)
+{
+        lluna_Container_RadixTree_Clear(Handle);
+        free(Handle);
+}
+
+uint64 lluna_Container_RadixTree_Count(struct lluna_Container_RadixTree* Handle)
+{
+        return Handle->Count;
+}
+
+void* lluna_Container_RadixTree_Find(struct lluna_Container_RadixTree* Handle, struct lluna_Core_Types_Text Key)
+{
+        const byte* Data = (const byte*)Key.Data;
+        uint64 Size = lluna_Macros_TextLength(Key);
+
+        void* Pointer = Handle->Root;
+        uint64 Depth = 0;
+        while (Pointer)
+        {
+                if (IsLeaf(Pointer))
+                {
+                        struct Leaf* Leaf = AsLeaf(Pointer);
+                        return LeafMatches(Leaf, Data, Size) ? Leaf->Value : NULL;
+                }
+
+                struct Node* Node = Pointer;
+                if (!PrefixMatches(Node, Data, Size, Depth))
+                {
+                        return NULL;
+                }
+                Depth += Node->PrefixSize;
+
+                if (Depth == Size)
+                {
+                        return Node->Terminal && LeafMatches(Node->Terminal, Data, Size) ? Node->Terminal->Value : NULL;
+                }
+
+                void** Child = FindChild(Node, Data[Depth++]);
+                Pointer = Child ? *Child : NULL;
+        }
+
+        return NULL;
+}
+
+void* lluna_Container_RadixTree_LongestPrefix(struct lluna_Container_RadixTree* Handle, struct lluna_Core_Types_Text Text, uint64* Length)
+{
+        const byte* Data = (const byte*)Text.Data;
+        uint64 Size = lluna_Macros_TextLength(Text);
+
+        // Every key along the path of the text is a candidate, checked in full as skipped prefixes may not match.
+        struct Leaf* Best = NULL;
+        void* Pointer = Handle->Root;
+        uint64 Depth = 0;
+        while (Pointer)
+        {
+                if (IsLeaf(Pointer))
+                {
+                        if (LeafIsPrefixOf(AsLeaf(Pointer), Data, Size))
+                        {
+                                Best = AsLeaf(Pointer);
+                        }
+                        break;
+                }
+
+                struct Node* Node = Pointer;
+                if (!PrefixMatches(Node, Data, Size, Depth))
+                {
+                        break;
+                }
+                Depth += Node->PrefixSize;
+
+                if (Node->Terminal && LeafIsPrefixOf(Node->Terminal, Data, Size))
+                {
+                        Best = Node->Terminal;
+                }
+                if (Depth == Size)
+                {
+                        break;
+                }
+
+                void** Child = FindChild(Node, Data[Depth++]);
+                Pointer = Child ? *Child : NULL;
+        }
+
+        if (!Best)
+        {
+                return NULL;
+        }
+
+        if (Length)
+        {
+                *Length = Best->Size;
+        }
+
+        return Best->Value;
+}
+
+boolean lluna_Container_RadixTree_VisitPrefix(struct lluna_Container_RadixTree* Handle, struct lluna_Core_Types_Text Prefix, lluna_Container_RadixTree_VisitFunction Visit, void* Context)
+{
+        const byte* Data = (const byte*)Prefix.Data;
+        uint64 Size = lluna_Macros_TextLength(Prefix);
+
+        // Descends to the first node whose keys all start with the prefix.
+        void* Pointer = Handle->Root;
+        uint64 Depth = 0;
+        while (Pointer)
+        {
+                if (IsLeaf(Pointer))
+                {
+                        struct Leaf* Leaf = AsLeaf(Pointer);
+                        return LeafStartsWith(Leaf, Data, Size) ? VisitLeaf(Leaf, Visit, Context) : true;
+                }
+
+                struct Node* Node = Pointer;
+                if (PrefixMismatch(Node, Data, Size, Depth) < Minimum(Node->PrefixSize, Size - Depth))
+                {
+                        return true;
+                }
+                Depth += Node->PrefixSize;
+
+                if (Depth >= Size)
+                {
+                        return VisitAll(Node, Visit, Context);
+                }
+
+                void** Child = FindChild(Node, Data[Depth++]);
+                Pointer = Child ? *Child : NULL;
+        }
+
+        return true;
+}
+
+void* lluna_Container_RadixTree_Insert(struct lluna_Container_RadixTree* Handle, struct lluna_Core_Types_Text Key, void* Value)
+{
+        return Insert(Handle, &Handle->Root, (const byte*)Key.Data, lluna_Macros_TextLength(Key), 0, Value);
+}
+
+void* lluna_Container_RadixTree_Remove(struct lluna_Container_RadixTree* Handle, struct lluna_Core_Types_Text Key)
+{
+        if (!Handle->Root)
+        {
+                return NULL;
+        }
+
+        struct Leaf* Leaf = Remove(&Handle->Root, (const byte*)Key.Data, lluna_Macros_TextLength(Key), 0);
+        if (!Leaf)
+        {
+                return NULL;
+        }
+
+        void* Value = Leaf->Value;
+        free(Leaf);
+        --Handle->Count;
+
+        return Value;
+}
+
+void lluna_Container_RadixTree_Clear(struct lluna_Container_RadixTree* Handle)
+{
+        if (Handle->Root)
+        {
+                Free(Handle->Root);
+        }
+
+        Handle->Root = NULL;
+        Handle->Count = 0;
+}
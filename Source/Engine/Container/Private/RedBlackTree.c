@@ -1,6 +1,8 @@
 #include <Engine/Container/Public/RedBlackTree.h>
 
+#include <Engine/Core/Public/Atomics.h>
 #include <Engine/Core/Public/Macros.h>
+#include <Engine/Core/Public/Memory.h>
 
 #include <stdlib.h>
 #include <string.h>
@@ -297,6 +299,14 @@ static void EraseFixup(struct lluna_Container_RedBlackTree* Handle, struct lluna
         }
 }
 
+// Published until the first snapshot replaces it, never freed.
+static struct lluna_Container_RedBlackTree_Snapshot EmptySnapshot;
+
+static void ReleaseSnapshot(void* Snapshot)
+{
+        lluna_Core_Memory_Free(Snapshot);
+}
+
 static uint64 CountSubtree(struct lluna_Container_RedBlackTree_Node* Node)
 {
         if (!Node)
@@ -309,8 +319,11 @@ static uint64 CountSubtree(struct lluna_Container_RedBlackTree_Node* Node)
 
 struct lluna_Container_RedBlackTree* lluna_Container_RedBlackTree_Create()
 {
-        struct lluna_Container_RedBlackTree* Handle = malloc(sizeof(struct lluna_Container_RedBlackTree));
+        struct lluna_Container_RedBlackTree* Handle = lluna_Core_Memory_Allocate(sizeof(struct lluna_Container_RedBlackTree), lluna_Core_Memory_RedBlackTree);
         Handle->Root = NULL;
+        Handle->Snapshot = &EmptySnapshot;
+
+        return Handle;
 }
 
 void lluna_Container_RedBlackTree_InitializeNode(struct lluna_Container_RedBlackTree_Node* Node)
@@ -324,7 +337,11 @@ void lluna_Container_RedBlackTree_InitializeNode(struct lluna_Container_RedBlack
 
 void lluna_Container_RedBlackTree_Destroy(struct lluna_Container_RedBlackTree* Handle)
 {
-        free(Handle);
+        if (Handle->Snapshot != &EmptySnapshot)
+        {
+                lluna_Core_Memory_Free(Handle->Snapshot);
+        }
+        lluna_Core_Memory_Free(Handle);
 }
 
 boolean lluna_Container_RedBlackTree_Empty(struct lluna_Container_RedBlackTree* Handle)
@@ -458,3 +475,52 @@ void lluna_Container_RedBlackTree_Remove(struct lluna_Container_RedBlackTree* Ha
                 EraseFixup(Handle, FixupTarget);
         }
 }
+
+void lluna_Container_RedBlackTree_Publish(struct lluna_Container_RedBlackTree* Handle, struct lluna_Core_Epoch* Epoch)
+{
+        uint64 Count = CountSubtree(Handle->Root);
+        struct lluna_Container_RedBlackTree_Snapshot* Snapshot = lluna_Core_Memory_Allocate(sizeof(struct lluna_Container_RedBlackTree_Snapshot) + Count * sizeof(struct lluna_Container_RedBlackTree_Node*), lluna_Core_Memory_RedBlackTree);
+        Snapshot->Count = Count;
+
+        uint64 Index = 0;
+        struct lluna_Container_RedBlackTree_Node* Node;
+        lluna_Container_RedBlackTree_ForEach(Handle, Node)
+        {
+                Snapshot->Nodes[Index++] = Node;
+        }
+
+        // Readers seeing the new snapshot see the nodes it lists as they were when it was published.
+        struct lluna_Container_RedBlackTree_Snapshot* Replaced = Handle->Snapshot;
+        lluna_Core_Atomics_StorePointer(&Handle->Snapshot, Snapshot, lluna_Core_Atomics_Release);
+
+        if (Replaced != &EmptySnapshot)
+        {
+                lluna_Core_Epoch_Retire(Epoch, Replaced, ReleaseSnapshot);
+        }
+        lluna_Core_Epoch_Reclaim(Epoch);
+}
+
+struct lluna_Container_RedBlackTree_Snapshot* lluna_Container_RedBlackTree_Acquire(struct lluna_Container_RedBlackTree* Handle)
+{
+        return lluna_Core_Atomics_LoadPointer(&Handle->Snapshot, lluna_Core_Atomics_Acquire);
+}
+
+uint64 lluna_Container_RedBlackTree_LowerBound(struct lluna_Container_RedBlackTree_Snapshot* Snapshot, lluna_Container_RedBlackTree_CompareFunction Compare, void* Context)
+{
+        uint64 Low = 0;
+        uint64 High = Snapshot->Count;
+        while (Low < High)
+        {
+                uint64 Middle = Low + (High - Low) / 2;
+                if (Compare(Context, Snapshot->Nodes[Middle]) < 0)
+                {
+                        Low = Middle + 1;
+                }
+                else
+                {
+                        High = Middle;
+                }
+        }
+
+        return Low;
+}
@@ -0,0 +1,131 @@
+#include <Engine/Container/Public/SlotMap.h>
+
+#include <stdlib.h>
+
+struct Slot
+{
+        uint32 Dense;
+        uint32 Generation;
+};
+
+static struct Slot* Slots(struct lluna_Container_SlotMap* Handle)
+{
+        return (struct Slot*)Handle->Slots->Data;
+}
+
+struct lluna_Container_SlotMap* lluna_Container_SlotMap_Create(uint64 InitialCount, uint32 ElementSize)
+{
+        uint64 Capacity = InitialCount > 0 ? InitialCount : 1;
+
+        struct lluna_Container_SlotMap* Handle = malloc(sizeof(struct lluna_Container_SlotMap));
+        Handle->Values = lluna_Container_DynamicArray_Create(Capacity, ElementSize);
+        Handle->Owners = lluna_Container_DynamicArray_Create(Capacity, sizeof(uint32));
+        Handle->Slots = lluna_Container_DynamicArray_Create(Capacity, sizeof(struct Slot));
+        Handle->FreeSlot = lluna_Container_SlotMap_InvalidIndex;
+
+        return Handle;
+}
+
+void lluna_Container_SlotMap_Destroy(struct lluna_Container_SlotMap* Handle)
+{
+        lluna_Container_DynamicArray_Destroy(Handle->Slots);
+        lluna_Container_DynamicArray_Destroy(Handle->Owners);
+        lluna_Container_DynamicArray_Destroy(Handle->Values);
+        free(Handle);
+}
+
+uint64 lluna_Container_SlotMap_Count(struct lluna_Container_SlotMap* Handle)
+{
+        return lluna_Container_DynamicArray_Count(Handle->Values);
+}
+
+boolean lluna_Container_SlotMap_Contains(struct lluna_Container_SlotMap* Handle, struct lluna_Container_SlotMap_Key Key)
+{
+        // Free slots already carry the generation of their next occupant, which no handed out key has.
+        return Key.Index < lluna_Container_DynamicArray_Count(Handle->Slots) && Slots(Handle)[Key.Index].Generation == Key.Generation;
+}
+
+byte* lluna_Container_SlotMap_Get(struct lluna_Container_SlotMap* Handle, struct lluna_Container_SlotMap_Key Key)
+{
+        if (!lluna_Container_SlotMap_Contains(Handle, Key))
+        {
+                return NULL;
+        }
+
+        return lluna_Container_DynamicArray_Get(Handle->Values, Slots(Handle)[Key.Index].Dense);
+}
+
+struct lluna_Container_SlotMap_Key lluna_Container_SlotMap_KeyAt(struct lluna_Container_SlotMap* Handle, uint64 Index)
+{
+        struct lluna_Container_SlotMap_Key Key;
+        Key.Index = ((uint32*)Handle->Owners->Data)[Index];
+        Key.Generation = Slots(Handle)[Key.Index].Generation;
+
+        return Key;
+}
+
+struct lluna_Container_SlotMap_Key lluna_Container_SlotMap_Insert(struct lluna_Container_SlotMap* Handle, const byte* Value)
+{
+        uint32 Dense = (uint32)lluna_Container_SlotMap_Count(Handle);
+
+        struct lluna_Container_SlotMap_Key Key;
+        if (Handle->FreeSlot != lluna_Container_SlotMap_InvalidIndex)
+        {
+                Key.Index = Handle->FreeSlot;
+                Handle->FreeSlot = Slots(Handle)[Key.Index].Dense;
+        }
+        else
+        {
+                struct Slot NewSlot = { 0, 0 };
+                Key.Index = (uint32)lluna_Container_DynamicArray_Count(Handle->Slots);
+                lluna_Container_DynamicArray_Append(Handle->Slots, (byte*)&NewSlot);
+        }
+
+        struct Slot* Occupied = &Slots(Handle)[Key.Index];
+        Occupied->Dense = Dense;
+        Key.Generation = Occupied->Generation;
+
+        lluna_Container_DynamicArray_Append(Handle->Values, (byte*)Value);
+        lluna_Container_DynamicArray_Append(Handle->Owners, (byte*)&Key.Index);
+
+        return Key;
+}
+
+boolean lluna_Container_SlotMap_Remove(struct lluna_Container_SlotMap* Handle, struct lluna_Container_SlotMap_Key Key)
+{
+        if (!lluna_Container_SlotMap_Contains(Handle, Key))
+        {
+                return false;
+        }
+
+        struct Slot* Freed = &Slots(Handle)[Key.Index];
+        uint32 Dense = Freed->Dense;
+
+        // The last value takes the place of the removed one, so its slot has to follow it.
+        uint32* Owners = (uint32*)Handle->Owners->Data;
+        uint32 LastOwner = Owners[lluna_Container_SlotMap_Count(Handle) - 1];
+        Slots(Handle)[LastOwner].Dense = Dense;
+        lluna_Container_DynamicArray_Remove(Handle->Values, Dense);
+        lluna_Container_DynamicArray_Remove(Handle->Owners, Dense);
+
+        ++Freed->Generation;
+        Freed->Dense = Handle->FreeSlot;
+        Handle->FreeSlot = Key.Index;
+
+        return true;
+}
+
+void lluna_Container_SlotMap_Clear(struct lluna_Container_SlotMap* Handle)
+{
+        uint32* Owners = (uint32*)Handle->Owners->Data;
+        for (uint64 Index = 0; Index < lluna_Container_SlotMap_Count(Handle); ++Index)
+        {
+                struct Slot* Freed = &Slots(Handle)[Owners[Index]];
+                ++Freed->Generation;
+                Freed->Dense = Handle->FreeSlot;
+                Handle->FreeSlot = Owners[Index];
+        }
+
+        lluna_Container_DynamicArray_Clear(Handle->Values);
+        lluna_Container_DynamicArray_Clear(Handle->Owners);
+}
@@ -0,0 +1,201 @@
+#include <Engine/Container/Public/Sort.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#define RadixBits 8
+#define RadixBuckets (1 << RadixBits)
+
+static inline __attribute__((always_inline)) uint64 ReadKey(const byte* Element, uint32 KeyOffset, uint32 KeySize)
+{
+        if (KeySize == sizeof(uint32))
+        {
+                uint32 Key;
+                memcpy(&Key, Element + KeyOffset, sizeof(uint32));
+                return Key;
+        }
+
+        uint64 Key;
+        memcpy(&Key, Element + KeyOffset, sizeof(uint64));
+        return Key;
+}
+
+// Always inlined so that calls with constant sizes turn the element copies into plain moves.
+static inline __attribute__((always_inline)) void Scatter(const byte* Source, byte* Destination, uint64 Count, uint32 ElementSize, uint32 KeyOffset, uint32 KeySize, uint32 Shift, uint64* Offsets)
+{
+        for (uint64 Index = 0; Index < Count; ++Index, Source += ElementSize)
+        {
+                uint32 Digit = (uint32)(ReadKey(Source, KeyOffset, KeySize) >> Shift) & (RadixBuckets - 1);
+                memcpy(Destination + Offsets[Digit]++ * ElementSize, Source, ElementSize);
+        }
+}
+
+// Dispatches to copies of Scatter with constant element and key sizes for the common layouts.
+static void ScatterPass(const byte* Source, byte* Destination, uint64 Count, uint32 ElementSize, uint32 KeyOffset, uint32 KeySize, uint32 Shift, uint64* Offsets)
+{
+        if (ElementSize == 4 && KeySize == 4)
+        {
+                Scatter(Source, Destination, Count, 4, 0, 4, Shift, Offsets);
+        }
+        else if (ElementSize == 8 && KeySize == 8)
+        {
+                Scatter(Source, Destination, Count, 8, 0, 8, Shift, Offsets);
+        }
+        else if (ElementSize == 8)
+        {
+                Scatter(Source, Destination, Count, 8, KeyOffset, 4, Shift, Offsets);
+        }
+        else if (ElementSize == 16 && KeySize == 8)
+        {
+                Scatter(Source, Destination, Count, 16, KeyOffset, 8, Shift, Offsets);
+        }
+        else if (ElementSize == 16)
+        {
+                Scatter(Source, Destination, Count, 16, KeyOffset, 4, Shift, Offsets);
+        }
+        else
+        {
+                Scatter(Source, Destination, Count, ElementSize, KeyOffset, KeySize, Shift, Offsets);
+        }
+}
+
+static inline __attribute__((always_inline)) void CountDigits(const byte* Data, uint64 Count, uint32 ElementSize, uint32 KeyOffset, uint32 KeySize, uint64 (*Histograms)[RadixBuckets])
+{
+        for (uint64 Index = 0; Index < Count; ++Index, Data += ElementSize)
+        {
+                uint64 Key = ReadKey(Data, KeyOffset, KeySize);
+                for (uint32 Pass = 0; Pass < KeySize; ++Pass)
+                {
+                        ++Histograms[Pass][(Key >> (Pass * RadixBits)) & (RadixBuckets - 1)];
+                }
+        }
+}
+
+static void SwapElements(byte* First, byte* Second, uint32 ElementSize)
+{
+        for (uint32 Offset = 0; Offset < ElementSize; ++Offset)
+        {
+                byte Swap = First[Offset];
+                First[Offset] = Second[Offset];
+                Second[Offset] = Swap;
+        }
+}
+
+// Stable and in place, used when no scratch buffer could be allocated.
+static void InsertionSort(byte* Data, uint64 Count, uint32 ElementSize, uint32 KeyOffset, uint32 KeySize)
+{
+        for (uint64 Index = 1; Index < Count; ++Index)
+        {
+                for (byte* Element = Data + Index * ElementSize;
+                     Element > Data && ReadKey(Element - ElementSize, KeyOffset, KeySize) > ReadKey(Element, KeyOffset, KeySize);
+                     Element -= ElementSize)
+                {
+                        SwapElements(Element - ElementSize, Element, ElementSize);
+                }
+        }
+}
+
+static void RadixSort(struct lluna_Container_DynamicArray* Handle, uint32 KeyOffset, uint32 KeySize, struct lluna_Container_DynamicArray* Scratch)
+{
+        uint64 Count = lluna_Container_DynamicArray_Count(Handle);
+        if (Count < 2)
+        {
+                return;
+        }
+
+        lluna_Container_DynamicArray_Unshare(Handle);
+
+        uint32 ElementSize = Handle->ElementSize;
+
+        // One read of the input counts the digits of every pass.
+        uint64 Histograms[sizeof(uint64)][RadixBuckets];
+        memset(Histograms, 0, sizeof(Histograms));
+
+        if (KeySize == sizeof(uint32))
+        {
+                CountDigits(Handle->Data, Count, ElementSize, KeyOffset, sizeof(uint32), Histograms);
+        }
+        else
+        {
+                CountDigits(Handle->Data, Count, ElementSize, KeyOffset, sizeof(uint64), Histograms);
+        }
+
+        byte* Buffer;
+        if (Scratch)
+        {
+                uint64 Needed = (Count * ElementSize + Scratch->ElementSize - 1) / Scratch->ElementSize;
+                if (lluna_Container_DynamicArray_Capacity(Scratch) < Needed)
+                {
+                        lluna_Container_DynamicArray_Resize(Scratch, Needed);
+                }
+                lluna_Container_DynamicArray_Unshare(Scratch);
+                Buffer = Scratch->Data;
+        }
+        else
+        {
+                Buffer = malloc(Count * ElementSize);
+                if (!Buffer)
+                {
+                        InsertionSort(Handle->Data, Count, ElementSize, KeyOffset, KeySize);
+                        return;
+                }
+        }
+
+        byte* Source = Handle->Data;
+        byte* Destination = Buffer;
+        uint64 FirstKey = ReadKey(Handle->Data, KeyOffset, KeySize);
+        for (uint32 Pass = 0; Pass < KeySize; ++Pass)
+        {
+                uint32 Shift = Pass * RadixBits;
+
+                // Every key has the same digit, so this pass wouldn't move anything.
+                if (Histograms[Pass][(FirstKey >> Shift) & (RadixBuckets - 1)] == Count)
+                {
+                        continue;
+                }
+
+                uint64 Offsets[RadixBuckets];
+                uint64 Total = 0;
+                for (uint32 Digit = 0; Digit < RadixBuckets; ++Digit)
+                {
+                        Offsets[Digit] = Total;
+                        Total += Histograms[Pass][Digit];
+                }
+
+                ScatterPass(Source, Destination, Count, ElementSize, KeyOffset, KeySize, Shift, Offsets);
+
+                byte* Swap = Source;
+                Source = Destination;
+                Destination = Swap;
+        }
+
+        if (Source != Handle->Data)
+        {
+                memcpy(Handle->Data, Source, Count * ElementSize);
+        }
+
+        if (!Scratch)
+        {
+                free(Buffer);
+        }
+}
+
+void lluna_Container_Sort_Radix32(struct lluna_Container_DynamicArray* Handle, struct lluna_Container_DynamicArray* Scratch)
+{
+        RadixSort(Handle, 0, sizeof(uint32), Scratch);
+}
+
+void lluna_Container_Sort_Radix64(struct lluna_Container_DynamicArray* Handle, struct lluna_Container_DynamicArray* Scratch)
+{
+        RadixSort(Handle, 0, sizeof(uint64), Scratch);
+}
+
+void lluna_Container_Sort_RadixKey32(struct lluna_Container_DynamicArray* Handle, uint32 KeyOffset, struct lluna_Container_DynamicArray* Scratch)
+{
+        RadixSort(Handle, KeyOffset, sizeof(uint32), Scratch);
+}
+
+void lluna_Container_Sort_RadixKey64(struct lluna_Container_DynamicArray* Handle, uint32 KeyOffset, struct lluna_Container_DynamicArray* Scratch)
+{
+        RadixSort(Handle, KeyOffset, sizeof(uint64), Scratch);
+}
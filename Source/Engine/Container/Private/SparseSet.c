@@ -0,0 +1,140 @@
+#include <Engine/Container/Public/SparseSet.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+static uint32* Sparse(struct lluna_Container_SparseSet* Handle)
+{
+        return (uint32*)Handle->Sparse->Data;
+}
+
+// Grows the sparse array geometrically to cover the given id, marking the new ids as absent.
+static void Cover(struct lluna_Container_SparseSet* Handle, uint32 Id)
+{
+        uint64 Count = lluna_Container_DynamicArray_Count(Handle->Sparse);
+        if (Id < Count)
+        {
+                return;
+        }
+
+        uint64 NewCount = Count * 2 > (uint64)Id + 1 ? Count * 2 : (uint64)Id + 1;
+        if (lluna_Container_DynamicArray_Capacity(Handle->Sparse) < NewCount)
+        {
+                lluna_Container_DynamicArray_Resize(Handle->Sparse, NewCount);
+        }
+
+        memset(Sparse(Handle) + Count, 0xFF, (NewCount - Count) * sizeof(uint32));
+        Handle->Sparse->Offset = NewCount * sizeof(uint32);
+}
+
+struct lluna_Container_SparseSet* lluna_Container_SparseSet_Create(uint64 InitialCount, uint32 ValueSize)
+{
+        uint64 Capacity = InitialCount > 0 ? InitialCount : 1;
+
+        struct lluna_Container_SparseSet* Handle = malloc(sizeof(struct lluna_Container_SparseSet));
+        Handle->Ids = lluna_Container_DynamicArray_Create(Capacity, sizeof(uint32));
+        Handle->Values = ValueSize > 0 ? lluna_Container_DynamicArray_Create(Capacity, ValueSize) : NULL;
+        Handle->Sparse = lluna_Container_DynamicArray_Create(Capacity, sizeof(uint32));
+
+        return Handle;
+}
+
+void lluna_Container_SparseSet_Destroy(struct lluna_Container_SparseSet* Handle)
+{
+        lluna_Container_DynamicArray_Destroy(Handle->Sparse);
+        if (Handle->Values)
+        {
+                lluna_Container_DynamicArray_Destroy(Handle->Values);
+        }
+        lluna_Container_DynamicArray_Destroy(Handle->Ids);
+        free(Handle);
+}
+
+uint64 lluna_Container_SparseSet_Count(struct lluna_Container_SparseSet* Handle)
+{
+        return lluna_Container_DynamicArray_Count(Handle->Ids);
+}
+
+uint32 lluna_Container_SparseSet_IndexOf(struct lluna_Container_SparseSet* Handle, uint32 Id)
+{
+        return Id < lluna_Container_DynamicArray_Count(Handle->Sparse) ? Sparse(Handle)[Id] : lluna_Container_SparseSet_InvalidIndex;
+}
+
+boolean lluna_Container_SparseSet_Contains(struct lluna_Container_SparseSet* Handle, uint32 Id)
+{
+        return lluna_Container_SparseSet_IndexOf(Handle, Id) != lluna_Container_SparseSet_InvalidIndex;
+}
+
+byte* lluna_Container_SparseSet_Get(struct lluna_Container_SparseSet* Handle, uint32 Id)
+{
+        uint32 Index = lluna_Container_SparseSet_IndexOf(Handle, Id);
+        if (Index == lluna_Container_SparseSet_InvalidIndex || !Handle->Values)
+        {
+                return NULL;
+        }
+
+        return lluna_Container_DynamicArray_Get(Handle->Values, Index);
+}
+
+uint32 lluna_Container_SparseSet_IdAt(struct lluna_Container_SparseSet* Handle, uint64 Index)
+{
+        return ((uint32*)Handle->Ids->Data)[Index];
+}
+
+void lluna_Container_SparseSet_Insert(struct lluna_Container_SparseSet* Handle, uint32 Id, const byte* Value)
+{
+        uint32 Index = lluna_Container_SparseSet_IndexOf(Handle, Id);
+        if (Index != lluna_Container_SparseSet_InvalidIndex)
+        {
+                if (Handle->Values)
+                {
+                        memcpy(lluna_Container_DynamicArray_Get(Handle->Values, Index), Value, Handle->Values->ElementSize);
+                }
+                return;
+        }
+
+        Cover(Handle, Id);
+        Sparse(Handle)[Id] = (uint32)lluna_Container_SparseSet_Count(Handle);
+
+        lluna_Container_DynamicArray_Append(Handle->Ids, (byte*)&Id);
+        if (Handle->Values)
+        {
+                lluna_Container_DynamicArray_Append(Handle->Values, (byte*)Value);
+        }
+}
+
+boolean lluna_Container_SparseSet_Remove(struct lluna_Container_SparseSet* Handle, uint32 Id)
+{
+        uint32 Index = lluna_Container_SparseSet_IndexOf(Handle, Id);
+        if (Index == lluna_Container_SparseSet_InvalidIndex)
+        {
+                return false;
+        }
+
+        // The last entry takes the place of the removed one, so its sparse entry has to follow it.
+        uint32 LastId = lluna_Container_SparseSet_IdAt(Handle, lluna_Container_SparseSet_Count(Handle) - 1);
+        Sparse(Handle)[LastId] = Index;
+        Sparse(Handle)[Id] = lluna_Container_SparseSet_InvalidIndex;
+
+        lluna_Container_DynamicArray_Remove(Handle->Ids, Index);
+        if (Handle->Values)
+        {
+                lluna_Container_DynamicArray_Remove(Handle->Values, Index);
+        }
+
+        return true;
+}
+
+void lluna_Container_SparseSet_Clear(struct lluna_Container_SparseSet* Handle)
+{
+        for (uint64 Index = 0; Index < lluna_Container_SparseSet_Count(Handle); ++Index)
+        {
+                Sparse(Handle)[lluna_Container_SparseSet_IdAt(Handle, Index)] = lluna_Container_SparseSet_InvalidIndex;
+        }
+
+        lluna_Container_DynamicArray_Clear(Handle->Ids);
+        if (Handle->Values)
+        {
+                lluna_Container_DynamicArray_Clear(Handle->Values);
+        }
+}
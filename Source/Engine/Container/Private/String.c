@@ -1,10 +1,80 @@
 #include <Engine/Container/Public/String.h>
 
+#include <Engine/Core/Public/Atomics.h>
+#include <Engine/Core/Public/Memory.h>
+#include <Engine/Core/Public/Utf8.h>
+
 #include <stdarg.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+// Strings sharing a buffer through lluna_Container_String_Share count its references right before the characters,
+// so Data keeps pointing at the first character.
+struct Buffer
+{
+        uint64 References;
+        char Data[] __attribute__((aligned(16)));
+};
+
+static struct Buffer* BufferOf(char* Data)
+{
+        return (struct Buffer*)(Data - offsetof(struct Buffer, Data));
+}
+
+static char* Allocate(uint64 Size)
+{
+        struct Buffer* Buffer = lluna_Core_Memory_Allocate(sizeof(struct Buffer) + Size, lluna_Core_Memory_String);
+        Buffer->References = 1;
+
+        return Buffer->Data;
+}
+
+// A count of one can only be seen by the last reference, and the acquire pairs with the release of the others.
+static boolean Shared(char* Data)
+{
+        return lluna_Core_Atomics_LoadUint64(&BufferOf(Data)->References, lluna_Core_Atomics_Acquire) > 1;
+}
+
+static void Release(char* Data)
+{
+        struct Buffer* Buffer = BufferOf(Data);
+        if (!Shared(Data) || lluna_Core_Atomics_FetchSubUint64(&Buffer->References, 1, lluna_Core_Atomics_AcquireRelease) == 1)
+        {
+                lluna_Core_Memory_Free(Buffer);
+        }
+}
+
+// Gives the string a buffer of its own of the given size. Shared buffers are left alone and only the characters that
+// fit, null terminator included, are copied out of them.
+static void Reallocate(struct lluna_Container_String* Handle, uint64 Size)
+{
+        if (Shared(Handle->Data))
+        {
+                char* Data = Allocate(Size);
+                memcpy(Data, Handle->Data, Handle->Offset + 1 < Size ? Handle->Offset + 1 : Size);
+                Release(Handle->Data);
+                Handle->Data = Data;
+        }
+        else
+        {
+                struct Buffer* Buffer = lluna_Core_Memory_Reallocate(BufferOf(Handle->Data), sizeof(struct Buffer) + Size, lluna_Core_Memory_String);
+                Handle->Data = Buffer->Data;
+        }
+
+        Handle->AllocatedSize = Size;
+}
+
+// Called before writing to the characters.
+static void Own(struct lluna_Container_String* Handle)
+{
+        if (Shared(Handle->Data))
+        {
+                Reallocate(Handle, Handle->AllocatedSize);
+        }
+}
+
 static void NullTerminate(struct lluna_Container_String* Handle)
 {
         Handle->Data[Handle->Offset] = '\0';
@@ -14,8 +84,8 @@ struct lluna_Container_String* lluna_Container_String_Create(uint64 InitialSize)
 {
         uint64 Size = (InitialSize + 1) * sizeof(char);
 
-        struct lluna_Container_String* Handle = malloc(sizeof(struct lluna_Container_String));
-        Handle->Data = malloc(Size);
+        struct lluna_Container_String* Handle = lluna_Core_Memory_Allocate(sizeof(struct lluna_Container_String), lluna_Core_Memory_String);
+        Handle->Data = Allocate(Size);
         Handle->AllocatedSize = Size;
         Handle->Offset = 0;
 
@@ -26,8 +96,8 @@ struct lluna_Container_String* lluna_Container_String_Create(uint64 InitialSize)
 
 struct lluna_Container_String* lluna_Container_String_CreateFromText(struct lluna_Core_Types_Text Text)
 {
-        struct lluna_Container_String* Handle = malloc(sizeof(struct lluna_Container_String));
-        Handle->Data = malloc(Text.Size);
+        struct lluna_Container_String* Handle = lluna_Core_Memory_Allocate(sizeof(struct lluna_Container_String), lluna_Core_Memory_String);
+        Handle->Data = Allocate(Text.Size);
         Handle->AllocatedSize = Text.Size;
         Handle->Offset = Text.Size - 1;
 
@@ -38,17 +108,21 @@ struct lluna_Container_String* lluna_Container_String_CreateFromText(struct llun
 
 struct lluna_Container_String* lluna_Container_String_CreateFormatted(struct lluna_Core_Types_Text Format, ...)
 {
-        struct lluna_Container_String* Handle = malloc(sizeof(struct lluna_Container_String));
+        struct lluna_Container_String* Handle = lluna_Core_Memory_Allocate(sizeof(struct lluna_Container_String), lluna_Core_Memory_String);
 
         int32 Size;
         va_list Args;
+        va_list Measure;
 
         va_start(Args, Format);
+        va_copy(Measure, Args);
 
-        Size = vsnprintf(NULL, 0, Format.Data, Args);
+        Size = vsnprintf(NULL, 0, Format.Data, Measure);
         ++Size;
 
-        Handle->Data = malloc(Size);
+        va_end(Measure);
+
+        Handle->Data = Allocate(Size);
         Handle->AllocatedSize = Size;
 
         vsnprintf(Handle->Data, Size, Format.Data, Args);
@@ -61,10 +135,30 @@ struct lluna_Container_String* lluna_Container_String_CreateFormatted(struct llu
         return Handle;
 }
 
+struct lluna_Container_String* lluna_Container_String_Share(struct lluna_Container_String* Handle)
+{
+        struct lluna_Container_String* Snapshot = lluna_Core_Memory_Allocate(sizeof(struct lluna_Container_String), lluna_Core_Memory_String);
+        *Snapshot = *Handle;
+
+        lluna_Core_Atomics_FetchAddUint64(&BufferOf(Handle->Data)->References, 1, lluna_Core_Atomics_Relaxed);
+
+        return Snapshot;
+}
+
 void lluna_Container_String_Destroy(struct lluna_Container_String* Handle)
 {
-        free(Handle->Data);
-        free(Handle);
+        Release(Handle->Data);
+        lluna_Core_Memory_Free(Handle);
+}
+
+boolean lluna_Container_String_Shared(struct lluna_Container_String* Handle)
+{
+        return Shared(Handle->Data);
+}
+
+void lluna_Container_String_Unshare(struct lluna_Container_String* Handle)
+{
+        Own(Handle);
 }
 
 boolean lluna_Container_String_Empty(struct lluna_Container_String* Handle)
@@ -77,6 +171,13 @@ uint64 lluna_Container_String_Length(struct lluna_Container_String* Handle)
         return Handle->Offset / sizeof(char);
 }
 
+uint64 lluna_Container_String_CodePointCount(struct lluna_Container_String* Handle)
+{
+        struct lluna_Core_Types_Text Text = { Handle->Data, Handle->Offset };
+
+        return lluna_Core_Utf8_CountCodePoints(Text);
+}
+
 uint64 lluna_Container_String_Capacity(struct lluna_Container_String* Handle)
 {
         return Handle->AllocatedSize - 1;
@@ -84,19 +185,13 @@ uint64 lluna_Container_String_Capacity(struct lluna_Container_String* Handle)
 
 void lluna_Container_String_Resize(struct lluna_Container_String* Handle, uint64 Size)
 {
-        uint64 NewSize = (Size + 1) * sizeof(char);
-
-        Handle->Data = realloc(Handle->Data, NewSize);
-        Handle->AllocatedSize = NewSize;
+        Reallocate(Handle, (Size + 1) * sizeof(char));
         Handle->Offset = Handle->Offset > Handle->AllocatedSize - 1 ? Handle->AllocatedSize - 1 : Handle->Offset;
 }
 
 void lluna_Container_String_Shrink(struct lluna_Container_String* Handle)
 {
-        uint64 NewSize = Handle->Offset + 1 * sizeof(char);
-
-        Handle->Data = realloc(Handle->Data, NewSize);
-        Handle->AllocatedSize = NewSize;
+        Reallocate(Handle, Handle->Offset + 1 * sizeof(char));
 }
 
 boolean lluna_Container_String_Equals(struct lluna_Container_String* Handle, struct lluna_Container_String* Other)
@@ -144,6 +239,8 @@ void lluna_Container_String_Append(struct lluna_Container_String* Handle, struct
                 lluna_Container_String_Resize(Handle, CombinedSize);
         }
 
+        Own(Handle);
+
         memcpy((byte*)Handle->Data + Handle->Offset, Other->Data, Other->Offset);
         Handle->Offset += Other->Offset;
 
@@ -159,22 +256,45 @@ void lluna_Container_String_AppendText(struct lluna_Container_String* Handle, st
                 lluna_Container_String_Resize(Handle, CombinedSize);
         }
 
+        Own(Handle);
+
         memcpy((byte*)Handle->Data + Handle->Offset, Text.Data, Text.Size);
         Handle->Offset += Text.Size - 1;
 }
 
-void lluna_Container_String_Assign(struct lluna_Container_String* Handle, struct lluna_Container_String* Other)
+void lluna_Container_String_AppendUtf32(struct lluna_Container_String* Handle, const uint32* CodePoints, uint64 Count)
 {
-        if (Other->Offset + 1 > Handle->AllocatedSize) {
-                lluna_Container_String_Resize(Handle, Other->Offset);
+        uint64 CombinedSize = Handle->Offset + lluna_Core_Utf8_EncodedSize(CodePoints, Count);
+
+        if (CombinedSize + 1 > Handle->AllocatedSize)
+        {
+                lluna_Container_String_Resize(Handle, CombinedSize);
         }
 
-        memcpy(Handle->Data, Other->Data, Other->Offset + 1);
+        Own(Handle);
+
+        Handle->Offset += lluna_Core_Utf8_Encode(CodePoints, Count, Handle->Data + Handle->Offset);
+
+        NullTerminate(Handle);
+}
+
+void lluna_Container_String_Assign(struct lluna_Container_String* Handle, struct lluna_Container_String* Other)
+{
+        // Referencing first keeps the buffer alive when both strings already share it.
+        lluna_Core_Atomics_FetchAddUint64(&BufferOf(Other->Data)->References, 1, lluna_Core_Atomics_Relaxed);
+        Release(Handle->Data);
+
+        Handle->Data = Other->Data;
+        Handle->AllocatedSize = Other->AllocatedSize;
         Handle->Offset = Other->Offset;
 }
 
 void lluna_Container_String_AssignText(struct lluna_Container_String* Handle, struct lluna_Core_Types_Text Text)
 {
+        // Nothing has to be copied out of a shared buffer that is overwritten.
+        Handle->Offset = 0;
+        Own(Handle);
+
         if (Text.Size > Handle->AllocatedSize) {
                 lluna_Container_String_Resize(Handle, Text.Size - 1);
         }
@@ -186,6 +306,7 @@ void lluna_Container_String_AssignText(struct lluna_Container_String* Handle, st
 void lluna_Container_String_Clear(struct lluna_Container_String* Handle)
 {
         Handle->Offset = 0;
+        Own(Handle);
         NullTerminate(Handle);
 }
 
@@ -193,12 +314,19 @@ void lluna_Container_String_Format(struct lluna_Container_String* Handle, struct
 {
         int32 Size;
         va_list Args;
+        va_list Measure;
 
         va_start(Args, Format);
+        va_copy(Measure, Args);
 
-        Size = vsnprintf(NULL, 0, Format.Data, Args);
+        Size = vsnprintf(NULL, 0, Format.Data, Measure);
         ++Size;
 
+        va_end(Measure);
+
+        Handle->Offset = 0;
+        Own(Handle);
+
         if (Size > Handle->AllocatedSize)
         {
                 lluna_Container_String_Resize(Handle, Size - 1);
@@ -0,0 +1,196 @@
+#include <Engine/Container/Public/StructOfArrays.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+static uint64 AlignUp(uint64 Value, uint64 Alignment)
+{
+        return (Value + Alignment - 1) & ~(Alignment - 1);
+}
+
+static uint64 StreamAlignment(const struct lluna_Container_StructOfArrays_Field* Field)
+{
+        return Field->Alignment > lluna_Container_StructOfArrays_StreamAlignment ? Field->Alignment : lluna_Container_StructOfArrays_StreamAlignment;
+}
+
+// Always inlined so that calls with constant sizes turn the field copies into plain moves.
+static inline __attribute__((always_inline)) void CopyStrided(byte* Destination, uint64 DestinationStride, const byte* Source, uint64 SourceStride, uint64 Count, uint32 Size)
+{
+        for (uint64 Index = 0; Index < Count; ++Index, Destination += DestinationStride, Source += SourceStride)
+        {
+                memcpy(Destination, Source, Size);
+        }
+}
+
+// Dispatches to copies of CopyStrided with constant sizes for the common field types.
+static void CopyField(byte* Destination, uint64 DestinationStride, const byte* Source, uint64 SourceStride, uint64 Count, uint32 Size)
+{
+        switch (Size)
+        {
+        case 4:
+                CopyStrided(Destination, DestinationStride, Source, SourceStride, Count, 4);
+                break;
+        case 8:
+                CopyStrided(Destination, DestinationStride, Source, SourceStride, Count, 8);
+                break;
+        case 12:
+                CopyStrided(Destination, DestinationStride, Source, SourceStride, Count, 12);
+                break;
+        case 16:
+                CopyStrided(Destination, DestinationStride, Source, SourceStride, Count, 16);
+                break;
+        default:
+                CopyStrided(Destination, DestinationStride, Source, SourceStride, Count, Size);
+                break;
+        }
+}
+
+struct lluna_Container_StructOfArrays* lluna_Container_StructOfArrays_Create(const struct lluna_Container_StructOfArrays_Field* Fields, uint32 FieldCount, uint64 InitialCount)
+{
+        struct lluna_Container_StructOfArrays* Handle = malloc(sizeof(struct lluna_Container_StructOfArrays));
+        Handle->Fields = malloc(FieldCount * sizeof(struct lluna_Container_StructOfArrays_Field));
+        Handle->Streams = malloc(FieldCount * sizeof(byte*));
+        Handle->Data = NULL;
+        Handle->Count = 0;
+        Handle->Capacity = 0;
+        Handle->FieldCount = FieldCount;
+
+        memcpy(Handle->Fields, Fields, FieldCount * sizeof(struct lluna_Container_StructOfArrays_Field));
+        lluna_Container_StructOfArrays_Reserve(Handle, InitialCount > 0 ? InitialCount : 1);
+
+        return Handle;
+}
+
+void lluna_Container_StructOfArrays_Destroy(struct lluna_Container_StructOfArrays* Handle)
+{
+        free(Handle->Data);
+        free(Handle->Streams);
+        free(Handle->Fields);
+        free(Handle);
+}
+
+uint64 lluna_Container_StructOfArrays_Count(struct lluna_Container_StructOfArrays* Handle)
+{
+        return Handle->Count;
+}
+
+void lluna_Container_StructOfArrays_Reserve(struct lluna_Container_StructOfArrays* Handle, uint64 Capacity)
+{
+        if (Capacity <= Handle->Capacity)
+        {
+                return;
+        }
+
+        // Lays the streams out back to back, each aligned and padded to whole cache lines.
+        uint64 Size = 0;
+        uint64 Alignment = lluna_Container_StructOfArrays_StreamAlignment;
+        for (uint32 Field = 0; Field < Handle->FieldCount; ++Field)
+        {
+                uint64 FieldAlignment = StreamAlignment(&Handle->Fields[Field]);
+                Alignment = FieldAlignment > Alignment ? FieldAlignment : Alignment;
+                Size = AlignUp(Size, FieldAlignment) + AlignUp(Capacity * Handle->Fields[Field].Size, lluna_Container_StructOfArrays_StreamAlignment);
+        }
+
+        void* Data;
+        if (posix_memalign(&Data, Alignment, Size > 0 ? Size : Alignment) != 0)
+        {
+                return;
+        }
+
+        uint64 Offset = 0;
+        for (uint32 Field = 0; Field < Handle->FieldCount; ++Field)
+        {
+                Offset = AlignUp(Offset, StreamAlignment(&Handle->Fields[Field]));
+
+                byte* Stream = (byte*)Data + Offset;
+                if (Handle->Count > 0)
+                {
+                        memcpy(Stream, Handle->Streams[Field], Handle->Count * Handle->Fields[Field].Size);
+                }
+                Handle->Streams[Field] = Stream;
+
+                Offset += AlignUp(Capacity * Handle->Fields[Field].Size, lluna_Container_StructOfArrays_StreamAlignment);
+        }
+
+        free(Handle->Data);
+        Handle->Data = Data;
+        Handle->Capacity = Capacity;
+}
+
+byte* lluna_Container_StructOfArrays_Stream(struct lluna_Container_StructOfArrays* Handle, uint32 Field)
+{
+        return Handle->Streams[Field];
+}
+
+byte* lluna_Container_StructOfArrays_Get(struct lluna_Container_StructOfArrays* Handle, uint32 Field, uint64 Index)
+{
+        return Handle->Streams[Field] + Index * Handle->Fields[Field].Size;
+}
+
+uint64 lluna_Container_StructOfArrays_Append(struct lluna_Container_StructOfArrays* Handle, const byte* Element)
+{
+        if (Handle->Count == Handle->Capacity)
+        {
+                lluna_Container_StructOfArrays_Reserve(Handle, Handle->Capacity * 2);
+        }
+
+        uint64 Index = Handle->Count++;
+        for (uint32 Field = 0; Field < Handle->FieldCount; ++Field)
+        {
+                byte* Destination = lluna_Container_StructOfArrays_Get(Handle, Field, Index);
+                if (Element)
+                {
+                        memcpy(Destination, Element + Handle->Fields[Field].Offset, Handle->Fields[Field].Size);
+                }
+                else
+                {
+                        memset(Destination, 0, Handle->Fields[Field].Size);
+                }
+        }
+
+        return Index;
+}
+
+void lluna_Container_StructOfArrays_Remove(struct lluna_Container_StructOfArrays* Handle, uint64 Index)
+{
+        uint64 Last = --Handle->Count;
+        if (Index == Last)
+        {
+                return;
+        }
+
+        for (uint32 Field = 0; Field < Handle->FieldCount; ++Field)
+        {
+                memcpy(lluna_Container_StructOfArrays_Get(Handle, Field, Index), lluna_Container_StructOfArrays_Get(Handle, Field, Last), Handle->Fields[Field].Size);
+        }
+}
+
+void lluna_Container_StructOfArrays_Clear(struct lluna_Container_StructOfArrays* Handle)
+{
+        Handle->Count = 0;
+}
+
+void lluna_Container_StructOfArrays_AppendStructs(struct lluna_Container_StructOfArrays* Handle, const byte* Elements, uint64 Count, uint64 Stride)
+{
+        if (Handle->Count + Count > Handle->Capacity)
+        {
+                uint64 Doubled = Handle->Capacity * 2;
+                lluna_Container_StructOfArrays_Reserve(Handle, Doubled > Handle->Count + Count ? Doubled : Handle->Count + Count);
+        }
+
+        for (uint32 Field = 0; Field < Handle->FieldCount; ++Field)
+        {
+                const struct lluna_Container_StructOfArrays_Field* Description = &Handle->Fields[Field];
+                CopyField(lluna_Container_StructOfArrays_Get(Handle, Field, Handle->Count), Description->Size, Elements + Description->Offset, Stride, Count, Description->Size);
+        }
+        Handle->Count += Count;
+}
+
+void lluna_Container_StructOfArrays_CopyToStructs(struct lluna_Container_StructOfArrays* Handle, uint64 First, uint64 Count, byte* Elements, uint64 Stride)
+{
+        for (uint32 Field = 0; Field < Handle->FieldCount; ++Field)
+        {
+                const struct lluna_Container_StructOfArrays_Field* Description = &Handle->Fields[Field];
+                CopyField(Elements + Description->Offset, Stride, lluna_Container_StructOfArrays_Get(Handle, Field, First), Description->Size, Count, Description->Size);
+        }
+}
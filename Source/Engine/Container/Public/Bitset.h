@@ -0,0 +1,176 @@
+#pragma once
+
+/**
+ * @file Bitset.h
+ * @brief Dynamically sized bitset.
+ *
+ * lluna_Container_Bitset stores flags one bit each, 64 to a word, instead of a whole `boolean` each. Besides taking an
+ * eighth of the memory, whole masks can then be combined a word at a time, or four words at a time with AVX2 when the
+ * processor supports it, which suits visibility and dirty flags or component masks queried over many entities.
+ *
+ * Bits past the last one in the final word are always kept clear, so counting and scanning never see them.
+ *
+ * Set bits can be visited in increasing order with an iterator, which skips empty words and finds each set bit with
+ * a trailing zero count.
+ */
+
+#include <Engine/Core/Public/Types.h>
+
+/**
+ * @brief Describes a bitset.
+ *
+ * Should not be written to externally.
+ */
+struct lluna_Container_Bitset
+{
+        uint64* Words; /**< Bits, starting from the lowest bit of the first word. */
+        uint64 Count; /**< Number of bits. */
+};
+
+/**
+ * @brief Iterates over the set bits of a bitset.
+ *
+ * @see lluna_Container_Bitset_Begin
+ */
+struct lluna_Container_Bitset_Iterator
+{
+        const uint64* Words; /**< Words of the iterated bitset. */
+        uint64 WordCount; /**< Number of words. */
+        uint64 WordIndex; /**< Index of the word being iterated. */
+        uint64 Remaining; /**< Bits of the current word not visited yet. */
+};
+
+/**
+ * @brief Creates a bitset and returns a handle to it.
+ *
+ * Created bitsets have to be manually destroyed.
+ *
+ * @param Count Number of bits, all initially clear.
+ * @return Handle to the created bitset.
+ *
+ * @see lluna_Container_Bitset_Destroy
+ */
+struct lluna_Container_Bitset* lluna_Container_Bitset_Create(uint64 Count);
+/**
+ * @brief Destroys the given bitset.
+ *
+ * @param Handle Bitset to destroy.
+ */
+void lluna_Container_Bitset_Destroy(struct lluna_Container_Bitset* Handle);
+
+/**
+ * @brief Returns the number of bits.
+ *
+ * @param Handle Bitset to count bits of.
+ * @return Number of bits.
+ */
+uint64 lluna_Container_Bitset_Count(struct lluna_Container_Bitset* Handle);
+/**
+ * @brief Changes the number of bits.
+ *
+ * Added bits are clear.
+ *
+ * @param Handle Bitset to resize.
+ * @param Count New number of bits.
+ */
+void lluna_Container_Bitset_Resize(struct lluna_Container_Bitset* Handle, uint64 Count);
+
+/**
+ * @brief Returns the bit at the given index.
+ *
+ * @param Handle Bitset to read from.
+ * @param Index Index of the bit.
+ * @return Whether or not the bit is set.
+ */
+boolean lluna_Container_Bitset_Test(struct lluna_Container_Bitset* Handle, uint64 Index);
+/**
+ * @brief Sets the bit at the given index.
+ *
+ * @param Handle Bitset to write to.
+ * @param Index Index of the bit.
+ */
+void lluna_Container_Bitset_Set(struct lluna_Container_Bitset* Handle, uint64 Index);
+/**
+ * @brief Clears the bit at the given index.
+ *
+ * @param Handle Bitset to write to.
+ * @param Index Index of the bit.
+ */
+void lluna_Container_Bitset_Reset(struct lluna_Container_Bitset* Handle, uint64 Index);
+/**
+ * @brief Sets every bit.
+ *
+ * @param Handle Bitset to write to.
+ */
+void lluna_Container_Bitset_SetAll(struct lluna_Container_Bitset* Handle);
+/**
+ * @brief Clears every bit.
+ *
+ * @param Handle Bitset to write to.
+ */
+void lluna_Container_Bitset_ResetAll(struct lluna_Container_Bitset* Handle);
+
+/**
+ * @brief Keeps only the bits also set in another bitset.
+ *
+ * @param Destination Bitset to update.
+ * @param Source Bitset with the same number of bits.
+ */
+void lluna_Container_Bitset_And(struct lluna_Container_Bitset* Destination, const struct lluna_Container_Bitset* Source);
+/**
+ * @brief Sets the bits set in another bitset.
+ *
+ * @param Destination Bitset to update.
+ * @param Source Bitset with the same number of bits.
+ */
+void lluna_Container_Bitset_Or(struct lluna_Container_Bitset* Destination, const struct lluna_Container_Bitset* Source);
+/**
+ * @brief Clears the bits set in another bitset.
+ *
+ * @param Destination Bitset to update.
+ * @param Source Bitset with the same number of bits.
+ */
+void lluna_Container_Bitset_AndNot(struct lluna_Container_Bitset* Destination, const struct lluna_Container_Bitset* Source);
+/**
+ * @brief Flips the bits set in another bitset.
+ *
+ * @param Destination Bitset to update.
+ * @param Source Bitset with the same number of bits.
+ */
+void lluna_Container_Bitset_Xor(struct lluna_Container_Bitset* Destination, const struct lluna_Container_Bitset* Source);
+
+/**
+ * @brief Returns the number of set bits.
+ *
+ * @param Handle Bitset to count set bits of.
+ * @return Number of set bits.
+ */
+uint64 lluna_Container_Bitset_PopCount(struct lluna_Container_Bitset* Handle);
+/**
+ * @brief Returns the index of the first set bit at or after the given one.
+ *
+ * @param Handle Bitset to search.
+ * @param Start Index of the first bit to consider.
+ * @return Index of the set bit, or the number of bits if there is none.
+ */
+uint64 lluna_Container_Bitset_FindFirstSet(struct lluna_Container_Bitset* Handle, uint64 Start);
+
+/**
+ * @brief Returns an iterator over the set bits.
+ *
+ * Modifying the bitset while iterating over it is allowed, but words already read aren't read again.
+ *
+ * @param Handle Bitset to iterate.
+ * @return Iterator positioned before the first set bit.
+ *
+ * @see lluna_Container_Bitset_Next
+ */
+struct lluna_Container_Bitset_Iterator lluna_Container_Bitset_Begin(struct lluna_Container_Bitset* Handle);
+/**
+ * @brief Advances an iterator to the next set bit.
+ *
+ * @param Iterator Iterator to advance.
+ * @param Index Receives the index of the set bit.
+ * @return False once every set bit has been visited.
+ */
+boolean lluna_Container_Bitset_Next(struct lluna_Container_Bitset_Iterator* Iterator, uint64* Index);
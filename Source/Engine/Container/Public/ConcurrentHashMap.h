@@ -0,0 +1,122 @@
+#pragma once
+
+/**
+ * @file ConcurrentHashMap.h
+ * @brief Hash map shared between threads.
+ *
+ * lluna_Container_ConcurrentHashMap maps `uint64` keys, usually hashes of names from lluna_Core_Hash, to pointers,
+ * and can be used from any number of threads at once without external locking. It suits tables read from every
+ * worker and written occasionally, like asset registries and string intern tables.
+ *
+ * Entries are stored inline in an open addressing table with linear probing. Lookups never lock or write shared
+ * memory: keys never move within a table, so a reader only has to validate, through a sequence counter, that the
+ * tables didn't change while it probed them. Writers lock one of lluna_Container_ConcurrentHashMap_StripeCount
+ * stripes chosen by key, so writers of different keys rarely wait for each other, and claim empty slots with a
+ * compare and swap.
+ *
+ * When a table is half full, a table sized for four times the live entries replaces it and writers move the entries
+ * of the old table over a chunk at a time, while readers keep looking in both. Writers only stop for the brief swap
+ * of the tables. Removed entries keep their slot until the next resize, so tables with many removals are resized to
+ * the same size to clean them up.
+ *
+ * Replaced tables stay alive until the map is destroyed, since a reader may still be probing them. Maps that keep
+ * removing keys and inserting new ones keep growing in memory, so they should be recreated from time to time.
+ */
+
+#include <Engine/Core/Public/Sync.h>
+#include <Engine/Core/Public/Types.h>
+
+struct lluna_Container_ConcurrentHashMap_Table;
+struct lluna_Container_ConcurrentHashMap_Stripe;
+
+/**
+ * @brief Number of writer lock stripes.
+ */
+#define lluna_Container_ConcurrentHashMap_StripeCount 64
+
+/**
+ * @brief Describes a concurrent hash map.
+ *
+ * Should not be written to externally.
+ */
+struct lluna_Container_ConcurrentHashMap
+{
+        struct lluna_Container_ConcurrentHashMap_Table* Current; /**< Table entries are written to. */
+        struct lluna_Container_ConcurrentHashMap_Table* Previous; /**< Table being moved to the current one, or NULL. */
+        struct lluna_Container_ConcurrentHashMap_Table* Retired; /**< Replaced tables, freed on destruction. */
+
+        uint32 Version; /**< Incremented before and after the tables change, so odd while they do. */
+        struct lluna_Core_Sync_Mutex ResizeLock; /**< Held while the tables change. */
+
+        struct lluna_Container_ConcurrentHashMap_Stripe* Stripes; /**< Writer locks and entry counts. */
+};
+
+/**
+ * @brief Creates a concurrent hash map and returns a handle to it.
+ *
+ * Created maps have to be manually destroyed.
+ *
+ * @param InitialCount Number of entries to make room for.
+ * @return Handle to the created map.
+ *
+ * @see lluna_Container_ConcurrentHashMap_Destroy
+ */
+struct lluna_Container_ConcurrentHashMap* lluna_Container_ConcurrentHashMap_Create(uint64 InitialCount);
+/**
+ * @brief Destroys the given map.
+ *
+ * No other thread may be using the map. Values are not owned by the map and are left untouched.
+ *
+ * @param Handle Map to destroy.
+ */
+void lluna_Container_ConcurrentHashMap_Destroy(struct lluna_Container_ConcurrentHashMap* Handle);
+
+/**
+ * @brief Returns the number of entries.
+ *
+ * Only exact when no other thread is writing.
+ *
+ * @param Handle Map to count entries of.
+ * @return Number of entries.
+ */
+uint64 lluna_Container_ConcurrentHashMap_Count(struct lluna_Container_ConcurrentHashMap* Handle);
+/**
+ * @brief Finds the value of a key.
+ *
+ * Never locks.
+ *
+ * @param Handle Map to search.
+ * @param Key Key to search for. Must not be 0.
+ * @return Value of the key, or NULL if it isn't in the map.
+ */
+void* lluna_Container_ConcurrentHashMap_Find(struct lluna_Container_ConcurrentHashMap* Handle, uint64 Key);
+
+/**
+ * @brief Inserts a key or replaces its value.
+ *
+ * @param Handle Map to insert into.
+ * @param Key Key to insert. Must not be 0.
+ * @param Value Value of the key. Must not be NULL.
+ * @return Previous value of the key, or NULL if it was inserted.
+ */
+void* lluna_Container_ConcurrentHashMap_Insert(struct lluna_Container_ConcurrentHashMap* Handle, uint64 Key, void* Value);
+/**
+ * @brief Inserts a key unless it is already in the map.
+ *
+ * When several threads insert the same key at once, all of them get the value of the one that won, which makes
+ * interning safe.
+ *
+ * @param Handle Map to insert into.
+ * @param Key Key to insert. Must not be 0.
+ * @param Value Value of the key. Must not be NULL.
+ * @return Value of the key in the map, which is `Value` if it was inserted.
+ */
+void* lluna_Container_ConcurrentHashMap_FindOrInsert(struct lluna_Container_ConcurrentHashMap* Handle, uint64 Key, void* Value);
+/**
+ * @brief Removes a key.
+ *
+ * @param Handle Map to remove from.
+ * @param Key Key to remove. Must not be 0.
+ * @return Value of the removed key, or NULL if it wasn't in the map.
+ */
+void* lluna_Container_ConcurrentHashMap_Remove(struct lluna_Container_ConcurrentHashMap* Handle, uint64 Key);
@@ -5,6 +5,12 @@
  * @brief Dinamically resizing array.
  *
  * lluna_Container_DynamicArray is a general purpose, dynamically resizing array that stores copies of sized elements received as byte pointers.
+ *
+ * Arrays can share their elements: lluna_Container_DynamicArray_Share creates an array using the same reference counted
+ * buffer in constant time, and the first array written to afterwards copies the elements into a buffer of its own.
+ * This hands frame data over to other threads without copying it, as long as nobody writes to it. Each array must only
+ * be used by one thread at a time, but arrays sharing a buffer can be used and destroyed from different threads.
+ * Elements of shared arrays must not be written to through pointers, call lluna_Container_DynamicArray_Unshare first.
  */
 
 #include <Engine/Core/Public/Types.h>
@@ -26,6 +32,15 @@ struct lluna_Container_DynamicArray {
         uint32 ElementSize; /**< Size of the stored data. Used for index calculations. */
 };
 
+/**
+ * @brief Function deciding whether an element should be removed.
+ *
+ * @param Context User data passed to the removal.
+ * @param Element Handle to the element.
+ * @return True to remove the element.
+ */
+typedef boolean (*lluna_Container_DynamicArray_PredicateFunction)(void* Context, const byte* Element);
+
 /**
  * @brief Creates a dynamic array and returns a handle to it.
  *
@@ -51,6 +66,18 @@ struct lluna_Container_DynamicArray* lluna_Container_DynamicArray_Create(uint64
  * @see lluna_Container_DynamicArray_Destroy
  */
 struct lluna_Container_DynamicArray* lluna_Container_DynamicArray_CreateFromData(byte* Data, uint64 DataSize, uint32 ElementSize);
+/**
+ * @brief Creates a dynamic array sharing the elements of the given array and returns a handle to it.
+ *
+ * Takes constant time. Both arrays keep the elements until one of them is written to.
+ * Created arrays have to be manually destroyed.
+ *
+ * @param Handle Dynamic array to share.
+ * @return Handle to the created array.
+ *
+ * @see lluna_Container_DynamicArray_Destroy
+ */
+struct lluna_Container_DynamicArray* lluna_Container_DynamicArray_Share(struct lluna_Container_DynamicArray* Handle);
 /**
  * @brief Destroys the given dynamic array.
  *
@@ -58,6 +85,22 @@ struct lluna_Container_DynamicArray* lluna_Container_DynamicArray_CreateFromData
  */
 void lluna_Container_DynamicArray_Destroy(struct lluna_Container_DynamicArray* Handle);
 
+/**
+ * @brief Returns true if the array shares its elements with other arrays.
+ *
+ * @param Handle Dynamic array to check.
+ * @return Whether or not the elements are shared.
+ */
+boolean lluna_Container_DynamicArray_Shared(struct lluna_Container_DynamicArray* Handle);
+/**
+ * @brief Copies the elements into a buffer of the array's own if they are shared.
+ *
+ * Has to be called before writing to elements through pointers. Functions modifying the array call it themselves.
+ *
+ * @param Handle Dynamic array to unshare.
+ */
+void lluna_Container_DynamicArray_Unshare(struct lluna_Container_DynamicArray* Handle);
+
 /**
  * @brief Returns true if the array is empty.
  *
@@ -175,6 +218,59 @@ void lluna_Container_DynamicArray_RemoveFirst(struct lluna_Container_DynamicArra
  * @param Handle Dynamic array to remove the last element from.
  */
 void lluna_Container_DynamicArray_RemoveLast(struct lluna_Container_DynamicArray* Handle);
+/**
+ * @brief Removes every element matching the given predicate.
+ *
+ * Preserves the order of the remaining elements. Compacts the array in a single pass, moving each run of kept elements
+ * at most once, and calls the predicate exactly once per element.
+ *
+ * @param Handle Dynamic array to remove the elements from.
+ * @param Predicate Function returning true for the elements to remove.
+ * @param Context User data passed to the predicate.
+ * @return Number of removed elements.
+ *
+ * @see lluna_Container_DynamicArray_RemoveIfUnordered
+ */
+uint64 lluna_Container_DynamicArray_RemoveIf(struct lluna_Container_DynamicArray* Handle, lluna_Container_DynamicArray_PredicateFunction Predicate, void* Context);
+/**
+ * @brief Removes every element matching the given predicate.
+ *
+ * Fills the gaps with kept elements taken from the end of the array, so only as many elements as were removed from
+ * the front are moved. **Does not** preserve the order of the elements.
+ *
+ * @param Handle Dynamic array to remove the elements from.
+ * @param Predicate Function returning true for the elements to remove.
+ * @param Context User data passed to the predicate.
+ * @return Number of removed elements.
+ *
+ * @see lluna_Container_DynamicArray_RemoveIf
+ */
+uint64 lluna_Container_DynamicArray_RemoveIfUnordered(struct lluna_Container_DynamicArray* Handle, lluna_Container_DynamicArray_PredicateFunction Predicate, void* Context);
+/**
+ * @brief Removes the elements at the given indices.
+ *
+ * Preserves the order of the remaining elements. Compacts the array in a single pass.
+ *
+ * @param Handle Dynamic array to remove the elements from.
+ * @param Indices Indices of the elements to remove, sorted in increasing order and without duplicates.
+ * @param Count Number of indices.
+ *
+ * @see lluna_Container_DynamicArray_RemoveIndicesUnordered
+ */
+void lluna_Container_DynamicArray_RemoveIndices(struct lluna_Container_DynamicArray* Handle, const uint64* Indices, uint64 Count);
+/**
+ * @brief Removes the elements at the given indices.
+ *
+ * Replaces each removed element by one from the end of the array, moving at most one element per index.
+ * **Does not** preserve the order of the elements.
+ *
+ * @param Handle Dynamic array to remove the elements from.
+ * @param Indices Indices of the elements to remove, sorted in increasing order and without duplicates.
+ * @param Count Number of indices.
+ *
+ * @see lluna_Container_DynamicArray_RemoveIndices
+ */
+void lluna_Container_DynamicArray_RemoveIndicesUnordered(struct lluna_Container_DynamicArray* Handle, const uint64* Indices, uint64 Count);
 /**
  * @brief Clears the given dynamic array.
  *
@@ -191,7 +287,7 @@ void lluna_Container_DynamicArray_Clear(struct lluna_Container_DynamicArray* Han
  * @param Pointer Iterator variable.
  */
 #define lluna_Container_DynamicArray_ForEach(DynamicArray, Pointer) \
-        for((Pointer) = (DynamicArray)->Data; (Pointer) < (DynamicArray)->Data + (DynamicArray)->Offset; (byte*)(Pointer) += (DynamicArray)->ElementSize)
+        for((Pointer) = (void*)(DynamicArray)->Data; (byte*)(Pointer) < (DynamicArray)->Data + (DynamicArray)->Offset; (Pointer) = (void*)((byte*)(Pointer) + (DynamicArray)->ElementSize))
 
  /**
   * @brief Convenience macro for iterating through all elements of the array in reversed order.
@@ -200,4 +296,4 @@ void lluna_Container_DynamicArray_Clear(struct lluna_Container_DynamicArray* Han
   * @param Pointer Iterator variable.
   */
 #define lluna_Container_DynamicArray_ReversedForEach(DynamicArray, Pointer) \
-        for((Pointer) = (byte*)(DynamicArray)->Data + (DynamicArray)->Offset - (DynamicArray)->ElementSize; (Pointer) >= (DynamicArray)->Data; (byte*)(Pointer) -= (DynamicArray)->ElementSize)
+        for((Pointer) = (void*)((DynamicArray)->Data + (DynamicArray)->Offset - (DynamicArray)->ElementSize); (byte*)(Pointer) >= (DynamicArray)->Data; (Pointer) = (void*)((byte*)(Pointer) - (DynamicArray)->ElementSize))
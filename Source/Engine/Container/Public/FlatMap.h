@@ -0,0 +1,177 @@
+#pragma once
+
+/**
+ * @file FlatMap.h
+ * @brief Sorted flat map and set.
+ *
+ * lluna_Container_FlatMap maps `uint64` keys to fixed size values. Keys are kept sorted in one dynamic array and values
+ * in another, at the same indices, so lookups only touch the keys until they find a match. For small and medium maps
+ * that are read much more often than written this beats lluna_Container_RedBlackTree by a wide margin, as there are
+ * no nodes to chase and the whole map is one or two contiguous blocks.
+ *
+ * Maps with a value size of 0 are sets.
+ *
+ * Lookups use a branchless binary search. Frozen maps can also be searched through a copy of the keys in Eytzinger
+ * order, which keeps the first levels of the search in a few cache lines and lets the next levels be prefetched.
+ * Modifying a frozen map thaws it, dropping the copy until the map is frozen again.
+ *
+ * Single insertions and removals shift the arrays, so building a map one key at a time is quadratic. Staged insertions
+ * are instead sorted together and merged into the map in one linear pass, which also suits building a map in bulk.
+ * String keys, like names, can be hashed with lluna_Core_Hash_Text.
+ *
+ * @see lluna_Container_DynamicArray
+ */
+
+#include <Engine/Core/Public/Types.h>
+
+#include <Engine/Container/Public/DynamicArray.h>
+
+/**
+ * @brief Describes a flat map.
+ *
+ * Should not be written to externally.
+ */
+struct lluna_Container_FlatMap
+{
+        struct lluna_Container_DynamicArray* Keys; /**< Sorted keys. */
+        struct lluna_Container_DynamicArray* Values; /**< Values at the same indices as their keys, or NULL for sets. */
+        struct lluna_Container_DynamicArray* Staged; /**< Staged insertions, each a key followed by its value. */
+
+        uint64* Layout; /**< Keys in Eytzinger order starting at index 1, or NULL. */
+        uint64* LayoutIndices; /**< Index in `Keys` of each key in `Layout`. */
+
+        uint32 ValueSize; /**< Size of each value. */
+        boolean Frozen; /**< True from a freeze until the next modification. */
+};
+
+/**
+ * @brief Creates a flat map and returns a handle to it.
+ *
+ * Created maps have to be manually destroyed.
+ *
+ * @param InitialCount Number of entries to allocate memory for.
+ * @param ValueSize Size of each value, or 0 for a set.
+ * @return Handle to the created map.
+ *
+ * @see lluna_Container_FlatMap_Destroy
+ */
+struct lluna_Container_FlatMap* lluna_Container_FlatMap_Create(uint64 InitialCount, uint32 ValueSize);
+/**
+ * @brief Destroys the given flat map.
+ *
+ * @param Handle Flat map to destroy.
+ */
+void lluna_Container_FlatMap_Destroy(struct lluna_Container_FlatMap* Handle);
+
+/**
+ * @brief Returns the number of entries in the map, not counting staged insertions.
+ *
+ * @param Handle Flat map to count entries of.
+ * @return Number of entries.
+ */
+uint64 lluna_Container_FlatMap_Count(struct lluna_Container_FlatMap* Handle);
+/**
+ * @brief Returns the key at the given index.
+ *
+ * Keys are sorted, so iterating over indices visits them in increasing order.
+ *
+ * @param Handle Flat map to get the key from.
+ * @param Index Index of the entry.
+ * @return Key of the entry.
+ */
+uint64 lluna_Container_FlatMap_KeyAt(struct lluna_Container_FlatMap* Handle, uint64 Index);
+/**
+ * @brief Returns the value at the given index.
+ *
+ * @param Handle Flat map to get the value from.
+ * @param Index Index of the entry.
+ * @return Handle to the value, or NULL for sets.
+ */
+byte* lluna_Container_FlatMap_ValueAt(struct lluna_Container_FlatMap* Handle, uint64 Index);
+
+/**
+ * @brief Returns the index of the first key not less than the given one.
+ *
+ * @param Handle Flat map to search.
+ * @param Key Key to search for.
+ * @return Index of the first key not less than `Key`, or the number of entries if there is none.
+ */
+uint64 lluna_Container_FlatMap_LowerBound(struct lluna_Container_FlatMap* Handle, uint64 Key);
+/**
+ * @brief Returns the index of the given key.
+ *
+ * Searches the Eytzinger layout if the map was frozen with one.
+ *
+ * @param Handle Flat map to search.
+ * @param Key Key to search for.
+ * @return Index of the key, or the number of entries if it isn't in the map.
+ */
+uint64 lluna_Container_FlatMap_IndexOf(struct lluna_Container_FlatMap* Handle, uint64 Key);
+/**
+ * @brief Returns true if the map contains the given key.
+ *
+ * @param Handle Flat map to search.
+ * @param Key Key to search for.
+ * @return Whether or not the key is in the map.
+ */
+boolean lluna_Container_FlatMap_Contains(struct lluna_Container_FlatMap* Handle, uint64 Key);
+/**
+ * @brief Returns the value of the given key.
+ *
+ * @param Handle Flat map to search.
+ * @param Key Key to search for.
+ * @return Handle to the value, or NULL if the key isn't in the map or the map is a set.
+ */
+byte* lluna_Container_FlatMap_Find(struct lluna_Container_FlatMap* Handle, uint64 Key);
+
+/**
+ * @brief Inserts a key, or replaces its value if it is already in the map.
+ *
+ * Shifts every entry after the key. Use lluna_Container_FlatMap_Stage to insert many keys.
+ *
+ * @param Handle Flat map to insert into. Frozen maps are thawed.
+ * @param Key Key to insert.
+ * @param Value Value to copy, ignored for sets.
+ *
+ * @see lluna_Container_FlatMap_Stage
+ */
+void lluna_Container_FlatMap_Insert(struct lluna_Container_FlatMap* Handle, uint64 Key, const byte* Value);
+/**
+ * @brief Removes the given key.
+ *
+ * @param Handle Flat map to remove from. Frozen maps are thawed.
+ * @param Key Key to remove.
+ * @return False if the key wasn't in the map.
+ */
+boolean lluna_Container_FlatMap_Remove(struct lluna_Container_FlatMap* Handle, uint64 Key);
+/**
+ * @brief Queues a key for insertion by the next commit.
+ *
+ * Staged keys aren't visible to lookups until committed. If a key is staged more than once, the last value wins.
+ *
+ * @param Handle Flat map to insert into. Frozen maps are thawed.
+ * @param Key Key to insert.
+ * @param Value Value to copy, ignored for sets.
+ *
+ * @see lluna_Container_FlatMap_Commit
+ */
+void lluna_Container_FlatMap_Stage(struct lluna_Container_FlatMap* Handle, uint64 Key, const byte* Value);
+/**
+ * @brief Inserts all staged keys.
+ *
+ * Staged keys are radix sorted and merged into the map from the back, in place, so the cost is linear in the size of
+ * the map plus the number of staged keys. Staged keys already in the map replace their values.
+ *
+ * @param Handle Flat map to commit.
+ */
+void lluna_Container_FlatMap_Commit(struct lluna_Container_FlatMap* Handle);
+/**
+ * @brief Commits staged keys and prepares the map for lookups.
+ *
+ * Shrinks the arrays to fit and optionally builds the Eytzinger layout used by lluna_Container_FlatMap_IndexOf.
+ *
+ * @param Handle Flat map to freeze.
+ * @param Eytzinger True to build the Eytzinger layout, which takes another 16 bytes per entry. It pays off once the keys
+ *                  no longer fit in the cache.
+ */
+void lluna_Container_FlatMap_Freeze(struct lluna_Container_FlatMap* Handle, boolean Eytzinger);
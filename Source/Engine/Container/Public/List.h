@@ -0,0 +1,179 @@
+#pragma once
+
+/**
+ * @file List.h
+ * @brief Intrusive doubly linked list.
+ *
+ * lluna_Container_List links nodes embedded in the structures being listed, like lluna_Container_RedBlackTree_Node,
+ * so the list never allocates and an element can be unlinked or moved in constant time without searching for it.
+ * lluna_Macros_ContainerOf recovers the structure from its node.
+ *
+ * Lists are circular around a sentinel node stored in the list itself, so linking and unlinking never branch on the
+ * ends of the list. Whole ranges of nodes can be spliced from one list into another in constant time.
+ *
+ * @see lluna_Macros_ContainerOf
+ */
+
+#include <Engine/Core/Public/Macros.h>
+#include <Engine/Core/Public/Types.h>
+
+/**
+ * @brief Describes a list node.
+ */
+struct lluna_Container_List_Node
+{
+        struct lluna_Container_List_Node* Next; /**< Next node, or the sentinel after the last node. */
+        struct lluna_Container_List_Node* Previous; /**< Previous node, or the sentinel before the first node. */
+};
+
+/**
+ * @brief Describes a list.
+ *
+ * Usually embedded in another structure. Must not be moved while it has nodes, as they point back to the sentinel.
+ */
+struct lluna_Container_List
+{
+        struct lluna_Container_List_Node Sentinel; /**< Links to the first and last nodes. */
+};
+
+/**
+ * @brief Initializes an empty list.
+ *
+ * Must be called on all lists before they're used.
+ *
+ * @param Handle List to initialize.
+ */
+void lluna_Container_List_Initialize(struct lluna_Container_List* Handle);
+
+/**
+ * @brief Returns true if the list is empty.
+ *
+ * @param Handle List to check.
+ */
+boolean lluna_Container_List_Empty(struct lluna_Container_List* Handle);
+/**
+ * @brief Returns the number of nodes in the list.
+ *
+ * Walks the whole list.
+ *
+ * @param Handle List to count nodes of.
+ * @return Number of nodes.
+ */
+uint64 lluna_Container_List_Count(struct lluna_Container_List* Handle);
+/**
+ * @brief Gets the first node.
+ *
+ * @param Handle List from which to get the first node.
+ * @return First node, or NULL if the list is empty.
+ */
+struct lluna_Container_List_Node* lluna_Container_List_First(struct lluna_Container_List* Handle);
+/**
+ * @brief Gets the last node.
+ *
+ * @param Handle List from which to get the last node.
+ * @return Last node, or NULL if the list is empty.
+ */
+struct lluna_Container_List_Node* lluna_Container_List_Last(struct lluna_Container_List* Handle);
+/**
+ * @brief Gets the next node.
+ *
+ * @param Handle List the node is in.
+ * @param Node Current node.
+ * @return Next node, or NULL after the last node.
+ */
+struct lluna_Container_List_Node* lluna_Container_List_Next(struct lluna_Container_List* Handle, struct lluna_Container_List_Node* Node);
+/**
+ * @brief Gets the previous node.
+ *
+ * @param Handle List the node is in.
+ * @param Node Current node.
+ * @return Previous node, or NULL before the first node.
+ */
+struct lluna_Container_List_Node* lluna_Container_List_Previous(struct lluna_Container_List* Handle, struct lluna_Container_List_Node* Node);
+
+/**
+ * @brief Links a node before another one.
+ *
+ * @param Position Node to insert before. May be the sentinel of a list, to insert at its end.
+ * @param Node Node to insert. Must not be in a list.
+ */
+void lluna_Container_List_InsertBefore(struct lluna_Container_List_Node* Position, struct lluna_Container_List_Node* Node);
+/**
+ * @brief Links a node after another one.
+ *
+ * @param Position Node to insert after. May be the sentinel of a list, to insert at its start.
+ * @param Node Node to insert. Must not be in a list.
+ */
+void lluna_Container_List_InsertAfter(struct lluna_Container_List_Node* Position, struct lluna_Container_List_Node* Node);
+/**
+ * @brief Inserts a node at the start of the list.
+ *
+ * @param Handle List to insert into.
+ * @param Node Node to insert. Must not be in a list.
+ */
+void lluna_Container_List_PushFront(struct lluna_Container_List* Handle, struct lluna_Container_List_Node* Node);
+/**
+ * @brief Inserts a node at the end of the list.
+ *
+ * @param Handle List to insert into.
+ * @param Node Node to insert. Must not be in a list.
+ */
+void lluna_Container_List_PushBack(struct lluna_Container_List* Handle, struct lluna_Container_List_Node* Node);
+/**
+ * @brief Unlinks a node from whichever list it is in.
+ *
+ * The node's links are cleared.
+ *
+ * @param Node Node to remove.
+ */
+void lluna_Container_List_Remove(struct lluna_Container_List_Node* Node);
+/**
+ * @brief Removes and returns the first node.
+ *
+ * @param Handle List to remove from.
+ * @return Removed node, or NULL if the list is empty.
+ */
+struct lluna_Container_List_Node* lluna_Container_List_PopFront(struct lluna_Container_List* Handle);
+/**
+ * @brief Removes and returns the last node.
+ *
+ * @param Handle List to remove from.
+ * @return Removed node, or NULL if the list is empty.
+ */
+struct lluna_Container_List_Node* lluna_Container_List_PopBack(struct lluna_Container_List* Handle);
+/**
+ * @brief Moves a node of the list to its start.
+ *
+ * @param Handle List the node is in.
+ * @param Node Node to move.
+ */
+void lluna_Container_List_MoveToFront(struct lluna_Container_List* Handle, struct lluna_Container_List_Node* Node);
+/**
+ * @brief Moves a range of nodes before another node.
+ *
+ * The range is unlinked from its list and linked in one piece, in constant time. Nodes don't know which list they
+ * are in, so the range may come from the same list or another one.
+ *
+ * @param Position Node to move the range before. Must not be in the range.
+ * @param First First node of the range.
+ * @param Last Last node of the range, which may be the first one.
+ */
+void lluna_Container_List_Splice(struct lluna_Container_List_Node* Position, struct lluna_Container_List_Node* First, struct lluna_Container_List_Node* Last);
+/**
+ * @brief Moves every node of a list to the end of another one.
+ *
+ * @param Destination List to append the nodes to.
+ * @param Source List to take the nodes from, left empty.
+ */
+void lluna_Container_List_Concatenate(struct lluna_Container_List* Destination, struct lluna_Container_List* Source);
+
+/**
+ * @brief Convenience macro for iterating through all nodes of the list.
+ *
+ * The current node must not be removed while iterating.
+ *
+ * @param List List to iterate.
+ * @param Node Iterator variable, a `struct lluna_Container_List_Node*`.
+ */
+#define lluna_Container_List_ForEach(List, Node) \
+        for ((Node) = (List)->Sentinel.Next; (Node) != &(List)->Sentinel; (Node) = (Node)->Next)
@@ -0,0 +1,159 @@
+#pragma once
+
+/**
+ * @file LruCache.h
+ * @brief Least recently used cache with a size budget.
+ *
+ * lluna_Container_LruCache indexes entries embedded in the cached structures, like decoded assets or glyphs, by a
+ * `uint64` key, and keeps the total of their sizes within a budget by evicting the least recently used ones. Entries
+ * are kept in recency order in a lluna_Container_List and indexed by a hash table chained through the entries
+ * themselves, so lookups, touches and evictions are constant time and the cache never allocates per entry. Only the
+ * bucket array is allocated, and grows with the number of entries.
+ *
+ * The cache doesn't own the entries. Evicted entries are handed to a callback, which usually releases the structure
+ * they are embedded in. String keys, like asset paths, can be hashed with lluna_Core_Hash_Text.
+ *
+ * @see lluna_Container_List
+ */
+
+#include <Engine/Core/Public/Macros.h>
+#include <Engine/Core/Public/Types.h>
+
+#include <Engine/Container/Public/List.h>
+
+/**
+ * @brief Describes a cache entry.
+ *
+ * Embedded in the cached structure, which lluna_Macros_ContainerOf recovers. Should not be written to externally.
+ */
+struct lluna_Container_LruCache_Entry
+{
+        struct lluna_Container_List_Node Node; /**< Position in recency order, most recent first. */
+        struct lluna_Container_LruCache_Entry* NextInBucket; /**< Next entry in the same hash bucket. */
+
+        uint64 Key; /**< Key of the entry. */
+        uint64 Size; /**< Size counted against the budget. */
+};
+
+/**
+ * @brief Function called on each evicted entry.
+ *
+ * The entry is no longer in the cache when called, so it may be released.
+ *
+ * @param Context User data given to the cache.
+ * @param Entry Evicted entry.
+ */
+typedef void (*lluna_Container_LruCache_EvictFunction)(void* Context, struct lluna_Container_LruCache_Entry* Entry);
+
+/**
+ * @brief Describes an LRU cache.
+ *
+ * Should not be written to externally.
+ */
+struct lluna_Container_LruCache
+{
+        struct lluna_Container_List Entries; /**< Entries, most recently used first. */
+        struct lluna_Container_LruCache_Entry** Buckets; /**< Hash buckets, each the first entry of a chain. */
+
+        uint64 BucketCount; /**< Number of buckets, a power of two. */
+        uint64 Count; /**< Number of entries. */
+        uint64 Size; /**< Total size of the entries. */
+        uint64 Budget; /**< Size the entries are kept within. */
+
+        lluna_Container_LruCache_EvictFunction Evict; /**< Called on each evicted entry. */
+        void* Context; /**< User data passed to `Evict`. */
+};
+
+/**
+ * @brief Creates an LRU cache and returns a handle to it.
+ *
+ * Created caches have to be manually destroyed.
+ *
+ * @param Budget Total size the entries are kept within.
+ * @param Evict Function called on each evicted entry, or NULL.
+ * @param Context User data passed to `Evict`.
+ * @return Handle to the created cache.
+ *
+ * @see lluna_Container_LruCache_Destroy
+ */
+struct lluna_Container_LruCache* lluna_Container_LruCache_Create(uint64 Budget, lluna_Container_LruCache_EvictFunction Evict, void* Context);
+/**
+ * @brief Evicts every entry and destroys the given cache.
+ *
+ * @param Handle Cache to destroy.
+ */
+void lluna_Container_LruCache_Destroy(struct lluna_Container_LruCache* Handle);
+
+/**
+ * @brief Returns the number of entries.
+ *
+ * @param Handle Cache to count entries of.
+ * @return Number of entries.
+ */
+uint64 lluna_Container_LruCache_Count(struct lluna_Container_LruCache* Handle);
+/**
+ * @brief Returns the total size of the entries.
+ *
+ * @param Handle Cache to get the size of.
+ * @return Total size of the entries.
+ */
+uint64 lluna_Container_LruCache_Size(struct lluna_Container_LruCache* Handle);
+
+/**
+ * @brief Returns the entry with the given key and marks it as the most recently used.
+ *
+ * @param Handle Cache to search.
+ * @param Key Key to search for.
+ * @return Entry with the key, or NULL if it isn't cached.
+ */
+struct lluna_Container_LruCache_Entry* lluna_Container_LruCache_Find(struct lluna_Container_LruCache* Handle, uint64 Key);
+/**
+ * @brief Returns the entry with the given key without changing its recency.
+ *
+ * @param Handle Cache to search.
+ * @param Key Key to search for.
+ * @return Entry with the key, or NULL if it isn't cached.
+ */
+struct lluna_Container_LruCache_Entry* lluna_Container_LruCache_Peek(struct lluna_Container_LruCache* Handle, uint64 Key);
+/**
+ * @brief Marks an entry as the most recently used.
+ *
+ * @param Handle Cache the entry is in.
+ * @param Entry Entry to touch.
+ */
+void lluna_Container_LruCache_Touch(struct lluna_Container_LruCache* Handle, struct lluna_Container_LruCache_Entry* Entry);
+
+/**
+ * @brief Adds an entry as the most recently used, then evicts entries until the cache fits its budget.
+ *
+ * An entry already cached with the same key is evicted first. Entries larger than the whole budget are evicted right
+ * away, so the entry may have been handed to the eviction callback when this returns.
+ *
+ * @param Handle Cache to insert into.
+ * @param Entry Entry to insert. Must not be in a cache.
+ * @param Key Key of the entry.
+ * @param Size Size counted against the budget.
+ */
+void lluna_Container_LruCache_Insert(struct lluna_Container_LruCache* Handle, struct lluna_Container_LruCache_Entry* Entry, uint64 Key, uint64 Size);
+/**
+ * @brief Removes an entry without evicting it.
+ *
+ * The eviction callback is not called.
+ *
+ * @param Handle Cache the entry is in.
+ * @param Entry Entry to remove.
+ */
+void lluna_Container_LruCache_Remove(struct lluna_Container_LruCache* Handle, struct lluna_Container_LruCache_Entry* Entry);
+/**
+ * @brief Changes the budget, evicting entries until the cache fits it.
+ *
+ * @param Handle Cache to change the budget of.
+ * @param Budget Total size the entries are kept within.
+ */
+void lluna_Container_LruCache_SetBudget(struct lluna_Container_LruCache* Handle, uint64 Budget);
+/**
+ * @brief Evicts every entry.
+ *
+ * @param Handle Cache to clear.
+ */
+void lluna_Container_LruCache_Clear(struct lluna_Container_LruCache* Handle);
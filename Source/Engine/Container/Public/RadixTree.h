@@ -0,0 +1,129 @@
+#pragma once
+
+/**
+ * @file RadixTree.h
+ * @brief Adaptive radix tree keyed by text.
+ *
+ * lluna_Container_RadixTree maps hierarchical text keys, like asset paths, console commands or config keys, to
+ * values. Each level of the tree consumes one byte of the key, so a lookup costs about one node per key byte instead
+ * of a full string comparison per level, and shared prefixes are compared once.
+ *
+ * Inner nodes adapt their layout to their number of children: up to 4 and 16 children are stored as sorted key bytes
+ * searched linearly, with SSE2 for 16, up to 48 children through a 256 byte index, and more directly by byte. Chains of
+ * single children are compressed into a prefix stored in the node, and keys with no siblings are stored in leaves
+ * high up in the tree until another key needs to tell them apart. Leaves hold a copy of their key, so the tree doesn't
+ * keep pointers to the texts it was given.
+ *
+ * Keys may be prefixes of each other. Besides exact lookups, the tree finds the longest key that is a prefix of a
+ * text and visits every key with a given prefix in lexicographic order.
+ *
+ * Trailing null terminators are not part of the keys, so texts created with lluna_Macros_Text can be used directly.
+ *
+ * @see lluna_Macros_TextLength
+ */
+
+#include <Engine/Core/Public/Macros.h>
+#include <Engine/Core/Public/Types.h>
+
+/**
+ * @brief Describes a radix tree.
+ *
+ * Nodes are private to the implementation. Should not be written to externally.
+ */
+struct lluna_Container_RadixTree
+{
+        void* Root; /**< Root node or leaf, or NULL when empty. */
+        uint64 Count; /**< Number of keys. */
+};
+
+/**
+ * @brief Function called on each visited key.
+ *
+ * @param Context User data given to the visit.
+ * @param Key Key, valid until the tree is modified. Not null terminated.
+ * @param Value Value of the key.
+ * @return False to stop visiting.
+ */
+typedef boolean (*lluna_Container_RadixTree_VisitFunction)(void* Context, struct lluna_Core_Types_Text Key, void* Value);
+
+/**
+ * @brief Creates an empty radix tree and returns a handle to it.
+ *
+ * Created trees have to be manually destroyed.
+ *
+ * @return Handle to the created tree.
+ *
+ * @see lluna_Container_RadixTree_Destroy
+ */
+struct lluna_Container_RadixTree* lluna_Container_RadixTree_Create();
+/**
+ * @brief Destroys the given radix tree.
+ *
+ * Values are not owned by the tree and are left untouched.
+ *
+ * @param Handle Tree to destroy.
+ */
+void lluna_Container_RadixTree_Destroy(struct lluna_Container_RadixTree* Handle);
+
+/**
+ * @brief Returns the number of keys.
+ *
+ * @param Handle Tree to count keys of.
+ * @return Number of keys.
+ */
+uint64 lluna_Container_RadixTree_Count(struct lluna_Container_RadixTree* Handle);
+/**
+ * @brief Finds the value of a key.
+ *
+ * @param Handle Tree to search.
+ * @param Key Key to search for.
+ * @return Value of the key, or NULL if it isn't in the tree.
+ */
+void* lluna_Container_RadixTree_Find(struct lluna_Container_RadixTree* Handle, struct lluna_Core_Types_Text Key);
+/**
+ * @brief Finds the longest key that is a prefix of the given text.
+ *
+ * Useful to resolve a path to the closest registered directory, or a command line to its command.
+ *
+ * @param Handle Tree to search.
+ * @param Text Text to match keys against.
+ * @param Length Set to the length of the matched key if not NULL. Untouched if there is no match.
+ * @return Value of the longest matching key, or NULL if no key is a prefix of the text.
+ */
+void* lluna_Container_RadixTree_LongestPrefix(struct lluna_Container_RadixTree* Handle, struct lluna_Core_Types_Text Text, uint64* Length);
+/**
+ * @brief Visits every key starting with the given prefix, in lexicographic order.
+ *
+ * The tree must not be modified while visiting.
+ *
+ * @param Handle Tree to visit.
+ * @param Prefix Prefix of the keys to visit. Empty to visit every key.
+ * @param Visit Function called on each key.
+ * @param Context User data passed to `Visit`.
+ * @return False if `Visit` stopped the visit.
+ */
+boolean lluna_Container_RadixTree_VisitPrefix(struct lluna_Container_RadixTree* Handle, struct lluna_Core_Types_Text Prefix, lluna_Container_RadixTree_VisitFunction Visit, void* Context);
+
+/**
+ * @brief Inserts a key or replaces its value.
+ *
+ * @param Handle Tree to insert into.
+ * @param Key Key to insert. Copied into the tree.
+ * @param Value Value of the key. Must not be NULL.
+ * @return Previous value of the key, or NULL if it was inserted.
+ */
+void* lluna_Container_RadixTree_Insert(struct lluna_Container_RadixTree* Handle, struct lluna_Core_Types_Text Key, void* Value);
+/**
+ * @brief Removes a key.
+ *
+ * @param Handle Tree to remove from.
+ * @param Key Key to remove.
+ * @return Value of the removed key, or NULL if it wasn't in the tree.
+ */
+void* lluna_Container_RadixTree_Remove(struct lluna_Container_RadixTree* Handle, struct lluna_Core_Types_Text Key);
+/**
+ * @brief Removes every key.
+ *
+ * @param Handle Tree to clear.
+ */
+void lluna_Container_RadixTree_Clear(struct lluna_Container_RadixTree* Handle);
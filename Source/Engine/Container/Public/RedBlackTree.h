@@ -5,8 +5,20 @@
  * @brief Base logic for red-black trees.
  *
  * lluna_Container_RedBlackTree is a general purpose red black tree base implementation.
+ *
+ * Trees read by many threads and written by one can publish snapshots for lock-free readers. A snapshot lists the
+ * nodes of the tree in order, so readers walk it by index and binary search it instead of following links the writer
+ * may be rotating. The writer keeps modifying the tree as usual and publishes a new snapshot once it's done with a
+ * batch of changes, like once per frame. Replaced snapshots are retired to a lluna_Core_Epoch domain, and readers
+ * access snapshots inside its read sections. Readers never lock and never write shared memory.
+ *
+ * Nodes listed in a snapshot are read in place, so removed nodes have to be retired to the domain as well instead of
+ * being freed, and the keys of listed nodes must not change.
+ *
+ * @see lluna_Core_Epoch
  */
 
+#include <Engine/Core/Public/Epoch.h>
 #include <Engine/Core/Public/Macros.h>
 #include <Engine/Core/Public/Types.h>
 
@@ -34,14 +46,34 @@ struct lluna_Container_RedBlackTree_Node
         struct lluna_Container_RedBlackTree_Node* Left; /**< Left subtree. */
         struct lluna_Container_RedBlackTree_Node* Right; /**< Right subtree. */
 };
+/**
+ * @brief Describes a published snapshot of a red-black tree.
+ *
+ * Should not be written to externally.
+ */
+struct lluna_Container_RedBlackTree_Snapshot
+{
+        uint64 Count; /**< Number of nodes. */
+        struct lluna_Container_RedBlackTree_Node* Nodes[]; /**< Nodes in order. */
+};
 /**
  * @brief Describes a red-black tree.
  */
 struct lluna_Container_RedBlackTree
 {
         struct lluna_Container_RedBlackTree_Node* Root; /**< Root of the tree. */
+        struct lluna_Container_RedBlackTree_Snapshot* Snapshot; /**< Last published snapshot. */
 };
 
+/**
+ * @brief Function comparing a searched key to a node.
+ *
+ * @param Context User data given to the search, usually the key.
+ * @param Node Node to compare to.
+ * @return Negative if the node orders before the key, zero if it matches and positive if it orders after.
+ */
+typedef int32 (*lluna_Container_RedBlackTree_CompareFunction)(void* Context, struct lluna_Container_RedBlackTree_Node* Node);
+
 /**
  * @brief Creates a red-black tree and returns a handle to it.
  *
@@ -63,6 +95,8 @@ void lluna_Container_RedBlackTree_InitializeNode(struct lluna_Container_RedBlack
 /**
  * @brief Destroys the given red-black tree.
  *
+ * Frees the last published snapshot, so no reader may be using it.
+ *
  * @param Handle Red-black tree to destroy.
  */
 void lluna_Container_RedBlackTree_Destroy(struct lluna_Container_RedBlackTree* Handle);
@@ -137,6 +171,37 @@ void lluna_Container_RedBlackTree_InsertFixup(struct lluna_Container_RedBlackTre
  */
 void lluna_Container_RedBlackTree_Remove(struct lluna_Container_RedBlackTree* Handle, struct lluna_Container_RedBlackTree_Node* Node);
 
+/**
+ * @brief Publishes a snapshot of the tree as it is now.
+ *
+ * Takes time linear in the number of nodes. The replaced snapshot is retired to the domain, and the domain reclaims
+ * what it can.
+ *
+ * @param Handle Tree to publish.
+ * @param Epoch Domain of the readers.
+ */
+void lluna_Container_RedBlackTree_Publish(struct lluna_Container_RedBlackTree* Handle, struct lluna_Core_Epoch* Epoch);
+/**
+ * @brief Returns the last published snapshot.
+ *
+ * Can be called from any thread. The snapshot stays valid until the calling thread leaves its read section.
+ *
+ * @param Handle Tree to read.
+ * @return Last published snapshot, empty until the tree is published.
+ *
+ * @see lluna_Core_Epoch_Enter
+ */
+struct lluna_Container_RedBlackTree_Snapshot* lluna_Container_RedBlackTree_Acquire(struct lluna_Container_RedBlackTree* Handle);
+/**
+ * @brief Binary searches a snapshot for the first node that doesn't order before a key.
+ *
+ * @param Snapshot Snapshot to search.
+ * @param Compare Function comparing the key to nodes.
+ * @param Context User data passed to `Compare`.
+ * @return Index of the first node not ordering before the key, or the number of nodes if there is none.
+ */
+uint64 lluna_Container_RedBlackTree_LowerBound(struct lluna_Container_RedBlackTree_Snapshot* Snapshot, lluna_Container_RedBlackTree_CompareFunction Compare, void* Context);
+
 /**
  @brief Convenience macro for iterating through all nodes of the tree in order.
 
@@ -0,0 +1,132 @@
+#pragma once
+
+/**
+ * @file SlotMap.h
+ * @brief Generational slot map.
+ *
+ * lluna_Container_SlotMap stores fixed size values and hands out keys that stay valid until their value is removed,
+ * unlike indices into a lluna_Container_DynamicArray, which lluna_Container_DynamicArray_Remove silently changes.
+ *
+ * Keys are a 32 bit slot index and a 32 bit generation. Each slot remembers where its value lives and the generation
+ * of its current occupant, so lookups are two array reads and a key whose value was removed, even if its slot was
+ * reused, is detected instead of aliasing the new value. Insertion, removal and lookup are constant time.
+ *
+ * Values are kept densely packed in a dynamic array, in no particular order, so iterating over them is linear and
+ * touches no holes. Removal moves the last value into the gap.
+ *
+ * @see lluna_Container_SparseSet
+ */
+
+#include <Engine/Core/Public/Types.h>
+
+#include <Engine/Container/Public/DynamicArray.h>
+
+/**
+ * @brief Slot index of keys that don't refer to any value.
+ */
+#define lluna_Container_SlotMap_InvalidIndex 0xFFFFFFFF
+
+/**
+ * @brief Identifies a value in a slot map.
+ */
+struct lluna_Container_SlotMap_Key
+{
+        uint32 Index; /**< Slot of the value. */
+        uint32 Generation; /**< Generation of the slot when the value was inserted. */
+};
+
+/**
+ * @brief Describes a slot map.
+ *
+ * Should not be written to externally.
+ */
+struct lluna_Container_SlotMap
+{
+        struct lluna_Container_DynamicArray* Values; /**< Densely packed values. May be iterated directly. */
+        struct lluna_Container_DynamicArray* Owners; /**< Slot index of each value, at the same indices as the values. */
+        struct lluna_Container_DynamicArray* Slots; /**< Dense index and generation of each slot. */
+
+        uint32 FreeSlot; /**< First free slot, each free slot storing the next one in place of its dense index. */
+};
+
+/**
+ * @brief Creates a slot map and returns a handle to it.
+ *
+ * Created slot maps have to be manually destroyed.
+ *
+ * @param InitialCount Number of values to allocate memory for.
+ * @param ElementSize Size of each value.
+ * @return Handle to the created slot map.
+ *
+ * @see lluna_Container_SlotMap_Destroy
+ */
+struct lluna_Container_SlotMap* lluna_Container_SlotMap_Create(uint64 InitialCount, uint32 ElementSize);
+/**
+ * @brief Destroys the given slot map.
+ *
+ * @param Handle Slot map to destroy.
+ */
+void lluna_Container_SlotMap_Destroy(struct lluna_Container_SlotMap* Handle);
+
+/**
+ * @brief Returns the number of values in the slot map.
+ *
+ * @param Handle Slot map to count values of.
+ * @return Number of values.
+ */
+uint64 lluna_Container_SlotMap_Count(struct lluna_Container_SlotMap* Handle);
+/**
+ * @brief Returns true if the given key refers to a value in the slot map.
+ *
+ * @param Handle Slot map to search.
+ * @param Key Key to check.
+ * @return Whether or not the key is valid.
+ */
+boolean lluna_Container_SlotMap_Contains(struct lluna_Container_SlotMap* Handle, struct lluna_Container_SlotMap_Key Key);
+/**
+ * @brief Returns the value of the given key.
+ *
+ * The returned handle is invalidated by insertions and removals.
+ *
+ * @param Handle Slot map to search.
+ * @param Key Key of the value.
+ * @return Handle to the value, or NULL if the key is not valid.
+ */
+byte* lluna_Container_SlotMap_Get(struct lluna_Container_SlotMap* Handle, struct lluna_Container_SlotMap_Key Key);
+/**
+ * @brief Returns the key of the value at the given dense index.
+ *
+ * Used to recover keys while iterating over the values.
+ *
+ * @param Handle Slot map to get the key from.
+ * @param Index Index of the value in `Values`.
+ * @return Key of the value.
+ */
+struct lluna_Container_SlotMap_Key lluna_Container_SlotMap_KeyAt(struct lluna_Container_SlotMap* Handle, uint64 Index);
+
+/**
+ * @brief Inserts a value and returns its key.
+ *
+ * Reuses the most recently freed slot, if any.
+ *
+ * @param Handle Slot map to insert into.
+ * @param Value Value to copy.
+ * @return Key of the inserted value.
+ */
+struct lluna_Container_SlotMap_Key lluna_Container_SlotMap_Insert(struct lluna_Container_SlotMap* Handle, const byte* Value);
+/**
+ * @brief Removes the value of the given key.
+ *
+ * Moves the last value into the gap and invalidates every copy of the key.
+ *
+ * @param Handle Slot map to remove from.
+ * @param Key Key of the value.
+ * @return False if the key was not valid.
+ */
+boolean lluna_Container_SlotMap_Remove(struct lluna_Container_SlotMap* Handle, struct lluna_Container_SlotMap_Key Key);
+/**
+ * @brief Removes every value, invalidating all keys.
+ *
+ * @param Handle Slot map to clear.
+ */
+void lluna_Container_SlotMap_Clear(struct lluna_Container_SlotMap* Handle);
@@ -0,0 +1,414 @@
+#pragma once
+
+/**
+ * @file Sort.h
+ * @brief Comparison and radix sorts for dynamic arrays.
+ *
+ * lluna_Container_Sort_Define generates a pattern-defeating quicksort (pdqsort, Peters 2021) specialized for one element type.
+ * The comparison is expanded inline, so there is no indirect call per comparison and elements are moved as whole values
+ * instead of byte by byte. Random inputs sort like introsort, while sorted, reversed and mostly sorted runs and inputs
+ * with many equal elements finish in linear time. Adversarial inputs are shuffled, falling back to heapsort if they
+ * keep producing bad partitions, so the worst case stays O(n log n). The sort is not stable.
+ *
+ * The radix sorts are stable LSD sorts over unsigned integer keys, one byte per pass. Histograms for every pass are
+ * counted in a single read of the input, and passes where all keys share the same byte are skipped.
+ * They take O(n) time and a scratch buffer as big as the array. If no scratch buffer can be allocated they fall back to
+ * a stable insertion sort in place, which is O(n^2).
+ *
+ * @see lluna_Container_DynamicArray
+ */
+
+#include <Engine/Core/Public/Types.h>
+
+#include <Engine/Container/Public/DynamicArray.h>
+
+/**
+ * @brief Ranges shorter than this are insertion sorted.
+ */
+#define lluna_Container_Sort_InsertionSortThreshold 24
+
+/**
+ * @brief Ranges longer than this pick the pivot as the median of three medians instead of the median of three elements.
+ */
+#define lluna_Container_Sort_NintherThreshold 128
+
+/**
+ * @brief Number of element moves after which an optimistic insertion sort of an already partitioned range gives up.
+ */
+#define lluna_Container_Sort_PartialInsertionSortLimit 8
+
+/**
+ * @brief Ordering for arithmetic element types, to be passed to lluna_Container_Sort_Define.
+ *
+ * @param Left Pointer to the first element.
+ * @param Right Pointer to the second element.
+ */
+#define lluna_Container_Sort_LessValue(Left, Right) (*(Left) < *(Right))
+
+/**
+ * @brief Defines a sort specialized for one element type.
+ *
+ * Generates two static functions:
+ * - `void Name(struct lluna_Container_DynamicArray* Handle)`, sorting a dynamic array whose elements are of type `Type`.
+ * - `void Name##_Range(Type* Data, uint64 Count)`, sorting a plain array.
+ *
+ * The ordering is a function or function-like macro taking two `const Type*` and returning non-zero if the first
+ * element goes strictly before the second. It must be a strict weak ordering.
+ *
+ * @param Name Name of the generated sort function.
+ * @param Type Type of the elements.
+ * @param Less Ordering of the elements.
+ *
+ * @see lluna_Container_Sort_LessValue
+ */
+#define lluna_Container_Sort_Define(Name, Type, Less) \
+        static inline void Name##_Swap(Type* Left, Type* Right) \
+        { \
+                Type Temporary = *Left; \
+                *Left = *Right; \
+                *Right = Temporary; \
+        } \
+        \
+        static inline void Name##_Sort2(Type* First, Type* Second) \
+        { \
+                if (Less(Second, First)) \
+                { \
+                        Name##_Swap(First, Second); \
+                } \
+        } \
+        \
+        static inline void Name##_Sort3(Type* First, Type* Second, Type* Third) \
+        { \
+                Name##_Sort2(First, Second); \
+                Name##_Sort2(Second, Third); \
+                Name##_Sort2(First, Second); \
+        } \
+        \
+        static inline void Name##_InsertionSort(Type* Begin, Type* End) \
+        { \
+                for (Type* Current = Begin + (Begin != End); Current < End; ++Current) \
+                { \
+                        if (Less(Current, Current - 1)) \
+                        { \
+                                Type Temporary = *Current; \
+                                Type* Sift = Current; \
+                                do \
+                                { \
+                                        *Sift = *(Sift - 1); \
+                                        --Sift; \
+                                } while (Sift != Begin && Less(&Temporary, Sift - 1)); \
+                                *Sift = Temporary; \
+                        } \
+                } \
+        } \
+        \
+        /* Needs an element before Begin that is not greater than any element of the range. */ \
+        static inline void Name##_UnguardedInsertionSort(Type* Begin, Type* End) \
+        { \
+                for (Type* Current = Begin + (Begin != End); Current < End; ++Current) \
+                { \
+                        if (Less(Current, Current - 1)) \
+                        { \
+                                Type Temporary = *Current; \
+                                Type* Sift = Current; \
+                                do \
+                                { \
+                                        *Sift = *(Sift - 1); \
+                                        --Sift; \
+                                } while (Less(&Temporary, Sift - 1)); \
+                                *Sift = Temporary; \
+                        } \
+                } \
+        } \
+        \
+        /* Returns false, leaving the range partly sorted, once too many elements had to be moved. */ \
+        static inline boolean Name##_PartialInsertionSort(Type* Begin, Type* End) \
+        { \
+                uint64 Moves = 0; \
+                for (Type* Current = Begin + (Begin != End); Current < End; ++Current) \
+                { \
+                        if (Less(Current, Current - 1)) \
+                        { \
+                                Type Temporary = *Current; \
+                                Type* Sift = Current; \
+                                do \
+                                { \
+                                        *Sift = *(Sift - 1); \
+                                        --Sift; \
+                                } while (Sift != Begin && Less(&Temporary, Sift - 1)); \
+                                *Sift = Temporary; \
+                                \
+                                Moves += (uint64)(Current - Sift); \
+                                if (Moves > lluna_Container_Sort_PartialInsertionSortLimit) \
+                                { \
+                                        return false; \
+                                } \
+                        } \
+                } \
+                \
+                return true; \
+        } \
+        \
+        /* Moves elements less than the pivot at Begin to its left. Equal elements end up on the right. */ \
+        static inline Type* Name##_PartitionRight(Type* Begin, Type* End, boolean* AlreadyPartitioned) \
+        { \
+                Type Pivot = *Begin; \
+                Type* First = Begin; \
+                Type* Last = End; \
+                \
+                /* The pivot is a median, so an element not less than it stops the first scan. */ \
+                while (Less(++First, &Pivot)) \
+                { \
+                } \
+                if (First - 1 == Begin) \
+                { \
+                        while (First < Last && !Less(--Last, &Pivot)) \
+                        { \
+                        } \
+                } \
+                else \
+                { \
+                        while (!Less(--Last, &Pivot)) \
+                        { \
+                        } \
+                } \
+                \
+                *AlreadyPartitioned = First >= Last; \
+                while (First < Last) \
+                { \
+                        Name##_Swap(First, Last); \
+                        while (Less(++First, &Pivot)) \
+                        { \
+                        } \
+                        while (!Less(--Last, &Pivot)) \
+                        { \
+                        } \
+                } \
+                \
+                Type* PivotPosition = First - 1; \
+                *Begin = *PivotPosition; \
+                *PivotPosition = Pivot; \
+                \
+                return PivotPosition; \
+        } \
+        \
+        /* Moves elements equal to the pivot at Begin to its left, used when many elements are equal. */ \
+        static inline Type* Name##_PartitionLeft(Type* Begin, Type* End) \
+        { \
+                Type Pivot = *Begin; \
+                Type* First = Begin; \
+                Type* Last = End; \
+                \
+                while (Less(&Pivot, --Last)) \
+                { \
+                } \
+                if (Last + 1 == End) \
+                { \
+                        while (First < Last && !Less(&Pivot, ++First)) \
+                        { \
+                        } \
+                } \
+                else \
+                { \
+                        while (!Less(&Pivot, ++First)) \
+                        { \
+                        } \
+                } \
+                \
+                while (First < Last) \
+                { \
+                        Name##_Swap(First, Last); \
+                        while (Less(&Pivot, --Last)) \
+                        { \
+                        } \
+                        while (!Less(&Pivot, ++First)) \
+                        { \
+                        } \
+                } \
+                \
+                *Begin = *Last; \
+                *Last = Pivot; \
+                \
+                return Last; \
+        } \
+        \
+        static inline void Name##_SiftDown(Type* Data, uint64 Root, uint64 Count) \
+        { \
+                for (uint64 Child = 2 * Root + 1; Child < Count; Root = Child, Child = 2 * Root + 1) \
+                { \
+                        if (Child + 1 < Count && Less(&Data[Child], &Data[Child + 1])) \
+                        { \
+                                ++Child; \
+                        } \
+                        if (!Less(&Data[Root], &Data[Child])) \
+                        { \
+                                return; \
+                        } \
+                        Name##_Swap(&Data[Root], &Data[Child]); \
+                } \
+        } \
+        \
+        static inline void Name##_HeapSort(Type* Begin, Type* End) \
+        { \
+                uint64 Count = (uint64)(End - Begin); \
+                for (uint64 Root = Count / 2; Root > 0; --Root) \
+                { \
+                        Name##_SiftDown(Begin, Root - 1, Count); \
+                } \
+                for (uint64 Last = Count; Last > 1; --Last) \
+                { \
+                        Name##_Swap(&Begin[0], &Begin[Last - 1]); \
+                        Name##_SiftDown(Begin, 0, Last - 1); \
+                } \
+        } \
+        \
+        /* Swaps a few elements of each side of a bad partition into new places, breaking up adversarial patterns. */ \
+        static inline void Name##_BreakPatterns(Type* Begin, Type* End, Type* Pivot) \
+        { \
+                uint64 LeftSize = (uint64)(Pivot - Begin); \
+                uint64 RightSize = (uint64)(End - (Pivot + 1)); \
+                \
+                if (LeftSize >= lluna_Container_Sort_InsertionSortThreshold) \
+                { \
+                        Name##_Swap(Begin, Begin + LeftSize / 4); \
+                        Name##_Swap(Pivot - 1, Pivot - LeftSize / 4); \
+                        if (LeftSize > lluna_Container_Sort_NintherThreshold) \
+                        { \
+                                Name##_Swap(Begin + 1, Begin + (LeftSize / 4 + 1)); \
+                                Name##_Swap(Begin + 2, Begin + (LeftSize / 4 + 2)); \
+                                Name##_Swap(Pivot - 2, Pivot - (LeftSize / 4 + 1)); \
+                                Name##_Swap(Pivot - 3, Pivot - (LeftSize / 4 + 2)); \
+                        } \
+                } \
+                if (RightSize >= lluna_Container_Sort_InsertionSortThreshold) \
+                { \
+                        Name##_Swap(Pivot + 1, Pivot + (1 + RightSize / 4)); \
+                        Name##_Swap(End - 1, End - RightSize / 4); \
+                        if (RightSize > lluna_Container_Sort_NintherThreshold) \
+                        { \
+                                Name##_Swap(Pivot + 2, Pivot + (2 + RightSize / 4)); \
+                                Name##_Swap(Pivot + 3, Pivot + (3 + RightSize / 4)); \
+                                Name##_Swap(End - 2, End - (1 + RightSize / 4)); \
+                                Name##_Swap(End - 3, End - (2 + RightSize / 4)); \
+                        } \
+                } \
+        } \
+        \
+        static void Name##_Loop(Type* Begin, Type* End, int32 BadAllowed, boolean Leftmost) \
+        { \
+                for (;;) \
+                { \
+                        uint64 Size = (uint64)(End - Begin); \
+                        if (Size < lluna_Container_Sort_InsertionSortThreshold) \
+                        { \
+                                if (Leftmost) \
+                                { \
+                                        Name##_InsertionSort(Begin, End); \
+                                } \
+                                else \
+                                { \
+                                        Name##_UnguardedInsertionSort(Begin, End); \
+                                } \
+                                return; \
+                        } \
+                        \
+                        /* Moves the pivot to Begin. */ \
+                        uint64 Half = Size / 2; \
+                        if (Size > lluna_Container_Sort_NintherThreshold) \
+                        { \
+                                Name##_Sort3(Begin, Begin + Half, End - 1); \
+                                Name##_Sort3(Begin + 1, Begin + (Half - 1), End - 2); \
+                                Name##_Sort3(Begin + 2, Begin + (Half + 1), End - 3); \
+                                Name##_Sort3(Begin + (Half - 1), Begin + Half, Begin + (Half + 1)); \
+                                Name##_Swap(Begin, Begin + Half); \
+                        } \
+                        else \
+                        { \
+                                Name##_Sort3(Begin + Half, Begin, End - 1); \
+                        } \
+                        \
+                        /* The element before a right hand range is a previous pivot. If it equals this pivot, */ \
+                        /* every element equal to the pivot is in place once partitioned to the left. */ \
+                        if (!Leftmost && !Less(Begin - 1, Begin)) \
+                        { \
+                                Begin = Name##_PartitionLeft(Begin, End) + 1; \
+                                continue; \
+                        } \
+                        \
+                        boolean AlreadyPartitioned; \
+                        Type* Pivot = Name##_PartitionRight(Begin, End, &AlreadyPartitioned); \
+                        uint64 LeftSize = (uint64)(Pivot - Begin); \
+                        uint64 RightSize = (uint64)(End - (Pivot + 1)); \
+                        \
+                        if (LeftSize < Size / 8 || RightSize < Size / 8) \
+                        { \
+                                if (--BadAllowed == 0) \
+                                { \
+                                        Name##_HeapSort(Begin, End); \
+                                        return; \
+                                } \
+                                Name##_BreakPatterns(Begin, End, Pivot); \
+                        } \
+                        else if (AlreadyPartitioned && Name##_PartialInsertionSort(Begin, Pivot) && Name##_PartialInsertionSort(Pivot + 1, End)) \
+                        { \
+                                return; \
+                        } \
+                        \
+                        Name##_Loop(Begin, Pivot, BadAllowed, Leftmost); \
+                        Begin = Pivot + 1; \
+                        Leftmost = false; \
+                } \
+        } \
+        \
+        static inline void Name##_Range(Type* Data, uint64 Count) \
+        { \
+                if (Count > 1) \
+                { \
+                        Name##_Loop(Data, Data + Count, 63 - __builtin_clzll(Count), true); \
+                } \
+        } \
+        \
+        static inline void Name(struct lluna_Container_DynamicArray* Handle) \
+        { \
+                lluna_Container_DynamicArray_Unshare(Handle); \
+                Name##_Range((Type*)Handle->Data, lluna_Container_DynamicArray_Count(Handle)); \
+        }
+
+/**
+ * @brief Sorts a dynamic array of `uint32` elements.
+ *
+ * @param Handle Dynamic array to sort.
+ * @param Scratch Dynamic array whose memory is used as scratch space, grown to fit if needed, or NULL to allocate some for this call.
+ *
+ * @see lluna_Container_Sort_RadixKey32
+ */
+void lluna_Container_Sort_Radix32(struct lluna_Container_DynamicArray* Handle, struct lluna_Container_DynamicArray* Scratch);
+/**
+ * @brief Sorts a dynamic array of `uint64` elements.
+ *
+ * @param Handle Dynamic array to sort.
+ * @param Scratch Dynamic array whose memory is used as scratch space, grown to fit if needed, or NULL to allocate some for this call.
+ *
+ * @see lluna_Container_Sort_RadixKey64
+ */
+void lluna_Container_Sort_Radix64(struct lluna_Container_DynamicArray* Handle, struct lluna_Container_DynamicArray* Scratch);
+/**
+ * @brief Sorts a dynamic array by a `uint32` key stored in each element.
+ *
+ * The rest of each element is moved along with its key. Elements with equal keys keep their order.
+ *
+ * @param Handle Dynamic array to sort.
+ * @param KeyOffset Offset of the key in bytes from the start of each element.
+ * @param Scratch Dynamic array whose memory is used as scratch space, grown to fit if needed, or NULL to allocate some for this call.
+ */
+void lluna_Container_Sort_RadixKey32(struct lluna_Container_DynamicArray* Handle, uint32 KeyOffset, struct lluna_Container_DynamicArray* Scratch);
+/**
+ * @brief Sorts a dynamic array by a `uint64` key stored in each element.
+ *
+ * The rest of each element is moved along with its key. Elements with equal keys keep their order.
+ *
+ * @param Handle Dynamic array to sort.
+ * @param KeyOffset Offset of the key in bytes from the start of each element.
+ * @param Scratch Dynamic array whose memory is used as scratch space, grown to fit if needed, or NULL to allocate some for this call.
+ */
+void lluna_Container_Sort_RadixKey64(struct lluna_Container_DynamicArray* Handle, uint32 KeyOffset, struct lluna_Container_DynamicArray* Scratch);
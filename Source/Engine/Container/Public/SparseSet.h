@@ -0,0 +1,125 @@
+#pragma once
+
+/**
+ * @file SparseSet.h
+ * @brief Sparse set of integer ids with attached values.
+ *
+ * lluna_Container_SparseSet maps `uint32` ids, like entity indices, to fixed size values, which makes it suitable as a
+ * component pool. A sparse array indexed by id holds the position of each id in a dense array, and the dense array
+ * holds the ids themselves, so insertion, removal and lookup are constant time while the ids and values stay densely
+ * packed for linear iteration. Removal moves the last entry into the gap.
+ *
+ * The sparse array grows to the largest inserted id, taking 4 bytes per id, so ids should be small and reused, like
+ * the slot indices of lluna_Container_SlotMap keys. Sets with a value size of 0 only store ids.
+ *
+ * @see lluna_Container_SlotMap
+ */
+
+#include <Engine/Core/Public/Types.h>
+
+#include <Engine/Container/Public/DynamicArray.h>
+
+/**
+ * @brief Dense index of ids that aren't in the set.
+ */
+#define lluna_Container_SparseSet_InvalidIndex 0xFFFFFFFF
+
+/**
+ * @brief Describes a sparse set.
+ *
+ * Should not be written to externally.
+ */
+struct lluna_Container_SparseSet
+{
+        struct lluna_Container_DynamicArray* Ids; /**< Densely packed ids. May be iterated directly. */
+        struct lluna_Container_DynamicArray* Values; /**< Values at the same indices as their ids, or NULL. */
+        struct lluna_Container_DynamicArray* Sparse; /**< Dense index of each id, or lluna_Container_SparseSet_InvalidIndex. */
+};
+
+/**
+ * @brief Creates a sparse set and returns a handle to it.
+ *
+ * Created sparse sets have to be manually destroyed.
+ *
+ * @param InitialCount Number of entries to allocate memory for.
+ * @param ValueSize Size of each value, or 0 to only store ids.
+ * @return Handle to the created sparse set.
+ *
+ * @see lluna_Container_SparseSet_Destroy
+ */
+struct lluna_Container_SparseSet* lluna_Container_SparseSet_Create(uint64 InitialCount, uint32 ValueSize);
+/**
+ * @brief Destroys the given sparse set.
+ *
+ * @param Handle Sparse set to destroy.
+ */
+void lluna_Container_SparseSet_Destroy(struct lluna_Container_SparseSet* Handle);
+
+/**
+ * @brief Returns the number of ids in the set.
+ *
+ * @param Handle Sparse set to count ids of.
+ * @return Number of ids.
+ */
+uint64 lluna_Container_SparseSet_Count(struct lluna_Container_SparseSet* Handle);
+/**
+ * @brief Returns the dense index of the given id.
+ *
+ * @param Handle Sparse set to search.
+ * @param Id Id to search for.
+ * @return Index of the id in `Ids` and `Values`, or lluna_Container_SparseSet_InvalidIndex if it isn't in the set.
+ */
+uint32 lluna_Container_SparseSet_IndexOf(struct lluna_Container_SparseSet* Handle, uint32 Id);
+/**
+ * @brief Returns true if the set contains the given id.
+ *
+ * @param Handle Sparse set to search.
+ * @param Id Id to search for.
+ * @return Whether or not the id is in the set.
+ */
+boolean lluna_Container_SparseSet_Contains(struct lluna_Container_SparseSet* Handle, uint32 Id);
+/**
+ * @brief Returns the value of the given id.
+ *
+ * The returned handle is invalidated by insertions and removals.
+ *
+ * @param Handle Sparse set to search.
+ * @param Id Id of the value.
+ * @return Handle to the value, or NULL if the id isn't in the set or the set stores no values.
+ */
+byte* lluna_Container_SparseSet_Get(struct lluna_Container_SparseSet* Handle, uint32 Id);
+/**
+ * @brief Returns the id at the given dense index.
+ *
+ * @param Handle Sparse set to get the id from.
+ * @param Index Dense index of the entry.
+ * @return Id of the entry.
+ */
+uint32 lluna_Container_SparseSet_IdAt(struct lluna_Container_SparseSet* Handle, uint64 Index);
+
+/**
+ * @brief Inserts an id, or replaces its value if it is already in the set.
+ *
+ * @param Handle Sparse set to insert into.
+ * @param Id Id to insert. Must not be lluna_Container_SparseSet_InvalidIndex.
+ * @param Value Value to copy, ignored if the set stores no values.
+ */
+void lluna_Container_SparseSet_Insert(struct lluna_Container_SparseSet* Handle, uint32 Id, const byte* Value);
+/**
+ * @brief Removes the given id.
+ *
+ * Moves the last entry into the gap.
+ *
+ * @param Handle Sparse set to remove from.
+ * @param Id Id to remove.
+ * @return False if the id wasn't in the set.
+ */
+boolean lluna_Container_SparseSet_Remove(struct lluna_Container_SparseSet* Handle, uint32 Id);
+/**
+ * @brief Removes every id.
+ *
+ * Only touches the sparse entries of ids in the set.
+ *
+ * @param Handle Sparse set to clear.
+ */
+void lluna_Container_SparseSet_Clear(struct lluna_Container_SparseSet* Handle);
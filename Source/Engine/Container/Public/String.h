@@ -5,6 +5,12 @@
  * @brief Managed string.
  *
  * lluna_Container_String is a managed, null terminated string with cached length.
+ *
+ * Strings can share their characters: lluna_Container_String_Share and lluna_Container_String_Assign make a string use
+ * the same reference counted buffer in constant time, and the first string written to afterwards copies the characters
+ * into a buffer of its own. Each string must only be used by one thread at a time, but strings sharing a buffer can be
+ * used and destroyed from different threads. Characters of shared strings must not be written to through pointers, call
+ * lluna_Container_String_Unshare first.
  */
 
 #include <Engine/Core/Public/Types.h>
@@ -52,6 +58,17 @@ struct lluna_Container_String* lluna_Container_String_CreateFromText(struct llun
  * @see lluna_Macros_Text
  */
 struct lluna_Container_String* lluna_Container_String_CreateFormatted(struct lluna_Core_Types_Text Format, ...);
+/**
+ * @brief Creates a string sharing the characters of the given string and returns a handle to it.
+ *
+ * Takes constant time. Both strings keep the characters until one of them is written to.
+ *
+ * @param Handle String to share.
+ * @return Handle to the created string.
+ *
+ * @see lluna_Container_String_Destroy
+ */
+struct lluna_Container_String* lluna_Container_String_Share(struct lluna_Container_String* Handle);
 /**
  * @brief Destroys the given string.
  *
@@ -59,6 +76,22 @@ struct lluna_Container_String* lluna_Container_String_CreateFormatted(struct llu
  */
 void lluna_Container_String_Destroy(struct lluna_Container_String* Handle);
 
+/**
+ * @brief Returns true if the string shares its characters with other strings.
+ *
+ * @param Handle String to check.
+ * @return Whether or not the characters are shared.
+ */
+boolean lluna_Container_String_Shared(struct lluna_Container_String* Handle);
+/**
+ * @brief Copies the characters into a buffer of the string's own if they are shared.
+ *
+ * Has to be called before writing to characters through pointers. Functions modifying the string call it themselves.
+ *
+ * @param Handle String to unshare.
+ */
+void lluna_Container_String_Unshare(struct lluna_Container_String* Handle);
+
 /**
  * @brief Returns true if the string is empty.
  *
@@ -73,6 +106,17 @@ boolean lluna_Container_String_Empty(struct lluna_Container_String* Handle);
  * @return Length of the string.
  */
 uint64 lluna_Container_String_Length(struct lluna_Container_String* Handle);
+/**
+ * @brief Returns the number of UTF-8 code points in the given string.
+ *
+ * Uses the cached length instead of scanning for the null terminator.
+ *
+ * @param Handle String to count.
+ * @return Number of code points.
+ *
+ * @see lluna_Core_Utf8_CountCodePoints
+ */
+uint64 lluna_Container_String_CodePointCount(struct lluna_Container_String* Handle);
 /**
  * @brief Returns the maximum number of characters that will fit in the currently allocated space.
  *
@@ -171,9 +215,21 @@ void lluna_Container_String_Append(struct lluna_Container_String* Handle, struct
  * @see lluna_Macros_Text
  */
 void lluna_Container_String_AppendText(struct lluna_Container_String* Handle, struct lluna_Core_Types_Text Text);
+/**
+ * @brief Appends code points to the end, encoded as UTF-8.
+ *
+ * @param Handle String to append to.
+ * @param CodePoints Code points to append.
+ * @param Count Number of code points.
+ *
+ * @see lluna_Core_Utf8_Encode
+ */
+void lluna_Container_String_AppendUtf32(struct lluna_Container_String* Handle, const uint32* CodePoints, uint64 Count);
 /**
  * @brief Replaces the content of the string by the contents of the given string.
  *
+ * Shares the characters of the given string, so takes constant time.
+ *
  * @param Handle String to be replaced.
  * @param Other New string.
  */
@@ -213,7 +269,7 @@ void lluna_Container_String_Clear(struct lluna_Container_String* Handle);
  * @param Pointer Iterator variable.
  */
 #define lluna_Container_String_ForEach(String, Pointer) \
-        for((Pointer) = (String)->Data; (Pointer) < (byte*)(String)->Data + (String)->Offset; (Pointer) += sizeof(char))
+        for((Pointer) = (void*)(String)->Data; (byte*)(Pointer) < (byte*)(String)->Data + (String)->Offset; (Pointer) = (void*)((byte*)(Pointer) + sizeof(char)))
 /**
  * @brief Convenience macro for iterating through all characters of the string in reversed order.
  *
@@ -221,4 +277,4 @@ void lluna_Container_String_Clear(struct lluna_Container_String* Handle);
  * @param Pointer Iterator variable.
  */
 #define lluna_Container_String_ReversedForEach(String, Pointer) \
-        for((Pointer) = (byte*)(String)->Data + (String)->Offset - sizeof(char); (Pointer) >= (String)->Data; (byte*)(Pointer) -= sizeof(char))
+        for((Pointer) = (void*)((byte*)(String)->Data + (String)->Offset - sizeof(char)); (byte*)(Pointer) >= (byte*)(String)->Data; (Pointer) = (void*)((byte*)(Pointer) - sizeof(char)))
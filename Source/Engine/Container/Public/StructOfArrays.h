@@ -0,0 +1,160 @@
+#pragma once
+
+/**
+ * @file StructOfArrays.h
+ * @brief Dynamically resizing structure of arrays.
+ *
+ * lluna_Container_StructOfArrays stores elements described by a list of fields, keeping each field in its own
+ * contiguous stream instead of storing whole elements one after the other like lluna_Container_DynamicArray. Loops
+ * that only touch a few fields of large elements then read only those streams, using every byte of each cache line,
+ * and can process consecutive elements with vector instructions.
+ *
+ * Every stream starts on a lluna_Container_StructOfArrays_StreamAlignment boundary and is padded to a multiple of it,
+ * so vectorized loops may read whole cache lines past the last element. All streams share one allocation and grow
+ * together. Removal moves the last element into the gap in every stream.
+ *
+ * Elements can be converted from and to structures, described by the offsets of their fields, to interface with code
+ * that works on whole elements.
+ *
+ * @see lluna_Container_DynamicArray
+ */
+
+#include <Engine/Core/Public/Types.h>
+
+/**
+ * @brief Alignment of each stream, in bytes. One cache line.
+ */
+#define lluna_Container_StructOfArrays_StreamAlignment 64
+
+/**
+ * @brief Describes one field of the stored elements.
+ */
+struct lluna_Container_StructOfArrays_Field
+{
+        uint32 Size; /**< Size of the field. */
+        uint32 Alignment; /**< Alignment of the field. Streams are aligned to the larger of this and a cache line. */
+        uint32 Offset; /**< Offset of the field in the structure used to convert elements. */
+};
+
+/**
+ * @brief Describes a structure of arrays.
+ *
+ * Should not be written to externally.
+ */
+struct lluna_Container_StructOfArrays
+{
+        byte* Data; /**< Allocation holding every stream. */
+        byte** Streams; /**< Handle to the first element of each stream. */
+        struct lluna_Container_StructOfArrays_Field* Fields; /**< Description of each field. */
+
+        uint64 Count; /**< Number of stored elements. */
+        uint64 Capacity; /**< Number of elements memory is allocated for. */
+
+        uint32 FieldCount; /**< Number of fields, and so of streams. */
+};
+
+/**
+ * @brief Creates a structure of arrays and returns a handle to it.
+ *
+ * Created structures of arrays have to be manually destroyed.
+ *
+ * @param Fields Description of each field. Copied.
+ * @param FieldCount Number of fields.
+ * @param InitialCount Number of elements to allocate memory for.
+ * @return Handle to the created structure of arrays.
+ *
+ * @see lluna_Container_StructOfArrays_Destroy
+ */
+struct lluna_Container_StructOfArrays* lluna_Container_StructOfArrays_Create(const struct lluna_Container_StructOfArrays_Field* Fields, uint32 FieldCount, uint64 InitialCount);
+/**
+ * @brief Destroys the given structure of arrays.
+ *
+ * @param Handle Structure of arrays to destroy.
+ */
+void lluna_Container_StructOfArrays_Destroy(struct lluna_Container_StructOfArrays* Handle);
+
+/**
+ * @brief Returns the number of elements.
+ *
+ * @param Handle Structure of arrays to count elements of.
+ * @return Number of elements.
+ */
+uint64 lluna_Container_StructOfArrays_Count(struct lluna_Container_StructOfArrays* Handle);
+/**
+ * @brief Allocates memory for at least the given number of elements.
+ *
+ * Does nothing if there already is enough. Moves every stream, invalidating handles to them. Leaves the structure of
+ * arrays unchanged if the allocation fails.
+ *
+ * @param Handle Structure of arrays to grow.
+ * @param Capacity Number of elements to allocate memory for.
+ */
+void lluna_Container_StructOfArrays_Reserve(struct lluna_Container_StructOfArrays* Handle, uint64 Capacity);
+/**
+ * @brief Returns the stream of the given field.
+ *
+ * @param Handle Structure of arrays to get the stream from.
+ * @param Field Index of the field.
+ * @return Handle to the field of the first element.
+ */
+byte* lluna_Container_StructOfArrays_Stream(struct lluna_Container_StructOfArrays* Handle, uint32 Field);
+/**
+ * @brief Returns a field of the given element.
+ *
+ * @param Handle Structure of arrays to get the field from.
+ * @param Field Index of the field.
+ * @param Index Index of the element.
+ * @return Handle to the field.
+ */
+byte* lluna_Container_StructOfArrays_Get(struct lluna_Container_StructOfArrays* Handle, uint32 Field, uint64 Index);
+
+/**
+ * @brief Inserts an element at the end.
+ *
+ * @param Handle Structure of arrays to append the element at.
+ * @param Element Structure to copy the fields from, at their offsets, or NULL to zero them.
+ * @return Index of the element.
+ */
+uint64 lluna_Container_StructOfArrays_Append(struct lluna_Container_StructOfArrays* Handle, const byte* Element);
+/**
+ * @brief Removes the element at the given index.
+ *
+ * Replaces the element by the last one in every stream. **Does not** preserve the order of the elements.
+ *
+ * @param Handle Structure of arrays to remove the element from.
+ * @param Index Index of the element.
+ */
+void lluna_Container_StructOfArrays_Remove(struct lluna_Container_StructOfArrays* Handle, uint64 Index);
+/**
+ * @brief Removes every element.
+ *
+ * Not the same as destroy. The memory will still be allocated.
+ *
+ * @param Handle Structure of arrays to clear.
+ */
+void lluna_Container_StructOfArrays_Clear(struct lluna_Container_StructOfArrays* Handle);
+
+/**
+ * @brief Appends elements stored as an array of structures.
+ *
+ * Copies one field at a time, so each stream is written sequentially.
+ *
+ * @param Handle Structure of arrays to append the elements at.
+ * @param Elements First structure to copy the fields from, at their offsets.
+ * @param Count Number of structures.
+ * @param Stride Distance in bytes between consecutive structures.
+ */
+void lluna_Container_StructOfArrays_AppendStructs(struct lluna_Container_StructOfArrays* Handle, const byte* Elements, uint64 Count, uint64 Stride);
+/**
+ * @brief Copies elements into an array of structures.
+ *
+ * Copies one field at a time, so each stream is read sequentially. Bytes of the structures not covered by a field are
+ * left untouched.
+ *
+ * @param Handle Structure of arrays to copy from.
+ * @param First Index of the first element to copy.
+ * @param Count Number of elements to copy.
+ * @param Elements First structure to copy the fields to, at their offsets.
+ * @param Stride Distance in bytes between consecutive structures.
+ */
+void lluna_Container_StructOfArrays_CopyToStructs(struct lluna_Container_StructOfArrays* Handle, uint64 First, uint64 Count, byte* Elements, uint64 Stride);
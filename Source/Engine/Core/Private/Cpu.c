@@ -0,0 +1,225 @@
+#include <Engine/Core/Public/Cpu.h>
+
+#include <Engine/Core/Public/Atomics.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HAS_CPUID
+#include <cpuid.h>
+#endif
+
+#define Uninitialized 0
+#define Initializing 1
+#define Initialized 2
+
+// XCR0 bits the operating system sets when it saves SSE, AVX and AVX-512 registers on context switches.
+#define XcrSse (1ULL << 1)
+#define XcrAvx (1ULL << 2)
+#define XcrAvx512 (7ULL << 5)
+
+#define LevelX86_64Features lluna_Core_Cpu_Sse2
+#define LevelX86_64V2Features \
+        (LevelX86_64Features | lluna_Core_Cpu_Sse3 | lluna_Core_Cpu_Ssse3 | lluna_Core_Cpu_Sse41 | lluna_Core_Cpu_Sse42 | lluna_Core_Cpu_Popcnt)
+#define LevelX86_64V3Features                                                                                                      \
+        (LevelX86_64V2Features | lluna_Core_Cpu_Avx | lluna_Core_Cpu_Avx2 | lluna_Core_Cpu_Fma | lluna_Core_Cpu_Bmi1 | lluna_Core_Cpu_Bmi2 | \
+         lluna_Core_Cpu_Lzcnt | lluna_Core_Cpu_Movbe)
+#define LevelX86_64V4Features                                                                                                      \
+        (LevelX86_64V3Features | lluna_Core_Cpu_Avx512F | lluna_Core_Cpu_Avx512Bw | lluna_Core_Cpu_Avx512Cd | lluna_Core_Cpu_Avx512Dq | \
+         lluna_Core_Cpu_Avx512Vl)
+
+static const uint64 LevelFeatures[] = { 0, LevelX86_64Features, LevelX86_64V2Features, LevelX86_64V3Features, LevelX86_64V4Features };
+static const char* LevelNames[] = { "scalar", "x86-64", "x86-64-v2", "x86-64-v3", "x86-64-v4" };
+
+#define LevelCount (sizeof(LevelFeatures) / sizeof(LevelFeatures[0]))
+
+static struct lluna_Core_Cpu_Info Info;
+static uint32 State = Uninitialized;
+
+#ifdef HAS_CPUID
+
+static uint64 ReadXcr0()
+{
+        uint32 Low;
+        uint32 High;
+        __asm__ volatile("xgetbv" : "=a"(Low), "=d"(High) : "c"(0));
+
+        return ((uint64)High << 32) | Low;
+}
+
+static uint64 Detect(struct lluna_Core_Cpu_Info* Description)
+{
+        uint32 Eax;
+        uint32 Ebx;
+        uint32 Ecx;
+        uint32 Edx;
+        uint64 Features = 0;
+
+        uint32 MaximumLeaf = __get_cpuid_max(0, NULL);
+        if (MaximumLeaf == 0)
+        {
+                return 0;
+        }
+
+        __cpuid(0, Eax, Ebx, Ecx, Edx);
+        memcpy(Description->Vendor, &Ebx, 4);
+        memcpy(Description->Vendor + 4, &Edx, 4);
+        memcpy(Description->Vendor + 8, &Ecx, 4);
+        Description->Vendor[12] = '\0';
+
+        __cpuid(1, Eax, Ebx, Ecx, Edx);
+        Features |= (Edx & bit_SSE2) ? lluna_Core_Cpu_Sse2 : 0;
+        Features |= (Ecx & bit_SSE3) ? lluna_Core_Cpu_Sse3 : 0;
+        Features |= (Ecx & bit_SSSE3) ? lluna_Core_Cpu_Ssse3 : 0;
+        Features |= (Ecx & bit_SSE4_1) ? lluna_Core_Cpu_Sse41 : 0;
+        Features |= (Ecx & bit_SSE4_2) ? lluna_Core_Cpu_Sse42 : 0;
+        Features |= (Ecx & bit_POPCNT) ? lluna_Core_Cpu_Popcnt : 0;
+        Features |= (Ecx & bit_MOVBE) ? lluna_Core_Cpu_Movbe : 0;
+
+        // AVX state has to be enabled by the operating system, not just supported by the processor.
+        uint64 Xcr0 = (Ecx & bit_OSXSAVE) ? ReadXcr0() : 0;
+        boolean AvxState = (Xcr0 & (XcrSse | XcrAvx)) == (XcrSse | XcrAvx);
+        boolean Avx512State = AvxState && (Xcr0 & XcrAvx512) == XcrAvx512;
+        if (AvxState)
+        {
+                Features |= (Ecx & bit_AVX) ? lluna_Core_Cpu_Avx : 0;
+                Features |= (Ecx & bit_FMA) ? lluna_Core_Cpu_Fma : 0;
+        }
+
+        if (MaximumLeaf >= 7)
+        {
+                __cpuid_count(7, 0, Eax, Ebx, Ecx, Edx);
+                Features |= (Ebx & bit_BMI) ? lluna_Core_Cpu_Bmi1 : 0;
+                Features |= (Ebx & bit_BMI2) ? lluna_Core_Cpu_Bmi2 : 0;
+                if (AvxState)
+                {
+                        Features |= (Ebx & bit_AVX2) ? lluna_Core_Cpu_Avx2 : 0;
+                }
+                if (Avx512State)
+                {
+                        Features |= (Ebx & bit_AVX512F) ? lluna_Core_Cpu_Avx512F : 0;
+                        Features |= (Ebx & bit_AVX512BW) ? lluna_Core_Cpu_Avx512Bw : 0;
+                        Features |= (Ebx & bit_AVX512CD) ? lluna_Core_Cpu_Avx512Cd : 0;
+                        Features |= (Ebx & bit_AVX512DQ) ? lluna_Core_Cpu_Avx512Dq : 0;
+                        Features |= (Ebx & bit_AVX512VL) ? lluna_Core_Cpu_Avx512Vl : 0;
+                }
+        }
+
+        uint32 MaximumExtendedLeaf = __get_cpuid_max(0x80000000, NULL);
+        if (MaximumExtendedLeaf >= 0x80000001)
+        {
+                __cpuid(0x80000001, Eax, Ebx, Ecx, Edx);
+                Features |= (Ecx & bit_LZCNT) ? lluna_Core_Cpu_Lzcnt : 0;
+        }
+        if (MaximumExtendedLeaf >= 0x80000004)
+        {
+                for (uint32 Leaf = 0; Leaf < 3; ++Leaf)
+                {
+                        uint32 Registers[4];
+                        __cpuid(0x80000002 + Leaf, Registers[0], Registers[1], Registers[2], Registers[3]);
+                        memcpy(Description->Brand + Leaf * 16, Registers, 16);
+                }
+                Description->Brand[48] = '\0';
+        }
+
+        return Features;
+}
+
+#else
+
+static uint64 Detect(struct lluna_Core_Cpu_Info* Description)
+{
+        (void)Description;
+
+#if defined(__aarch64__)
+        return lluna_Core_Cpu_Neon;
+#else
+        return 0;
+#endif
+}
+
+#endif
+
+static uint32 ReadLevelOverride()
+{
+        const char* Name = getenv("LLUNA_CPU_LEVEL");
+        if (!Name)
+        {
+                return LevelCount;
+        }
+
+        for (uint32 Level = 0; Level < LevelCount; ++Level)
+        {
+                if (strcmp(Name, LevelNames[Level]) == 0)
+                {
+                        return Level;
+                }
+        }
+
+        return LevelCount;
+}
+
+static void Initialize()
+{
+        Info.DetectedFeatures = Detect(&Info);
+        Info.Features = Info.DetectedFeatures;
+
+        uint32 Override = ReadLevelOverride();
+        if (Override < LevelCount)
+        {
+                uint64 Hidden = LevelFeatures[LevelCount - 1] & ~LevelFeatures[Override];
+                if (Override == lluna_Core_Cpu_LevelScalar)
+                {
+                        Hidden |= lluna_Core_Cpu_Neon;
+                }
+                Info.Features &= ~Hidden;
+        }
+
+        Info.Level = lluna_Core_Cpu_LevelScalar;
+        while (Info.Level + 1 < LevelCount && (LevelFeatures[Info.Level + 1] & ~Info.Features) == 0)
+        {
+                ++Info.Level;
+        }
+}
+
+const struct lluna_Core_Cpu_Info* lluna_Core_Cpu_GetInfo()
+{
+        if (lluna_Core_Atomics_LoadUint32(&State, lluna_Core_Atomics_Acquire) == Initialized)
+        {
+                return &Info;
+        }
+
+        uint32 Expected = Uninitialized;
+        if (lluna_Core_Atomics_CompareExchangeUint32(&State, &Expected, Initializing, false, lluna_Core_Atomics_Acquire,
+                                                     lluna_Core_Atomics_Acquire))
+        {
+                Initialize();
+                lluna_Core_Atomics_StoreUint32(&State, Initialized, lluna_Core_Atomics_Release);
+        }
+        while (lluna_Core_Atomics_LoadUint32(&State, lluna_Core_Atomics_Acquire) != Initialized)
+        {
+                lluna_Core_Atomics_Yield();
+        }
+
+        return &Info;
+}
+
+boolean lluna_Core_Cpu_Supports(uint64 Features)
+{
+        return (lluna_Core_Cpu_GetInfo()->Features & Features) == Features;
+}
+
+lluna_Core_Cpu_Function lluna_Core_Cpu_Dispatch(const struct lluna_Core_Cpu_Kernel* Kernels, uint32 Count)
+{
+        uint64 Features = lluna_Core_Cpu_GetInfo()->Features;
+        for (uint32 Index = 0; Index < Count; ++Index)
+        {
+                if ((Kernels[Index].Features & ~Features) == 0)
+                {
+                        return Kernels[Index].Function;
+                }
+        }
+
+        return NULL;
+}
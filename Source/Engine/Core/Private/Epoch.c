@@ -0,0 +1,156 @@
+#include <Engine/Core/Public/Epoch.h>
+
+#include <Engine/Core/Public/Atomics.h>
+
+#include <stdlib.h>
+
+#define Active 1
+
+struct lluna_Core_Epoch_Retired
+{
+        void* Pointer;
+        lluna_Core_Epoch_FreeFunction Free;
+        uint64 Epoch;
+
+        struct lluna_Core_Epoch_Retired* Next;
+};
+
+static uint64 FreeRetired(struct lluna_Core_Epoch_Retired* Retired)
+{
+        uint64 Count = 0;
+        while (Retired)
+        {
+                struct lluna_Core_Epoch_Retired* Next = Retired->Next;
+                Retired->Free(Retired->Pointer);
+                free(Retired);
+
+                Retired = Next;
+                ++Count;
+        }
+
+        return Count;
+}
+
+struct lluna_Core_Epoch* lluna_Core_Epoch_Create()
+{
+        struct lluna_Core_Epoch* Handle = malloc(sizeof(struct lluna_Core_Epoch));
+        Handle->Global = 0;
+        lluna_Core_Sync_InitializeMutex(&Handle->Lock);
+        Handle->Participants = NULL;
+        Handle->Retired = NULL;
+
+        return Handle;
+}
+
+void lluna_Core_Epoch_Destroy(struct lluna_Core_Epoch* Handle)
+{
+        FreeRetired(Handle->Retired);
+        free(Handle);
+}
+
+void lluna_Core_Epoch_Register(struct lluna_Core_Epoch* Handle, struct lluna_Core_Epoch_Participant* Participant)
+{
+        Participant->Epoch = Handle;
+        Participant->Local = 0;
+        Participant->Depth = 0;
+
+        lluna_Core_Sync_LockMutex(&Handle->Lock);
+        Participant->Next = Handle->Participants;
+        Handle->Participants = Participant;
+        lluna_Core_Sync_UnlockMutex(&Handle->Lock);
+}
+
+void lluna_Core_Epoch_Unregister(struct lluna_Core_Epoch_Participant* Participant)
+{
+        struct lluna_Core_Epoch* Handle = Participant->Epoch;
+
+        lluna_Core_Sync_LockMutex(&Handle->Lock);
+        struct lluna_Core_Epoch_Participant** Link = &Handle->Participants;
+        while (*Link != Participant)
+        {
+                Link = &(*Link)->Next;
+        }
+        *Link = Participant->Next;
+        lluna_Core_Sync_UnlockMutex(&Handle->Lock);
+
+        Participant->Epoch = NULL;
+        Participant->Next = NULL;
+}
+
+void lluna_Core_Epoch_Enter(struct lluna_Core_Epoch_Participant* Participant)
+{
+        if (Participant->Depth++)
+        {
+                return;
+        }
+
+        // The fence pairs with the one in Reclaim: either the writer sees this section, or the section sees everything
+        // the writer unlinked before reclaiming.
+        uint64 Global = lluna_Core_Atomics_LoadUint64(&Participant->Epoch->Global, lluna_Core_Atomics_Acquire);
+        lluna_Core_Atomics_StoreUint64(&Participant->Local, (Global << 1) | Active, lluna_Core_Atomics_Relaxed);
+        lluna_Core_Atomics_Fence(lluna_Core_Atomics_SequentiallyConsistent);
+}
+
+void lluna_Core_Epoch_Leave(struct lluna_Core_Epoch_Participant* Participant)
+{
+        if (--Participant->Depth)
+        {
+                return;
+        }
+
+        lluna_Core_Atomics_StoreUint64(&Participant->Local, 0, lluna_Core_Atomics_Release);
+}
+
+void lluna_Core_Epoch_Retire(struct lluna_Core_Epoch* Handle, void* Pointer, lluna_Core_Epoch_FreeFunction Free)
+{
+        struct lluna_Core_Epoch_Retired* Retired = malloc(sizeof(struct lluna_Core_Epoch_Retired));
+        Retired->Pointer = Pointer;
+        Retired->Free = Free;
+
+        lluna_Core_Sync_LockMutex(&Handle->Lock);
+        Retired->Epoch = Handle->Global;
+        Retired->Next = Handle->Retired;
+        Handle->Retired = Retired;
+        lluna_Core_Sync_UnlockMutex(&Handle->Lock);
+}
+
+uint64 lluna_Core_Epoch_Reclaim(struct lluna_Core_Epoch* Handle)
+{
+        lluna_Core_Sync_LockMutex(&Handle->Lock);
+        lluna_Core_Atomics_Fence(lluna_Core_Atomics_SequentiallyConsistent);
+
+        uint64 Global = Handle->Global;
+        boolean Advance = true;
+        for (struct lluna_Core_Epoch_Participant* Participant = Handle->Participants; Participant; Participant = Participant->Next)
+        {
+                uint64 Local = lluna_Core_Atomics_LoadUint64(&Participant->Local, lluna_Core_Atomics_Acquire);
+                if ((Local & Active) && (Local >> 1) != Global)
+                {
+                        Advance = false;
+                        break;
+                }
+        }
+
+        if (Advance)
+        {
+                lluna_Core_Atomics_StoreUint64(&Handle->Global, ++Global, lluna_Core_Atomics_Release);
+        }
+
+        // Readers still in a section entered at most one epoch ago, so they entered after anything retired two epochs
+        // ago was unlinked. The list is sorted by epoch, so everything past the first such retirement goes too.
+        struct lluna_Core_Epoch_Retired* Expired = NULL;
+        struct lluna_Core_Epoch_Retired** Link = &Handle->Retired;
+        while (*Link)
+        {
+                if ((*Link)->Epoch + 2 <= Global)
+                {
+                        Expired = *Link;
+                        *Link = NULL;
+                        break;
+                }
+                Link = &(*Link)->Next;
+        }
+        lluna_Core_Sync_UnlockMutex(&Handle->Lock);
+
+        return FreeRetired(Expired);
+}
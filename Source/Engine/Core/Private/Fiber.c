@@ -0,0 +1,368 @@
+#include <Engine/Core/Public/Fiber.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if defined(__ELF__) && (defined(__x86_64__) || defined(__aarch64__))
+#define HAS_ASSEMBLY_SWITCH
+#else
+#include <ucontext.h>
+#endif
+
+#ifdef MAP_STACK
+#define StackFlags (MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK)
+#else
+#define StackFlags (MAP_PRIVATE | MAP_ANONYMOUS)
+#endif
+
+#ifdef __SANITIZE_THREAD__
+// ThreadSanitizer keeps a state per stack and has to be told about every switch.
+void* __tsan_get_current_fiber();
+void* __tsan_create_fiber(unsigned Flags);
+void __tsan_destroy_fiber(void* Fiber);
+void __tsan_switch_to_fiber(void* Fiber, unsigned Flags);
+
+#define AnnotateCreate(Fiber) ((Fiber)->Sanitizer = __tsan_create_fiber(0))
+#define AnnotateDestroy(Fiber) __tsan_destroy_fiber((Fiber)->Sanitizer)
+#define AnnotateResume(Fiber) ((Fiber)->SanitizerReturn = __tsan_get_current_fiber(), __tsan_switch_to_fiber((Fiber)->Sanitizer, 0))
+#define AnnotateYield(Fiber) __tsan_switch_to_fiber((Fiber)->SanitizerReturn, 0)
+#else
+#define AnnotateCreate(Fiber)
+#define AnnotateDestroy(Fiber)
+#define AnnotateResume(Fiber)
+#define AnnotateYield(Fiber)
+#endif
+
+// Fibers are stored at the top of their stack, rounded up to keep the stack pointer aligned below them.
+#define RecordSize ((sizeof(struct lluna_Core_Fiber) + 63) & ~(uint64)63)
+
+#ifdef HAS_ASSEMBLY_SWITCH
+typedef void* Context;
+#else
+typedef ucontext_t Context;
+#endif
+
+struct lluna_Core_Fiber
+{
+        Context Context;
+        Context ReturnContext;
+        struct lluna_Core_Fiber* Previous;
+
+        lluna_Core_Fiber_Function Function;
+        void* Data;
+        boolean Finished;
+
+        struct lluna_Core_Fiber_Pool* Pool;
+
+        void* Sanitizer;
+        void* SanitizerReturn;
+};
+
+struct lluna_Core_Fiber_Stack
+{
+        struct lluna_Core_Fiber_Stack* Next;
+};
+
+static __thread struct lluna_Core_Fiber* CurrentFiber = NULL;
+
+// Fibers can move between threads, so the thread local has to be looked up again after every switch instead of
+// having its address kept around by the compiler.
+__attribute__((noinline)) static struct lluna_Core_Fiber* GetCurrent()
+{
+        return CurrentFiber;
+}
+
+__attribute__((noinline)) static void SetCurrent(struct lluna_Core_Fiber* Fiber)
+{
+        CurrentFiber = Fiber;
+}
+
+static void Start(struct lluna_Core_Fiber* Fiber);
+
+#ifdef HAS_ASSEMBLY_SWITCH
+
+// Saves the callee-saved registers on the current stack, stores the stack pointer to From, then switches to the
+// stack To and restores the registers saved on it.
+void lluna_Core_Fiber_SwitchContext(void** From, void* To);
+// Return address of new fibers. Calls the function in the second saved register with the fiber in the first.
+void lluna_Core_Fiber_EnterContext();
+
+#if defined(__x86_64__)
+
+__asm__(".text\n"
+        ".globl lluna_Core_Fiber_SwitchContext\n"
+        ".hidden lluna_Core_Fiber_SwitchContext\n"
+        ".type lluna_Core_Fiber_SwitchContext, @function\n"
+        ".p2align 4\n"
+        "lluna_Core_Fiber_SwitchContext:\n"
+        "        pushq %rbp\n"
+        "        pushq %rbx\n"
+        "        pushq %r12\n"
+        "        pushq %r13\n"
+        "        pushq %r14\n"
+        "        pushq %r15\n"
+        "        subq $8, %rsp\n"
+        "        stmxcsr (%rsp)\n"
+        "        fnstcw 4(%rsp)\n"
+        "        movq %rsp, (%rdi)\n"
+        "        movq %rsi, %rsp\n"
+        "        ldmxcsr (%rsp)\n"
+        "        fldcw 4(%rsp)\n"
+        "        addq $8, %rsp\n"
+        "        popq %r15\n"
+        "        popq %r14\n"
+        "        popq %r13\n"
+        "        popq %r12\n"
+        "        popq %rbx\n"
+        "        popq %rbp\n"
+        "        ret\n"
+        ".size lluna_Core_Fiber_SwitchContext, .-lluna_Core_Fiber_SwitchContext\n"
+        ".globl lluna_Core_Fiber_EnterContext\n"
+        ".hidden lluna_Core_Fiber_EnterContext\n"
+        ".type lluna_Core_Fiber_EnterContext, @function\n"
+        ".p2align 4\n"
+        "lluna_Core_Fiber_EnterContext:\n"
+        "        movq %r12, %rdi\n"
+        "        callq *%r13\n"
+        "        ud2\n"
+        ".size lluna_Core_Fiber_EnterContext, .-lluna_Core_Fiber_EnterContext\n");
+
+// Default MXCSR and x87 control word, as saved below the registers.
+#define InitialControl (0x1F80ULL | (0x037FULL << 32))
+
+static void Prepare(struct lluna_Core_Fiber* Fiber, byte* Top)
+{
+        // Control words, r15, r14, r13, r12, rbx, rbp and the return address, leaving the stack pointer aligned to
+        // 16 bytes once the return address is popped.
+        uint64* Frame = (uint64*)Top - 10;
+        Frame[0] = InitialControl;
+        Frame[1] = 0;
+        Frame[2] = 0;
+        Frame[3] = (uint64)(uintptr_t)Start;
+        Frame[4] = (uint64)(uintptr_t)Fiber;
+        Frame[5] = 0;
+        Frame[6] = 0;
+        Frame[7] = (uint64)(uintptr_t)lluna_Core_Fiber_EnterContext;
+        Frame[8] = 0;
+        Frame[9] = 0;
+
+        Fiber->Context = Frame;
+}
+
+#else
+
+__asm__(".text\n"
+        ".globl lluna_Core_Fiber_SwitchContext\n"
+        ".hidden lluna_Core_Fiber_SwitchContext\n"
+        ".type lluna_Core_Fiber_SwitchContext, %function\n"
+        ".p2align 4\n"
+        "lluna_Core_Fiber_SwitchContext:\n"
+        "        sub sp, sp, #160\n"
+        "        stp x19, x20, [sp, #0]\n"
+        "        stp x21, x22, [sp, #16]\n"
+        "        stp x23, x24, [sp, #32]\n"
+        "        stp x25, x26, [sp, #48]\n"
+        "        stp x27, x28, [sp, #64]\n"
+        "        stp x29, x30, [sp, #80]\n"
+        "        stp d8, d9, [sp, #96]\n"
+        "        stp d10, d11, [sp, #112]\n"
+        "        stp d12, d13, [sp, #128]\n"
+        "        stp d14, d15, [sp, #144]\n"
+        "        mov x9, sp\n"
+        "        str x9, [x0]\n"
+        "        mov sp, x1\n"
+        "        ldp x19, x20, [sp, #0]\n"
+        "        ldp x21, x22, [sp, #16]\n"
+        "        ldp x23, x24, [sp, #32]\n"
+        "        ldp x25, x26, [sp, #48]\n"
+        "        ldp x27, x28, [sp, #64]\n"
+        "        ldp x29, x30, [sp, #80]\n"
+        "        ldp d8, d9, [sp, #96]\n"
+        "        ldp d10, d11, [sp, #112]\n"
+        "        ldp d12, d13, [sp, #128]\n"
+        "        ldp d14, d15, [sp, #144]\n"
+        "        add sp, sp, #160\n"
+        "        ret\n"
+        ".size lluna_Core_Fiber_SwitchContext, .-lluna_Core_Fiber_SwitchContext\n"
+        ".globl lluna_Core_Fiber_EnterContext\n"
+        ".hidden lluna_Core_Fiber_EnterContext\n"
+        ".type lluna_Core_Fiber_EnterContext, %function\n"
+        ".p2align 4\n"
+        "lluna_Core_Fiber_EnterContext:\n"
+        "        mov x0, x19\n"
+        "        blr x20\n"
+        "        brk #0\n"
+        ".size lluna_Core_Fiber_EnterContext, .-lluna_Core_Fiber_EnterContext\n");
+
+static void Prepare(struct lluna_Core_Fiber* Fiber, byte* Top)
+{
+        // x19 to x30 followed by d8 to d15, with the link register returning to the entry.
+        uint64* Frame = (uint64*)Top - 20;
+        for (uint32 Index = 0; Index < 20; ++Index)
+        {
+                Frame[Index] = 0;
+        }
+        Frame[0] = (uint64)(uintptr_t)Fiber;
+        Frame[1] = (uint64)(uintptr_t)Start;
+        Frame[11] = (uint64)(uintptr_t)lluna_Core_Fiber_EnterContext;
+
+        Fiber->Context = Frame;
+}
+
+#endif
+
+static void Switch(Context* From, Context* To)
+{
+        lluna_Core_Fiber_SwitchContext(From, *To);
+}
+
+#else
+
+static void EnterContext(uint32 Low, uint32 High)
+{
+        Start((struct lluna_Core_Fiber*)(uintptr_t)(((uint64)High << 32) | Low));
+}
+
+static void Prepare(struct lluna_Core_Fiber* Fiber, byte* Top)
+{
+        uint64 Fiber64 = (uint64)(uintptr_t)Fiber;
+
+        getcontext(&Fiber->Context);
+        Fiber->Context.uc_stack.ss_sp = Top - Fiber->Pool->StackSize + RecordSize;
+        Fiber->Context.uc_stack.ss_size = Fiber->Pool->StackSize - RecordSize;
+        Fiber->Context.uc_link = NULL;
+        makecontext(&Fiber->Context, (void (*)())EnterContext, 2, (uint32)Fiber64, (uint32)(Fiber64 >> 32));
+}
+
+static void Switch(Context* From, Context* To)
+{
+        swapcontext(From, To);
+}
+
+#endif
+
+static void Start(struct lluna_Core_Fiber* Fiber)
+{
+        Fiber->Function(Fiber->Data);
+        Fiber->Finished = true;
+
+        SetCurrent(Fiber->Previous);
+        AnnotateYield(Fiber);
+        Switch(&Fiber->Context, &Fiber->ReturnContext);
+}
+
+struct lluna_Core_Fiber_Pool* lluna_Core_Fiber_CreatePool(uint64 StackSize)
+{
+        uint64 PageSize = (uint64)sysconf(_SC_PAGESIZE);
+        if (StackSize == 0)
+        {
+                StackSize = lluna_Core_Fiber_DefaultStackSize;
+        }
+
+        struct lluna_Core_Fiber_Pool* Pool = malloc(sizeof(struct lluna_Core_Fiber_Pool));
+        if (!Pool)
+        {
+                return NULL;
+        }
+
+        Pool->StackSize = (StackSize + RecordSize + PageSize - 1) / PageSize * PageSize;
+        Pool->PageSize = PageSize;
+        lluna_Core_Sync_InitializeMutex(&Pool->Lock);
+        Pool->Free = NULL;
+        Pool->FreeCount = 0;
+
+        return Pool;
+}
+
+void lluna_Core_Fiber_DestroyPool(struct lluna_Core_Fiber_Pool* Pool)
+{
+        while (Pool->Free)
+        {
+                struct lluna_Core_Fiber_Stack* Stack = Pool->Free;
+                Pool->Free = Stack->Next;
+
+                munmap((byte*)Stack + RecordSize - Pool->StackSize - Pool->PageSize, Pool->StackSize + Pool->PageSize);
+        }
+
+        free(Pool);
+}
+
+struct lluna_Core_Fiber* lluna_Core_Fiber_Create(struct lluna_Core_Fiber_Pool* Pool, lluna_Core_Fiber_Function Function, void* Data)
+{
+        lluna_Core_Sync_LockMutex(&Pool->Lock);
+        struct lluna_Core_Fiber_Stack* Stack = Pool->Free;
+        if (Stack)
+        {
+                Pool->Free = Stack->Next;
+                --Pool->FreeCount;
+        }
+        lluna_Core_Sync_UnlockMutex(&Pool->Lock);
+
+        if (!Stack)
+        {
+                byte* Mapping = mmap(NULL, Pool->StackSize + Pool->PageSize, PROT_READ | PROT_WRITE, StackFlags, -1, 0);
+                if (Mapping == MAP_FAILED)
+                {
+                        return NULL;
+                }
+
+                // Stacks grow down, so the guard page goes below the lowest usable address.
+                mprotect(Mapping, Pool->PageSize, PROT_NONE);
+                Stack = (struct lluna_Core_Fiber_Stack*)(Mapping + Pool->PageSize + Pool->StackSize - RecordSize);
+        }
+
+        struct lluna_Core_Fiber* Fiber = (struct lluna_Core_Fiber*)Stack;
+        Fiber->Previous = NULL;
+        Fiber->Function = Function;
+        Fiber->Data = Data;
+        Fiber->Finished = false;
+        Fiber->Pool = Pool;
+
+        Prepare(Fiber, (byte*)Fiber);
+        AnnotateCreate(Fiber);
+
+        return Fiber;
+}
+
+void lluna_Core_Fiber_Destroy(struct lluna_Core_Fiber* Fiber)
+{
+        struct lluna_Core_Fiber_Pool* Pool = Fiber->Pool;
+        struct lluna_Core_Fiber_Stack* Stack = (struct lluna_Core_Fiber_Stack*)Fiber;
+        AnnotateDestroy(Fiber);
+
+        lluna_Core_Sync_LockMutex(&Pool->Lock);
+        Stack->Next = Pool->Free;
+        Pool->Free = Stack;
+        ++Pool->FreeCount;
+        lluna_Core_Sync_UnlockMutex(&Pool->Lock);
+}
+
+void lluna_Core_Fiber_Resume(struct lluna_Core_Fiber* Fiber)
+{
+        Fiber->Previous = GetCurrent();
+        SetCurrent(Fiber);
+
+        AnnotateResume(Fiber);
+        Switch(&Fiber->ReturnContext, &Fiber->Context);
+}
+
+void lluna_Core_Fiber_Yield()
+{
+        struct lluna_Core_Fiber* Fiber = GetCurrent();
+        SetCurrent(Fiber->Previous);
+
+        AnnotateYield(Fiber);
+        Switch(&Fiber->Context, &Fiber->ReturnContext);
+}
+
+struct lluna_Core_Fiber* lluna_Core_Fiber_Current()
+{
+        return GetCurrent();
+}
+
+boolean lluna_Core_Fiber_Finished(struct lluna_Core_Fiber* Fiber)
+{
+        return Fiber->Finished;
+}
@@ -0,0 +1,662 @@
+#include <Engine/Core/Public/Hash.h>
+
+#include <Engine/Core/Public/Cpu.h>
+#include <Engine/Core/Public/Macros.h>
+
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HAS_X86_INTRINSICS
+#include <immintrin.h>
+#endif
+
+#define Prime32_1 0x9E3779B1U
+#define Prime32_2 0x85EBCA77U
+#define Prime32_3 0xC2B2AE3DU
+#define Prime64_1 0x9E3779B185EBCA87ULL
+#define Prime64_2 0xC2B2AE3D27D4EB4FULL
+#define Prime64_3 0x165667B19E3779F9ULL
+#define Prime64_4 0x85EBCA77C2B2AE63ULL
+#define Prime64_5 0x27D4EB2F165667C5ULL
+
+#define StripeSize 64
+#define SecretConsumeRate 8
+#define MidSizeMax 240
+#define SecretSizeMin 136
+#define SecretMergeStart 11
+#define SecretLastStripeStart 7
+#define StripesPerBlock ((lluna_Core_Hash_SecretSize - StripeSize) / SecretConsumeRate)
+#define BufferStripes (lluna_Core_Hash_BufferSize / StripeSize)
+
+// Reflected Castagnoli polynomial.
+#define Crc32cPolynomial 0x82F63B78U
+
+typedef void (*AccumulateFunction)(uint64*, const byte*, const byte*, uint64);
+typedef void (*ScrambleFunction)(uint64*, const byte*);
+typedef uint32 (*Crc32cFunction)(uint32, const byte*, uint64);
+
+static const byte DefaultSecret[lluna_Core_Hash_SecretSize] = {
+        0xB8, 0xFE, 0x6C, 0x39, 0x23, 0xA4, 0x4B, 0xBE, 0x7C, 0x01, 0x81, 0x2C, 0xF7, 0x21, 0xAD, 0x1C,
+        0xDE, 0xD4, 0x6D, 0xE9, 0x83, 0x90, 0x97, 0xDB, 0x72, 0x40, 0xA4, 0xA4, 0xB7, 0xB3, 0x67, 0x1F,
+        0xCB, 0x79, 0xE6, 0x4E, 0xCC, 0xC0, 0xE5, 0x78, 0x82, 0x5A, 0xD0, 0x7D, 0xCC, 0xFF, 0x72, 0x21,
+        0xB8, 0x08, 0x46, 0x74, 0xF7, 0x43, 0x24, 0x8E, 0xE0, 0x35, 0x90, 0xE6, 0x81, 0x3A, 0x26, 0x4C,
+        0x3C, 0x28, 0x52, 0xBB, 0x91, 0xC3, 0x00, 0xCB, 0x88, 0xD0, 0x65, 0x8B, 0x1B, 0x53, 0x2E, 0xA3,
+        0x71, 0x64, 0x48, 0x97, 0xA2, 0x0D, 0xF9, 0x4E, 0x38, 0x19, 0xEF, 0x46, 0xA9, 0xDE, 0xAC, 0xD8,
+        0xA8, 0xFA, 0x76, 0x3F, 0xE3, 0x9C, 0x34, 0x3F, 0xF9, 0xDC, 0xBB, 0xC7, 0xC7, 0x0B, 0x4F, 0x1D,
+        0x8A, 0x51, 0xE0, 0x4B, 0xCD, 0xB4, 0x59, 0x31, 0xC8, 0x9F, 0x7E, 0xC9, 0xD9, 0x78, 0x73, 0x64,
+        0xEA, 0xC5, 0xAC, 0x83, 0x34, 0xD3, 0xEB, 0xC3, 0xC5, 0x81, 0xA0, 0xFF, 0xFA, 0x13, 0x63, 0xEB,
+        0x17, 0x0D, 0xDD, 0x51, 0xB7, 0xF0, 0xDA, 0x49, 0xD3, 0x16, 0x55, 0x26, 0x29, 0xD4, 0x68, 0x9E,
+        0x2B, 0x16, 0xBE, 0x58, 0x7D, 0x47, 0xA1, 0xFC, 0x8F, 0xF8, 0xB8, 0xD1, 0x7A, 0xD0, 0x31, 0xCE,
+        0x45, 0xCB, 0x3A, 0x8F, 0x95, 0x16, 0x04, 0x28, 0xAF, 0xD7, 0xFB, 0xCA, 0xBB, 0x4B, 0x40, 0x7E,
+};
+
+static const uint64 InitialAccumulators[8] = {
+        Prime32_3, Prime64_1, Prime64_2, Prime64_3, Prime64_4, Prime32_2, Prime64_5, Prime32_1
+};
+
+static uint32 Read32(const byte* Data)
+{
+        uint32 Value;
+        memcpy(&Value, Data, sizeof(Value));
+        return Value;
+}
+
+static uint64 Read64(const byte* Data)
+{
+        uint64 Value;
+        memcpy(&Value, Data, sizeof(Value));
+        return Value;
+}
+
+static void Write64(byte* Data, uint64 Value)
+{
+        memcpy(Data, &Value, sizeof(Value));
+}
+
+static uint64 RotateLeft64(uint64 Value, uint32 Amount)
+{
+        return (Value << Amount) | (Value >> (64 - Amount));
+}
+
+static uint64 Multiply128Fold64(uint64 Left, uint64 Right)
+{
+#ifdef __SIZEOF_INT128__
+        unsigned __int128 Product = (unsigned __int128)Left * Right;
+
+        return (uint64)Product ^ (uint64)(Product >> 64);
+#else
+        uint64 LowLow = (Left & 0xFFFFFFFF) * (Right & 0xFFFFFFFF);
+        uint64 HighLow = (Left >> 32) * (Right & 0xFFFFFFFF);
+        uint64 LowHigh = (Left & 0xFFFFFFFF) * (Right >> 32);
+        uint64 HighHigh = (Left >> 32) * (Right >> 32);
+        uint64 Cross = (LowLow >> 32) + (HighLow & 0xFFFFFFFF) + LowHigh;
+        uint64 High = (HighLow >> 32) + (Cross >> 32) + HighHigh;
+        uint64 Low = (Cross << 32) | (LowLow & 0xFFFFFFFF);
+
+        return Low ^ High;
+#endif
+}
+
+static uint64 Avalanche64(uint64 Hash)
+{
+        Hash ^= Hash >> 33;
+        Hash *= Prime64_2;
+        Hash ^= Hash >> 29;
+        Hash *= Prime64_3;
+        Hash ^= Hash >> 32;
+        return Hash;
+}
+
+static uint64 Avalanche(uint64 Hash)
+{
+        Hash ^= Hash >> 37;
+        Hash *= 0x165667919E3779F9ULL;
+        Hash ^= Hash >> 32;
+        return Hash;
+}
+
+static uint64 StrongAvalanche(uint64 Hash, uint64 Length)
+{
+        Hash ^= RotateLeft64(Hash, 49) ^ RotateLeft64(Hash, 24);
+        Hash *= 0x9FB21C651E98DF25ULL;
+        Hash ^= (Hash >> 35) + Length;
+        Hash *= 0x9FB21C651E98DF25ULL;
+        Hash ^= Hash >> 28;
+        return Hash;
+}
+
+static uint64 Mix16(const byte* Input, const byte* Secret, uint64 Seed)
+{
+        return Multiply128Fold64(Read64(Input) ^ (Read64(Secret) + Seed), Read64(Input + 8) ^ (Read64(Secret + 8) - Seed));
+}
+
+static uint64 Hash1To3(const byte* Input, uint64 Length, uint64 Seed)
+{
+        uint32 Combined = ((uint32)Input[0] << 16) | ((uint32)Input[Length >> 1] << 24) | (uint32)Input[Length - 1] | ((uint32)Length << 8);
+        uint64 Flip = (uint64)(Read32(DefaultSecret) ^ Read32(DefaultSecret + 4)) + Seed;
+
+        return Avalanche64(Combined ^ Flip);
+}
+
+static uint64 Hash4To8(const byte* Input, uint64 Length, uint64 Seed)
+{
+        Seed ^= (uint64)__builtin_bswap32((uint32)Seed) << 32;
+
+        uint64 Flip = (Read64(DefaultSecret + 8) ^ Read64(DefaultSecret + 16)) - Seed;
+        uint64 Combined = (uint64)Read32(Input + Length - 4) + ((uint64)Read32(Input) << 32);
+
+        return StrongAvalanche(Combined ^ Flip, Length);
+}
+
+static uint64 Hash9To16(const byte* Input, uint64 Length, uint64 Seed)
+{
+        uint64 Flip1 = (Read64(DefaultSecret + 24) ^ Read64(DefaultSecret + 32)) + Seed;
+        uint64 Flip2 = (Read64(DefaultSecret + 40) ^ Read64(DefaultSecret + 48)) - Seed;
+        uint64 Low = Read64(Input) ^ Flip1;
+        uint64 High = Read64(Input + Length - 8) ^ Flip2;
+
+        return Avalanche(Length + __builtin_bswap64(Low) + High + Multiply128Fold64(Low, High));
+}
+
+static uint64 Hash17To128(const byte* Input, uint64 Length, uint64 Seed)
+{
+        uint64 Accumulator = Length * Prime64_1;
+
+        if (Length > 32)
+        {
+                if (Length > 64)
+                {
+                        if (Length > 96)
+                        {
+                                Accumulator += Mix16(Input + 48, DefaultSecret + 96, Seed);
+                                Accumulator += Mix16(Input + Length - 64, DefaultSecret + 112, Seed);
+                        }
+                        Accumulator += Mix16(Input + 32, DefaultSecret + 64, Seed);
+                        Accumulator += Mix16(Input + Length - 48, DefaultSecret + 80, Seed);
+                }
+                Accumulator += Mix16(Input + 16, DefaultSecret + 32, Seed);
+                Accumulator += Mix16(Input + Length - 32, DefaultSecret + 48, Seed);
+        }
+        Accumulator += Mix16(Input, DefaultSecret, Seed);
+        Accumulator += Mix16(Input + Length - 16, DefaultSecret + 16, Seed);
+
+        return Avalanche(Accumulator);
+}
+
+static uint64 Hash129To240(const byte* Input, uint64 Length, uint64 Seed)
+{
+        uint64 Accumulator = Length * Prime64_1;
+        uint64 RoundCount = Length / 16;
+
+        uint64 Round = 0;
+        for (; Round < 8; ++Round)
+        {
+                Accumulator += Mix16(Input + 16 * Round, DefaultSecret + 16 * Round, Seed);
+        }
+        Accumulator = Avalanche(Accumulator);
+
+        for (; Round < RoundCount; ++Round)
+        {
+                Accumulator += Mix16(Input + 16 * Round, DefaultSecret + 16 * (Round - 8) + 3, Seed);
+        }
+        Accumulator += Mix16(Input + Length - 16, DefaultSecret + SecretSizeMin - 17, Seed);
+
+        return Avalanche(Accumulator);
+}
+
+static uint64 HashShort(const byte* Input, uint64 Length, uint64 Seed)
+{
+        if (Length > 128)
+        {
+                return Hash129To240(Input, Length, Seed);
+        }
+        if (Length > 16)
+        {
+                return Hash17To128(Input, Length, Seed);
+        }
+        if (Length > 8)
+        {
+                return Hash9To16(Input, Length, Seed);
+        }
+        if (Length >= 4)
+        {
+                return Hash4To8(Input, Length, Seed);
+        }
+        if (Length > 0)
+        {
+                return Hash1To3(Input, Length, Seed);
+        }
+
+        return Avalanche64(Seed ^ Read64(DefaultSecret + 56) ^ Read64(DefaultSecret + 64));
+}
+
+static void AccumulateScalar(uint64* Accumulators, const byte* Input, const byte* Secret, uint64 StripeCount)
+{
+        for (uint64 Stripe = 0; Stripe < StripeCount; ++Stripe)
+        {
+                const byte* StripeInput = Input + Stripe * StripeSize;
+                const byte* StripeSecret = Secret + Stripe * SecretConsumeRate;
+
+                for (uint32 Lane = 0; Lane < 8; ++Lane)
+                {
+                        uint64 Value = Read64(StripeInput + 8 * Lane);
+                        uint64 Keyed = Value ^ Read64(StripeSecret + 8 * Lane);
+
+                        Accumulators[Lane ^ 1] += Value;
+                        Accumulators[Lane] += (Keyed & 0xFFFFFFFF) * (Keyed >> 32);
+                }
+        }
+}
+
+static void ScrambleScalar(uint64* Accumulators, const byte* Secret)
+{
+        for (uint32 Lane = 0; Lane < 8; ++Lane)
+        {
+                uint64 Accumulator = Accumulators[Lane];
+                Accumulator ^= Accumulator >> 47;
+                Accumulator ^= Read64(Secret + 8 * Lane);
+                Accumulators[Lane] = Accumulator * Prime32_1;
+        }
+}
+
+#ifdef HAS_X86_INTRINSICS
+
+__attribute__((target("sse2")))
+static __m128i AccumulateLaneSse2(__m128i Accumulator, const byte* Input, const byte* Secret)
+{
+        __m128i Value = _mm_loadu_si128((const __m128i*)Input);
+        __m128i Keyed = _mm_xor_si128(Value, _mm_loadu_si128((const __m128i*)Secret));
+        __m128i Product = _mm_mul_epu32(Keyed, _mm_shuffle_epi32(Keyed, _MM_SHUFFLE(0, 3, 0, 1)));
+        __m128i Swapped = _mm_shuffle_epi32(Value, _MM_SHUFFLE(1, 0, 3, 2));
+
+        return _mm_add_epi64(_mm_add_epi64(Accumulator, Swapped), Product);
+}
+
+__attribute__((target("sse2")))
+static void AccumulateSse2(uint64* Accumulators, const byte* Input, const byte* Secret, uint64 StripeCount)
+{
+        __m128i Accumulator[4];
+        for (uint32 Lane = 0; Lane < 4; ++Lane)
+        {
+                Accumulator[Lane] = _mm_loadu_si128((const __m128i*)(Accumulators + 2 * Lane));
+        }
+
+        for (uint64 Stripe = 0; Stripe < StripeCount; ++Stripe)
+        {
+                const byte* StripeInput = Input + Stripe * StripeSize;
+                const byte* StripeSecret = Secret + Stripe * SecretConsumeRate;
+
+                for (uint32 Lane = 0; Lane < 4; ++Lane)
+                {
+                        Accumulator[Lane] = AccumulateLaneSse2(Accumulator[Lane], StripeInput + 16 * Lane, StripeSecret + 16 * Lane);
+                }
+        }
+
+        for (uint32 Lane = 0; Lane < 4; ++Lane)
+        {
+                _mm_storeu_si128((__m128i*)(Accumulators + 2 * Lane), Accumulator[Lane]);
+        }
+}
+
+__attribute__((target("sse2")))
+static void ScrambleSse2(uint64* Accumulators, const byte* Secret)
+{
+        const __m128i Prime = _mm_set1_epi32((int32)Prime32_1);
+
+        for (uint32 Lane = 0; Lane < 4; ++Lane)
+        {
+                __m128i Accumulator = _mm_loadu_si128((const __m128i*)(Accumulators + 2 * Lane));
+                Accumulator = _mm_xor_si128(Accumulator, _mm_srli_epi64(Accumulator, 47));
+
+                __m128i Keyed = _mm_xor_si128(Accumulator, _mm_loadu_si128((const __m128i*)(Secret + 16 * Lane)));
+                __m128i ProductLow = _mm_mul_epu32(Keyed, Prime);
+                __m128i ProductHigh = _mm_mul_epu32(_mm_shuffle_epi32(Keyed, _MM_SHUFFLE(0, 3, 0, 1)), Prime);
+
+                _mm_storeu_si128((__m128i*)(Accumulators + 2 * Lane), _mm_add_epi64(ProductLow, _mm_slli_epi64(ProductHigh, 32)));
+        }
+}
+
+__attribute__((target("avx2")))
+static __m256i AccumulateLaneAvx2(__m256i Accumulator, const byte* Input, const byte* Secret)
+{
+        __m256i Value = _mm256_loadu_si256((const __m256i*)Input);
+        __m256i Keyed = _mm256_xor_si256(Value, _mm256_loadu_si256((const __m256i*)Secret));
+        __m256i Product = _mm256_mul_epu32(Keyed, _mm256_srli_epi64(Keyed, 32));
+        __m256i Swapped = _mm256_shuffle_epi32(Value, _MM_SHUFFLE(1, 0, 3, 2));
+
+        return _mm256_add_epi64(_mm256_add_epi64(Accumulator, Swapped), Product);
+}
+
+__attribute__((target("avx2")))
+static void AccumulateAvx2(uint64* Accumulators, const byte* Input, const byte* Secret, uint64 StripeCount)
+{
+        __m256i Low = _mm256_loadu_si256((const __m256i*)Accumulators);
+        __m256i High = _mm256_loadu_si256((const __m256i*)(Accumulators + 4));
+
+        for (uint64 Stripe = 0; Stripe < StripeCount; ++Stripe)
+        {
+                const byte* StripeInput = Input + Stripe * StripeSize;
+                const byte* StripeSecret = Secret + Stripe * SecretConsumeRate;
+
+                Low = AccumulateLaneAvx2(Low, StripeInput, StripeSecret);
+                High = AccumulateLaneAvx2(High, StripeInput + 32, StripeSecret + 32);
+        }
+
+        _mm256_storeu_si256((__m256i*)Accumulators, Low);
+        _mm256_storeu_si256((__m256i*)(Accumulators + 4), High);
+}
+
+__attribute__((target("avx2")))
+static void ScrambleAvx2(uint64* Accumulators, const byte* Secret)
+{
+        const __m256i Prime = _mm256_set1_epi32((int32)Prime32_1);
+
+        for (uint32 Lane = 0; Lane < 2; ++Lane)
+        {
+                __m256i Accumulator = _mm256_loadu_si256((const __m256i*)(Accumulators + 4 * Lane));
+                Accumulator = _mm256_xor_si256(Accumulator, _mm256_srli_epi64(Accumulator, 47));
+
+                __m256i Keyed = _mm256_xor_si256(Accumulator, _mm256_loadu_si256((const __m256i*)(Secret + 32 * Lane)));
+                __m256i ProductLow = _mm256_mul_epu32(Keyed, Prime);
+                __m256i ProductHigh = _mm256_mul_epu32(_mm256_srli_epi64(Keyed, 32), Prime);
+
+                _mm256_storeu_si256((__m256i*)(Accumulators + 4 * Lane), _mm256_add_epi64(ProductLow, _mm256_slli_epi64(ProductHigh, 32)));
+        }
+}
+
+__attribute__((target("sse4.2")))
+static uint32 Crc32cSse42(uint32 Checksum, const byte* Data, uint64 Size)
+{
+        uint64 Offset = 0;
+#ifdef __x86_64__
+        uint64 Wide = Checksum;
+        for (; Offset + 8 <= Size; Offset += 8)
+        {
+                Wide = _mm_crc32_u64(Wide, Read64(Data + Offset));
+        }
+        Checksum = (uint32)Wide;
+#endif
+        for (; Offset + 4 <= Size; Offset += 4)
+        {
+                Checksum = _mm_crc32_u32(Checksum, Read32(Data + Offset));
+        }
+        for (; Offset < Size; ++Offset)
+        {
+                Checksum = _mm_crc32_u8(Checksum, Data[Offset]);
+        }
+
+        return Checksum;
+}
+
+#endif
+
+static void ResolveLongFunctions(AccumulateFunction* Accumulate, ScrambleFunction* Scramble)
+{
+        static AccumulateFunction ResolvedAccumulate = NULL;
+        static ScrambleFunction ResolvedScramble = NULL;
+        if (!ResolvedAccumulate)
+        {
+                ResolvedAccumulate = AccumulateScalar;
+                ResolvedScramble = ScrambleScalar;
+#ifdef HAS_X86_INTRINSICS
+                if (lluna_Core_Cpu_Supports(lluna_Core_Cpu_Avx2))
+                {
+                        ResolvedAccumulate = AccumulateAvx2;
+                        ResolvedScramble = ScrambleAvx2;
+                }
+                else if (lluna_Core_Cpu_Supports(lluna_Core_Cpu_Sse2))
+                {
+                        ResolvedAccumulate = AccumulateSse2;
+                        ResolvedScramble = ScrambleSse2;
+                }
+#endif
+        }
+
+        *Accumulate = ResolvedAccumulate;
+        *Scramble = ResolvedScramble;
+}
+
+static void DeriveSecret(byte* Secret, uint64 Seed)
+{
+        for (uint32 Offset = 0; Offset < lluna_Core_Hash_SecretSize; Offset += 16)
+        {
+                Write64(Secret + Offset, Read64(DefaultSecret + Offset) + Seed);
+                Write64(Secret + Offset + 8, Read64(DefaultSecret + Offset + 8) - Seed);
+        }
+}
+
+static uint64 MergeAccumulators(const uint64* Accumulators, const byte* Secret, uint64 Start)
+{
+        uint64 Result = Start;
+        for (uint32 Lane = 0; Lane < 8; Lane += 2)
+        {
+                Result += Multiply128Fold64(Accumulators[Lane] ^ Read64(Secret + 8 * Lane), Accumulators[Lane + 1] ^ Read64(Secret + 8 * Lane + 8));
+        }
+
+        return Avalanche(Result);
+}
+
+static uint64 HashLong(const byte* Input, uint64 Length, const byte* Secret)
+{
+        const uint64 BlockSize = StripeSize * StripesPerBlock;
+        const uint64 BlockCount = (Length - 1) / BlockSize;
+
+        AccumulateFunction Accumulate;
+        ScrambleFunction Scramble;
+        ResolveLongFunctions(&Accumulate, &Scramble);
+
+        uint64 Accumulators[8];
+        memcpy(Accumulators, InitialAccumulators, sizeof(Accumulators));
+
+        for (uint64 Block = 0; Block < BlockCount; ++Block)
+        {
+                Accumulate(Accumulators, Input + Block * BlockSize, Secret, StripesPerBlock);
+                Scramble(Accumulators, Secret + lluna_Core_Hash_SecretSize - StripeSize);
+        }
+
+        // The last stripe always overlaps the end of the input and uses its own secret offset.
+        uint64 StripeCount = ((Length - 1) - BlockSize * BlockCount) / StripeSize;
+        Accumulate(Accumulators, Input + BlockCount * BlockSize, Secret, StripeCount);
+        Accumulate(Accumulators, Input + Length - StripeSize, Secret + lluna_Core_Hash_SecretSize - StripeSize - SecretLastStripeStart, 1);
+
+        return MergeAccumulators(Accumulators, Secret + SecretMergeStart, Length * Prime64_1);
+}
+
+uint64 lluna_Core_Hash_Bytes(const void* Data, uint64 Size, uint64 Seed)
+{
+        if (Size <= MidSizeMax)
+        {
+                return HashShort((const byte*)Data, Size, Seed);
+        }
+        if (Seed == 0)
+        {
+                return HashLong((const byte*)Data, Size, DefaultSecret);
+        }
+
+        byte Secret[lluna_Core_Hash_SecretSize];
+        DeriveSecret(Secret, Seed);
+
+        return HashLong((const byte*)Data, Size, Secret);
+}
+
+uint64 lluna_Core_Hash_Text(struct lluna_Core_Types_Text Text, uint64 Seed)
+{
+        return lluna_Core_Hash_Bytes(Text.Data, lluna_Macros_TextLength(Text), Seed);
+}
+
+void lluna_Core_Hash_Initialize(struct lluna_Core_Hash_State* State, uint64 Seed)
+{
+        memcpy(State->Accumulators, InitialAccumulators, sizeof(State->Accumulators));
+        DeriveSecret(State->Secret, Seed);
+        State->BufferedSize = 0;
+        State->StripeCount = 0;
+        State->TotalSize = 0;
+        State->Seed = Seed;
+}
+
+// Consumes whole stripes, scrambling whenever a block of secret is used up. Returns the new stripe count within the block.
+static uint64 ConsumeStripes(uint64* Accumulators, uint64 StripeCount, const byte* Input, uint64 Count, const byte* Secret)
+{
+        AccumulateFunction Accumulate;
+        ScrambleFunction Scramble;
+        ResolveLongFunctions(&Accumulate, &Scramble);
+
+        if (StripesPerBlock - StripeCount <= Count)
+        {
+                uint64 StripesToEnd = StripesPerBlock - StripeCount;
+
+                Accumulate(Accumulators, Input, Secret + StripeCount * SecretConsumeRate, StripesToEnd);
+                Scramble(Accumulators, Secret + lluna_Core_Hash_SecretSize - StripeSize);
+                Accumulate(Accumulators, Input + StripesToEnd * StripeSize, Secret, Count - StripesToEnd);
+
+                return Count - StripesToEnd;
+        }
+
+        Accumulate(Accumulators, Input, Secret + StripeCount * SecretConsumeRate, Count);
+
+        return StripeCount + Count;
+}
+
+void lluna_Core_Hash_Update(struct lluna_Core_Hash_State* State, const void* Data, uint64 Size)
+{
+        const byte* Input = (const byte*)Data;
+        State->TotalSize += Size;
+
+        if (State->BufferedSize + Size <= lluna_Core_Hash_BufferSize)
+        {
+                memcpy(State->Buffer + State->BufferedSize, Input, Size);
+                State->BufferedSize += Size;
+                return;
+        }
+
+        // Input is only consumed while more follows, so the final stripe is always left for the digest.
+        if (State->BufferedSize > 0)
+        {
+                uint64 FillSize = lluna_Core_Hash_BufferSize - State->BufferedSize;
+                memcpy(State->Buffer + State->BufferedSize, Input, FillSize);
+                Input += FillSize;
+                Size -= FillSize;
+
+                State->StripeCount = ConsumeStripes(State->Accumulators, State->StripeCount, State->Buffer, BufferStripes, State->Secret);
+                State->BufferedSize = 0;
+        }
+
+        if (Size > lluna_Core_Hash_BufferSize)
+        {
+                do
+                {
+                        State->StripeCount = ConsumeStripes(State->Accumulators, State->StripeCount, Input, BufferStripes, State->Secret);
+                        Input += lluna_Core_Hash_BufferSize;
+                        Size -= lluna_Core_Hash_BufferSize;
+                } while (Size > lluna_Core_Hash_BufferSize);
+
+                // Keep the last consumed stripe around in case the digest needs to look back into it.
+                memcpy(State->Buffer + lluna_Core_Hash_BufferSize - StripeSize, Input - StripeSize, StripeSize);
+        }
+
+        memcpy(State->Buffer, Input, Size);
+        State->BufferedSize = Size;
+}
+
+uint64 lluna_Core_Hash_Digest(const struct lluna_Core_Hash_State* State)
+{
+        if (State->TotalSize <= MidSizeMax)
+        {
+                return HashShort(State->Buffer, State->TotalSize, State->Seed);
+        }
+
+        AccumulateFunction Accumulate;
+        ScrambleFunction Scramble;
+        ResolveLongFunctions(&Accumulate, &Scramble);
+
+        uint64 Accumulators[8];
+        memcpy(Accumulators, State->Accumulators, sizeof(Accumulators));
+
+        const byte* LastStripeSecret = State->Secret + lluna_Core_Hash_SecretSize - StripeSize - SecretLastStripeStart;
+        if (State->BufferedSize >= StripeSize)
+        {
+                uint64 StripeCount = (State->BufferedSize - 1) / StripeSize;
+                ConsumeStripes(Accumulators, State->StripeCount, State->Buffer, StripeCount, State->Secret);
+                Accumulate(Accumulators, State->Buffer + State->BufferedSize - StripeSize, LastStripeSecret, 1);
+        }
+        else
+        {
+                // The last stripe starts in bytes that were already consumed from the end of the buffer.
+                byte LastStripe[StripeSize];
+                uint64 CatchUpSize = StripeSize - State->BufferedSize;
+                memcpy(LastStripe, State->Buffer + lluna_Core_Hash_BufferSize - CatchUpSize, CatchUpSize);
+                memcpy(LastStripe + CatchUpSize, State->Buffer, State->BufferedSize);
+                Accumulate(Accumulators, LastStripe, LastStripeSecret, 1);
+        }
+
+        return MergeAccumulators(Accumulators, State->Secret + SecretMergeStart, State->TotalSize * Prime64_1);
+}
+
+static uint32 Crc32cTable[8][256];
+
+static void BuildCrc32cTable()
+{
+        for (uint32 Index = 0; Index < 256; ++Index)
+        {
+                uint32 Value = Index;
+                for (uint32 Bit = 0; Bit < 8; ++Bit)
+                {
+                        Value = (Value >> 1) ^ (Crc32cPolynomial & (0U - (Value & 1)));
+                }
+                Crc32cTable[0][Index] = Value;
+        }
+
+        for (uint32 Index = 0; Index < 256; ++Index)
+        {
+                for (uint32 Slice = 1; Slice < 8; ++Slice)
+                {
+                        uint32 Previous = Crc32cTable[Slice - 1][Index];
+                        Crc32cTable[Slice][Index] = (Previous >> 8) ^ Crc32cTable[0][Previous & 0xFF];
+                }
+        }
+}
+
+static uint32 Crc32cScalar(uint32 Checksum, const byte* Data, uint64 Size)
+{
+        uint64 Offset = 0;
+        for (; Offset + 8 <= Size; Offset += 8)
+        {
+                uint32 Low = Read32(Data + Offset) ^ Checksum;
+                uint32 High = Read32(Data + Offset + 4);
+
+                Checksum = Crc32cTable[7][Low & 0xFF] ^ Crc32cTable[6][(Low >> 8) & 0xFF] ^
+                        Crc32cTable[5][(Low >> 16) & 0xFF] ^ Crc32cTable[4][Low >> 24] ^
+                        Crc32cTable[3][High & 0xFF] ^ Crc32cTable[2][(High >> 8) & 0xFF] ^
+                        Crc32cTable[1][(High >> 16) & 0xFF] ^ Crc32cTable[0][High >> 24];
+        }
+        for (; Offset < Size; ++Offset)
+        {
+                Checksum = (Checksum >> 8) ^ Crc32cTable[0][(Checksum ^ Data[Offset]) & 0xFF];
+        }
+
+        return Checksum;
+}
+
+static Crc32cFunction ResolveCrc32c()
+{
+#ifdef HAS_X86_INTRINSICS
+        if (lluna_Core_Cpu_Supports(lluna_Core_Cpu_Sse42))
+        {
+                return Crc32cSse42;
+        }
+#endif
+
+        BuildCrc32cTable();
+        return Crc32cScalar;
+}
+
+uint32 lluna_Core_Hash_Crc32c(uint32 Checksum, const void* Data, uint64 Size)
+{
+        static Crc32cFunction Crc32c = NULL;
+        if (!Crc32c)
+        {
+                Crc32c = ResolveCrc32c();
+        }
+
+        return ~Crc32c(~Checksum, (const byte*)Data, Size);
+}
@@ -0,0 +1,335 @@
+#include <Engine/Core/Public/Memory.h>
+
+#include <Engine/Core/Public/Atomics.h>
+#include <Engine/Core/Public/Macros.h>
+#include <Engine/Core/Public/Sync.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#define CacheLineSize 64
+#define BuiltInTagCount 4
+
+// Tracked allocations are preceded by their size and tags, 16 bytes keeping the alignment of malloc.
+struct Header
+{
+        uint64 Size;
+        uint32 Tag;
+        uint32 Scope;
+};
+
+// Tags are updated by every allocating thread, so each tag gets its own cache lines and no tag slows down another.
+struct Tag
+{
+        const char* Module;
+        const char* Name;
+        uint64 Budget;
+
+        uint64 CurrentBytes;
+        uint64 PeakBytes;
+        uint64 TotalBytes;
+        uint64 Allocations;
+        uint64 Reallocations;
+        uint64 Frees;
+        uint64 Histogram[lluna_Core_Memory_HistogramSize];
+} __attribute__((aligned(CacheLineSize)));
+
+static struct Tag Tags[lluna_Core_Memory_MaxTags] = {
+        [lluna_Core_Memory_Untagged] = {"Core", "Untagged"},
+        [lluna_Core_Memory_DynamicArray] = {"Container", "DynamicArray"},
+        [lluna_Core_Memory_String] = {"Container", "String"},
+        [lluna_Core_Memory_RedBlackTree] = {"Container", "RedBlackTree"},
+};
+static uint32 TagCount = BuiltInTagCount;
+static struct lluna_Core_Sync_Mutex RegisterLock;
+static __thread uint32 ScopeTag = lluna_Core_Memory_Untagged;
+
+static uint32 Resolve(uint32 Tag)
+{
+        return Tag < lluna_Core_Atomics_LoadUint32(&TagCount, lluna_Core_Atomics_Acquire) ? Tag : lluna_Core_Memory_Untagged;
+}
+
+static uint32 BucketOf(uint64 Size)
+{
+        uint32 Bucket = Size ? 64 - __builtin_clzll(Size) : 0;
+
+        return Bucket < lluna_Core_Memory_HistogramSize ? Bucket : lluna_Core_Memory_HistogramSize - 1;
+}
+
+static void Grow(struct Tag* Tag, uint64 Size)
+{
+        uint64 Current = lluna_Core_Atomics_FetchAddUint64(&Tag->CurrentBytes, Size, lluna_Core_Atomics_Relaxed) + Size;
+        uint64 Peak = lluna_Core_Atomics_LoadUint64(&Tag->PeakBytes, lluna_Core_Atomics_Relaxed);
+        while (Current > Peak && !lluna_Core_Atomics_CompareExchangeUint64(&Tag->PeakBytes, &Peak, Current, true,
+                                                                           lluna_Core_Atomics_Relaxed, lluna_Core_Atomics_Relaxed))
+        {
+        }
+}
+
+static void CountAllocation(uint32 Index, uint64 Size)
+{
+        struct Tag* Tag = &Tags[Index];
+
+        lluna_Core_Atomics_FetchAddUint64(&Tag->Allocations, 1, lluna_Core_Atomics_Relaxed);
+        lluna_Core_Atomics_FetchAddUint64(&Tag->TotalBytes, Size, lluna_Core_Atomics_Relaxed);
+        lluna_Core_Atomics_FetchAddUint64(&Tag->Histogram[BucketOf(Size)], 1, lluna_Core_Atomics_Relaxed);
+        Grow(Tag, Size);
+}
+
+static void CountReallocation(uint32 Index, uint64 OldSize, uint64 Size)
+{
+        struct Tag* Tag = &Tags[Index];
+
+        lluna_Core_Atomics_FetchAddUint64(&Tag->Reallocations, 1, lluna_Core_Atomics_Relaxed);
+        lluna_Core_Atomics_FetchAddUint64(&Tag->Histogram[BucketOf(Size)], 1, lluna_Core_Atomics_Relaxed);
+        if (Size > OldSize)
+        {
+                lluna_Core_Atomics_FetchAddUint64(&Tag->TotalBytes, Size - OldSize, lluna_Core_Atomics_Relaxed);
+                Grow(Tag, Size - OldSize);
+        }
+        else
+        {
+                lluna_Core_Atomics_FetchSubUint64(&Tag->CurrentBytes, OldSize - Size, lluna_Core_Atomics_Relaxed);
+        }
+}
+
+static void CountFree(uint32 Index, uint64 Size)
+{
+        struct Tag* Tag = &Tags[Index];
+
+        lluna_Core_Atomics_FetchAddUint64(&Tag->Frees, 1, lluna_Core_Atomics_Relaxed);
+        lluna_Core_Atomics_FetchSubUint64(&Tag->CurrentBytes, Size, lluna_Core_Atomics_Relaxed);
+}
+
+void* lluna_Core_Memory_TrackedAllocate(uint64 Size, uint32 Tag)
+{
+        struct Header* Header = malloc(sizeof(struct Header) + Size);
+        if (!Header)
+        {
+                return NULL;
+        }
+
+        Header->Size = Size;
+        Header->Tag = Resolve(Tag);
+        Header->Scope = ScopeTag != Header->Tag ? ScopeTag : lluna_Core_Memory_Untagged;
+
+        CountAllocation(Header->Tag, Size);
+        if (Header->Scope != lluna_Core_Memory_Untagged)
+        {
+                CountAllocation(Header->Scope, Size);
+        }
+
+        return Header + 1;
+}
+
+void* lluna_Core_Memory_TrackedReallocate(void* Pointer, uint64 Size, uint32 Tag)
+{
+        if (!Pointer)
+        {
+                return lluna_Core_Memory_TrackedAllocate(Size, Tag);
+        }
+
+        uint64 OldSize = ((struct Header*)Pointer - 1)->Size;
+        struct Header* Header = realloc((struct Header*)Pointer - 1, sizeof(struct Header) + Size);
+        if (!Header)
+        {
+                return NULL;
+        }
+
+        Header->Size = Size;
+
+        CountReallocation(Header->Tag, OldSize, Size);
+        if (Header->Scope != lluna_Core_Memory_Untagged)
+        {
+                CountReallocation(Header->Scope, OldSize, Size);
+        }
+
+        return Header + 1;
+}
+
+void lluna_Core_Memory_TrackedFree(void* Pointer)
+{
+        if (!Pointer)
+        {
+                return;
+        }
+
+        struct Header* Header = (struct Header*)Pointer - 1;
+
+        CountFree(Header->Tag, Header->Size);
+        if (Header->Scope != lluna_Core_Memory_Untagged)
+        {
+                CountFree(Header->Scope, Header->Size);
+        }
+
+        free(Header);
+}
+
+uint32 lluna_Core_Memory_RegisterTag(const char* Module, const char* Name)
+{
+        lluna_Core_Sync_LockMutex(&RegisterLock);
+
+        uint32 Count = lluna_Core_Atomics_LoadUint32(&TagCount, lluna_Core_Atomics_Relaxed);
+        uint32 Tag = lluna_Core_Memory_Untagged;
+        for (uint32 Index = 0; Index < Count; ++Index)
+        {
+                if (strcmp(Tags[Index].Module, Module) == 0 && strcmp(Tags[Index].Name, Name) == 0)
+                {
+                        Tag = Index;
+                        break;
+                }
+        }
+
+        if (Tag == lluna_Core_Memory_Untagged && Count < lluna_Core_Memory_MaxTags)
+        {
+                Tag = Count;
+                Tags[Tag].Module = Module;
+                Tags[Tag].Name = Name;
+
+                // Threads seeing the new count see the names of the tag.
+                lluna_Core_Atomics_StoreUint32(&TagCount, Count + 1, lluna_Core_Atomics_Release);
+        }
+
+        lluna_Core_Sync_UnlockMutex(&RegisterLock);
+
+        return Tag;
+}
+
+uint32 lluna_Core_Memory_TagCount()
+{
+        return lluna_Core_Atomics_LoadUint32(&TagCount, lluna_Core_Atomics_Acquire);
+}
+
+uint32 lluna_Core_Memory_EnterScope(uint32 Tag)
+{
+        uint32 Previous = ScopeTag;
+        ScopeTag = Resolve(Tag);
+
+        return Previous;
+}
+
+void lluna_Core_Memory_LeaveScope(uint32 Previous)
+{
+        ScopeTag = Previous;
+}
+
+void lluna_Core_Memory_SetBudget(uint32 Tag, uint64 Budget)
+{
+        lluna_Core_Atomics_StoreUint64(&Tags[Resolve(Tag)].Budget, Budget, lluna_Core_Atomics_Relaxed);
+}
+
+boolean lluna_Core_Memory_OverBudget(uint32 Tag)
+{
+        struct Tag* Entry = &Tags[Resolve(Tag)];
+        uint64 Budget = lluna_Core_Atomics_LoadUint64(&Entry->Budget, lluna_Core_Atomics_Relaxed);
+
+        return Budget && lluna_Core_Atomics_LoadUint64(&Entry->PeakBytes, lluna_Core_Atomics_Relaxed) > Budget;
+}
+
+void lluna_Core_Memory_ResetPeak(uint32 Tag)
+{
+        struct Tag* Entry = &Tags[Resolve(Tag)];
+        lluna_Core_Atomics_StoreUint64(&Entry->PeakBytes, lluna_Core_Atomics_LoadUint64(&Entry->CurrentBytes, lluna_Core_Atomics_Relaxed),
+                                       lluna_Core_Atomics_Relaxed);
+}
+
+boolean lluna_Core_Memory_GetStats(uint32 Tag, struct lluna_Core_Memory_Stats* Stats)
+{
+        if (Tag >= lluna_Core_Atomics_LoadUint32(&TagCount, lluna_Core_Atomics_Acquire))
+        {
+                return false;
+        }
+
+        struct Tag* Entry = &Tags[Tag];
+
+        Stats->Module = Entry->Module;
+        Stats->Name = Entry->Name;
+
+        Stats->CurrentBytes = lluna_Core_Atomics_LoadUint64(&Entry->CurrentBytes, lluna_Core_Atomics_Relaxed);
+        Stats->PeakBytes = lluna_Core_Atomics_LoadUint64(&Entry->PeakBytes, lluna_Core_Atomics_Relaxed);
+        Stats->TotalBytes = lluna_Core_Atomics_LoadUint64(&Entry->TotalBytes, lluna_Core_Atomics_Relaxed);
+        Stats->Budget = lluna_Core_Atomics_LoadUint64(&Entry->Budget, lluna_Core_Atomics_Relaxed);
+
+        Stats->Allocations = lluna_Core_Atomics_LoadUint64(&Entry->Allocations, lluna_Core_Atomics_Relaxed);
+        Stats->Reallocations = lluna_Core_Atomics_LoadUint64(&Entry->Reallocations, lluna_Core_Atomics_Relaxed);
+        Stats->Frees = lluna_Core_Atomics_LoadUint64(&Entry->Frees, lluna_Core_Atomics_Relaxed);
+
+        for (uint32 Bucket = 0; Bucket < lluna_Core_Memory_HistogramSize; ++Bucket)
+        {
+                Stats->Histogram[Bucket] = lluna_Core_Atomics_LoadUint64(&Entry->Histogram[Bucket], lluna_Core_Atomics_Relaxed);
+        }
+
+        return true;
+}
+
+static void WriteHistogram(struct lluna_Core_Writer* Output, struct lluna_Core_Memory_Stats* Stats)
+{
+        lluna_Core_Writer_Format(Output, lluna_Macros_Text("\n%s/%s sizes:\n"), Stats->Module, Stats->Name);
+
+        for (uint32 Bucket = 0; Bucket < lluna_Core_Memory_HistogramSize; ++Bucket)
+        {
+                if (!Stats->Histogram[Bucket])
+                {
+                        continue;
+                }
+
+                if (Bucket == 0)
+                {
+                        lluna_Core_Writer_Format(Output, lluna_Macros_Text("  %24s %12llu\n"), "0", (unsigned long long)Stats->Histogram[Bucket]);
+                }
+                else if (Bucket == lluna_Core_Memory_HistogramSize - 1)
+                {
+                        lluna_Core_Writer_Format(Output, lluna_Macros_Text("  %23llu+ %12llu\n"), 1ULL << (Bucket - 1),
+                                                 (unsigned long long)Stats->Histogram[Bucket]);
+                }
+                else
+                {
+                        lluna_Core_Writer_Format(Output, lluna_Macros_Text("  %11llu-%12llu %12llu\n"), 1ULL << (Bucket - 1),
+                                                 (1ULL << Bucket) - 1, (unsigned long long)Stats->Histogram[Bucket]);
+                }
+        }
+}
+
+void lluna_Core_Memory_Report(struct lluna_Core_Writer* Output)
+{
+        uint32 Count = lluna_Core_Memory_TagCount();
+        struct lluna_Core_Memory_Stats Stats;
+
+        lluna_Core_Writer_Format(Output, lluna_Macros_Text("%-12s %-16s %14s %14s %14s %12s %12s %12s\n"), "Module", "Tag", "Current",
+                                 "Peak", "Budget", "Allocations", "Reallocs", "Frees");
+        for (uint32 Tag = 0; Tag < Count; ++Tag)
+        {
+                lluna_Core_Memory_GetStats(Tag, &Stats);
+                if (!Stats.Allocations)
+                {
+                        continue;
+                }
+
+                lluna_Core_Writer_Format(Output, lluna_Macros_Text("%-12s %-16s %14llu %14llu "), Stats.Module, Stats.Name,
+                                         (unsigned long long)Stats.CurrentBytes, (unsigned long long)Stats.PeakBytes);
+                if (Stats.Budget)
+                {
+                        lluna_Core_Writer_Format(Output, lluna_Macros_Text("%14llu "), (unsigned long long)Stats.Budget);
+                }
+                else
+                {
+                        lluna_Core_Writer_Format(Output, lluna_Macros_Text("%14s "), "-");
+                }
+                lluna_Core_Writer_Format(Output, lluna_Macros_Text("%12llu %12llu %12llu"), (unsigned long long)Stats.Allocations,
+                                         (unsigned long long)Stats.Reallocations, (unsigned long long)Stats.Frees);
+                if (Stats.Budget && Stats.PeakBytes > Stats.Budget)
+                {
+                        lluna_Core_Writer_WriteText(Output, lluna_Macros_Text(" over budget"));
+                }
+                lluna_Core_Writer_WriteCharacter(Output, '\n');
+        }
+
+        for (uint32 Tag = 0; Tag < Count; ++Tag)
+        {
+                lluna_Core_Memory_GetStats(Tag, &Stats);
+                if (Stats.Allocations)
+                {
+                        WriteHistogram(Output, &Stats);
+                }
+        }
+}
@@ -0,0 +1,848 @@
+#include <Engine/Core/Public/Parse.h>
+
+#include <Engine/Core/Public/Macros.h>
+
+#include <float.h>
+#include <string.h>
+
+#define MantissaBits 23
+#define MinimumExponent -127
+#define InfinitePower 0xFF
+#define SmallestPowerOfTen -64
+#define LargestPowerOfTen 38
+#define MinimumExponentRoundToEven -17
+#define MaximumExponentRoundToEven 10
+#define MinimumNineteenDigitInteger 1000000000000000000ULL
+#define MaxExactDigits 128
+#define BigIntegerLimbCount 40
+
+// Normalized 128 bit approximations of 5^q for q in [SmallestPowerOfTen, LargestPowerOfTen], high word first.
+// Negative powers are rounded up, positive ones truncated.
+static const uint64 PowersOfFive[] = {
+        0xA87FEA27A539E9A5, 0x3F2398D747B36224,
+        0xD29FE4B18E88640E, 0x8EEC7F0D19A03AAD,
+        0x83A3EEEEF9153E89, 0x1953CF68300424AC,
+        0xA48CEAAAB75A8E2B, 0x5FA8C3423C052DD7,
+        0xCDB02555653131B6, 0x3792F412CB06794D,
+        0x808E17555F3EBF11, 0xE2BBD88BBEE40BD0,
+        0xA0B19D2AB70E6ED6, 0x5B6ACEAEAE9D0EC4,
+        0xC8DE047564D20A8B, 0xF245825A5A445275,
+        0xFB158592BE068D2E, 0xEED6E2F0F0D56712,
+        0x9CED737BB6C4183D, 0x55464DD69685606B,
+        0xC428D05AA4751E4C, 0xAA97E14C3C26B886,
+        0xF53304714D9265DF, 0xD53DD99F4B3066A8,
+        0x993FE2C6D07B7FAB, 0xE546A8038EFE4029,
+        0xBF8FDB78849A5F96, 0xDE98520472BDD033,
+        0xEF73D256A5C0F77C, 0x963E66858F6D4440,
+        0x95A8637627989AAD, 0xDDE7001379A44AA8,
+        0xBB127C53B17EC159, 0x5560C018580D5D52,
+        0xE9D71B689DDE71AF, 0xAAB8F01E6E10B4A6,
+        0x9226712162AB070D, 0xCAB3961304CA70E8,
+        0xB6B00D69BB55C8D1, 0x3D607B97C5FD0D22,
+        0xE45C10C42A2B3B05, 0x8CB89A7DB77C506A,
+        0x8EB98A7A9A5B04E3, 0x77F3608E92ADB242,
+        0xB267ED1940F1C61C, 0x55F038B237591ED3,
+        0xDF01E85F912E37A3, 0x6B6C46DEC52F6688,
+        0x8B61313BBABCE2C6, 0x2323AC4B3B3DA015,
+        0xAE397D8AA96C1B77, 0xABEC975E0A0D081A,
+        0xD9C7DCED53C72255, 0x96E7BD358C904A21,
+        0x881CEA14545C7575, 0x7E50D64177DA2E54,
+        0xAA242499697392D2, 0xDDE50BD1D5D0B9E9,
+        0xD4AD2DBFC3D07787, 0x955E4EC64B44E864,
+        0x84EC3C97DA624AB4, 0xBD5AF13BEF0B113E,
+        0xA6274BBDD0FADD61, 0xECB1AD8AEACDD58E,
+        0xCFB11EAD453994BA, 0x67DE18EDA5814AF2,
+        0x81CEB32C4B43FCF4, 0x80EACF948770CED7,
+        0xA2425FF75E14FC31, 0xA1258379A94D028D,
+        0xCAD2F7F5359A3B3E, 0x096EE45813A04330,
+        0xFD87B5F28300CA0D, 0x8BCA9D6E188853FC,
+        0x9E74D1B791E07E48, 0x775EA264CF55347E,
+        0xC612062576589DDA, 0x95364AFE032A819E,
+        0xF79687AED3EEC551, 0x3A83DDBD83F52205,
+        0x9ABE14CD44753B52, 0xC4926A9672793543,
+        0xC16D9A0095928A27, 0x75B7053C0F178294,
+        0xF1C90080BAF72CB1, 0x5324C68B12DD6339,
+        0x971DA05074DA7BEE, 0xD3F6FC16EBCA5E04,
+        0xBCE5086492111AEA, 0x88F4BB1CA6BCF585,
+        0xEC1E4A7DB69561A5, 0x2B31E9E3D06C32E6,
+        0x9392EE8E921D5D07, 0x3AFF322E62439FD0,
+        0xB877AA3236A4B449, 0x09BEFEB9FAD487C3,
+        0xE69594BEC44DE15B, 0x4C2EBE687989A9B4,
+        0x901D7CF73AB0ACD9, 0x0F9D37014BF60A11,
+        0xB424DC35095CD80F, 0x538484C19EF38C95,
+        0xE12E13424BB40E13, 0x2865A5F206B06FBA,
+        0x8CBCCC096F5088CB, 0xF93F87B7442E45D4,
+        0xAFEBFF0BCB24AAFE, 0xF78F69A51539D749,
+        0xDBE6FECEBDEDD5BE, 0xB573440E5A884D1C,
+        0x89705F4136B4A597, 0x31680A88F8953031,
+        0xABCC77118461CEFC, 0xFDC20D2B36BA7C3E,
+        0xD6BF94D5E57A42BC, 0x3D32907604691B4D,
+        0x8637BD05AF6C69B5, 0xA63F9A49C2C1B110,
+        0xA7C5AC471B478423, 0x0FCF80DC33721D54,
+        0xD1B71758E219652B, 0xD3C36113404EA4A9,
+        0x83126E978D4FDF3B, 0x645A1CAC083126EA,
+        0xA3D70A3D70A3D70A, 0x3D70A3D70A3D70A4,
+        0xCCCCCCCCCCCCCCCC, 0xCCCCCCCCCCCCCCCD,
+        0x8000000000000000, 0x0000000000000000,
+        0xA000000000000000, 0x0000000000000000,
+        0xC800000000000000, 0x0000000000000000,
+        0xFA00000000000000, 0x0000000000000000,
+        0x9C40000000000000, 0x0000000000000000,
+        0xC350000000000000, 0x0000000000000000,
+        0xF424000000000000, 0x0000000000000000,
+        0x9896800000000000, 0x0000000000000000,
+        0xBEBC200000000000, 0x0000000000000000,
+        0xEE6B280000000000, 0x0000000000000000,
+        0x9502F90000000000, 0x0000000000000000,
+        0xBA43B74000000000, 0x0000000000000000,
+        0xE8D4A51000000000, 0x0000000000000000,
+        0x9184E72A00000000, 0x0000000000000000,
+        0xB5E620F480000000, 0x0000000000000000,
+        0xE35FA931A0000000, 0x0000000000000000,
+        0x8E1BC9BF04000000, 0x0000000000000000,
+        0xB1A2BC2EC5000000, 0x0000000000000000,
+        0xDE0B6B3A76400000, 0x0000000000000000,
+        0x8AC7230489E80000, 0x0000000000000000,
+        0xAD78EBC5AC620000, 0x0000000000000000,
+        0xD8D726B7177A8000, 0x0000000000000000,
+        0x878678326EAC9000, 0x0000000000000000,
+        0xA968163F0A57B400, 0x0000000000000000,
+        0xD3C21BCECCEDA100, 0x0000000000000000,
+        0x84595161401484A0, 0x0000000000000000,
+        0xA56FA5B99019A5C8, 0x0000000000000000,
+        0xCECB8F27F4200F3A, 0x0000000000000000,
+        0x813F3978F8940984, 0x4000000000000000,
+        0xA18F07D736B90BE5, 0x5000000000000000,
+        0xC9F2C9CD04674EDE, 0xA400000000000000,
+        0xFC6F7C4045812296, 0x4D00000000000000,
+        0x9DC5ADA82B70B59D, 0xF020000000000000,
+        0xC5371912364CE305, 0x6C28000000000000,
+        0xF684DF56C3E01BC6, 0xC732000000000000,
+        0x9A130B963A6C115C, 0x3C7F400000000000,
+        0xC097CE7BC90715B3, 0x4B9F100000000000,
+        0xF0BDC21ABB48DB20, 0x1E86D40000000000,
+        0x96769950B50D88F4, 0x1314448000000000
+};
+
+static const float ExactPowersOfTen[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+// Decimal number split into a mantissa of at most 19 significant digits and a power of ten.
+// The digit runs are kept for the exact comparison needed when the mantissa had to be truncated.
+struct Decimal
+{
+        uint64 Mantissa;
+        int64 Exponent;
+        boolean Negative;
+        boolean Truncated;
+
+        const char* Integer;
+        uint64 IntegerLength;
+        const char* Fraction;
+        uint64 FractionLength;
+        int64 ExplicitExponent;
+};
+
+// Binary float as a mantissa without the implicit bit and a biased exponent.
+struct AdjustedMantissa
+{
+        uint64 Mantissa;
+        int32 Power2;
+};
+
+// Fixed size unsigned big integer, least significant limb first.
+struct BigInteger
+{
+        uint32 Limbs[BigIntegerLimbCount];
+        uint32 Count;
+};
+
+static boolean IsDigit(char Character)
+{
+        return (uint8)(Character - '0') < 10;
+}
+
+static boolean IsSpace(char Character)
+{
+        return Character == ' ' || (Character >= '\t' && Character <= '\r');
+}
+
+static uint64 ReadEightBytes(const char* Data)
+{
+        uint64 Value;
+        memcpy(&Value, Data, sizeof(Value));
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        Value = __builtin_bswap64(Value);
+#endif
+
+        return Value;
+}
+
+static boolean IsEightDigits(uint64 Value)
+{
+        return (((Value & 0xF0F0F0F0F0F0F0F0) | (((Value + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333);
+}
+
+static uint32 ParseEightDigits(uint64 Value)
+{
+        const uint64 Mask = 0x000000FF000000FF;
+        const uint64 FirstMultiplier = 100 + (1000000ULL << 32);
+        const uint64 SecondMultiplier = 1 + (10000ULL << 32);
+
+        // Pairs of digits are combined first, then pairs of pairs with a single multiplication each.
+        Value -= 0x3030303030303030;
+        Value = (Value * 10) + (Value >> 8);
+        Value = (((Value & Mask) * FirstMultiplier) + (((Value >> 16) & Mask) * SecondMultiplier)) >> 32;
+
+        return (uint32)Value;
+}
+
+static uint64 ParseDigits(const char* Data, uint64 Length, uint64* Value)
+{
+        uint64 Index = 0;
+        while (Index + 8 <= Length && IsEightDigits(ReadEightBytes(Data + Index)))
+        {
+                *Value = *Value * 100000000 + ParseEightDigits(ReadEightBytes(Data + Index));
+                Index += 8;
+        }
+
+        while (Index < Length && IsDigit(Data[Index]))
+        {
+                *Value = *Value * 10 + (uint64)(Data[Index] - '0');
+                ++Index;
+        }
+
+        return Index;
+}
+
+static void Multiply128(uint64 Left, uint64 Right, uint64* High, uint64* Low)
+{
+#if defined(__SIZEOF_INT128__)
+        unsigned __int128 Product = (unsigned __int128)Left * Right;
+        *High = (uint64)(Product >> 64);
+        *Low = (uint64)Product;
+#else
+        uint64 LowLow = (Left & 0xFFFFFFFF) * (Right & 0xFFFFFFFF);
+        uint64 LowHigh = (Left & 0xFFFFFFFF) * (Right >> 32);
+        uint64 HighLow = (Left >> 32) * (Right & 0xFFFFFFFF);
+        uint64 HighHigh = (Left >> 32) * (Right >> 32);
+        uint64 Cross = (LowLow >> 32) + (HighLow & 0xFFFFFFFF) + LowHigh;
+
+        *High = HighHigh + (HighLow >> 32) + (Cross >> 32);
+        *Low = (Cross << 32) | (LowLow & 0xFFFFFFFF);
+#endif
+}
+
+static int32 LeadingZeros(uint64 Value)
+{
+#if defined(__GNUC__)
+        return __builtin_clzll(Value);
+#else
+        int32 Count = 0;
+        while (!(Value & 0x8000000000000000))
+        {
+                Value <<= 1;
+                ++Count;
+        }
+
+        return Count;
+#endif
+}
+
+static uint64 ParseMagnitude(const char* Data, uint64 Length, uint64* Value)
+{
+        // Eight digit steps are only taken while they can't overflow.
+        uint64 Index = 0;
+        while (Index + 8 <= Length && *Value <= 184467440736ULL && IsEightDigits(ReadEightBytes(Data + Index)))
+        {
+                *Value = *Value * 100000000 + ParseEightDigits(ReadEightBytes(Data + Index));
+                Index += 8;
+        }
+
+        while (Index < Length && IsDigit(Data[Index]))
+        {
+                uint64 Digit = (uint64)(Data[Index] - '0');
+                if (*Value > (0xFFFFFFFFFFFFFFFFULL - Digit) / 10)
+                {
+                        return 0;
+                }
+
+                *Value = *Value * 10 + Digit;
+                ++Index;
+        }
+
+        return Index;
+}
+
+static uint64 ParseDecimal(const char* Data, uint64 Length, struct Decimal* Result)
+{
+        uint64 Index = 0;
+
+        Result->Negative = false;
+        if (Index < Length && (Data[Index] == '-' || Data[Index] == '+'))
+        {
+                Result->Negative = Data[Index] == '-';
+                ++Index;
+        }
+
+        Result->Mantissa = 0;
+        Result->Integer = Data + Index;
+        Result->IntegerLength = ParseDigits(Result->Integer, Length - Index, &Result->Mantissa);
+        Index += Result->IntegerLength;
+
+        Result->Fraction = Data + Index;
+        Result->FractionLength = 0;
+        if (Index < Length && Data[Index] == '.')
+        {
+                ++Index;
+                Result->Fraction = Data + Index;
+                Result->FractionLength = ParseDigits(Result->Fraction, Length - Index, &Result->Mantissa);
+                Index += Result->FractionLength;
+        }
+
+        uint64 DigitCount = Result->IntegerLength + Result->FractionLength;
+        if (DigitCount == 0)
+        {
+                return 0;
+        }
+
+        Result->ExplicitExponent = 0;
+        if (Index < Length && (Data[Index] == 'e' || Data[Index] == 'E'))
+        {
+                uint64 ExponentStart = Index;
+                boolean NegativeExponent = false;
+
+                ++Index;
+                if (Index < Length && (Data[Index] == '-' || Data[Index] == '+'))
+                {
+                        NegativeExponent = Data[Index] == '-';
+                        ++Index;
+                }
+
+                if (Index < Length && IsDigit(Data[Index]))
+                {
+                        while (Index < Length && IsDigit(Data[Index]))
+                        {
+                                // Anything this large is out of range already, so further digits are ignored instead of overflowing.
+                                if (Result->ExplicitExponent < 0x10000000)
+                                {
+                                        Result->ExplicitExponent = Result->ExplicitExponent * 10 + (Data[Index] - '0');
+                                }
+                                ++Index;
+                        }
+
+                        if (NegativeExponent)
+                        {
+                                Result->ExplicitExponent = -Result->ExplicitExponent;
+                        }
+                }
+                else
+                {
+                        // A lone 'e' is not part of the number.
+                        Index = ExponentStart;
+                }
+        }
+
+        Result->Exponent = Result->ExplicitExponent - (int64)Result->FractionLength;
+        Result->Truncated = false;
+
+        if (DigitCount > 19)
+        {
+                uint64 LeadingZeroCount = 0;
+                while (LeadingZeroCount < Result->IntegerLength && Result->Integer[LeadingZeroCount] == '0')
+                {
+                        ++LeadingZeroCount;
+                }
+                if (LeadingZeroCount == Result->IntegerLength)
+                {
+                        uint64 FractionZeroCount = 0;
+                        while (FractionZeroCount < Result->FractionLength && Result->Fraction[FractionZeroCount] == '0')
+                        {
+                                ++FractionZeroCount;
+                        }
+                        LeadingZeroCount += FractionZeroCount;
+                }
+
+                if (DigitCount - LeadingZeroCount > 19)
+                {
+                        // Keep the first 19 significant digits, leading zeros don't grow the mantissa so they are skipped naturally.
+                        Result->Truncated = true;
+                        Result->Mantissa = 0;
+
+                        uint64 Position = 0;
+                        while (Result->Mantissa < MinimumNineteenDigitInteger && Position < Result->IntegerLength)
+                        {
+                                Result->Mantissa = Result->Mantissa * 10 + (uint64)(Result->Integer[Position] - '0');
+                                ++Position;
+                        }
+
+                        if (Result->Mantissa >= MinimumNineteenDigitInteger)
+                        {
+                                Result->Exponent = (int64)(Result->IntegerLength - Position) + Result->ExplicitExponent;
+                        }
+                        else
+                        {
+                                Position = 0;
+                                while (Result->Mantissa < MinimumNineteenDigitInteger && Position < Result->FractionLength)
+                                {
+                                        Result->Mantissa = Result->Mantissa * 10 + (uint64)(Result->Fraction[Position] - '0');
+                                        ++Position;
+                                }
+
+                                Result->Exponent = -(int64)Position + Result->ExplicitExponent;
+                        }
+                }
+        }
+
+        return Index;
+}
+
+static struct AdjustedMantissa ComputeFloat(int64 Q, uint64 W)
+{
+        struct AdjustedMantissa Result;
+
+        if (W == 0 || Q < SmallestPowerOfTen)
+        {
+                Result.Mantissa = 0;
+                Result.Power2 = 0;
+                return Result;
+        }
+        if (Q > LargestPowerOfTen)
+        {
+                Result.Mantissa = 0;
+                Result.Power2 = InfinitePower;
+                return Result;
+        }
+
+        int32 LeadingZeroCount = LeadingZeros(W);
+        W <<= LeadingZeroCount;
+
+        // Only the high half of the product is needed, unless its low bits are all ones and a carry from the lower product could change the result.
+        uint32 Index = 2 * (uint32)(Q - SmallestPowerOfTen);
+        uint64 High;
+        uint64 Low;
+        Multiply128(W, PowersOfFive[Index], &High, &Low);
+
+        const uint64 PrecisionMask = 0xFFFFFFFFFFFFFFFFULL >> (MantissaBits + 3);
+        if ((High & PrecisionMask) == PrecisionMask)
+        {
+                uint64 SecondHigh;
+                uint64 SecondLow;
+                Multiply128(W, PowersOfFive[Index + 1], &SecondHigh, &SecondLow);
+
+                Low += SecondHigh;
+                if (SecondHigh > Low)
+                {
+                        ++High;
+                }
+        }
+
+        int32 UpperBit = (int32)(High >> 63);
+        int32 Shift = UpperBit + 64 - MantissaBits - 3;
+
+        // floor(log2(10^q)) + 63, computed with a fixed point approximation of log2(10).
+        int32 Power = (((152170 + 65536) * (int32)Q) >> 16) + 63;
+
+        Result.Mantissa = High >> Shift;
+        Result.Power2 = Power + UpperBit - LeadingZeroCount - MinimumExponent;
+
+        if (Result.Power2 <= 0)
+        {
+                // Subnormal.
+                if (-Result.Power2 + 1 >= 64)
+                {
+                        Result.Mantissa = 0;
+                        Result.Power2 = 0;
+                        return Result;
+                }
+
+                Result.Mantissa >>= -Result.Power2 + 1;
+                Result.Mantissa += Result.Mantissa & 1;
+                Result.Mantissa >>= 1;
+                Result.Power2 = Result.Mantissa < (1ULL << MantissaBits) ? 0 : 1;
+
+                return Result;
+        }
+
+        // Exactly halfway between two floats. Only possible for small powers of ten, where the product is exact.
+        if (Low <= 1 && Q >= MinimumExponentRoundToEven && Q <= MaximumExponentRoundToEven && (Result.Mantissa & 3) == 1)
+        {
+                if ((Result.Mantissa << Shift) == High)
+                {
+                        Result.Mantissa &= ~1ULL;
+                }
+        }
+
+        Result.Mantissa += Result.Mantissa & 1;
+        Result.Mantissa >>= 1;
+        if (Result.Mantissa >= (2ULL << MantissaBits))
+        {
+                Result.Mantissa = 1ULL << MantissaBits;
+                ++Result.Power2;
+        }
+
+        Result.Mantissa &= ~(1ULL << MantissaBits);
+        if (Result.Power2 >= InfinitePower)
+        {
+                Result.Mantissa = 0;
+                Result.Power2 = InfinitePower;
+        }
+
+        return Result;
+}
+
+static uint32 ToBits(struct AdjustedMantissa Value)
+{
+        return (uint32)Value.Mantissa | ((uint32)Value.Power2 << MantissaBits);
+}
+
+static void BigIntegerFromUint64(struct BigInteger* Handle, uint64 Value)
+{
+        Handle->Count = 0;
+        while (Value)
+        {
+                Handle->Limbs[Handle->Count++] = (uint32)Value;
+                Value >>= 32;
+        }
+}
+
+static void BigIntegerMultiplyAdd(struct BigInteger* Handle, uint32 Factor, uint32 Addend)
+{
+        uint64 Carry = Addend;
+        for (uint32 Index = 0; Index < Handle->Count; ++Index)
+        {
+                uint64 Product = (uint64)Handle->Limbs[Index] * Factor + Carry;
+                Handle->Limbs[Index] = (uint32)Product;
+                Carry = Product >> 32;
+        }
+
+        if (Carry)
+        {
+                Handle->Limbs[Handle->Count++] = (uint32)Carry;
+        }
+}
+
+static void BigIntegerMultiplyPowerOfFive(struct BigInteger* Handle, uint32 Exponent)
+{
+        static const uint32 SmallPowersOfFive[] = { 1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625, 48828125, 244140625, 1220703125 };
+
+        while (Exponent >= 13)
+        {
+                BigIntegerMultiplyAdd(Handle, SmallPowersOfFive[13], 0);
+                Exponent -= 13;
+        }
+
+        BigIntegerMultiplyAdd(Handle, SmallPowersOfFive[Exponent], 0);
+}
+
+static void BigIntegerShiftLeft(struct BigInteger* Handle, uint32 Shift)
+{
+        if (Handle->Count == 0)
+        {
+                return;
+        }
+
+        uint32 LimbShift = Shift / 32;
+        uint32 BitShift = Shift % 32;
+
+        if (BitShift)
+        {
+                uint32 Carry = 0;
+                for (uint32 Index = 0; Index < Handle->Count; ++Index)
+                {
+                        uint32 Limb = Handle->Limbs[Index];
+                        Handle->Limbs[Index] = (Limb << BitShift) | Carry;
+                        Carry = Limb >> (32 - BitShift);
+                }
+
+                if (Carry)
+                {
+                        Handle->Limbs[Handle->Count++] = Carry;
+                }
+        }
+
+        if (LimbShift)
+        {
+                memmove(Handle->Limbs + LimbShift, Handle->Limbs, Handle->Count * sizeof(uint32));
+                memset(Handle->Limbs, 0, LimbShift * sizeof(uint32));
+                Handle->Count += LimbShift;
+        }
+}
+
+static int32 BigIntegerCompare(const struct BigInteger* Left, const struct BigInteger* Right)
+{
+        if (Left->Count != Right->Count)
+        {
+                return Left->Count > Right->Count ? 1 : -1;
+        }
+
+        for (uint32 Index = Left->Count; Index > 0; --Index)
+        {
+                if (Left->Limbs[Index - 1] != Right->Limbs[Index - 1])
+                {
+                        return Left->Limbs[Index - 1] > Right->Limbs[Index - 1] ? 1 : -1;
+                }
+        }
+
+        return 0;
+}
+
+// Rounds a decimal with more than 19 significant digits exactly.
+// `Candidate` is the float right below the decimal, which is compared against the halfway point to the next float.
+static uint32 RoundExactly(const struct Decimal* Value, uint32 Candidate)
+{
+        struct BigInteger Digits;
+        BigIntegerFromUint64(&Digits, 0);
+
+        // Digits past MaxExactDigits can only break ties, which is all that's needed from them.
+        int64 Exponent = Value->ExplicitExponent - (int64)Value->FractionLength;
+        boolean NonZeroTail = false;
+        uint32 KeptDigits = 0;
+        for (uint64 Index = 0; Index < Value->IntegerLength + Value->FractionLength; ++Index)
+        {
+                char Character = Index < Value->IntegerLength ? Value->Integer[Index] : Value->Fraction[Index - Value->IntegerLength];
+                uint32 Digit = (uint32)(Character - '0');
+
+                if (KeptDigits == 0 && Digit == 0)
+                {
+                        continue;
+                }
+
+                if (KeptDigits < MaxExactDigits)
+                {
+                        BigIntegerMultiplyAdd(&Digits, 10, Digit);
+                        ++KeptDigits;
+                }
+                else
+                {
+                        NonZeroTail |= Digit != 0;
+                        ++Exponent;
+                }
+        }
+
+        uint64 Significand = Candidate & ((1U << MantissaBits) - 1);
+        int32 BinaryExponent = 1 + MinimumExponent - MantissaBits;
+        if (Candidate >> MantissaBits)
+        {
+                Significand |= 1U << MantissaBits;
+                BinaryExponent = (int32)(Candidate >> MantissaBits) + MinimumExponent - MantissaBits;
+        }
+
+        // Digits * 10^Exponent is compared against (2 * Significand + 1) * 2^(BinaryExponent - 1).
+        struct BigInteger Halfway;
+        BigIntegerFromUint64(&Halfway, 2 * Significand + 1);
+
+        if (Exponent >= 0)
+        {
+                BigIntegerMultiplyPowerOfFive(&Digits, (uint32)Exponent);
+        }
+        else
+        {
+                BigIntegerMultiplyPowerOfFive(&Halfway, (uint32)-Exponent);
+        }
+
+        int64 HalfwayExponent = BinaryExponent - 1;
+        if (Exponent > HalfwayExponent)
+        {
+                BigIntegerShiftLeft(&Digits, (uint32)(Exponent - HalfwayExponent));
+        }
+        else
+        {
+                BigIntegerShiftLeft(&Halfway, (uint32)(HalfwayExponent - Exponent));
+        }
+
+        int32 Order = BigIntegerCompare(&Digits, &Halfway);
+        if (Order > 0 || (Order == 0 && (NonZeroTail || (Significand & 1))))
+        {
+                return Candidate + 1;
+        }
+
+        return Candidate;
+}
+
+static float ToFloat(const struct Decimal* Value)
+{
+        uint32 Bits;
+
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+        // Both operands are exact floats, so a single correctly rounded operation gives the right answer.
+        if (!Value->Truncated && Value->Exponent >= -10 && Value->Exponent <= 10 && Value->Mantissa <= (1ULL << 24))
+        {
+                float Result = (float)Value->Mantissa;
+                if (Value->Exponent < 0)
+                {
+                        Result /= ExactPowersOfTen[-Value->Exponent];
+                }
+                else
+                {
+                        Result *= ExactPowersOfTen[Value->Exponent];
+                }
+
+                return Value->Negative ? -Result : Result;
+        }
+#endif
+
+        Bits = ToBits(ComputeFloat(Value->Exponent, Value->Mantissa));
+        if (Value->Truncated)
+        {
+                // The exact value lies between Mantissa and Mantissa + 1 scaled, if both round the same way there is nothing left to decide.
+                uint32 UpperBits = ToBits(ComputeFloat(Value->Exponent, Value->Mantissa + 1));
+                if (UpperBits != Bits)
+                {
+                        Bits = RoundExactly(Value, Bits);
+                }
+        }
+
+        Bits |= (uint32)Value->Negative << 31;
+
+        float Result;
+        memcpy(&Result, &Bits, sizeof(Result));
+
+        return Result;
+}
+
+static boolean MatchesIgnoreCase(const char* Data, uint64 Length, const char* Word)
+{
+        uint64 Index = 0;
+        for (; Word[Index]; ++Index)
+        {
+                if (Index >= Length || (Data[Index] | 0x20) != Word[Index])
+                {
+                        return false;
+                }
+        }
+
+        return true;
+}
+
+static uint64 ParseSpecial(const char* Data, uint64 Length, float* Value)
+{
+        uint64 Index = 0;
+        uint32 Bits;
+
+        boolean Negative = false;
+        if (Index < Length && (Data[Index] == '-' || Data[Index] == '+'))
+        {
+                Negative = Data[Index] == '-';
+                ++Index;
+        }
+
+        if (MatchesIgnoreCase(Data + Index, Length - Index, "infinity"))
+        {
+                Bits = 0x7F800000;
+                Index += 8;
+        }
+        else if (MatchesIgnoreCase(Data + Index, Length - Index, "inf"))
+        {
+                Bits = 0x7F800000;
+                Index += 3;
+        }
+        else if (MatchesIgnoreCase(Data + Index, Length - Index, "nan"))
+        {
+                Bits = 0x7FC00000;
+                Index += 3;
+        }
+        else
+        {
+                return 0;
+        }
+
+        Bits |= (uint32)Negative << 31;
+        memcpy(Value, &Bits, sizeof(*Value));
+
+        return Index;
+}
+
+static uint64 ParseFloat(const char* Data, uint64 Length, float* Value)
+{
+        struct Decimal Decimal;
+
+        uint64 Consumed = ParseDecimal(Data, Length, &Decimal);
+        if (!Consumed)
+        {
+                return ParseSpecial(Data, Length, Value);
+        }
+
+        *Value = ToFloat(&Decimal);
+
+        return Consumed;
+}
+
+uint64 lluna_Core_Parse_Int64(struct lluna_Core_Types_Text Text, int64* Value)
+{
+        uint64 Length = lluna_Macros_TextLength(Text);
+        uint64 Index = 0;
+
+        boolean Negative = false;
+        if (Index < Length && (Text.Data[Index] == '-' || Text.Data[Index] == '+'))
+        {
+                Negative = Text.Data[Index] == '-';
+                ++Index;
+        }
+
+        uint64 Magnitude = 0;
+        uint64 DigitCount = ParseMagnitude(Text.Data + Index, Length - Index, &Magnitude);
+        if (DigitCount == 0 || Magnitude > (uint64)0x7FFFFFFFFFFFFFFFULL + Negative)
+        {
+                return 0;
+        }
+
+        *Value = Negative ? (int64)(0 - Magnitude) : (int64)Magnitude;
+
+        return Index + DigitCount;
+}
+
+uint64 lluna_Core_Parse_Uint64(struct lluna_Core_Types_Text Text, uint64* Value)
+{
+        uint64 Length = lluna_Macros_TextLength(Text);
+        uint64 Index = 0;
+
+        if (Index < Length && Text.Data[Index] == '+')
+        {
+                ++Index;
+        }
+
+        uint64 Magnitude = 0;
+        uint64 DigitCount = ParseMagnitude(Text.Data + Index, Length - Index, &Magnitude);
+        if (DigitCount == 0)
+        {
+                return 0;
+        }
+
+        *Value = Magnitude;
+
+        return Index + DigitCount;
+}
+
+uint64 lluna_Core_Parse_Float(struct lluna_Core_Types_Text Text, float* Value)
+{
+        return ParseFloat(Text.Data, lluna_Macros_TextLength(Text), Value);
+}
+
+uint64 lluna_Core_Parse_FloatArray(struct lluna_Core_Types_Text Text, struct lluna_Container_DynamicArray* Output)
+{
+        uint64 Length = lluna_Macros_TextLength(Text);
+        uint64 Offset = 0;
+        uint64 Consumed = 0;
+
+        while (true)
+        {
+                while (Offset < Length && IsSpace(Text.Data[Offset]))
+                {
+                        ++Offset;
+                }
+                Consumed = Offset;
+
+                float Value;
+                uint64 TokenLength = Offset < Length ? ParseFloat(Text.Data + Offset, Length - Offset, &Value) : 0;
+                if (TokenLength == 0 || (Offset + TokenLength < Length && !IsSpace(Text.Data[Offset + TokenLength])))
+                {
+                        break;
+                }
+
+                lluna_Container_DynamicArray_Append(Output, (byte*)&Value);
+                Offset += TokenLength;
+        }
+
+        return Consumed;
+}
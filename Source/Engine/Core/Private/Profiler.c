@@ -0,0 +1,610 @@
+#include <Engine/Core/Public/Profiler.h>
+
+#include <Engine/Core/Public/Atomics.h>
+#include <Engine/Core/Public/Macros.h>
+#include <Engine/Core/Public/Sync.h>
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HAS_X86_INTRINSICS
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+#define CacheLineSize 64
+#define RingMask (lluna_Core_Profiler_RingCapacity - 1)
+
+// The rate of the time stamp counter is measured over at least this many nanoseconds.
+#define CalibrationTime 10000000ULL
+
+#define BinaryMagic "LLPF"
+#define BinaryVersion 1
+
+#define Uninitialized 0
+#define Initializing 1
+#define Initialized 2
+
+// Rings are only written by their thread and only drained by collectors, so the head and tail each live on their
+// own cache line. Dropped only grows and is only written by the owning thread, collectors remember how much of it they
+// already counted in Collected.
+struct Ring
+{
+        struct lluna_Core_Profiler_Event Events[lluna_Core_Profiler_RingCapacity];
+
+        uint64 Head __attribute__((aligned(CacheLineSize)));
+        uint64 Tail __attribute__((aligned(CacheLineSize)));
+        uint64 Dropped;
+        uint64 Collected;
+
+        uint32 Thread;
+        uint32 Owned;
+        struct Ring* Next;
+};
+
+// Rings of exited threads are kept in the list and claimed again by new threads.
+static struct Ring* Rings = NULL;
+static uint32 ThreadCount = 0;
+static struct lluna_Core_Sync_Mutex CollectLock;
+static __thread struct Ring* CurrentRing = NULL;
+static pthread_key_t RingKey;
+
+static uint32 State = Uninitialized;
+static boolean UseTsc = false;
+static uint64 StartTicks = 0;
+static uint64 StartTime = 0;
+
+static struct lluna_Core_Sync_Mutex CalibrationLock;
+static uint32 Calibrated = false;
+static double Rate = 1e9;
+
+static uint64 ReadMonotonicClock()
+{
+        struct timespec Time;
+        clock_gettime(CLOCK_MONOTONIC, &Time);
+
+        return (uint64)Time.tv_sec * 1000000000ULL + (uint64)Time.tv_nsec;
+}
+
+static uint64 ReadClock()
+{
+#if defined(HAS_X86_INTRINSICS)
+        if (UseTsc)
+        {
+                return __rdtsc();
+        }
+#endif
+
+        return ReadMonotonicClock();
+}
+
+// Time stamp counters that change rate with the core frequency can't be turned into time.
+static boolean HasInvariantTsc()
+{
+#if defined(HAS_X86_INTRINSICS)
+        uint32 Eax, Ebx, Ecx, Edx;
+        if (__get_cpuid(0x80000000, &Eax, &Ebx, &Ecx, &Edx) && Eax >= 0x80000007 && __get_cpuid(0x80000007, &Eax, &Ebx, &Ecx, &Edx))
+        {
+                return (Edx >> 8) & 1;
+        }
+#endif
+
+        return false;
+}
+
+static void ReleaseRing(void* Data)
+{
+        struct Ring* Ring = Data;
+        lluna_Core_Atomics_StoreUint32(&Ring->Owned, false, lluna_Core_Atomics_Release);
+}
+
+static void Initialize()
+{
+        pthread_key_create(&RingKey, ReleaseRing);
+
+        UseTsc = HasInvariantTsc();
+        StartTime = ReadMonotonicClock();
+        StartTicks = ReadClock();
+}
+
+static void EnsureInitialized()
+{
+        if (lluna_Core_Atomics_LoadUint32(&State, lluna_Core_Atomics_Acquire) == Initialized)
+        {
+                return;
+        }
+
+        uint32 Expected = Uninitialized;
+        if (lluna_Core_Atomics_CompareExchangeUint32(&State, &Expected, Initializing, false, lluna_Core_Atomics_Acquire,
+                                                     lluna_Core_Atomics_Acquire))
+        {
+                Initialize();
+                lluna_Core_Atomics_StoreUint32(&State, Initialized, lluna_Core_Atomics_Release);
+        }
+        while (lluna_Core_Atomics_LoadUint32(&State, lluna_Core_Atomics_Acquire) != Initialized)
+        {
+                lluna_Core_Atomics_Yield();
+        }
+}
+
+// Gives the calling thread a ring, preferring one released by an exited thread. Returns NULL if no ring could be
+// allocated, dropping the event.
+static struct Ring* ClaimRing()
+{
+        EnsureInitialized();
+
+        struct Ring* Ring = lluna_Core_Atomics_LoadPointer(&Rings, lluna_Core_Atomics_Acquire);
+        for (; Ring; Ring = Ring->Next)
+        {
+                uint32 Expected = false;
+                if (lluna_Core_Atomics_CompareExchangeUint32(&Ring->Owned, &Expected, true, false, lluna_Core_Atomics_Acquire,
+                                                             lluna_Core_Atomics_Relaxed))
+                {
+                        break;
+                }
+        }
+
+        if (!Ring)
+        {
+                if (posix_memalign((void**)&Ring, CacheLineSize, sizeof(struct Ring)) != 0)
+                {
+                        return NULL;
+                }
+                memset(Ring, 0, sizeof(struct Ring));
+                Ring->Owned = true;
+
+                struct Ring* Head = lluna_Core_Atomics_LoadPointer(&Rings, lluna_Core_Atomics_Relaxed);
+                do
+                {
+                        Ring->Next = Head;
+                } while (!lluna_Core_Atomics_CompareExchangePointer(&Rings, &Head, Ring, true, lluna_Core_Atomics_Release,
+                                                                    lluna_Core_Atomics_Relaxed));
+        }
+
+        Ring->Thread = lluna_Core_Atomics_FetchAddUint32(&ThreadCount, 1, lluna_Core_Atomics_Relaxed);
+        pthread_setspecific(RingKey, Ring);
+        CurrentRing = Ring;
+
+        return Ring;
+}
+
+static void Reserve(struct lluna_Core_Profiler_Capture* Capture, uint64 Count)
+{
+        if (Capture->Count + Count <= Capture->Capacity)
+        {
+                return;
+        }
+
+        uint64 Capacity = Capture->Capacity > 0 ? Capture->Capacity * 2 : 1024;
+        while (Capacity < Capture->Count + Count)
+        {
+                Capacity *= 2;
+        }
+        Capture->Events = realloc(Capture->Events, Capacity * sizeof(struct lluna_Core_Profiler_Event));
+        Capture->Capacity = Capacity;
+}
+
+static void WriteJsonString(struct lluna_Core_Writer* Output, const char* Text)
+{
+        static const char Digits[] = "0123456789abcdef";
+
+        lluna_Core_Writer_WriteCharacter(Output, '"');
+        for (const char* Character = Text ? Text : ""; *Character; ++Character)
+        {
+                byte Value = (byte)*Character;
+                if (Value == '"' || Value == '\\')
+                {
+                        lluna_Core_Writer_WriteCharacter(Output, '\\');
+                        lluna_Core_Writer_WriteCharacter(Output, (char)Value);
+                }
+                else if (Value < 0x20)
+                {
+                        char Escape[6] = { '\\', 'u', '0', '0', Digits[Value >> 4], Digits[Value & 15] };
+                        lluna_Core_Writer_WriteBytes(Output, Escape, sizeof(Escape));
+                }
+                else
+                {
+                        lluna_Core_Writer_WriteCharacter(Output, (char)Value);
+                }
+        }
+        lluna_Core_Writer_WriteCharacter(Output, '"');
+}
+
+static void WriteVarint(struct lluna_Core_Writer* Output, uint64 Value)
+{
+        byte Bytes[10];
+        uint32 Size = 0;
+        while (Value >= 0x80)
+        {
+                Bytes[Size++] = (byte)(Value | 0x80);
+                Value >>= 7;
+        }
+        Bytes[Size++] = (byte)Value;
+
+        lluna_Core_Writer_WriteBytes(Output, Bytes, Size);
+}
+
+static uint64 ZigZag(int64 Value)
+{
+        return ((uint64)Value << 1) ^ (uint64)(Value >> 63);
+}
+
+static int64 UnZigZag(uint64 Value)
+{
+        return (int64)(Value >> 1) ^ -(int64)(Value & 1);
+}
+
+static int ComparePointers(const void* Left, const void* Right)
+{
+        uint64 LeftValue = (uint64)(size_t)*(const char* const*)Left;
+        uint64 RightValue = (uint64)(size_t)*(const char* const*)Right;
+
+        return (LeftValue > RightValue) - (LeftValue < RightValue);
+}
+
+static boolean HasName(uint32 Type)
+{
+        return Type == lluna_Core_Profiler_EventBegin || Type == lluna_Core_Profiler_EventCounter || Type == lluna_Core_Profiler_EventThreadName;
+}
+
+struct Input
+{
+        const byte* Data;
+        uint64 Size;
+        uint64 Offset;
+        boolean Failed;
+};
+
+static uint64 ReadVarint(struct Input* Input)
+{
+        uint64 Value = 0;
+        for (uint32 Shift = 0; Shift < 64; Shift += 7)
+        {
+                if (Input->Offset >= Input->Size)
+                {
+                        break;
+                }
+
+                byte Byte = Input->Data[Input->Offset++];
+                Value |= (uint64)(Byte & 0x7F) << Shift;
+                if (!(Byte & 0x80))
+                {
+                        return Value;
+                }
+        }
+
+        Input->Failed = true;
+        return 0;
+}
+
+void lluna_Core_Profiler_Record(uint32 Type, const char* Name, int64 Value)
+{
+        struct Ring* Ring = CurrentRing;
+        if (!Ring && !(Ring = ClaimRing()))
+        {
+                return;
+        }
+
+        uint64 Head = lluna_Core_Atomics_LoadUint64(&Ring->Head, lluna_Core_Atomics_Relaxed);
+        if (Head - lluna_Core_Atomics_LoadUint64(&Ring->Tail, lluna_Core_Atomics_Acquire) >= lluna_Core_Profiler_RingCapacity)
+        {
+                uint64 Dropped = lluna_Core_Atomics_LoadUint64(&Ring->Dropped, lluna_Core_Atomics_Relaxed);
+                lluna_Core_Atomics_StoreUint64(&Ring->Dropped, Dropped + 1, lluna_Core_Atomics_Relaxed);
+                return;
+        }
+
+        struct lluna_Core_Profiler_Event* Event = &Ring->Events[Head & RingMask];
+        Event->Timestamp = ReadClock();
+        Event->Name = Name;
+        Event->Value = Value;
+        Event->Type = Type;
+        Event->Thread = Ring->Thread;
+
+        lluna_Core_Atomics_StoreUint64(&Ring->Head, Head + 1, lluna_Core_Atomics_Release);
+}
+
+void lluna_Core_Profiler_EndScope(const char** Name)
+{
+        (void)Name;
+        lluna_Core_Profiler_Record(lluna_Core_Profiler_EventEnd, NULL, 0);
+}
+
+uint64 lluna_Core_Profiler_Now()
+{
+        EnsureInitialized();
+
+        return ReadClock();
+}
+
+double lluna_Core_Profiler_TicksPerSecond()
+{
+        EnsureInitialized();
+        if (!UseTsc || lluna_Core_Atomics_LoadUint32(&Calibrated, lluna_Core_Atomics_Acquire))
+        {
+                return Rate;
+        }
+
+        lluna_Core_Sync_LockMutex(&CalibrationLock);
+        if (!Calibrated)
+        {
+                uint64 Elapsed = ReadMonotonicClock() - StartTime;
+                if (Elapsed < CalibrationTime)
+                {
+                        struct timespec Remaining = { 0, (long)(CalibrationTime - Elapsed) };
+                        nanosleep(&Remaining, NULL);
+                }
+
+                uint64 Ticks = ReadClock() - StartTicks;
+                uint64 Time = ReadMonotonicClock() - StartTime;
+                Rate = (double)Ticks * 1e9 / (double)Time;
+                lluna_Core_Atomics_StoreUint32(&Calibrated, true, lluna_Core_Atomics_Release);
+        }
+        lluna_Core_Sync_UnlockMutex(&CalibrationLock);
+
+        return Rate;
+}
+
+struct lluna_Core_Profiler_Capture* lluna_Core_Profiler_CreateCapture()
+{
+        struct lluna_Core_Profiler_Capture* Capture = calloc(1, sizeof(struct lluna_Core_Profiler_Capture));
+        Capture->TicksPerSecond = lluna_Core_Profiler_TicksPerSecond();
+
+        return Capture;
+}
+
+void lluna_Core_Profiler_DestroyCapture(struct lluna_Core_Profiler_Capture* Capture)
+{
+        free(Capture->Events);
+        free(Capture->Names);
+        free(Capture);
+}
+
+void lluna_Core_Profiler_ClearCapture(struct lluna_Core_Profiler_Capture* Capture)
+{
+        free(Capture->Names);
+        Capture->Names = NULL;
+        Capture->Count = 0;
+        Capture->Dropped = 0;
+}
+
+void lluna_Core_Profiler_Collect(struct lluna_Core_Profiler_Capture* Capture)
+{
+        lluna_Core_Sync_LockMutex(&CollectLock);
+
+        struct Ring* Ring = lluna_Core_Atomics_LoadPointer(&Rings, lluna_Core_Atomics_Acquire);
+        for (; Ring; Ring = Ring->Next)
+        {
+                uint64 Tail = lluna_Core_Atomics_LoadUint64(&Ring->Tail, lluna_Core_Atomics_Relaxed);
+                uint64 Head = lluna_Core_Atomics_LoadUint64(&Ring->Head, lluna_Core_Atomics_Acquire);
+                uint64 Count = Head - Tail;
+                Reserve(Capture, Count);
+
+                // Copies up to the end of the ring, then whatever wrapped around to its start.
+                uint64 Start = Tail & RingMask;
+                uint64 First = Count < lluna_Core_Profiler_RingCapacity - Start ? Count : lluna_Core_Profiler_RingCapacity - Start;
+                memcpy(Capture->Events + Capture->Count, Ring->Events + Start, First * sizeof(struct lluna_Core_Profiler_Event));
+                memcpy(Capture->Events + Capture->Count + First, Ring->Events, (Count - First) * sizeof(struct lluna_Core_Profiler_Event));
+                Capture->Count += Count;
+
+                lluna_Core_Atomics_StoreUint64(&Ring->Tail, Head, lluna_Core_Atomics_Release);
+                uint64 Dropped = lluna_Core_Atomics_LoadUint64(&Ring->Dropped, lluna_Core_Atomics_Relaxed);
+                Capture->Dropped += Dropped - Ring->Collected;
+                Ring->Collected = Dropped;
+        }
+
+        lluna_Core_Sync_UnlockMutex(&CollectLock);
+}
+
+void lluna_Core_Profiler_WriteChromeTrace(struct lluna_Core_Profiler_Capture* Capture, struct lluna_Core_Writer* Output)
+{
+        uint64 Start = Capture->Count > 0 ? Capture->Events[0].Timestamp : 0;
+        for (uint64 Index = 1; Index < Capture->Count; ++Index)
+        {
+                Start = Capture->Events[Index].Timestamp < Start ? Capture->Events[Index].Timestamp : Start;
+        }
+        double Microseconds = 1e6 / Capture->TicksPerSecond;
+
+        lluna_Core_Writer_WriteText(Output, lluna_Macros_Text("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+        for (uint64 Index = 0; Index < Capture->Count; ++Index)
+        {
+                struct lluna_Core_Profiler_Event* Event = &Capture->Events[Index];
+                double Time = (double)(Event->Timestamp - Start) * Microseconds;
+
+                lluna_Core_Writer_WriteText(Output, Index > 0 ? lluna_Macros_Text(",\n{") : lluna_Macros_Text("\n{"));
+                switch (Event->Type)
+                {
+                case lluna_Core_Profiler_EventBegin:
+                        lluna_Core_Writer_WriteText(Output, lluna_Macros_Text("\"ph\":\"B\",\"name\":"));
+                        WriteJsonString(Output, Event->Name);
+                        break;
+                case lluna_Core_Profiler_EventEnd:
+                        lluna_Core_Writer_WriteText(Output, lluna_Macros_Text("\"ph\":\"E\""));
+                        break;
+                case lluna_Core_Profiler_EventCounter:
+                        lluna_Core_Writer_WriteText(Output, lluna_Macros_Text("\"ph\":\"C\",\"name\":"));
+                        WriteJsonString(Output, Event->Name);
+                        lluna_Core_Writer_Format(Output, lluna_Macros_Text(",\"args\":{\"value\":%lld}"), (long long)Event->Value);
+                        break;
+                case lluna_Core_Profiler_EventFrame:
+                        lluna_Core_Writer_WriteText(Output, lluna_Macros_Text("\"ph\":\"i\",\"s\":\"g\",\"name\":\"Frame\""));
+                        break;
+                default:
+                        lluna_Core_Writer_WriteText(Output, lluna_Macros_Text("\"ph\":\"M\",\"name\":\"thread_name\",\"args\":{\"name\":"));
+                        WriteJsonString(Output, Event->Name);
+                        lluna_Core_Writer_WriteCharacter(Output, '}');
+                        break;
+                }
+                lluna_Core_Writer_Format(Output, lluna_Macros_Text(",\"pid\":1,\"tid\":%u,\"ts\":%.3f}"), Event->Thread, Time);
+        }
+        lluna_Core_Writer_WriteText(Output, lluna_Macros_Text("\n]}\n"));
+}
+
+void lluna_Core_Profiler_WriteBinary(struct lluna_Core_Profiler_Capture* Capture, struct lluna_Core_Writer* Output)
+{
+        // Names are numbered in address order, 0 standing for no name.
+        const char** Names = malloc((Capture->Count > 0 ? Capture->Count : 1) * sizeof(const char*));
+        uint64 NameCount = 0;
+        for (uint64 Index = 0; Index < Capture->Count; ++Index)
+        {
+                if (HasName(Capture->Events[Index].Type) && Capture->Events[Index].Name)
+                {
+                        Names[NameCount++] = Capture->Events[Index].Name;
+                }
+        }
+        qsort(Names, NameCount, sizeof(const char*), ComparePointers);
+
+        uint64 UniqueCount = 0;
+        for (uint64 Index = 0; Index < NameCount; ++Index)
+        {
+                if (UniqueCount == 0 || Names[UniqueCount - 1] != Names[Index])
+                {
+                        Names[UniqueCount++] = Names[Index];
+                }
+        }
+
+        uint64 RateBits;
+        memcpy(&RateBits, &Capture->TicksPerSecond, sizeof(RateBits));
+
+        lluna_Core_Writer_WriteBytes(Output, BinaryMagic, 4);
+        WriteVarint(Output, BinaryVersion);
+        WriteVarint(Output, RateBits);
+        WriteVarint(Output, Capture->Dropped);
+        WriteVarint(Output, UniqueCount);
+        for (uint64 Index = 0; Index < UniqueCount; ++Index)
+        {
+                uint64 Length = strlen(Names[Index]);
+                WriteVarint(Output, Length);
+                lluna_Core_Writer_WriteBytes(Output, Names[Index], Length);
+        }
+
+        WriteVarint(Output, Capture->Count);
+        uint64 Previous = 0;
+        for (uint64 Index = 0; Index < Capture->Count; ++Index)
+        {
+                struct lluna_Core_Profiler_Event* Event = &Capture->Events[Index];
+                lluna_Core_Writer_WriteCharacter(Output, (char)Event->Type);
+                WriteVarint(Output, Event->Thread);
+                WriteVarint(Output, ZigZag((int64)(Event->Timestamp - Previous)));
+                Previous = Event->Timestamp;
+
+                if (HasName(Event->Type))
+                {
+                        const char** Found = Event->Name ? bsearch(&Event->Name, Names, UniqueCount, sizeof(const char*), ComparePointers) : NULL;
+                        WriteVarint(Output, Found ? (uint64)(Found - Names) + 1 : 0);
+                }
+                if (Event->Type == lluna_Core_Profiler_EventCounter)
+                {
+                        WriteVarint(Output, ZigZag(Event->Value));
+                }
+        }
+
+        free(Names);
+}
+
+boolean lluna_Core_Profiler_ReadBinary(struct lluna_Core_Profiler_Capture* Capture, const byte* Data, uint64 Size)
+{
+        struct Input Input = { Data, Size, 4, false };
+        if (Size < 4 || memcmp(Data, BinaryMagic, 4) != 0 || ReadVarint(&Input) != BinaryVersion)
+        {
+                return false;
+        }
+
+        uint64 RateBits = ReadVarint(&Input);
+        uint64 Dropped = ReadVarint(&Input);
+        uint64 NameCount = ReadVarint(&Input);
+
+        // Every name and event takes at least a byte, which bounds the counts before anything is allocated.
+        if (Input.Failed || NameCount > Size - Input.Offset)
+        {
+                return false;
+        }
+
+        uint64 NamesStart = Input.Offset;
+        uint64 NamesSize = 0;
+        for (uint64 Index = 0; Index < NameCount && !Input.Failed; ++Index)
+        {
+                uint64 Length = ReadVarint(&Input);
+                if (Length > Size - Input.Offset)
+                {
+                        return false;
+                }
+                Input.Offset += Length;
+                NamesSize += Length + 1;
+        }
+
+        uint64 EventCount = ReadVarint(&Input);
+        if (Input.Failed || EventCount > (Size - Input.Offset) / 3)
+        {
+                return false;
+        }
+
+        char* Storage = malloc(NamesSize > 0 ? NamesSize : 1);
+        const char** Names = malloc((NameCount > 0 ? NameCount : 1) * sizeof(const char*));
+        struct Input NameInput = { Data, Size, NamesStart, false };
+        char* Next = Storage;
+        for (uint64 Index = 0; Index < NameCount; ++Index)
+        {
+                uint64 Length = ReadVarint(&NameInput);
+                memcpy(Next, Data + NameInput.Offset, Length);
+                Next[Length] = '\0';
+                NameInput.Offset += Length;
+                Names[Index] = Next;
+                Next += Length + 1;
+        }
+
+        struct lluna_Core_Profiler_Event* Events = malloc((EventCount > 0 ? EventCount : 1) * sizeof(struct lluna_Core_Profiler_Event));
+        uint64 Previous = 0;
+        for (uint64 Index = 0; Index < EventCount && !Input.Failed; ++Index)
+        {
+                struct lluna_Core_Profiler_Event* Event = &Events[Index];
+                if (Input.Offset >= Size)
+                {
+                        Input.Failed = true;
+                        break;
+                }
+
+                Event->Type = Data[Input.Offset++];
+                Event->Thread = (uint32)ReadVarint(&Input);
+                Previous += (uint64)UnZigZag(ReadVarint(&Input));
+                Event->Timestamp = Previous;
+                Event->Name = NULL;
+                Event->Value = 0;
+
+                if (Event->Type > lluna_Core_Profiler_EventThreadName)
+                {
+                        Input.Failed = true;
+                }
+                if (HasName(Event->Type))
+                {
+                        uint64 Name = ReadVarint(&Input);
+                        Input.Failed |= Name > NameCount;
+                        Event->Name = Name > 0 && Name <= NameCount ? Names[Name - 1] : NULL;
+                }
+                if (Event->Type == lluna_Core_Profiler_EventCounter)
+                {
+                        Event->Value = UnZigZag(ReadVarint(&Input));
+                }
+        }
+        free(Names);
+
+        if (Input.Failed)
+        {
+                free(Storage);
+                free(Events);
+                return false;
+        }
+
+        free(Capture->Events);
+        free(Capture->Names);
+        Capture->Events = Events;
+        Capture->Count = EventCount;
+        Capture->Capacity = EventCount > 0 ? EventCount : 1;
+        Capture->Dropped = Dropped;
+        memcpy(&Capture->TicksPerSecond, &RateBits, sizeof(RateBits));
+        Capture->Names = Storage;
+
+        return true;
+}
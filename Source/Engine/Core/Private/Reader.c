@@ -0,0 +1,301 @@
+#include <Engine/Core/Public/Reader.h>
+
+#include <Engine/Core/Public/Cpu.h>
+#include <Engine/Core/Public/Macros.h>
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HAS_X86_INTRINSICS
+#include <immintrin.h>
+#endif
+
+typedef uint64 (*FindFunction)(const byte*, uint64, byte);
+
+static uint64 FindScalar(const byte* Data, uint64 Length, byte Delimiter)
+{
+        for (uint64 Offset = 0; Offset < Length; ++Offset)
+        {
+                if (Data[Offset] == Delimiter)
+                {
+                        return Offset;
+                }
+        }
+
+        return Length;
+}
+
+#ifdef HAS_X86_INTRINSICS
+
+__attribute__((target("sse2")))
+static uint64 FindSse2(const byte* Data, uint64 Length, byte Delimiter)
+{
+        const __m128i Pattern = _mm_set1_epi8((char)Delimiter);
+
+        uint64 Offset = 0;
+        for (; Offset + 16 <= Length; Offset += 16)
+        {
+                int32 Mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(Data + Offset)), Pattern));
+                if (Mask != 0)
+                {
+                        return Offset + __builtin_ctz(Mask);
+                }
+        }
+
+        return Offset + FindScalar(Data + Offset, Length - Offset, Delimiter);
+}
+
+__attribute__((target("avx2")))
+static uint64 FindAvx2(const byte* Data, uint64 Length, byte Delimiter)
+{
+        const __m256i Pattern = _mm256_set1_epi8((char)Delimiter);
+
+        // Two vectors per step keep the loop bound by loads rather than branches on long records.
+        uint64 Offset = 0;
+        for (; Offset + 64 <= Length; Offset += 64)
+        {
+                __m256i Low = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(Data + Offset)), Pattern);
+                __m256i High = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(Data + Offset + 32)), Pattern);
+                uint32 LowMask = (uint32)_mm256_movemask_epi8(Low);
+                uint32 HighMask = (uint32)_mm256_movemask_epi8(High);
+                if ((LowMask | HighMask) != 0)
+                {
+                        uint64 Mask = ((uint64)HighMask << 32) | LowMask;
+                        return Offset + __builtin_ctzll(Mask);
+                }
+        }
+        for (; Offset + 32 <= Length; Offset += 32)
+        {
+                uint32 Mask = (uint32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(Data + Offset)), Pattern));
+                if (Mask != 0)
+                {
+                        return Offset + __builtin_ctz(Mask);
+                }
+        }
+
+        return Offset + FindScalar(Data + Offset, Length - Offset, Delimiter);
+}
+
+#endif
+
+static FindFunction ResolveFind()
+{
+        static const struct lluna_Core_Cpu_Kernel Kernels[] = {
+#ifdef HAS_X86_INTRINSICS
+                { lluna_Core_Cpu_Avx2, (lluna_Core_Cpu_Function)FindAvx2 },
+                { lluna_Core_Cpu_Sse2, (lluna_Core_Cpu_Function)FindSse2 },
+#endif
+                { 0, (lluna_Core_Cpu_Function)FindScalar },
+        };
+
+        return (FindFunction)lluna_Core_Cpu_Dispatch(Kernels, sizeof(Kernels) / sizeof(Kernels[0]));
+}
+
+static uint64 Find(const byte* Data, uint64 Length, byte Delimiter)
+{
+        static FindFunction Function = NULL;
+        if (!Function)
+        {
+                Function = ResolveFind();
+        }
+
+        return Function(Data, Length, Delimiter);
+}
+
+static int64 ReadBlock(int32 FileDescriptor, byte* Data, uint64 Size)
+{
+#ifdef _WIN32
+        return _read(FileDescriptor, Data, (uint32)(Size > 0x40000000 ? 0x40000000 : Size));
+#else
+        ssize_t Read;
+        do
+        {
+                Read = read(FileDescriptor, Data, Size);
+        } while (Read < 0 && errno == EINTR);
+
+        return Read;
+#endif
+}
+
+// Moves unread bytes to the start of the buffer and reads another block after them. Returns false if nothing was added.
+static boolean Fill(struct lluna_Core_Reader* Handle)
+{
+        if (Handle->EndOfFile || !Handle->Buffer)
+        {
+                return false;
+        }
+
+        if (Handle->Offset > 0)
+        {
+                memmove(Handle->Buffer, Handle->Buffer + Handle->Offset, Handle->Size - Handle->Offset);
+                Handle->Size -= Handle->Offset;
+                Handle->Offset = 0;
+        }
+
+        if (Handle->Size == Handle->Capacity)
+        {
+                Handle->Capacity *= 2;
+                Handle->Buffer = realloc(Handle->Buffer, Handle->Capacity);
+                Handle->Data = Handle->Buffer;
+        }
+
+        int64 Read = ReadBlock(Handle->FileDescriptor, Handle->Buffer + Handle->Size, Handle->Capacity - Handle->Size);
+        if (Read <= 0)
+        {
+                Handle->EndOfFile = true;
+                Handle->Failed = Read < 0;
+                return false;
+        }
+
+        Handle->Size += Read;
+
+        return true;
+}
+
+static struct lluna_Core_Reader* CreateEmpty(int32 FileDescriptor)
+{
+        struct lluna_Core_Reader* Handle = malloc(sizeof(struct lluna_Core_Reader));
+        Handle->Data = NULL;
+        Handle->Buffer = NULL;
+        Handle->Capacity = 0;
+        Handle->Offset = 0;
+        Handle->Size = 0;
+        Handle->FileDescriptor = FileDescriptor;
+        Handle->Mapped = false;
+        Handle->EndOfFile = true;
+        Handle->Failed = false;
+
+        return Handle;
+}
+
+struct lluna_Core_Reader* lluna_Core_Reader_Create(int32 FileDescriptor, uint64 Capacity)
+{
+        struct lluna_Core_Reader* Handle = CreateEmpty(FileDescriptor);
+        Handle->Capacity = Capacity > 0 ? Capacity : 1;
+        Handle->Buffer = malloc(Handle->Capacity);
+        Handle->Data = Handle->Buffer;
+        Handle->EndOfFile = false;
+
+        return Handle;
+}
+
+struct lluna_Core_Reader* lluna_Core_Reader_CreateMapped(int32 FileDescriptor)
+{
+#ifndef _WIN32
+        struct stat Status;
+        if (fstat(FileDescriptor, &Status) == 0 && S_ISREG(Status.st_mode))
+        {
+                // Empty files can't be mapped, but there is nothing to read either.
+                if (Status.st_size == 0)
+                {
+                        return CreateEmpty(FileDescriptor);
+                }
+
+                void* Mapping = mmap(NULL, Status.st_size, PROT_READ, MAP_PRIVATE, FileDescriptor, 0);
+                if (Mapping != MAP_FAILED)
+                {
+                        madvise(Mapping, Status.st_size, MADV_SEQUENTIAL);
+
+                        struct lluna_Core_Reader* Handle = CreateEmpty(FileDescriptor);
+                        Handle->Data = Mapping;
+                        Handle->Size = Status.st_size;
+                        Handle->Mapped = true;
+
+                        return Handle;
+                }
+        }
+#endif
+
+        return lluna_Core_Reader_Create(FileDescriptor, lluna_Core_Reader_DefaultCapacity);
+}
+
+struct lluna_Core_Reader* lluna_Core_Reader_CreateFromText(struct lluna_Core_Types_Text Text)
+{
+        struct lluna_Core_Reader* Handle = CreateEmpty(-1);
+        Handle->Data = (const byte*)Text.Data;
+        Handle->Size = lluna_Macros_TextLength(Text);
+
+        return Handle;
+}
+
+void lluna_Core_Reader_Destroy(struct lluna_Core_Reader* Handle)
+{
+#ifndef _WIN32
+        if (Handle->Mapped)
+        {
+                munmap((void*)Handle->Data, Handle->Size);
+        }
+#endif
+
+        free(Handle->Buffer);
+        free(Handle);
+}
+
+boolean lluna_Core_Reader_ReadRecord(struct lluna_Core_Reader* Handle, char Delimiter, struct lluna_Core_Types_Text* Record)
+{
+        uint64 ScanOffset = Handle->Offset;
+        for (;;)
+        {
+                uint64 Found = ScanOffset + Find(Handle->Data + ScanOffset, Handle->Size - ScanOffset, (byte)Delimiter);
+                if (Found < Handle->Size)
+                {
+                        Record->Data = (const char*)Handle->Data + Handle->Offset;
+                        Record->Size = Found - Handle->Offset;
+                        Handle->Offset = Found + 1;
+                        return true;
+                }
+
+                // Bytes already scanned don't need scanning again once the next block is in.
+                uint64 Scanned = Handle->Size - Handle->Offset;
+                if (!Fill(Handle))
+                {
+                        if (Handle->Offset == Handle->Size)
+                        {
+                                return false;
+                        }
+
+                        Record->Data = (const char*)Handle->Data + Handle->Offset;
+                        Record->Size = Handle->Size - Handle->Offset;
+                        Handle->Offset = Handle->Size;
+                        return true;
+                }
+                ScanOffset = Handle->Offset + Scanned;
+        }
+}
+
+boolean lluna_Core_Reader_ReadLine(struct lluna_Core_Reader* Handle, struct lluna_Core_Types_Text* Line)
+{
+        if (!lluna_Core_Reader_ReadRecord(Handle, '\n', Line))
+        {
+                return false;
+        }
+
+        if (Line->Size > 0 && Line->Data[Line->Size - 1] == '\r')
+        {
+                --Line->Size;
+        }
+
+        return true;
+}
+
+struct lluna_Core_Types_Text lluna_Core_Reader_ReadRemaining(struct lluna_Core_Reader* Handle)
+{
+        while (Fill(Handle))
+        {
+        }
+
+        struct lluna_Core_Types_Text Text = { (const char*)Handle->Data + Handle->Offset, Handle->Size - Handle->Offset };
+        Handle->Offset = Handle->Size;
+
+        return Text;
+}
@@ -0,0 +1,431 @@
+#include <Engine/Core/Public/Sync.h>
+
+#include <Engine/Core/Public/Atomics.h>
+
+#include <limits.h>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Most rounds of spinning before parking a waiting thread.
+#define SpinLimit 100
+
+// Reader-writer lock states. The low bits count readers, all of them set means write locked.
+#define ReaderMask ((1u << 30) - 1)
+#define WriteLocked ReaderMask
+#define MaximumReaders (ReaderMask - 1)
+#define ReadersWaiting (1u << 30)
+#define WritersWaiting (1u << 31)
+
+#define Clear 0
+#define Set 1
+#define ClearWaiting 2
+
+// Parks the thread while the word holds the expected value. Can return spuriously.
+static void Wait(uint32* Address, uint32 Expected)
+{
+#if defined(__linux__)
+        syscall(SYS_futex, Address, FUTEX_WAIT_PRIVATE, Expected, NULL, NULL, 0);
+#else
+        if (lluna_Core_Atomics_LoadUint32(Address, lluna_Core_Atomics_Relaxed) == Expected)
+        {
+                lluna_Core_Atomics_Yield();
+        }
+#endif
+}
+
+// Returns the number of parked threads woken up.
+static uint32 Wake(uint32* Address, uint32 Count)
+{
+#if defined(__linux__)
+        long Woken = syscall(SYS_futex, Address, FUTEX_WAKE_PRIVATE, Count > INT_MAX ? INT_MAX : Count, NULL, NULL, 0);
+
+        return Woken > 0 ? (uint32)Woken : 0;
+#else
+        return 0;
+#endif
+}
+
+void lluna_Core_Sync_InitializeMutex(struct lluna_Core_Sync_Mutex* Mutex)
+{
+        Mutex->State = 0;
+        Mutex->Spins = 0;
+}
+
+void lluna_Core_Sync_LockMutex(struct lluna_Core_Sync_Mutex* Mutex)
+{
+        uint32 Expected = 0;
+        if (lluna_Core_Atomics_CompareExchangeUint32(&Mutex->State, &Expected, 1, true, lluna_Core_Atomics_Acquire, lluna_Core_Atomics_Relaxed))
+        {
+                return;
+        }
+
+        // Spin a little longer than it took to get the lock recently, so locks held briefly are taken without parking.
+        int32 Average = (int32)lluna_Core_Atomics_LoadUint32(&Mutex->Spins, lluna_Core_Atomics_Relaxed);
+        int32 Limit = Average * 2 + 10 < SpinLimit ? Average * 2 + 10 : SpinLimit;
+        int32 Spin = 0;
+        boolean Locked = false;
+        while (!Locked && Spin < Limit)
+        {
+                lluna_Core_Atomics_Pause();
+                ++Spin;
+
+                Expected = 0;
+                Locked = lluna_Core_Atomics_LoadUint32(&Mutex->State, lluna_Core_Atomics_Relaxed) == 0 &&
+                         lluna_Core_Atomics_CompareExchangeUint32(&Mutex->State, &Expected, 1, true, lluna_Core_Atomics_Acquire, lluna_Core_Atomics_Relaxed);
+        }
+        lluna_Core_Atomics_StoreUint32(&Mutex->Spins, (uint32)(Average + (Spin - Average) / 8), lluna_Core_Atomics_Relaxed);
+
+        if (Locked)
+        {
+                return;
+        }
+
+        // Locked with waiters from now on, since it can't be known whether others are parked.
+        while (lluna_Core_Atomics_ExchangeUint32(&Mutex->State, 2, lluna_Core_Atomics_Acquire) != 0)
+        {
+                Wait(&Mutex->State, 2);
+        }
+}
+
+boolean lluna_Core_Sync_TryLockMutex(struct lluna_Core_Sync_Mutex* Mutex)
+{
+        uint32 Expected = 0;
+
+        return lluna_Core_Atomics_CompareExchangeUint32(&Mutex->State, &Expected, 1, false, lluna_Core_Atomics_Acquire, lluna_Core_Atomics_Relaxed);
+}
+
+void lluna_Core_Sync_UnlockMutex(struct lluna_Core_Sync_Mutex* Mutex)
+{
+        if (lluna_Core_Atomics_ExchangeUint32(&Mutex->State, 0, lluna_Core_Atomics_Release) == 2)
+        {
+                Wake(&Mutex->State, 1);
+        }
+}
+
+static boolean ReadLockable(uint32 State)
+{
+        return (State & ReaderMask) < MaximumReaders && !(State & (ReadersWaiting | WritersWaiting));
+}
+
+static boolean Unlocked(uint32 State)
+{
+        return (State & ReaderMask) == 0;
+}
+
+static uint32 SpinRead(struct lluna_Core_Sync_RwLock* Lock)
+{
+        uint32 State = lluna_Core_Atomics_LoadUint32(&Lock->State, lluna_Core_Atomics_Relaxed);
+        for (uint32 Spin = 0; Spin < SpinLimit && (State & ReaderMask) == WriteLocked && !(State & (ReadersWaiting | WritersWaiting)); ++Spin)
+        {
+                lluna_Core_Atomics_Pause();
+                State = lluna_Core_Atomics_LoadUint32(&Lock->State, lluna_Core_Atomics_Relaxed);
+        }
+
+        return State;
+}
+
+static uint32 SpinWrite(struct lluna_Core_Sync_RwLock* Lock)
+{
+        uint32 State = lluna_Core_Atomics_LoadUint32(&Lock->State, lluna_Core_Atomics_Relaxed);
+        for (uint32 Spin = 0; Spin < SpinLimit && !Unlocked(State) && !(State & WritersWaiting); ++Spin)
+        {
+                lluna_Core_Atomics_Pause();
+                State = lluna_Core_Atomics_LoadUint32(&Lock->State, lluna_Core_Atomics_Relaxed);
+        }
+
+        return State;
+}
+
+static boolean WakeWriter(struct lluna_Core_Sync_RwLock* Lock)
+{
+        lluna_Core_Atomics_FetchAddUint32(&Lock->WriterNotify, 1, lluna_Core_Atomics_Release);
+
+        return Wake(&Lock->WriterNotify, 1) > 0;
+}
+
+// Called with the lock just unlocked. Writers are preferred, readers are woken if no writer was actually parked.
+static void WakeWriterOrReaders(struct lluna_Core_Sync_RwLock* Lock, uint32 State)
+{
+        if (State == WritersWaiting)
+        {
+                if (lluna_Core_Atomics_CompareExchangeUint32(&Lock->State, &State, 0, false, lluna_Core_Atomics_Relaxed, lluna_Core_Atomics_Relaxed))
+                {
+                        WakeWriter(Lock);
+                        return;
+                }
+        }
+
+        if (State == (ReadersWaiting | WritersWaiting))
+        {
+                if (!lluna_Core_Atomics_CompareExchangeUint32(&Lock->State, &State, ReadersWaiting, false,
+                                                              lluna_Core_Atomics_Relaxed, lluna_Core_Atomics_Relaxed))
+                {
+                        return;
+                }
+                if (WakeWriter(Lock))
+                {
+                        return;
+                }
+                State = ReadersWaiting;
+        }
+
+        if (State == ReadersWaiting)
+        {
+                if (lluna_Core_Atomics_CompareExchangeUint32(&Lock->State, &State, 0, false, lluna_Core_Atomics_Relaxed, lluna_Core_Atomics_Relaxed))
+                {
+                        Wake(&Lock->State, UINT_MAX);
+                }
+        }
+}
+
+void lluna_Core_Sync_InitializeRwLock(struct lluna_Core_Sync_RwLock* Lock)
+{
+        Lock->State = 0;
+        Lock->WriterNotify = 0;
+}
+
+void lluna_Core_Sync_ReadLock(struct lluna_Core_Sync_RwLock* Lock)
+{
+        uint32 State = lluna_Core_Atomics_LoadUint32(&Lock->State, lluna_Core_Atomics_Relaxed);
+        if (ReadLockable(State) && lluna_Core_Atomics_CompareExchangeUint32(&Lock->State, &State, State + 1, true,
+                                                                            lluna_Core_Atomics_Acquire, lluna_Core_Atomics_Relaxed))
+        {
+                return;
+        }
+
+        State = SpinRead(Lock);
+        for (;;)
+        {
+                if (ReadLockable(State))
+                {
+                        if (lluna_Core_Atomics_CompareExchangeUint32(&Lock->State, &State, State + 1, true,
+                                                                     lluna_Core_Atomics_Acquire, lluna_Core_Atomics_Relaxed))
+                        {
+                                return;
+                        }
+                        continue;
+                }
+
+                if (!(State & ReadersWaiting) &&
+                    !lluna_Core_Atomics_CompareExchangeUint32(&Lock->State, &State, State | ReadersWaiting, false,
+                                                              lluna_Core_Atomics_Relaxed, lluna_Core_Atomics_Relaxed))
+                {
+                        continue;
+                }
+
+                Wait(&Lock->State, State | ReadersWaiting);
+                State = SpinRead(Lock);
+        }
+}
+
+void lluna_Core_Sync_ReadUnlock(struct lluna_Core_Sync_RwLock* Lock)
+{
+        uint32 State = lluna_Core_Atomics_FetchSubUint32(&Lock->State, 1, lluna_Core_Atomics_Release) - 1;
+
+        // Readers only park behind writers, so the last reader leaving only has writers to wake.
+        if (Unlocked(State) && (State & WritersWaiting))
+        {
+                WakeWriterOrReaders(Lock, State);
+        }
+}
+
+void lluna_Core_Sync_WriteLock(struct lluna_Core_Sync_RwLock* Lock)
+{
+        uint32 State = 0;
+        if (lluna_Core_Atomics_CompareExchangeUint32(&Lock->State, &State, WriteLocked, true, lluna_Core_Atomics_Acquire, lluna_Core_Atomics_Relaxed))
+        {
+                return;
+        }
+
+        // Once this writer has parked, others might still be parked, so the flag is kept when taking the lock.
+        uint32 OtherWritersWaiting = 0;
+        State = SpinWrite(Lock);
+        for (;;)
+        {
+                if (Unlocked(State))
+                {
+                        if (lluna_Core_Atomics_CompareExchangeUint32(&Lock->State, &State, State | WriteLocked | OtherWritersWaiting, true,
+                                                                     lluna_Core_Atomics_Acquire, lluna_Core_Atomics_Relaxed))
+                        {
+                                return;
+                        }
+                        continue;
+                }
+
+                if (!(State & WritersWaiting) &&
+                    !lluna_Core_Atomics_CompareExchangeUint32(&Lock->State, &State, State | WritersWaiting, false,
+                                                              lluna_Core_Atomics_Relaxed, lluna_Core_Atomics_Relaxed))
+                {
+                        continue;
+                }
+                OtherWritersWaiting = WritersWaiting;
+
+                // Read the notification counter before checking the state again, so an unlock in between is not missed.
+                uint32 Notify = lluna_Core_Atomics_LoadUint32(&Lock->WriterNotify, lluna_Core_Atomics_Acquire);
+                State = lluna_Core_Atomics_LoadUint32(&Lock->State, lluna_Core_Atomics_Relaxed);
+                if (Unlocked(State) || !(State & WritersWaiting))
+                {
+                        continue;
+                }
+
+                Wait(&Lock->WriterNotify, Notify);
+                State = SpinWrite(Lock);
+        }
+}
+
+void lluna_Core_Sync_WriteUnlock(struct lluna_Core_Sync_RwLock* Lock)
+{
+        uint32 State = lluna_Core_Atomics_FetchSubUint32(&Lock->State, WriteLocked, lluna_Core_Atomics_Release) - WriteLocked;
+        if (State)
+        {
+                WakeWriterOrReaders(Lock, State);
+        }
+}
+
+void lluna_Core_Sync_InitializeEvent(struct lluna_Core_Sync_Event* Event, boolean ManualReset, boolean Signaled)
+{
+        Event->State = Signaled ? Set : Clear;
+        Event->ManualReset = ManualReset;
+}
+
+void lluna_Core_Sync_SignalEvent(struct lluna_Core_Sync_Event* Event)
+{
+        if (lluna_Core_Atomics_ExchangeUint32(&Event->State, Set, lluna_Core_Atomics_Release) == ClearWaiting)
+        {
+                Wake(&Event->State, Event->ManualReset ? UINT_MAX : 1);
+        }
+}
+
+void lluna_Core_Sync_ResetEvent(struct lluna_Core_Sync_Event* Event)
+{
+        uint32 State = Set;
+        lluna_Core_Atomics_CompareExchangeUint32(&Event->State, &State, Clear, false, lluna_Core_Atomics_Relaxed, lluna_Core_Atomics_Relaxed);
+}
+
+void lluna_Core_Sync_WaitEvent(struct lluna_Core_Sync_Event* Event)
+{
+        boolean Parked = false;
+        uint32 State = lluna_Core_Atomics_LoadUint32(&Event->State, lluna_Core_Atomics_Acquire);
+        for (uint32 Spin = 0; Spin < SpinLimit && State != Set; ++Spin)
+        {
+                lluna_Core_Atomics_Pause();
+                State = lluna_Core_Atomics_LoadUint32(&Event->State, lluna_Core_Atomics_Acquire);
+        }
+
+        for (;;)
+        {
+                if (State == Set)
+                {
+                        if (Event->ManualReset)
+                        {
+                                return;
+                        }
+
+                        // Threads that parked can't know whether others are still parked, so they leave the flag set.
+                        if (lluna_Core_Atomics_CompareExchangeUint32(&Event->State, &State, Parked ? ClearWaiting : Clear, false,
+                                                                     lluna_Core_Atomics_Acquire, lluna_Core_Atomics_Acquire))
+                        {
+                                return;
+                        }
+                        continue;
+                }
+
+                if (State == Clear &&
+                    !lluna_Core_Atomics_CompareExchangeUint32(&Event->State, &State, ClearWaiting, false,
+                                                              lluna_Core_Atomics_Relaxed, lluna_Core_Atomics_Relaxed))
+                {
+                        continue;
+                }
+
+                Wait(&Event->State, ClearWaiting);
+                Parked = true;
+                State = lluna_Core_Atomics_LoadUint32(&Event->State, lluna_Core_Atomics_Acquire);
+        }
+}
+
+void lluna_Core_Sync_InitializeSemaphore(struct lluna_Core_Sync_Semaphore* Semaphore, uint32 Count)
+{
+        Semaphore->Count = Count;
+        Semaphore->WaitingCount = 0;
+}
+
+void lluna_Core_Sync_AcquireSemaphore(struct lluna_Core_Sync_Semaphore* Semaphore)
+{
+        for (uint32 Spin = 0; Spin < SpinLimit; ++Spin)
+        {
+                if (lluna_Core_Sync_TryAcquireSemaphore(Semaphore))
+                {
+                        return;
+                }
+                lluna_Core_Atomics_Pause();
+        }
+
+        while (!lluna_Core_Sync_TryAcquireSemaphore(Semaphore))
+        {
+                // Announce waiting before the kernel checks the count. Pairs with ReleaseSemaphore, so either the
+                // releasing thread sees a waiter or the kernel sees the released units.
+                lluna_Core_Atomics_FetchAddUint32(&Semaphore->WaitingCount, 1, lluna_Core_Atomics_SequentiallyConsistent);
+                Wait(&Semaphore->Count, 0);
+                lluna_Core_Atomics_FetchSubUint32(&Semaphore->WaitingCount, 1, lluna_Core_Atomics_Relaxed);
+        }
+}
+
+boolean lluna_Core_Sync_TryAcquireSemaphore(struct lluna_Core_Sync_Semaphore* Semaphore)
+{
+        uint32 Count = lluna_Core_Atomics_LoadUint32(&Semaphore->Count, lluna_Core_Atomics_Relaxed);
+        while (Count > 0)
+        {
+                if (lluna_Core_Atomics_CompareExchangeUint32(&Semaphore->Count, &Count, Count - 1, true,
+                                                             lluna_Core_Atomics_Acquire, lluna_Core_Atomics_Relaxed))
+                {
+                        return true;
+                }
+        }
+
+        return false;
+}
+
+void lluna_Core_Sync_ReleaseSemaphore(struct lluna_Core_Sync_Semaphore* Semaphore, uint32 Count)
+{
+        lluna_Core_Atomics_FetchAddUint32(&Semaphore->Count, Count, lluna_Core_Atomics_SequentiallyConsistent);
+        if (lluna_Core_Atomics_LoadUint32(&Semaphore->WaitingCount, lluna_Core_Atomics_SequentiallyConsistent))
+        {
+                Wake(&Semaphore->Count, Count);
+        }
+}
+
+void lluna_Core_Sync_InitializeBarrier(struct lluna_Core_Sync_Barrier* Barrier, uint32 Count)
+{
+        Barrier->Count = Count;
+        Barrier->Remaining = Count;
+        Barrier->Generation = 0;
+}
+
+boolean lluna_Core_Sync_WaitBarrier(struct lluna_Core_Sync_Barrier* Barrier)
+{
+        uint32 Generation = lluna_Core_Atomics_LoadUint32(&Barrier->Generation, lluna_Core_Atomics_Acquire);
+        if (lluna_Core_Atomics_FetchSubUint32(&Barrier->Remaining, 1, lluna_Core_Atomics_AcquireRelease) == 1)
+        {
+                // Reset before publishing the new generation, threads leaving for the next round see it.
+                lluna_Core_Atomics_StoreUint32(&Barrier->Remaining, Barrier->Count, lluna_Core_Atomics_Relaxed);
+                lluna_Core_Atomics_FetchAddUint32(&Barrier->Generation, 1, lluna_Core_Atomics_Release);
+                Wake(&Barrier->Generation, UINT_MAX);
+
+                return true;
+        }
+
+        for (uint32 Spin = 0; Spin < SpinLimit && lluna_Core_Atomics_LoadUint32(&Barrier->Generation, lluna_Core_Atomics_Acquire) == Generation; ++Spin)
+        {
+                lluna_Core_Atomics_Pause();
+        }
+        while (lluna_Core_Atomics_LoadUint32(&Barrier->Generation, lluna_Core_Atomics_Acquire) == Generation)
+        {
+                Wait(&Barrier->Generation, Generation);
+        }
+
+        return false;
+}
@@ -0,0 +1,666 @@
+#include <Engine/Core/Public/Utf8.h>
+
+#include <Engine/Core/Public/Cpu.h>
+#include <Engine/Core/Public/Macros.h>
+
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HAS_X86_INTRINSICS
+#include <immintrin.h>
+#endif
+
+// Error flags of the lookup validation algorithm. Each one describes an invalid pair of adjacent bytes.
+#define TooShort (1 << 0)
+#define TooLong (1 << 1)
+#define Overlong3 (1 << 2)
+#define TooLarge (1 << 3)
+#define Surrogate (1 << 4)
+#define Overlong2 (1 << 5)
+#define TooLarge1000 (1 << 6)
+#define Overlong4 (1 << 6)
+#define TwoContinuations (1 << 7)
+#define Carry (TooShort | TooLong | TwoContinuations)
+
+typedef boolean (*ValidateFunction)(const byte*, uint64);
+
+static boolean IsContinuation(byte Byte)
+{
+        return (Byte & 0xC0) == 0x80;
+}
+
+static uint32 DecodeSequence(const byte* Data, uint64 Length, uint64* Offset)
+{
+        byte Lead = Data[*Offset];
+        uint32 CodePoint;
+        uint32 SequenceLength;
+        uint32 Minimum;
+
+        if (Lead < 0x80)
+        {
+                ++*Offset;
+                return Lead;
+        }
+        else if ((Lead & 0xE0) == 0xC0)
+        {
+                CodePoint = Lead & 0x1F;
+                SequenceLength = 2;
+                Minimum = 0x80;
+        }
+        else if ((Lead & 0xF0) == 0xE0)
+        {
+                CodePoint = Lead & 0x0F;
+                SequenceLength = 3;
+                Minimum = 0x800;
+        }
+        else if ((Lead & 0xF8) == 0xF0)
+        {
+                CodePoint = Lead & 0x07;
+                SequenceLength = 4;
+                Minimum = 0x10000;
+        }
+        else
+        {
+                ++*Offset;
+                return lluna_Core_Utf8_ReplacementCharacter;
+        }
+
+        if (*Offset + SequenceLength > Length)
+        {
+                ++*Offset;
+                return lluna_Core_Utf8_ReplacementCharacter;
+        }
+
+        for (uint32 Index = 1; Index < SequenceLength; ++Index)
+        {
+                byte Continuation = Data[*Offset + Index];
+                if (!IsContinuation(Continuation))
+                {
+                        ++*Offset;
+                        return lluna_Core_Utf8_ReplacementCharacter;
+                }
+
+                CodePoint = (CodePoint << 6) | (Continuation & 0x3F);
+        }
+
+        if (CodePoint < Minimum || CodePoint > 0x10FFFF || (CodePoint >= 0xD800 && CodePoint <= 0xDFFF))
+        {
+                ++*Offset;
+                return lluna_Core_Utf8_ReplacementCharacter;
+        }
+
+        *Offset += SequenceLength;
+        return CodePoint;
+}
+
+static boolean ValidateScalar(const byte* Data, uint64 Length)
+{
+        uint64 Offset = 0;
+        while (Offset < Length)
+        {
+                if (Data[Offset] < 0x80)
+                {
+                        ++Offset;
+                        continue;
+                }
+
+                uint64 SequenceStart = Offset;
+                if (DecodeSequence(Data, Length, &Offset) == lluna_Core_Utf8_ReplacementCharacter && Offset == SequenceStart + 1)
+                {
+                        // U+FFFD itself is three bytes long, so a single byte advance always means a malformed sequence.
+                        return false;
+                }
+        }
+
+        return true;
+}
+
+static uint64 CountCodePointsScalar(const byte* Data, uint64 Length)
+{
+        uint64 Count = 0;
+        for (uint64 Offset = 0; Offset < Length; ++Offset)
+        {
+                Count += !IsContinuation(Data[Offset]);
+        }
+
+        return Count;
+}
+
+#ifdef HAS_X86_INTRINSICS
+
+__attribute__((target("ssse3")))
+static void CheckBlockSsse3(__m128i Input, __m128i PreviousInput, __m128i* Error)
+{
+        const __m128i ByteOneHighTable = _mm_setr_epi8(
+                TooLong, TooLong, TooLong, TooLong,
+                TooLong, TooLong, TooLong, TooLong,
+                (char)TwoContinuations, (char)TwoContinuations, (char)TwoContinuations, (char)TwoContinuations,
+                TooShort | Overlong2,
+                TooShort,
+                TooShort | Overlong3 | Surrogate,
+                TooShort | TooLarge | TooLarge1000 | Overlong4
+        );
+        const __m128i ByteOneLowTable = _mm_setr_epi8(
+                (char)(Carry | Overlong3 | Overlong2 | Overlong4),
+                (char)(Carry | Overlong2),
+                (char)Carry,
+                (char)Carry,
+                (char)(Carry | TooLarge),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000 | Surrogate),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000)
+        );
+        const __m128i ByteTwoHighTable = _mm_setr_epi8(
+                TooShort, TooShort, TooShort, TooShort,
+                TooShort, TooShort, TooShort, TooShort,
+                (char)(TooLong | Overlong2 | TwoContinuations | Overlong3 | TooLarge1000 | Overlong4),
+                (char)(TooLong | Overlong2 | TwoContinuations | Overlong3 | TooLarge),
+                (char)(TooLong | Overlong2 | TwoContinuations | Surrogate | TooLarge),
+                (char)(TooLong | Overlong2 | TwoContinuations | Surrogate | TooLarge),
+                TooShort, TooShort, TooShort, TooShort
+        );
+        const __m128i LowNibbleMask = _mm_set1_epi8(0x0F);
+
+        __m128i Previous1 = _mm_alignr_epi8(Input, PreviousInput, 16 - 1);
+        __m128i Previous2 = _mm_alignr_epi8(Input, PreviousInput, 16 - 2);
+        __m128i Previous3 = _mm_alignr_epi8(Input, PreviousInput, 16 - 3);
+
+        __m128i ByteOneHigh = _mm_shuffle_epi8(ByteOneHighTable, _mm_and_si128(_mm_srli_epi16(Previous1, 4), LowNibbleMask));
+        __m128i ByteOneLow = _mm_shuffle_epi8(ByteOneLowTable, _mm_and_si128(Previous1, LowNibbleMask));
+        __m128i ByteTwoHigh = _mm_shuffle_epi8(ByteTwoHighTable, _mm_and_si128(_mm_srli_epi16(Input, 4), LowNibbleMask));
+        __m128i SpecialCases = _mm_and_si128(_mm_and_si128(ByteOneHigh, ByteOneLow), ByteTwoHigh);
+
+        // Third and fourth bytes of a sequence are only checked for being continuations here.
+        __m128i IsThirdByte = _mm_subs_epu8(Previous2, _mm_set1_epi8((char)(0xE0 - 0x80)));
+        __m128i IsFourthByte = _mm_subs_epu8(Previous3, _mm_set1_epi8((char)(0xF0 - 0x80)));
+        __m128i MustBeContinuation = _mm_and_si128(_mm_or_si128(IsThirdByte, IsFourthByte), _mm_set1_epi8((char)0x80));
+
+        *Error = _mm_or_si128(*Error, _mm_xor_si128(MustBeContinuation, SpecialCases));
+}
+
+__attribute__((target("ssse3")))
+static __m128i IsIncompleteSsse3(__m128i Input)
+{
+        const __m128i MaxValue = _mm_setr_epi8(
+                -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1)
+        );
+
+        return _mm_subs_epu8(Input, MaxValue);
+}
+
+__attribute__((target("ssse3")))
+static boolean ValidateSsse3(const byte* Data, uint64 Length)
+{
+        __m128i Error = _mm_setzero_si128();
+        __m128i PreviousInput = _mm_setzero_si128();
+        __m128i PreviousIncomplete = _mm_setzero_si128();
+
+        uint64 Offset = 0;
+        for (; Offset + 16 <= Length; Offset += 16)
+        {
+                __m128i Input = _mm_loadu_si128((const __m128i*)(Data + Offset));
+                if (_mm_movemask_epi8(Input) == 0)
+                {
+                        Error = _mm_or_si128(Error, PreviousIncomplete);
+                        PreviousIncomplete = _mm_setzero_si128();
+                }
+                else
+                {
+                        CheckBlockSsse3(Input, PreviousInput, &Error);
+                        PreviousIncomplete = IsIncompleteSsse3(Input);
+                }
+                PreviousInput = Input;
+        }
+
+        if (Offset < Length)
+        {
+                byte Tail[16] = { 0 };
+                memcpy(Tail, Data + Offset, Length - Offset);
+
+                __m128i Input = _mm_loadu_si128((const __m128i*)Tail);
+                CheckBlockSsse3(Input, PreviousInput, &Error);
+                PreviousIncomplete = IsIncompleteSsse3(Input);
+        }
+
+        Error = _mm_or_si128(Error, PreviousIncomplete);
+
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(Error, _mm_setzero_si128())) == 0xFFFF;
+}
+
+__attribute__((target("avx2")))
+static void CheckBlockAvx2(__m256i Input, __m256i PreviousInput, __m256i* Error)
+{
+        const __m256i ByteOneHighTable = _mm256_setr_epi8(
+                TooLong, TooLong, TooLong, TooLong,
+                TooLong, TooLong, TooLong, TooLong,
+                (char)TwoContinuations, (char)TwoContinuations, (char)TwoContinuations, (char)TwoContinuations,
+                TooShort | Overlong2,
+                TooShort,
+                TooShort | Overlong3 | Surrogate,
+                TooShort | TooLarge | TooLarge1000 | Overlong4,
+                TooLong, TooLong, TooLong, TooLong,
+                TooLong, TooLong, TooLong, TooLong,
+                (char)TwoContinuations, (char)TwoContinuations, (char)TwoContinuations, (char)TwoContinuations,
+                TooShort | Overlong2,
+                TooShort,
+                TooShort | Overlong3 | Surrogate,
+                TooShort | TooLarge | TooLarge1000 | Overlong4
+        );
+        const __m256i ByteOneLowTable = _mm256_setr_epi8(
+                (char)(Carry | Overlong3 | Overlong2 | Overlong4),
+                (char)(Carry | Overlong2),
+                (char)Carry,
+                (char)Carry,
+                (char)(Carry | TooLarge),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000 | Surrogate),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | Overlong3 | Overlong2 | Overlong4),
+                (char)(Carry | Overlong2),
+                (char)Carry,
+                (char)Carry,
+                (char)(Carry | TooLarge),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000 | Surrogate),
+                (char)(Carry | TooLarge | TooLarge1000),
+                (char)(Carry | TooLarge | TooLarge1000)
+        );
+        const __m256i ByteTwoHighTable = _mm256_setr_epi8(
+                TooShort, TooShort, TooShort, TooShort,
+                TooShort, TooShort, TooShort, TooShort,
+                (char)(TooLong | Overlong2 | TwoContinuations | Overlong3 | TooLarge1000 | Overlong4),
+                (char)(TooLong | Overlong2 | TwoContinuations | Overlong3 | TooLarge),
+                (char)(TooLong | Overlong2 | TwoContinuations | Surrogate | TooLarge),
+                (char)(TooLong | Overlong2 | TwoContinuations | Surrogate | TooLarge),
+                TooShort, TooShort, TooShort, TooShort,
+                TooShort, TooShort, TooShort, TooShort,
+                TooShort, TooShort, TooShort, TooShort,
+                (char)(TooLong | Overlong2 | TwoContinuations | Overlong3 | TooLarge1000 | Overlong4),
+                (char)(TooLong | Overlong2 | TwoContinuations | Overlong3 | TooLarge),
+                (char)(TooLong | Overlong2 | TwoContinuations | Surrogate | TooLarge),
+                (char)(TooLong | Overlong2 | TwoContinuations | Surrogate | TooLarge),
+                TooShort, TooShort, TooShort, TooShort
+        );
+        const __m256i LowNibbleMask = _mm256_set1_epi8(0x0F);
+
+        // Lanes are shifted independently, so the upper half of the previous block is moved next to the lower half of the input first.
+        __m256i Straddle = _mm256_permute2x128_si256(PreviousInput, Input, 0x21);
+        __m256i Previous1 = _mm256_alignr_epi8(Input, Straddle, 16 - 1);
+        __m256i Previous2 = _mm256_alignr_epi8(Input, Straddle, 16 - 2);
+        __m256i Previous3 = _mm256_alignr_epi8(Input, Straddle, 16 - 3);
+
+        __m256i ByteOneHigh = _mm256_shuffle_epi8(ByteOneHighTable, _mm256_and_si256(_mm256_srli_epi16(Previous1, 4), LowNibbleMask));
+        __m256i ByteOneLow = _mm256_shuffle_epi8(ByteOneLowTable, _mm256_and_si256(Previous1, LowNibbleMask));
+        __m256i ByteTwoHigh = _mm256_shuffle_epi8(ByteTwoHighTable, _mm256_and_si256(_mm256_srli_epi16(Input, 4), LowNibbleMask));
+        __m256i SpecialCases = _mm256_and_si256(_mm256_and_si256(ByteOneHigh, ByteOneLow), ByteTwoHigh);
+
+        __m256i IsThirdByte = _mm256_subs_epu8(Previous2, _mm256_set1_epi8((char)(0xE0 - 0x80)));
+        __m256i IsFourthByte = _mm256_subs_epu8(Previous3, _mm256_set1_epi8((char)(0xF0 - 0x80)));
+        __m256i MustBeContinuation = _mm256_and_si256(_mm256_or_si256(IsThirdByte, IsFourthByte), _mm256_set1_epi8((char)0x80));
+
+        *Error = _mm256_or_si256(*Error, _mm256_xor_si256(MustBeContinuation, SpecialCases));
+}
+
+__attribute__((target("avx2")))
+static __m256i IsIncompleteAvx2(__m256i Input)
+{
+        const __m256i MaxValue = _mm256_setr_epi8(
+                -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1)
+        );
+
+        return _mm256_subs_epu8(Input, MaxValue);
+}
+
+__attribute__((target("avx2")))
+static boolean ValidateAvx2(const byte* Data, uint64 Length)
+{
+        __m256i Error = _mm256_setzero_si256();
+        __m256i PreviousInput = _mm256_setzero_si256();
+        __m256i PreviousIncomplete = _mm256_setzero_si256();
+
+        uint64 Offset = 0;
+        for (; Offset + 32 <= Length; Offset += 32)
+        {
+                __m256i Input = _mm256_loadu_si256((const __m256i*)(Data + Offset));
+                if (_mm256_movemask_epi8(Input) == 0)
+                {
+                        Error = _mm256_or_si256(Error, PreviousIncomplete);
+                        PreviousIncomplete = _mm256_setzero_si256();
+                }
+                else
+                {
+                        CheckBlockAvx2(Input, PreviousInput, &Error);
+                        PreviousIncomplete = IsIncompleteAvx2(Input);
+                }
+                PreviousInput = Input;
+        }
+
+        if (Offset < Length)
+        {
+                byte Tail[32] = { 0 };
+                memcpy(Tail, Data + Offset, Length - Offset);
+
+                __m256i Input = _mm256_loadu_si256((const __m256i*)Tail);
+                CheckBlockAvx2(Input, PreviousInput, &Error);
+                PreviousIncomplete = IsIncompleteAvx2(Input);
+        }
+
+        Error = _mm256_or_si256(Error, PreviousIncomplete);
+
+        return _mm256_testz_si256(Error, Error);
+}
+
+__attribute__((target("sse2")))
+static uint64 CountCodePointsSse2(const byte* Data, uint64 Length)
+{
+        // Continuation bytes are the only ones in [-128, -65] when read as signed.
+        const __m128i ContinuationLimit = _mm_set1_epi8(-65);
+
+        uint64 Count = 0;
+        uint64 Offset = 0;
+        for (; Offset + 16 <= Length; Offset += 16)
+        {
+                __m128i Input = _mm_loadu_si128((const __m128i*)(Data + Offset));
+                Count += __builtin_popcount(_mm_movemask_epi8(_mm_cmpgt_epi8(Input, ContinuationLimit)));
+        }
+
+        return Count + CountCodePointsScalar(Data + Offset, Length - Offset);
+}
+
+__attribute__((target("sse2")))
+static uint32 AsciiPrefixSse2(const byte* Data, uint64 Length)
+{
+        if (Length < 16)
+        {
+                return 0;
+        }
+
+        int32 Mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)Data));
+
+        return Mask == 0 ? 16 : __builtin_ctz(Mask);
+}
+
+__attribute__((target("sse2")))
+static void WidenAsciiUtf32Sse2(const byte* Data, uint32* Output)
+{
+        __m128i Zero = _mm_setzero_si128();
+        __m128i Input = _mm_loadu_si128((const __m128i*)Data);
+        __m128i Low = _mm_unpacklo_epi8(Input, Zero);
+        __m128i High = _mm_unpackhi_epi8(Input, Zero);
+
+        _mm_storeu_si128((__m128i*)Output, _mm_unpacklo_epi16(Low, Zero));
+        _mm_storeu_si128((__m128i*)(Output + 4), _mm_unpackhi_epi16(Low, Zero));
+        _mm_storeu_si128((__m128i*)(Output + 8), _mm_unpacklo_epi16(High, Zero));
+        _mm_storeu_si128((__m128i*)(Output + 12), _mm_unpackhi_epi16(High, Zero));
+}
+
+__attribute__((target("sse2")))
+static void WidenAsciiUtf16Sse2(const byte* Data, uint16* Output)
+{
+        __m128i Zero = _mm_setzero_si128();
+        __m128i Input = _mm_loadu_si128((const __m128i*)Data);
+
+        _mm_storeu_si128((__m128i*)Output, _mm_unpacklo_epi8(Input, Zero));
+        _mm_storeu_si128((__m128i*)(Output + 8), _mm_unpackhi_epi8(Input, Zero));
+}
+
+#endif
+
+static ValidateFunction ResolveValidate()
+{
+        static const struct lluna_Core_Cpu_Kernel Kernels[] = {
+#ifdef HAS_X86_INTRINSICS
+                { lluna_Core_Cpu_Avx2, (lluna_Core_Cpu_Function)ValidateAvx2 },
+                { lluna_Core_Cpu_Ssse3, (lluna_Core_Cpu_Function)ValidateSsse3 },
+#endif
+                { 0, (lluna_Core_Cpu_Function)ValidateScalar },
+        };
+
+        return (ValidateFunction)lluna_Core_Cpu_Dispatch(Kernels, sizeof(Kernels) / sizeof(Kernels[0]));
+}
+
+static boolean HasSse2()
+{
+#ifdef HAS_X86_INTRINSICS
+        return lluna_Core_Cpu_Supports(lluna_Core_Cpu_Sse2);
+#else
+        return false;
+#endif
+}
+
+boolean lluna_Core_Utf8_Validate(struct lluna_Core_Types_Text Text)
+{
+        static ValidateFunction Validate = NULL;
+        if (!Validate)
+        {
+                Validate = ResolveValidate();
+        }
+
+        return Validate((const byte*)Text.Data, lluna_Macros_TextLength(Text));
+}
+
+uint64 lluna_Core_Utf8_CountCodePoints(struct lluna_Core_Types_Text Text)
+{
+#ifdef HAS_X86_INTRINSICS
+        if (HasSse2())
+        {
+                return CountCodePointsSse2((const byte*)Text.Data, lluna_Macros_TextLength(Text));
+        }
+#endif
+
+        return CountCodePointsScalar((const byte*)Text.Data, lluna_Macros_TextLength(Text));
+}
+
+uint32 lluna_Core_Utf8_Decode(struct lluna_Core_Types_Text Text, uint64* Offset)
+{
+        return DecodeSequence((const byte*)Text.Data, lluna_Macros_TextLength(Text), Offset);
+}
+
+uint64 lluna_Core_Utf8_EncodedSize(const uint32* CodePoints, uint64 Count)
+{
+        uint64 Size = 0;
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                uint32 CodePoint = CodePoints[Index];
+                if (CodePoint < 0x80)
+                {
+                        Size += 1;
+                }
+                else if (CodePoint < 0x800)
+                {
+                        Size += 2;
+                }
+                else if (CodePoint < 0x10000 || CodePoint > 0x10FFFF)
+                {
+                        // Everything that can't be encoded becomes U+FFFD, which takes three bytes.
+                        Size += 3;
+                }
+                else
+                {
+                        Size += 4;
+                }
+        }
+
+        return Size;
+}
+
+uint64 lluna_Core_Utf8_Encode(const uint32* CodePoints, uint64 Count, char* Output)
+{
+        byte* Cursor = (byte*)Output;
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                uint32 CodePoint = CodePoints[Index];
+                if ((CodePoint >= 0xD800 && CodePoint <= 0xDFFF) || CodePoint > 0x10FFFF)
+                {
+                        CodePoint = lluna_Core_Utf8_ReplacementCharacter;
+                }
+
+                if (CodePoint < 0x80)
+                {
+                        *Cursor++ = (byte)CodePoint;
+                }
+                else if (CodePoint < 0x800)
+                {
+                        *Cursor++ = (byte)(0xC0 | (CodePoint >> 6));
+                        *Cursor++ = (byte)(0x80 | (CodePoint & 0x3F));
+                }
+                else if (CodePoint < 0x10000)
+                {
+                        *Cursor++ = (byte)(0xE0 | (CodePoint >> 12));
+                        *Cursor++ = (byte)(0x80 | ((CodePoint >> 6) & 0x3F));
+                        *Cursor++ = (byte)(0x80 | (CodePoint & 0x3F));
+                }
+                else
+                {
+                        *Cursor++ = (byte)(0xF0 | (CodePoint >> 18));
+                        *Cursor++ = (byte)(0x80 | ((CodePoint >> 12) & 0x3F));
+                        *Cursor++ = (byte)(0x80 | ((CodePoint >> 6) & 0x3F));
+                        *Cursor++ = (byte)(0x80 | (CodePoint & 0x3F));
+                }
+        }
+
+        return Cursor - (byte*)Output;
+}
+
+uint64 lluna_Core_Utf8_ToUtf32(struct lluna_Core_Types_Text Text, uint32* Output)
+{
+        const byte* Data = (const byte*)Text.Data;
+        uint64 Length = lluna_Macros_TextLength(Text);
+        boolean UseSse2 = HasSse2();
+
+        uint64 Offset = 0;
+        uint64 Written = 0;
+        while (Offset < Length)
+        {
+                uint32 AsciiCount = 0;
+#ifdef HAS_X86_INTRINSICS
+                if (UseSse2)
+                {
+                        AsciiCount = AsciiPrefixSse2(Data + Offset, Length - Offset);
+                        if (AsciiCount == 16)
+                        {
+                                WidenAsciiUtf32Sse2(Data + Offset, Output + Written);
+                                Offset += 16;
+                                Written += 16;
+                                continue;
+                        }
+                }
+#endif
+
+                for (uint32 Index = 0; Index < AsciiCount; ++Index)
+                {
+                        Output[Written++] = Data[Offset++];
+                }
+
+                if (Offset < Length)
+                {
+                        // Stray continuation bytes produce no output so that the written count stays within lluna_Core_Utf8_CountCodePoints.
+                        if (IsContinuation(Data[Offset]))
+                        {
+                                ++Offset;
+                                continue;
+                        }
+
+                        Output[Written++] = DecodeSequence(Data, Length, &Offset);
+                }
+        }
+
+        return Written;
+}
+
+uint64 lluna_Core_Utf8_CountUtf16(struct lluna_Core_Types_Text Text)
+{
+        const byte* Data = (const byte*)Text.Data;
+        uint64 Length = lluna_Macros_TextLength(Text);
+
+        // Four byte sequences are the only ones that need a surrogate pair.
+        uint64 FourByteLeads = 0;
+        for (uint64 Offset = 0; Offset < Length; ++Offset)
+        {
+                FourByteLeads += Data[Offset] >= 0xF0;
+        }
+
+        return lluna_Core_Utf8_CountCodePoints(Text) + FourByteLeads;
+}
+
+uint64 lluna_Core_Utf8_ToUtf16(struct lluna_Core_Types_Text Text, uint16* Output)
+{
+        const byte* Data = (const byte*)Text.Data;
+        uint64 Length = lluna_Macros_TextLength(Text);
+        boolean UseSse2 = HasSse2();
+
+        uint64 Offset = 0;
+        uint64 Written = 0;
+        while (Offset < Length)
+        {
+                uint32 AsciiCount = 0;
+#ifdef HAS_X86_INTRINSICS
+                if (UseSse2)
+                {
+                        AsciiCount = AsciiPrefixSse2(Data + Offset, Length - Offset);
+                        if (AsciiCount == 16)
+                        {
+                                WidenAsciiUtf16Sse2(Data + Offset, Output + Written);
+                                Offset += 16;
+                                Written += 16;
+                                continue;
+                        }
+                }
+#endif
+
+                for (uint32 Index = 0; Index < AsciiCount; ++Index)
+                {
+                        Output[Written++] = Data[Offset++];
+                }
+
+                if (Offset < Length)
+                {
+                        if (IsContinuation(Data[Offset]))
+                        {
+                                ++Offset;
+                                continue;
+                        }
+
+                        uint32 CodePoint = DecodeSequence(Data, Length, &Offset);
+                        if (CodePoint >= 0x10000)
+                        {
+                                CodePoint -= 0x10000;
+                                Output[Written++] = (uint16)(0xD800 | (CodePoint >> 10));
+                                Output[Written++] = (uint16)(0xDC00 | (CodePoint & 0x3FF));
+                        }
+                        else
+                        {
+                                Output[Written++] = (uint16)CodePoint;
+                        }
+                }
+        }
+
+        return Written;
+}
@@ -0,0 +1,319 @@
+#include <Engine/Core/Public/Writer.h>
+
+#include <Engine/Core/Public/Macros.h>
+#include <Engine/Core/Public/Parse.h>
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+// Longest decimal representation of a 64-bit integer, including the sign.
+#define MaxIntegerLength 20
+
+// Longest "%.9g" representation of a float, including the null terminator written by snprintf.
+#define MaxFloatLength 32
+
+static const char DigitPairs[] =
+        "0001020304050607080910111213141516171819"
+        "2021222324252627282930313233343536373839"
+        "4041424344454647484950515253545556575859"
+        "6061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+struct Chunk
+{
+        const byte* Data;
+        uint64 Size;
+};
+
+// Writes all chunks, retrying after interruptions and partial writes.
+static boolean WriteChunks(int32 FileDescriptor, struct Chunk* Chunks, uint32 Count)
+{
+#ifdef _WIN32
+        for (uint32 Index = 0; Index < Count; ++Index)
+        {
+                while (Chunks[Index].Size > 0)
+                {
+                        int32 Written = _write(FileDescriptor, Chunks[Index].Data, (uint32)(Chunks[Index].Size > 0x40000000 ? 0x40000000 : Chunks[Index].Size));
+                        if (Written < 0)
+                        {
+                                return false;
+                        }
+                        Chunks[Index].Data += Written;
+                        Chunks[Index].Size -= Written;
+                }
+        }
+
+        return true;
+#else
+        struct iovec Vectors[2];
+        struct iovec* Vector = Vectors;
+        for (uint32 Index = 0; Index < Count; ++Index)
+        {
+                Vectors[Index].iov_base = (void*)Chunks[Index].Data;
+                Vectors[Index].iov_len = Chunks[Index].Size;
+        }
+
+        while (Count > 0)
+        {
+                ssize_t Written = writev(FileDescriptor, Vector, Count);
+                if (Written < 0)
+                {
+                        if (errno == EINTR)
+                        {
+                                continue;
+                        }
+                        return false;
+                }
+
+                while (Count > 0 && (size_t)Written >= Vector->iov_len)
+                {
+                        Written -= Vector->iov_len;
+                        ++Vector;
+                        --Count;
+                }
+                if (Count > 0)
+                {
+                        Vector->iov_base = (byte*)Vector->iov_base + Written;
+                        Vector->iov_len -= Written;
+                }
+        }
+
+        return true;
+#endif
+}
+
+static void Grow(struct lluna_Core_Writer* Handle, uint64 Size)
+{
+        uint64 Capacity = Handle->Capacity * 2;
+        if (Capacity < Handle->Offset + Size)
+        {
+                Capacity = Handle->Offset + Size;
+        }
+
+        Handle->Data = realloc(Handle->Data, Capacity);
+        Handle->Capacity = Capacity;
+}
+
+// Writes an integer backwards, ending right before End. Returns the number of characters written.
+static uint32 FormatUint64(uint64 Value, char* End)
+{
+        char* Cursor = End;
+        while (Value >= 100)
+        {
+                uint32 Pair = (uint32)(Value % 100) * 2;
+                Value /= 100;
+                *--Cursor = DigitPairs[Pair + 1];
+                *--Cursor = DigitPairs[Pair];
+        }
+        if (Value >= 10)
+        {
+                *--Cursor = DigitPairs[Value * 2 + 1];
+                *--Cursor = DigitPairs[Value * 2];
+        }
+        else
+        {
+                *--Cursor = (char)('0' + Value);
+        }
+
+        return (uint32)(End - Cursor);
+}
+
+struct lluna_Core_Writer* lluna_Core_Writer_Create(int32 FileDescriptor, uint64 Capacity)
+{
+        if (Capacity < MaxFloatLength)
+        {
+                Capacity = MaxFloatLength;
+        }
+
+        struct lluna_Core_Writer* Handle = malloc(sizeof(struct lluna_Core_Writer));
+        Handle->Data = malloc(Capacity);
+        Handle->Capacity = Capacity;
+        Handle->Offset = 0;
+        Handle->FileDescriptor = FileDescriptor;
+        Handle->Failed = false;
+
+        return Handle;
+}
+
+void lluna_Core_Writer_Destroy(struct lluna_Core_Writer* Handle)
+{
+        lluna_Core_Writer_Flush(Handle);
+
+        free(Handle->Data);
+        free(Handle);
+}
+
+boolean lluna_Core_Writer_Flush(struct lluna_Core_Writer* Handle)
+{
+        if (Handle->FileDescriptor == lluna_Core_Writer_NoFile)
+        {
+                return true;
+        }
+
+        if (!Handle->Failed && Handle->Offset > 0)
+        {
+                struct Chunk Buffered = { Handle->Data, Handle->Offset };
+                Handle->Failed = !WriteChunks(Handle->FileDescriptor, &Buffered, 1);
+        }
+        Handle->Offset = 0;
+
+        return !Handle->Failed;
+}
+
+void lluna_Core_Writer_Clear(struct lluna_Core_Writer* Handle)
+{
+        Handle->Offset = 0;
+}
+
+struct lluna_Core_Types_Text lluna_Core_Writer_Text(struct lluna_Core_Writer* Handle)
+{
+        struct lluna_Core_Types_Text Text = { (const char*)Handle->Data, Handle->Offset };
+
+        return Text;
+}
+
+char* lluna_Core_Writer_Reserve(struct lluna_Core_Writer* Handle, uint64 Size)
+{
+        if (Handle->Capacity - Handle->Offset < Size)
+        {
+                lluna_Core_Writer_Flush(Handle);
+
+                if (Handle->Capacity - Handle->Offset < Size)
+                {
+                        Grow(Handle, Size);
+                }
+        }
+
+        return (char*)Handle->Data + Handle->Offset;
+}
+
+void lluna_Core_Writer_Commit(struct lluna_Core_Writer* Handle, uint64 Size)
+{
+        Handle->Offset += Size;
+}
+
+void lluna_Core_Writer_WriteBytes(struct lluna_Core_Writer* Handle, const void* Data, uint64 Size)
+{
+        if (Handle->Capacity - Handle->Offset >= Size)
+        {
+                memcpy(Handle->Data + Handle->Offset, Data, Size);
+                Handle->Offset += Size;
+                return;
+        }
+
+        // Bytes that wouldn't fit in an empty buffer either go out together with the buffered ones in one call.
+        if (Handle->FileDescriptor != lluna_Core_Writer_NoFile && Size >= Handle->Capacity)
+        {
+                if (!Handle->Failed)
+                {
+                        struct Chunk Chunks[2] = { { Handle->Data, Handle->Offset }, { (const byte*)Data, Size } };
+                        Handle->Failed = !WriteChunks(Handle->FileDescriptor, Chunks, 2);
+                }
+                Handle->Offset = 0;
+                return;
+        }
+
+        memcpy(lluna_Core_Writer_Reserve(Handle, Size), Data, Size);
+        Handle->Offset += Size;
+}
+
+void lluna_Core_Writer_WriteText(struct lluna_Core_Writer* Handle, struct lluna_Core_Types_Text Text)
+{
+        lluna_Core_Writer_WriteBytes(Handle, Text.Data, lluna_Macros_TextLength(Text));
+}
+
+void lluna_Core_Writer_WriteCharacter(struct lluna_Core_Writer* Handle, char Character)
+{
+        if (Handle->Offset == Handle->Capacity)
+        {
+                lluna_Core_Writer_Reserve(Handle, 1);
+        }
+
+        Handle->Data[Handle->Offset++] = (byte)Character;
+}
+
+void lluna_Core_Writer_WriteInt64(struct lluna_Core_Writer* Handle, int64 Value)
+{
+        char Digits[MaxIntegerLength];
+        char* End = Digits + MaxIntegerLength;
+
+        // Negating in unsigned arithmetic keeps the minimum value representable.
+        uint64 Magnitude = Value < 0 ? 0 - (uint64)Value : (uint64)Value;
+        uint32 Length = FormatUint64(Magnitude, End);
+        if (Value < 0)
+        {
+                ++Length;
+                *(End - Length) = '-';
+        }
+
+        lluna_Core_Writer_WriteBytes(Handle, End - Length, Length);
+}
+
+void lluna_Core_Writer_WriteUint64(struct lluna_Core_Writer* Handle, uint64 Value)
+{
+        char Digits[MaxIntegerLength];
+        char* End = Digits + MaxIntegerLength;
+        uint32 Length = FormatUint64(Value, End);
+
+        lluna_Core_Writer_WriteBytes(Handle, End - Length, Length);
+}
+
+void lluna_Core_Writer_WriteFloat(struct lluna_Core_Writer* Handle, float Value)
+{
+        char* Output = lluna_Core_Writer_Reserve(Handle, MaxFloatLength);
+
+        // Six significant digits are exact for most values. Nine always round trip.
+        int32 Length = 0;
+        for (int32 Precision = 6; Precision <= 9; ++Precision)
+        {
+                Length = snprintf(Output, MaxFloatLength, "%.*g", Precision, Value);
+
+                float Parsed;
+                struct lluna_Core_Types_Text Text = { Output, (uint64)Length };
+                if (Value != Value || (lluna_Core_Parse_Float(Text, &Parsed) == (uint64)Length && Parsed == Value))
+                {
+                        break;
+                }
+        }
+
+        Handle->Offset += Length;
+}
+
+void lluna_Core_Writer_Format(struct lluna_Core_Writer* Handle, struct lluna_Core_Types_Text Format, ...)
+{
+        va_list Args;
+
+        va_start(Args, Format);
+        lluna_Core_Writer_FormatList(Handle, Format, Args);
+        va_end(Args);
+}
+
+void lluna_Core_Writer_FormatList(struct lluna_Core_Writer* Handle, struct lluna_Core_Types_Text Format, va_list Args)
+{
+        va_list Retry;
+        va_copy(Retry, Args);
+
+        // Format into the free space first and only make room when the output didn't fit, counting the null terminator vsnprintf writes.
+        uint64 Available = Handle->Capacity - Handle->Offset;
+        int32 Length = vsnprintf((char*)Handle->Data + Handle->Offset, Available, Format.Data, Args);
+        if (Length >= 0 && (uint64)Length >= Available)
+        {
+                char* Output = lluna_Core_Writer_Reserve(Handle, (uint64)Length + 1);
+                vsnprintf(Output, (uint64)Length + 1, Format.Data, Retry);
+        }
+        va_end(Retry);
+
+        if (Length > 0)
+        {
+                Handle->Offset += Length;
+        }
+}
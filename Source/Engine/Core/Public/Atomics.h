@@ -0,0 +1,416 @@
+#pragma once
+
+/**
+ * @file Atomics.h
+ * @brief Atomic operations, memory ordering and spin hints.
+ *
+ * The engine builds as C99, which lacks `<stdatomic.h>`, so atomic accesses go through the typed functions of this
+ * header instead. They map directly to the GCC and Clang `__atomic` builtins and compile to the same instructions.
+ * Any plain `uint32`, `uint64` or `int64` can be accessed atomically as long as it is naturally aligned, and every
+ * concurrent access to it has to go through these functions.
+ *
+ * Each operation takes an explicit memory order from lluna_Core_Atomics_Relaxed to
+ * lluna_Core_Atomics_SequentiallyConsistent. Orders should be constants, so the functions inline to a single
+ * instruction.
+ *
+ * Pointer operations are macros, so they work on pointers to any type and keep it.
+ *
+ * lluna_Core_Atomics_Pause and lluna_Core_Atomics_Yield are hints for threads spinning on a value.
+ */
+
+#include <Engine/Core/Public/Types.h>
+
+#include <sched.h>
+
+/**
+ * @brief No ordering, only atomicity.
+ */
+#define lluna_Core_Atomics_Relaxed __ATOMIC_RELAXED
+/**
+ * @brief Later accesses can't move before the operation. Pairs with a release of the same value.
+ */
+#define lluna_Core_Atomics_Acquire __ATOMIC_ACQUIRE
+/**
+ * @brief Earlier accesses can't move after the operation. Pairs with an acquire of the same value.
+ */
+#define lluna_Core_Atomics_Release __ATOMIC_RELEASE
+/**
+ * @brief Both acquire and release, for read-modify-write operations.
+ */
+#define lluna_Core_Atomics_AcquireRelease __ATOMIC_ACQ_REL
+/**
+ * @brief Acquire and release, and all sequentially consistent operations appear in a single total order.
+ */
+#define lluna_Core_Atomics_SequentiallyConsistent __ATOMIC_SEQ_CST
+
+/**
+ * @brief Atomically loads a 32-bit unsigned integer.
+ *
+ * @param Address Value to load.
+ * @param Order Memory order, not a release.
+ * @return Loaded value.
+ */
+static inline uint32 lluna_Core_Atomics_LoadUint32(const uint32* Address, int32 Order)
+{
+        return __atomic_load_n(Address, Order);
+}
+
+/**
+ * @brief Atomically stores a 32-bit unsigned integer.
+ *
+ * @param Address Value to store to.
+ * @param Value Value to store.
+ * @param Order Memory order, not an acquire.
+ */
+static inline void lluna_Core_Atomics_StoreUint32(uint32* Address, uint32 Value, int32 Order)
+{
+        __atomic_store_n(Address, Value, Order);
+}
+
+/**
+ * @brief Atomically replaces a 32-bit unsigned integer.
+ *
+ * @param Address Value to replace.
+ * @param Value New value.
+ * @param Order Memory order.
+ * @return Previous value.
+ */
+static inline uint32 lluna_Core_Atomics_ExchangeUint32(uint32* Address, uint32 Value, int32 Order)
+{
+        return __atomic_exchange_n(Address, Value, Order);
+}
+
+/**
+ * @brief Atomically replaces a 32-bit unsigned integer if it holds the expected value.
+ *
+ * Weak exchanges can fail spuriously, which is cheaper on some architectures when retrying in a loop anyway.
+ *
+ * @param Address Value to replace.
+ * @param Expected Value expected, set to the current value on failure.
+ * @param Desired New value.
+ * @param Weak True to allow spurious failures.
+ * @param Success Memory order if replaced.
+ * @param Failure Memory order if not replaced, no stronger than Success and not a release.
+ * @return True if the value was replaced.
+ */
+static inline boolean lluna_Core_Atomics_CompareExchangeUint32(uint32* Address, uint32* Expected, uint32 Desired, boolean Weak, int32 Success, int32 Failure)
+{
+        return __atomic_compare_exchange_n(Address, Expected, Desired, Weak, Success, Failure);
+}
+
+/**
+ * @brief Atomically adds to a 32-bit unsigned integer.
+ *
+ * @param Address Value to add to.
+ * @param Value Value to add.
+ * @param Order Memory order.
+ * @return Previous value.
+ */
+static inline uint32 lluna_Core_Atomics_FetchAddUint32(uint32* Address, uint32 Value, int32 Order)
+{
+        return __atomic_fetch_add(Address, Value, Order);
+}
+
+/**
+ * @brief Atomically subtracts from a 32-bit unsigned integer.
+ *
+ * @param Address Value to subtract from.
+ * @param Value Value to subtract.
+ * @param Order Memory order.
+ * @return Previous value.
+ */
+static inline uint32 lluna_Core_Atomics_FetchSubUint32(uint32* Address, uint32 Value, int32 Order)
+{
+        return __atomic_fetch_sub(Address, Value, Order);
+}
+
+/**
+ * @brief Atomically ands bits into a 32-bit unsigned integer.
+ *
+ * @param Address Value to and into.
+ * @param Value Bits to and.
+ * @param Order Memory order.
+ * @return Previous value.
+ */
+static inline uint32 lluna_Core_Atomics_FetchAndUint32(uint32* Address, uint32 Value, int32 Order)
+{
+        return __atomic_fetch_and(Address, Value, Order);
+}
+
+/**
+ * @brief Atomically ors bits into a 32-bit unsigned integer.
+ *
+ * @param Address Value to or into.
+ * @param Value Bits to or.
+ * @param Order Memory order.
+ * @return Previous value.
+ */
+static inline uint32 lluna_Core_Atomics_FetchOrUint32(uint32* Address, uint32 Value, int32 Order)
+{
+        return __atomic_fetch_or(Address, Value, Order);
+}
+
+/**
+ * @brief Atomically loads a 64-bit unsigned integer.
+ *
+ * @param Address Value to load.
+ * @param Order Memory order, not a release.
+ * @return Loaded value.
+ */
+static inline uint64 lluna_Core_Atomics_LoadUint64(const uint64* Address, int32 Order)
+{
+        return __atomic_load_n(Address, Order);
+}
+
+/**
+ * @brief Atomically stores a 64-bit unsigned integer.
+ *
+ * @param Address Value to store to.
+ * @param Value Value to store.
+ * @param Order Memory order, not an acquire.
+ */
+static inline void lluna_Core_Atomics_StoreUint64(uint64* Address, uint64 Value, int32 Order)
+{
+        __atomic_store_n(Address, Value, Order);
+}
+
+/**
+ * @brief Atomically replaces a 64-bit unsigned integer.
+ *
+ * @param Address Value to replace.
+ * @param Value New value.
+ * @param Order Memory order.
+ * @return Previous value.
+ */
+static inline uint64 lluna_Core_Atomics_ExchangeUint64(uint64* Address, uint64 Value, int32 Order)
+{
+        return __atomic_exchange_n(Address, Value, Order);
+}
+
+/**
+ * @brief Atomically replaces a 64-bit unsigned integer if it holds the expected value.
+ *
+ * Weak exchanges can fail spuriously, which is cheaper on some architectures when retrying in a loop anyway.
+ *
+ * @param Address Value to replace.
+ * @param Expected Value expected, set to the current value on failure.
+ * @param Desired New value.
+ * @param Weak True to allow spurious failures.
+ * @param Success Memory order if replaced.
+ * @param Failure Memory order if not replaced, no stronger than Success and not a release.
+ * @return True if the value was replaced.
+ */
+static inline boolean lluna_Core_Atomics_CompareExchangeUint64(uint64* Address, uint64* Expected, uint64 Desired, boolean Weak, int32 Success, int32 Failure)
+{
+        return __atomic_compare_exchange_n(Address, Expected, Desired, Weak, Success, Failure);
+}
+
+/**
+ * @brief Atomically adds to a 64-bit unsigned integer.
+ *
+ * @param Address Value to add to.
+ * @param Value Value to add.
+ * @param Order Memory order.
+ * @return Previous value.
+ */
+static inline uint64 lluna_Core_Atomics_FetchAddUint64(uint64* Address, uint64 Value, int32 Order)
+{
+        return __atomic_fetch_add(Address, Value, Order);
+}
+
+/**
+ * @brief Atomically subtracts from a 64-bit unsigned integer.
+ *
+ * @param Address Value to subtract from.
+ * @param Value Value to subtract.
+ * @param Order Memory order.
+ * @return Previous value.
+ */
+static inline uint64 lluna_Core_Atomics_FetchSubUint64(uint64* Address, uint64 Value, int32 Order)
+{
+        return __atomic_fetch_sub(Address, Value, Order);
+}
+
+/**
+ * @brief Atomically ands bits into a 64-bit unsigned integer.
+ *
+ * @param Address Value to and into.
+ * @param Value Bits to and.
+ * @param Order Memory order.
+ * @return Previous value.
+ */
+static inline uint64 lluna_Core_Atomics_FetchAndUint64(uint64* Address, uint64 Value, int32 Order)
+{
+        return __atomic_fetch_and(Address, Value, Order);
+}
+
+/**
+ * @brief Atomically ors bits into a 64-bit unsigned integer.
+ *
+ * @param Address Value to or into.
+ * @param Value Bits to or.
+ * @param Order Memory order.
+ * @return Previous value.
+ */
+static inline uint64 lluna_Core_Atomics_FetchOrUint64(uint64* Address, uint64 Value, int32 Order)
+{
+        return __atomic_fetch_or(Address, Value, Order);
+}
+
+/**
+ * @brief Atomically loads a 64-bit signed integer.
+ *
+ * @param Address Value to load.
+ * @param Order Memory order, not a release.
+ * @return Loaded value.
+ */
+static inline int64 lluna_Core_Atomics_LoadInt64(const int64* Address, int32 Order)
+{
+        return __atomic_load_n(Address, Order);
+}
+
+/**
+ * @brief Atomically stores a 64-bit signed integer.
+ *
+ * @param Address Value to store to.
+ * @param Value Value to store.
+ * @param Order Memory order, not an acquire.
+ */
+static inline void lluna_Core_Atomics_StoreInt64(int64* Address, int64 Value, int32 Order)
+{
+        __atomic_store_n(Address, Value, Order);
+}
+
+/**
+ * @brief Atomically replaces a 64-bit signed integer.
+ *
+ * @param Address Value to replace.
+ * @param Value New value.
+ * @param Order Memory order.
+ * @return Previous value.
+ */
+static inline int64 lluna_Core_Atomics_ExchangeInt64(int64* Address, int64 Value, int32 Order)
+{
+        return __atomic_exchange_n(Address, Value, Order);
+}
+
+/**
+ * @brief Atomically replaces a 64-bit signed integer if it holds the expected value.
+ *
+ * Weak exchanges can fail spuriously, which is cheaper on some architectures when retrying in a loop anyway.
+ *
+ * @param Address Value to replace.
+ * @param Expected Value expected, set to the current value on failure.
+ * @param Desired New value.
+ * @param Weak True to allow spurious failures.
+ * @param Success Memory order if replaced.
+ * @param Failure Memory order if not replaced, no stronger than Success and not a release.
+ * @return True if the value was replaced.
+ */
+static inline boolean lluna_Core_Atomics_CompareExchangeInt64(int64* Address, int64* Expected, int64 Desired, boolean Weak, int32 Success, int32 Failure)
+{
+        return __atomic_compare_exchange_n(Address, Expected, Desired, Weak, Success, Failure);
+}
+
+/**
+ * @brief Atomically adds to a 64-bit signed integer.
+ *
+ * @param Address Value to add to.
+ * @param Value Value to add.
+ * @param Order Memory order.
+ * @return Previous value.
+ */
+static inline int64 lluna_Core_Atomics_FetchAddInt64(int64* Address, int64 Value, int32 Order)
+{
+        return __atomic_fetch_add(Address, Value, Order);
+}
+
+/**
+ * @brief Atomically subtracts from a 64-bit signed integer.
+ *
+ * @param Address Value to subtract from.
+ * @param Value Value to subtract.
+ * @param Order Memory order.
+ * @return Previous value.
+ */
+static inline int64 lluna_Core_Atomics_FetchSubInt64(int64* Address, int64 Value, int32 Order)
+{
+        return __atomic_fetch_sub(Address, Value, Order);
+}
+
+/**
+ * @brief Atomically loads a pointer.
+ *
+ * @param Address Pointer to load.
+ * @param Order Memory order, not a release.
+ * @return Loaded pointer, of the type pointed to by Address.
+ */
+#define lluna_Core_Atomics_LoadPointer(Address, Order) __atomic_load_n((Address), (Order))
+/**
+ * @brief Atomically stores a pointer.
+ *
+ * @param Address Pointer to store to.
+ * @param Value Pointer to store.
+ * @param Order Memory order, not an acquire.
+ */
+#define lluna_Core_Atomics_StorePointer(Address, Value, Order) __atomic_store_n((Address), (Value), (Order))
+/**
+ * @brief Atomically replaces a pointer.
+ *
+ * @param Address Pointer to replace.
+ * @param Value New pointer.
+ * @param Order Memory order.
+ * @return Previous pointer.
+ */
+#define lluna_Core_Atomics_ExchangePointer(Address, Value, Order) __atomic_exchange_n((Address), (Value), (Order))
+/**
+ * @brief Atomically replaces a pointer if it holds the expected one.
+ *
+ * @param Address Pointer to replace.
+ * @param Expected Pointer to the expected pointer, set to the current pointer on failure.
+ * @param Desired New pointer.
+ * @param Weak True to allow spurious failures.
+ * @param Success Memory order if replaced.
+ * @param Failure Memory order if not replaced, no stronger than Success and not a release.
+ * @return True if the pointer was replaced.
+ */
+#define lluna_Core_Atomics_CompareExchangePointer(Address, Expected, Desired, Weak, Success, Failure) \
+        __atomic_compare_exchange_n((Address), (Expected), (Desired), (Weak), (Success), (Failure))
+
+/**
+ * @brief Orders memory accesses around the fence without accessing memory.
+ *
+ * An acquire fence after a relaxed load acts as an acquire load, a release fence before a relaxed store acts as a
+ * release store.
+ *
+ * @param Order Memory order.
+ */
+static inline void lluna_Core_Atomics_Fence(int32 Order)
+{
+        __atomic_thread_fence(Order);
+}
+
+/**
+ * @brief Tells the core the thread is spinning.
+ *
+ * Saves power and frees resources for the other hardware thread of the core. Should be called in every round of a
+ * spin loop.
+ */
+static inline void lluna_Core_Atomics_Pause()
+{
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        __asm__ __volatile__("yield");
+#endif
+}
+
+/**
+ * @brief Gives the rest of the time slice of the thread to other threads.
+ *
+ * For spin loops that have paused for a while without progress, so the thread they wait for can run.
+ */
+static inline void lluna_Core_Atomics_Yield()
+{
+        sched_yield();
+}
@@ -0,0 +1,172 @@
+#pragma once
+
+/**
+ * @file Cpu.h
+ * @brief Processor feature detection and kernel dispatch.
+ *
+ * Features are detected once, on first use, with `cpuid` and `xgetbv` on x86, so AVX and AVX-512 are only reported
+ * when the operating system also saves their registers. AArch64 always reports NEON.
+ *
+ * Kernels specialized for several instruction sets are picked with lluna_Core_Cpu_Dispatch from a table ordered from
+ * most to least demanding, and callers keep the resolved function pointer rather than dispatching on every call.
+ *
+ * Setting the `LLUNA_CPU_LEVEL` environment variable to `scalar`, `x86-64`, `x86-64-v2`, `x86-64-v3` or `x86-64-v4`
+ * hides every feature above that level, which is useful to benchmark and test the slower paths on a fast machine.
+ * The override can only hide features, never report ones the processor lacks. `scalar` also hides NEON.
+ */
+
+#include <Engine/Core/Public/Types.h>
+
+/**
+ * @brief SSE2 instructions.
+ */
+#define lluna_Core_Cpu_Sse2 (1ULL << 0)
+/**
+ * @brief SSE3 instructions.
+ */
+#define lluna_Core_Cpu_Sse3 (1ULL << 1)
+/**
+ * @brief Supplemental SSE3 instructions.
+ */
+#define lluna_Core_Cpu_Ssse3 (1ULL << 2)
+/**
+ * @brief SSE4.1 instructions.
+ */
+#define lluna_Core_Cpu_Sse41 (1ULL << 3)
+/**
+ * @brief SSE4.2 instructions, including `crc32`.
+ */
+#define lluna_Core_Cpu_Sse42 (1ULL << 4)
+/**
+ * @brief `popcnt` instruction.
+ */
+#define lluna_Core_Cpu_Popcnt (1ULL << 5)
+/**
+ * @brief AVX instructions.
+ */
+#define lluna_Core_Cpu_Avx (1ULL << 6)
+/**
+ * @brief AVX2 instructions.
+ */
+#define lluna_Core_Cpu_Avx2 (1ULL << 7)
+/**
+ * @brief Fused multiply-add instructions.
+ */
+#define lluna_Core_Cpu_Fma (1ULL << 8)
+/**
+ * @brief First bit manipulation instruction set.
+ */
+#define lluna_Core_Cpu_Bmi1 (1ULL << 9)
+/**
+ * @brief Second bit manipulation instruction set.
+ */
+#define lluna_Core_Cpu_Bmi2 (1ULL << 10)
+/**
+ * @brief `lzcnt` instruction.
+ */
+#define lluna_Core_Cpu_Lzcnt (1ULL << 11)
+/**
+ * @brief `movbe` instruction.
+ */
+#define lluna_Core_Cpu_Movbe (1ULL << 12)
+/**
+ * @brief AVX-512 foundation instructions.
+ */
+#define lluna_Core_Cpu_Avx512F (1ULL << 13)
+/**
+ * @brief AVX-512 byte and word instructions.
+ */
+#define lluna_Core_Cpu_Avx512Bw (1ULL << 14)
+/**
+ * @brief AVX-512 conflict detection instructions.
+ */
+#define lluna_Core_Cpu_Avx512Cd (1ULL << 15)
+/**
+ * @brief AVX-512 doubleword and quadword instructions.
+ */
+#define lluna_Core_Cpu_Avx512Dq (1ULL << 16)
+/**
+ * @brief AVX-512 vector length extensions.
+ */
+#define lluna_Core_Cpu_Avx512Vl (1ULL << 17)
+/**
+ * @brief AArch64 Advanced SIMD instructions.
+ */
+#define lluna_Core_Cpu_Neon (1ULL << 18)
+
+/**
+ * @brief No SIMD features.
+ */
+#define lluna_Core_Cpu_LevelScalar 0
+/**
+ * @brief x86-64 baseline, SSE2.
+ */
+#define lluna_Core_Cpu_LevelX86_64 1
+/**
+ * @brief x86-64-v2, adding up to SSE4.2 and `popcnt`.
+ */
+#define lluna_Core_Cpu_LevelX86_64V2 2
+/**
+ * @brief x86-64-v3, adding AVX2, FMA and the bit manipulation instructions.
+ */
+#define lluna_Core_Cpu_LevelX86_64V3 3
+/**
+ * @brief x86-64-v4, adding the common AVX-512 subsets.
+ */
+#define lluna_Core_Cpu_LevelX86_64V4 4
+
+/**
+ * @brief Describes the processor running the program.
+ *
+ * Should not be written to externally.
+ *
+ * @see lluna_Core_Cpu_GetInfo
+ */
+struct lluna_Core_Cpu_Info
+{
+        uint64 Features; /**< Usable features, after the `LLUNA_CPU_LEVEL` override. */
+        uint64 DetectedFeatures; /**< Features supported by the processor and operating system. */
+        uint32 Level; /**< Highest x86-64 level whose features are all usable. */
+        char Vendor[13]; /**< Null terminated vendor identifier, empty if unknown. */
+        char Brand[49]; /**< Null terminated brand string, empty if unknown. */
+};
+
+/**
+ * @brief Generic function pointer type stored in dispatch tables.
+ *
+ * Kernels are cast to it when building a table and the result of lluna_Core_Cpu_Dispatch is cast back.
+ */
+typedef void (*lluna_Core_Cpu_Function)(void);
+
+/**
+ * @brief Describes one implementation of a kernel in a dispatch table.
+ */
+struct lluna_Core_Cpu_Kernel
+{
+        uint64 Features; /**< Features the implementation needs, 0 for a portable fallback. */
+        lluna_Core_Cpu_Function Function; /**< Implementation. */
+};
+
+/**
+ * @brief Gets a description of the processor.
+ *
+ * Detects the processor on the first call. Safe to call from any thread.
+ *
+ * @return Processor description, valid for the lifetime of the program.
+ */
+const struct lluna_Core_Cpu_Info* lluna_Core_Cpu_GetInfo();
+/**
+ * @brief Checks whether features are usable.
+ *
+ * @param Features Bitwise or of features.
+ * @return True if every feature in `Features` is usable.
+ */
+boolean lluna_Core_Cpu_Supports(uint64 Features);
+/**
+ * @brief Picks the first usable implementation from a dispatch table.
+ *
+ * @param Kernels Implementations, from most to least demanding. The last one should need no features.
+ * @param Count Number of implementations.
+ * @return First implementation whose features are all usable, NULL if there is none.
+ */
+lluna_Core_Cpu_Function lluna_Core_Cpu_Dispatch(const struct lluna_Core_Cpu_Kernel* Kernels, uint32 Count);
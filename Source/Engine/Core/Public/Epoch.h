@@ -0,0 +1,130 @@
+#pragma once
+
+/**
+ * @file Epoch.h
+ * @brief Epoch based reclamation of memory shared with lock-free readers.
+ *
+ * lluna_Core_Epoch lets writers free memory that threads reading without locks may still be using. Readers mark the
+ * sections in which they hold pointers to shared memory with lluna_Core_Epoch_Enter and lluna_Core_Epoch_Leave,
+ * which only store to memory owned by the reading thread. Writers unlink memory from the shared structures first, then
+ * retire it instead of freeing it, and retired memory is freed once every reader that could have seen it has left
+ * its section.
+ *
+ * The epoch advances when every reader inside a section entered it during the current epoch, and memory retired in an
+ * epoch is freed two epochs later. Readers staying long in a section hold back every retirement, so sections should
+ * be short, like a single lookup or walk.
+ *
+ * Each reading thread registers a lluna_Core_Epoch_Participant, usually kept with the rest of its thread state.
+ * Writers share a lock and don't have to be registered.
+ */
+
+#include <Engine/Core/Public/Sync.h>
+#include <Engine/Core/Public/Types.h>
+
+struct lluna_Core_Epoch_Retired;
+
+/**
+ * @brief Function freeing retired memory.
+ *
+ * @param Pointer Retired memory.
+ */
+typedef void (*lluna_Core_Epoch_FreeFunction)(void* Pointer);
+
+/**
+ * @brief Describes an epoch domain.
+ *
+ * Should not be written to externally.
+ */
+struct lluna_Core_Epoch
+{
+        uint64 Global; /**< Current epoch. */
+
+        struct lluna_Core_Sync_Mutex Lock; /**< Held by writers retiring and reclaiming memory. */
+        struct lluna_Core_Epoch_Participant* Participants; /**< Registered readers. */
+        struct lluna_Core_Epoch_Retired* Retired; /**< Memory waiting to be freed, most recently retired first. */
+};
+
+/**
+ * @brief Describes a reader of an epoch domain.
+ *
+ * Participants are owned by a single thread. Should not be written to externally.
+ */
+struct lluna_Core_Epoch_Participant
+{
+        struct lluna_Core_Epoch* Epoch; /**< Domain the participant is registered to. */
+
+        uint64 Local; /**< Epoch the section was entered in shifted left by one and ored with one, or 0 outside of sections. */
+        uint32 Depth; /**< Number of nested sections. */
+
+        struct lluna_Core_Epoch_Participant* Next; /**< Next registered participant. */
+};
+
+/**
+ * @brief Creates an epoch domain and returns a handle to it.
+ *
+ * Created domains have to be manually destroyed.
+ *
+ * @return Handle to the created domain.
+ *
+ * @see lluna_Core_Epoch_Destroy
+ */
+struct lluna_Core_Epoch* lluna_Core_Epoch_Create();
+/**
+ * @brief Frees all retired memory and destroys the given domain.
+ *
+ * No reader may be inside a section. Participants don't have to be unregistered first.
+ *
+ * @param Handle Domain to destroy.
+ */
+void lluna_Core_Epoch_Destroy(struct lluna_Core_Epoch* Handle);
+
+/**
+ * @brief Registers a reader.
+ *
+ * @param Handle Domain to register to.
+ * @param Participant Participant to register. Must stay alive until unregistered.
+ */
+void lluna_Core_Epoch_Register(struct lluna_Core_Epoch* Handle, struct lluna_Core_Epoch_Participant* Participant);
+/**
+ * @brief Unregisters a reader.
+ *
+ * @param Participant Participant to unregister. Must be outside of any section.
+ */
+void lluna_Core_Epoch_Unregister(struct lluna_Core_Epoch_Participant* Participant);
+
+/**
+ * @brief Enters a read section.
+ *
+ * Memory reached from shared structures inside the section stays valid until the section is left. Sections can be
+ * nested, only the outermost one counts. Never locks and never writes shared memory.
+ *
+ * @param Participant Participant of the calling thread.
+ */
+void lluna_Core_Epoch_Enter(struct lluna_Core_Epoch_Participant* Participant);
+/**
+ * @brief Leaves a read section.
+ *
+ * @param Participant Participant of the calling thread.
+ */
+void lluna_Core_Epoch_Leave(struct lluna_Core_Epoch_Participant* Participant);
+
+/**
+ * @brief Frees memory once no reader can be using it anymore.
+ *
+ * The memory must already be unreachable from the shared structures. It is freed by a later
+ * lluna_Core_Epoch_Reclaim, or when the domain is destroyed.
+ *
+ * @param Handle Domain of the readers.
+ * @param Pointer Memory to free.
+ * @param Free Function freeing the memory.
+ */
+void lluna_Core_Epoch_Retire(struct lluna_Core_Epoch* Handle, void* Pointer, lluna_Core_Epoch_FreeFunction Free);
+/**
+ * @brief Advances the epoch if possible and frees the retired memory no reader can be using anymore.
+ *
+ * Writers should call this regularly, like once per frame.
+ *
+ * @param Handle Domain to reclaim memory of.
+ * @return Number of retirements freed.
+ */
+uint64 lluna_Core_Epoch_Reclaim(struct lluna_Core_Epoch* Handle);
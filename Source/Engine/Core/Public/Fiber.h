@@ -0,0 +1,122 @@
+#pragma once
+
+/**
+ * @file Fiber.h
+ * @brief Stackful fibers.
+ *
+ * Fibers are functions running on their own stack that can suspend themselves with lluna_Core_Fiber_Yield and be
+ * continued later with lluna_Core_Fiber_Resume, so long running logic can be written sequentially without tying up a
+ * thread. Switching between fibers only saves and restores the callee-saved registers, which is done in hand-written
+ * assembly on x86-64 and AArch64. Other platforms fall back to `ucontext`, which is much slower.
+ *
+ * Stacks come from a lluna_Core_Fiber_Pool and are reused once their fiber is destroyed. Every stack has a
+ * guard page below it, so an overflow faults instead of silently corrupting memory.
+ *
+ * A suspended fiber can be resumed from any thread, but only by one thread at a time. Compilers assume a function stays
+ * on one thread, so fibers that move should not keep thread locals or results of functions like `pthread_self` across
+ * a yield.
+ *
+ * @see lluna_Core_Fiber_Create
+ */
+
+#include <Engine/Core/Public/Sync.h>
+#include <Engine/Core/Public/Types.h>
+
+/**
+ * @brief Default size in bytes of fiber stacks, not counting the guard page.
+ */
+#define lluna_Core_Fiber_DefaultStackSize (256 * 1024)
+
+/**
+ * @brief Function run by a fiber.
+ *
+ * @param Data User data of the fiber.
+ */
+typedef void (*lluna_Core_Fiber_Function)(void* Data);
+
+struct lluna_Core_Fiber;
+struct lluna_Core_Fiber_Stack;
+
+/**
+ * @brief Describes a pool of fiber stacks.
+ *
+ * Should not be written to externally.
+ *
+ * @see lluna_Core_Fiber_CreatePool
+ */
+struct lluna_Core_Fiber_Pool
+{
+        uint64 StackSize; /**< Size in bytes of each stack above its guard page, a multiple of the page size. */
+        uint64 PageSize; /**< Size in bytes of the guard page. */
+
+        struct lluna_Core_Sync_Mutex Lock; /**< Guards the free stacks. */
+        struct lluna_Core_Fiber_Stack* Free; /**< Stacks of destroyed fibers, ready for reuse. */
+        uint64 FreeCount; /**< Number of free stacks. */
+};
+
+/**
+ * @brief Creates a pool of fiber stacks and returns a handle to it.
+ *
+ * @param StackSize Minimum usable size in bytes of each stack, or 0 for lluna_Core_Fiber_DefaultStackSize.
+ * @return Handle to the created pool, NULL if it could not be allocated.
+ *
+ * @see lluna_Core_Fiber_DestroyPool
+ */
+struct lluna_Core_Fiber_Pool* lluna_Core_Fiber_CreatePool(uint64 StackSize);
+/**
+ * @brief Releases every stack of a pool and destroys it.
+ *
+ * All fibers created from the pool have to be destroyed.
+ *
+ * @param Pool Pool to destroy.
+ */
+void lluna_Core_Fiber_DestroyPool(struct lluna_Core_Fiber_Pool* Pool);
+
+/**
+ * @brief Creates a fiber that will run a function once resumed.
+ *
+ * The fiber is stored at the top of its own stack, so creating a fiber reusing a free stack doesn't allocate.
+ * Safe to call from any thread.
+ *
+ * @param Pool Pool to take the stack from.
+ * @param Function Function to run.
+ * @param Data User data passed to the function.
+ * @return Handle to the created fiber, NULL if a new stack could not be mapped.
+ *
+ * @see lluna_Core_Fiber_Destroy
+ */
+struct lluna_Core_Fiber* lluna_Core_Fiber_Create(struct lluna_Core_Fiber_Pool* Pool, lluna_Core_Fiber_Function Function, void* Data);
+/**
+ * @brief Destroys a fiber and returns its stack to its pool.
+ *
+ * The fiber must not be running. Destroying a suspended fiber discards its stack without unwinding it.
+ *
+ * @param Fiber Fiber to destroy.
+ */
+void lluna_Core_Fiber_Destroy(struct lluna_Core_Fiber* Fiber);
+
+/**
+ * @brief Switches to a fiber until it yields or its function returns.
+ *
+ * @param Fiber Fiber to run. Must not be running or finished.
+ */
+void lluna_Core_Fiber_Resume(struct lluna_Core_Fiber* Fiber);
+/**
+ * @brief Suspends the calling fiber, switching back to the thread or fiber that resumed it.
+ *
+ * Must be called from a fiber. Returns once the fiber is resumed again, possibly on another thread.
+ */
+void lluna_Core_Fiber_Yield();
+/**
+ * @brief Returns the fiber running on the calling thread.
+ *
+ * @return Running fiber, NULL if the thread is running on its own stack.
+ */
+struct lluna_Core_Fiber* lluna_Core_Fiber_Current();
+/**
+ * @brief Returns true if the function of a fiber has returned.
+ *
+ * @param Fiber Fiber to check.
+ * @return Whether or not the fiber finished.
+ */
+boolean lluna_Core_Fiber_Finished(struct lluna_Core_Fiber* Fiber);
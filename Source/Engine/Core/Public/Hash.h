@@ -0,0 +1,105 @@
+#pragma once
+
+/**
+ * @file Hash.h
+ * @brief Non-cryptographic hashing and checksums.
+ *
+ * 64-bit hashes follow the XXH3 algorithm and match the reference `XXH3_64bits_withSeed` output bit for bit.
+ * Inputs longer than 240 bytes are processed in 64 byte stripes using SSE2 or AVX2 when available.
+ *
+ * CRC32C (Castagnoli) checksums use the SSE4.2 `crc32` instruction when available and a sliced lookup table otherwise.
+ *
+ * Functions taking texts don't hash a trailing null terminator, as counted by lluna_Macros_Text.
+ * Hashes assume a little endian host.
+ *
+ * @see lluna_Macros_TextLength
+ */
+
+#include <Engine/Core/Public/Types.h>
+
+/**
+ * @brief Size in bytes of the internal buffer of lluna_Core_Hash_State.
+ */
+#define lluna_Core_Hash_BufferSize 256
+
+/**
+ * @brief Size in bytes of the secret used by long inputs.
+ */
+#define lluna_Core_Hash_SecretSize 192
+
+/**
+ * @brief Incremental hashing state.
+ *
+ * Produces the same hash as hashing the concatenation of all updates in one go.
+ * Can be copied to fork a hash of a common prefix.
+ * Should not be written to externally.
+ *
+ * @see lluna_Core_Hash_Initialize
+ */
+struct lluna_Core_Hash_State
+{
+        uint64 Accumulators[8]; /**< Accumulator lanes. */
+        byte Secret[lluna_Core_Hash_SecretSize]; /**< Secret derived from the seed. */
+        byte Buffer[lluna_Core_Hash_BufferSize]; /**< Bytes not yet consumed. */
+        uint64 BufferedSize; /**< Number of bytes in the buffer. */
+        uint64 StripeCount; /**< Number of stripes consumed in the current block. */
+        uint64 TotalSize; /**< Total number of bytes hashed so far. */
+        uint64 Seed; /**< Seed of the hash. */
+};
+
+/**
+ * @brief Hashes a byte buffer.
+ *
+ * @param Data Bytes to hash.
+ * @param Size Number of bytes.
+ * @param Seed Seed of the hash. Different seeds produce unrelated hashes.
+ * @return 64-bit hash.
+ */
+uint64 lluna_Core_Hash_Bytes(const void* Data, uint64 Size, uint64 Seed);
+/**
+ * @brief Hashes a text.
+ *
+ * @param Text Text to hash.
+ * @param Seed Seed of the hash.
+ * @return 64-bit hash.
+ *
+ * @see lluna_Core_Hash_Bytes
+ */
+uint64 lluna_Core_Hash_Text(struct lluna_Core_Types_Text Text, uint64 Seed);
+/**
+ * @brief Initializes an incremental hashing state.
+ *
+ * Can also be used to reset a state.
+ *
+ * @param State State to initialize.
+ * @param Seed Seed of the hash.
+ */
+void lluna_Core_Hash_Initialize(struct lluna_Core_Hash_State* State, uint64 Seed);
+/**
+ * @brief Feeds bytes to an incremental hashing state.
+ *
+ * @param State State to update.
+ * @param Data Bytes to hash.
+ * @param Size Number of bytes.
+ */
+void lluna_Core_Hash_Update(struct lluna_Core_Hash_State* State, const void* Data, uint64 Size);
+/**
+ * @brief Returns the hash of all bytes fed so far.
+ *
+ * Doesn't modify the state, so updates can continue afterwards.
+ *
+ * @param State State to read.
+ * @return 64-bit hash.
+ */
+uint64 lluna_Core_Hash_Digest(const struct lluna_Core_Hash_State* State);
+/**
+ * @brief Computes or continues a CRC32C checksum.
+ *
+ * Start with a checksum of 0 and pass the previous result to continue over more bytes.
+ *
+ * @param Checksum Checksum of the preceding bytes.
+ * @param Data Bytes to checksum.
+ * @param Size Number of bytes.
+ * @return Checksum including the given bytes.
+ */
+uint32 lluna_Core_Hash_Crc32c(uint32 Checksum, const void* Data, uint64 Size);
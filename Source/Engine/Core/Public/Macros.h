@@ -32,3 +32,14 @@
  * @param Text String literal.
  */
 #define lluna_Macros_Text(Text) ((struct lluna_Core_Types_Text){(Text), (uint64)sizeof(Text)})
+
+/**
+ * @brief Gets the length of a sized text, excluding the trailing null terminator if there is one.
+ *
+ * Texts created with lluna_Macros_Text count the null terminator in their size, while views into larger buffers do not.
+ *
+ * @param Text Sized text.
+ *
+ * @see lluna_Macros_Text
+ */
+#define lluna_Macros_TextLength(Text) ((Text).Size - ((Text).Size > 0 && (Text).Data[(Text).Size - 1] == '\0'))
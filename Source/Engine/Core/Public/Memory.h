@@ -0,0 +1,221 @@
+#pragma once
+
+/**
+ * @file Memory.h
+ * @brief Tagged allocations and per-tag memory statistics.
+ *
+ * Engine code allocates with the lluna_Core_Memory_Allocate, lluna_Core_Memory_Reallocate and lluna_Core_Memory_Free
+ * macros, passing a tag telling who owns the memory. They only track when `LLUNA_MEMORY_TRACKING` is defined, which the
+ * `ENABLE_MEMORY_TRACKING` CMake option does for the engine and everything linking it. Otherwise they expand to malloc,
+ * realloc and free and tracking costs nothing.
+ *
+ * Tracked allocations keep their size and tags in a 16 byte header, so freeing needs no lookup. Every tag counts its
+ * current and peak bytes, its allocations, reallocations and frees, and a histogram of allocation sizes with relaxed
+ * atomics, so the fast path takes no locks. Allocation rates come from the difference of the counts between two calls to
+ * lluna_Core_Memory_GetStats, usually a frame apart.
+ *
+ * Containers tag their memory by container type. Modules and subsystems register their own tags with
+ * lluna_Core_Memory_RegisterTag and make them the scope tag of a thread with lluna_Core_Memory_EnterScope. Allocations
+ * made in a scope count under both their own tag and the scope tag, so scope tags overlap the container tags.
+ *
+ * Memory allocated with tracking has to be freed with tracking and the other way around, so code sharing allocations
+ * has to agree on `LLUNA_MEMORY_TRACKING`.
+ *
+ * @see lluna_Core_Memory_Stats
+ */
+
+#include <Engine/Core/Public/Types.h>
+#include <Engine/Core/Public/Writer.h>
+
+#include <stdlib.h>
+
+/**
+ * @brief Maximum number of tags, built-in tags included.
+ */
+#define lluna_Core_Memory_MaxTags 64
+/**
+ * @brief Number of buckets of the allocation size histograms.
+ *
+ * Bucket 0 counts empty allocations and bucket N allocations of 2^(N-1) to 2^N - 1 bytes, the last bucket counting
+ * every larger allocation too.
+ */
+#define lluna_Core_Memory_HistogramSize 32
+
+/**
+ * @brief Tag of memory no one claimed, also meaning no scope tag.
+ */
+#define lluna_Core_Memory_Untagged 0
+/**
+ * @brief Tag of the memory of dynamic arrays.
+ */
+#define lluna_Core_Memory_DynamicArray 1
+/**
+ * @brief Tag of the memory of strings.
+ */
+#define lluna_Core_Memory_String 2
+/**
+ * @brief Tag of the memory of red-black trees.
+ */
+#define lluna_Core_Memory_RedBlackTree 3
+
+/**
+ * @brief Describes the statistics of a tag.
+ *
+ * Counters are read one at a time while other threads allocate, so they can be slightly out of step with each other.
+ *
+ * @see lluna_Core_Memory_GetStats
+ */
+struct lluna_Core_Memory_Stats
+{
+        const char* Module; /**< Module owning the tag. */
+        const char* Name; /**< Name of the tag. */
+
+        uint64 CurrentBytes; /**< Bytes currently allocated. */
+        uint64 PeakBytes; /**< Most bytes allocated at once since the last reset of the peak. */
+        uint64 TotalBytes; /**< Bytes allocated since the start, growth of reallocations included. */
+        uint64 Budget; /**< Most bytes the tag should hold at once, 0 if unlimited. */
+
+        uint64 Allocations; /**< Number of allocations. */
+        uint64 Reallocations; /**< Number of reallocations. */
+        uint64 Frees; /**< Number of frees. */
+
+        uint64 Histogram[lluna_Core_Memory_HistogramSize]; /**< Number of allocations and reallocations by size. */
+};
+
+#if defined(LLUNA_MEMORY_TRACKING)
+/**
+ * @brief Allocates memory owned by a tag.
+ *
+ * @param Size Size of the memory in bytes.
+ * @param Tag Tag owning the memory.
+ * @return Allocated memory, NULL on failure.
+ */
+#define lluna_Core_Memory_Allocate(Size, Tag) lluna_Core_Memory_TrackedAllocate((Size), (Tag))
+/**
+ * @brief Resizes memory allocated with lluna_Core_Memory_Allocate.
+ *
+ * The memory stays owned by the tags it was allocated with, the given tag is only used when allocating from NULL.
+ *
+ * @param Pointer Memory to resize, or NULL to allocate.
+ * @param Size New size of the memory in bytes.
+ * @param Tag Tag owning the memory.
+ * @return Resized memory, NULL on failure, leaving the memory unchanged.
+ */
+#define lluna_Core_Memory_Reallocate(Pointer, Size, Tag) lluna_Core_Memory_TrackedReallocate((Pointer), (Size), (Tag))
+/**
+ * @brief Frees memory allocated with lluna_Core_Memory_Allocate.
+ *
+ * @param Pointer Memory to free, or NULL.
+ */
+#define lluna_Core_Memory_Free(Pointer) lluna_Core_Memory_TrackedFree(Pointer)
+#else
+#define lluna_Core_Memory_Allocate(Size, Tag) malloc(Size)
+#define lluna_Core_Memory_Reallocate(Pointer, Size, Tag) realloc((Pointer), (Size))
+#define lluna_Core_Memory_Free(Pointer) free(Pointer)
+#endif
+
+/**
+ * @brief Allocates tracked memory owned by a tag.
+ *
+ * Called by lluna_Core_Memory_Allocate, which should be preferred so tracking compiles out.
+ *
+ * @param Size Size of the memory in bytes.
+ * @param Tag Tag owning the memory, counted as untagged if it was never registered.
+ * @return Allocated memory aligned like malloc, NULL on failure.
+ */
+void* lluna_Core_Memory_TrackedAllocate(uint64 Size, uint32 Tag);
+/**
+ * @brief Resizes tracked memory.
+ *
+ * Called by lluna_Core_Memory_Reallocate, which should be preferred so tracking compiles out.
+ *
+ * @param Pointer Memory to resize, or NULL to allocate.
+ * @param Size New size of the memory in bytes.
+ * @param Tag Tag owning the memory when allocating from NULL.
+ * @return Resized memory, NULL on failure, leaving the memory unchanged.
+ */
+void* lluna_Core_Memory_TrackedReallocate(void* Pointer, uint64 Size, uint32 Tag);
+/**
+ * @brief Frees tracked memory.
+ *
+ * Called by lluna_Core_Memory_Free, which should be preferred so tracking compiles out.
+ *
+ * @param Pointer Memory to free, or NULL.
+ */
+void lluna_Core_Memory_TrackedFree(void* Pointer);
+
+/**
+ * @brief Registers a tag and returns it.
+ *
+ * Registering a module and name twice returns the same tag. Names are kept by address, so they have to live as long as
+ * the tag, like string literals do.
+ *
+ * @param Module Module owning the tag.
+ * @param Name Name of the tag.
+ * @return Registered tag, lluna_Core_Memory_Untagged if lluna_Core_Memory_MaxTags tags are already registered.
+ */
+uint32 lluna_Core_Memory_RegisterTag(const char* Module, const char* Name);
+/**
+ * @brief Returns the number of registered tags, built-in tags included.
+ *
+ * Tags are numbered from 0 to this number minus one.
+ *
+ * @return Number of registered tags.
+ */
+uint32 lluna_Core_Memory_TagCount();
+
+/**
+ * @brief Makes a tag the scope tag of the calling thread.
+ *
+ * Until the scope is left, tracked allocations of the thread also count under the scope tag.
+ *
+ * @param Tag Scope tag, lluna_Core_Memory_Untagged for none.
+ * @return Previous scope tag, to pass to lluna_Core_Memory_LeaveScope.
+ */
+uint32 lluna_Core_Memory_EnterScope(uint32 Tag);
+/**
+ * @brief Restores the scope tag of the calling thread.
+ *
+ * @param Previous Scope tag returned by the matching lluna_Core_Memory_EnterScope.
+ */
+void lluna_Core_Memory_LeaveScope(uint32 Previous);
+
+/**
+ * @brief Sets the budget of a tag.
+ *
+ * Budgets are not enforced, tags over budget are reported by lluna_Core_Memory_OverBudget and lluna_Core_Memory_Report.
+ *
+ * @param Tag Tag to set the budget of.
+ * @param Budget Most bytes the tag should hold at once, 0 if unlimited.
+ */
+void lluna_Core_Memory_SetBudget(uint32 Tag, uint64 Budget);
+/**
+ * @brief Returns whether or not the peak of a tag went over its budget.
+ *
+ * @param Tag Tag to check.
+ * @return Whether or not the tag went over budget since the last reset of its peak.
+ */
+boolean lluna_Core_Memory_OverBudget(uint32 Tag);
+/**
+ * @brief Lowers the peak of a tag to its current bytes, to measure peaks over a frame or a level.
+ *
+ * @param Tag Tag to reset the peak of.
+ */
+void lluna_Core_Memory_ResetPeak(uint32 Tag);
+
+/**
+ * @brief Reads the statistics of a tag.
+ *
+ * @param Tag Tag to read.
+ * @param Stats Statistics to fill.
+ * @return Whether or not the tag is registered. Statistics of unregistered tags are left unchanged.
+ */
+boolean lluna_Core_Memory_GetStats(uint32 Tag, struct lluna_Core_Memory_Stats* Stats);
+/**
+ * @brief Writes a table of the statistics of every tag that allocated, followed by their size histograms.
+ *
+ * Tags over budget are marked.
+ *
+ * @param Output Writer to write to.
+ */
+void lluna_Core_Memory_Report(struct lluna_Core_Writer* Output);
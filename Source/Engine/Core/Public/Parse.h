@@ -0,0 +1,64 @@
+#pragma once
+
+/**
+ * @file Parse.h
+ * @brief Locale independent number parsing.
+ *
+ * Floats are parsed with the Eisel-Lemire algorithm, which is exact for up to 19 significant digits.
+ * Longer inputs that fall too close to a rounding boundary are settled by an exact big integer comparison, so results always match a correctly rounded `strtof`.
+ *
+ * Parsing functions read a number from the start of the given text, without skipping whitespace, and return the number of bytes consumed.
+ * A result of 0 means no number could be read, and the output value is left untouched.
+ * A trailing null terminator, as counted by lluna_Macros_Text, is not considered part of the text.
+ *
+ * @see lluna_Macros_TextLength
+ */
+
+#include <Engine/Container/Public/DynamicArray.h>
+#include <Engine/Core/Public/Types.h>
+
+/**
+ * @brief Parses a signed integer.
+ *
+ * Accepts an optional sign followed by decimal digits.
+ * Values that don't fit in 64 bits are rejected.
+ *
+ * @param Text Text to parse.
+ * @param Value Parsed value.
+ * @return Number of bytes consumed.
+ */
+uint64 lluna_Core_Parse_Int64(struct lluna_Core_Types_Text Text, int64* Value);
+/**
+ * @brief Parses an unsigned integer.
+ *
+ * Accepts an optional `+` sign followed by decimal digits.
+ * Values that don't fit in 64 bits are rejected.
+ *
+ * @param Text Text to parse.
+ * @param Value Parsed value.
+ * @return Number of bytes consumed.
+ */
+uint64 lluna_Core_Parse_Uint64(struct lluna_Core_Types_Text Text, uint64* Value);
+/**
+ * @brief Parses a float.
+ *
+ * Accepts an optional sign, digits with an optional `.` fraction and an optional `e` or `E` exponent, as well as `inf`, `infinity` and `nan` in any case.
+ * Out of range values become infinity or zero.
+ *
+ * @param Text Text to parse.
+ * @param Value Parsed value, correctly rounded to nearest even.
+ * @return Number of bytes consumed.
+ */
+uint64 lluna_Core_Parse_Float(struct lluna_Core_Types_Text Text, float* Value);
+/**
+ * @brief Parses a whitespace separated run of floats and appends them to the given array.
+ *
+ * Stops before the first token that isn't a float followed by whitespace or the end of the text.
+ *
+ * @param Text Text to parse.
+ * @param Output Dynamic array of `float` to append to.
+ * @return Number of bytes consumed, including whitespace.
+ *
+ * @see lluna_Core_Parse_Float
+ */
+uint64 lluna_Core_Parse_FloatArray(struct lluna_Core_Types_Text Text, struct lluna_Container_DynamicArray* Output);
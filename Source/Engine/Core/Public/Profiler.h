@@ -0,0 +1,225 @@
+#pragma once
+
+/**
+ * @file Profiler.h
+ * @brief Instrumentation zones, counters and frame markers.
+ *
+ * Code is instrumented with the lluna_Core_Profiler_Begin, lluna_Core_Profiler_End, lluna_Core_Profiler_Zone,
+ * lluna_Core_Profiler_Count and lluna_Core_Profiler_Frame macros. They only record when `LLUNA_PROFILING` is defined,
+ * which the `ENABLE_PROFILING` CMake option does for the engine and everything linking it. Otherwise they expand to
+ * nothing and instrumentation costs nothing.
+ *
+ * Every recording thread gets its own ring of events, so recording is a timestamp and a few stores without locks or
+ * atomic read-modify-writes. Timestamps come from the time stamp counter on x86 processors where it runs at a constant
+ * rate, and from the monotonic clock elsewhere. Rings are drained into a lluna_Core_Profiler_Capture with
+ * lluna_Core_Profiler_Collect, usually once per frame. Events recorded while a ring is full are dropped and counted.
+ *
+ * Captures are written as Chrome trace JSON, which chrome://tracing and Perfetto open directly, or in a compact binary
+ * format that can be read back with lluna_Core_Profiler_ReadBinary and converted offline.
+ *
+ * Names are kept by address and are never copied while recording, so they have to outlive the capture, like string
+ * literals do. A zone has to end on the thread it began on, so zones must not span a wait that can suspend a job.
+ *
+ * @see lluna_Core_Profiler_Capture
+ */
+
+#include <Engine/Core/Public/Types.h>
+#include <Engine/Core/Public/Writer.h>
+
+/**
+ * @brief Number of events each thread can record between two collections, a power of two.
+ */
+#define lluna_Core_Profiler_RingCapacity (64 * 1024)
+
+/**
+ * @brief Event type of the beginning of a zone.
+ */
+#define lluna_Core_Profiler_EventBegin 0
+/**
+ * @brief Event type of the end of a zone.
+ */
+#define lluna_Core_Profiler_EventEnd 1
+/**
+ * @brief Event type of a counter value.
+ */
+#define lluna_Core_Profiler_EventCounter 2
+/**
+ * @brief Event type of the end of a frame.
+ */
+#define lluna_Core_Profiler_EventFrame 3
+/**
+ * @brief Event type naming the recording thread.
+ */
+#define lluna_Core_Profiler_EventThreadName 4
+
+/**
+ * @brief Describes a recorded event.
+ */
+struct lluna_Core_Profiler_Event
+{
+        uint64 Timestamp; /**< Time of the event in ticks. */
+        const char* Name; /**< Name of the zone, counter or thread, NULL for ends of zones and frames. */
+        int64 Value; /**< Value of counters, 0 otherwise. */
+        uint32 Type; /**< Type of the event. */
+        uint32 Thread; /**< Index of the recording thread, in order of first recording. */
+};
+
+/**
+ * @brief Describes a capture of events collected from every thread.
+ *
+ * Events of each thread are in the order they were recorded, threads are interleaved by collection.
+ * Should not be written to externally.
+ *
+ * @see lluna_Core_Profiler_CreateCapture
+ */
+struct lluna_Core_Profiler_Capture
+{
+        struct lluna_Core_Profiler_Event* Events; /**< Collected events. */
+        uint64 Count; /**< Number of collected events. */
+        uint64 Capacity; /**< Number of events there is room for. */
+
+        uint64 Dropped; /**< Number of events dropped because a ring was full. */
+        double TicksPerSecond; /**< Rate of the timestamps. */
+
+        char* Names; /**< Names of events read from a binary capture. */
+};
+
+#if defined(LLUNA_PROFILING)
+/**
+ * @brief Begins a zone on the calling thread.
+ *
+ * @param Name Name of the zone.
+ */
+#define lluna_Core_Profiler_Begin(Name) lluna_Core_Profiler_Record(lluna_Core_Profiler_EventBegin, (Name), 0)
+/**
+ * @brief Ends the last zone begun on the calling thread.
+ */
+#define lluna_Core_Profiler_End() lluna_Core_Profiler_Record(lluna_Core_Profiler_EventEnd, NULL, 0)
+/**
+ * @brief Begins a zone ending with the enclosing scope.
+ *
+ * @param Name Name of the zone.
+ */
+#define lluna_Core_Profiler_Zone(Name) lluna_Core_Profiler_ZoneAt(Name, __LINE__)
+/**
+ * @brief Records the value of a counter.
+ *
+ * @param Name Name of the counter.
+ * @param Value Value of the counter.
+ */
+#define lluna_Core_Profiler_Count(Name, Value) lluna_Core_Profiler_Record(lluna_Core_Profiler_EventCounter, (Name), (int64)(Value))
+/**
+ * @brief Marks the end of a frame.
+ */
+#define lluna_Core_Profiler_Frame() lluna_Core_Profiler_Record(lluna_Core_Profiler_EventFrame, NULL, 0)
+/**
+ * @brief Names the calling thread in captures.
+ *
+ * @param Name Name of the thread.
+ */
+#define lluna_Core_Profiler_NameThread(Name) lluna_Core_Profiler_Record(lluna_Core_Profiler_EventThreadName, (Name), 0)
+
+#define lluna_Core_Profiler_ZoneAt(Name, Line) lluna_Core_Profiler_ZoneVariable(Name, Line)
+#define lluna_Core_Profiler_ZoneVariable(Name, Line) \
+        __attribute__((cleanup(lluna_Core_Profiler_EndScope))) const char* lluna_Core_Profiler_Zone##Line = \
+                (lluna_Core_Profiler_Record(lluna_Core_Profiler_EventBegin, (Name), 0), (Name))
+#else
+#define lluna_Core_Profiler_Begin(Name) ((void)0)
+#define lluna_Core_Profiler_End() ((void)0)
+#define lluna_Core_Profiler_Zone(Name) ((void)0)
+#define lluna_Core_Profiler_Count(Name, Value) ((void)0)
+#define lluna_Core_Profiler_Frame() ((void)0)
+#define lluna_Core_Profiler_NameThread(Name) ((void)0)
+#endif
+
+/**
+ * @brief Records an event on the calling thread.
+ *
+ * Called by the instrumentation macros, which should be preferred so instrumentation compiles out.
+ *
+ * @param Type Type of the event.
+ * @param Name Name of the event, kept by address.
+ * @param Value Value of the event.
+ */
+void lluna_Core_Profiler_Record(uint32 Type, const char* Name, int64 Value);
+/**
+ * @brief Ends the zone of a scope, called when leaving scopes opened by lluna_Core_Profiler_Zone.
+ *
+ * @param Name Name of the zone.
+ */
+void lluna_Core_Profiler_EndScope(const char** Name);
+
+/**
+ * @brief Returns the current time in ticks.
+ *
+ * @return Current time.
+ */
+uint64 lluna_Core_Profiler_Now();
+/**
+ * @brief Returns the number of ticks per second.
+ *
+ * The rate of the time stamp counter is measured against the monotonic clock the first time it's needed, which can
+ * take up to a few milliseconds.
+ *
+ * @return Rate of lluna_Core_Profiler_Now.
+ */
+double lluna_Core_Profiler_TicksPerSecond();
+
+/**
+ * @brief Creates an empty capture and returns a handle to it.
+ *
+ * @return Handle to the created capture.
+ *
+ * @see lluna_Core_Profiler_DestroyCapture
+ */
+struct lluna_Core_Profiler_Capture* lluna_Core_Profiler_CreateCapture();
+/**
+ * @brief Destroys the given capture.
+ *
+ * @param Capture Capture to destroy.
+ */
+void lluna_Core_Profiler_DestroyCapture(struct lluna_Core_Profiler_Capture* Capture);
+/**
+ * @brief Removes every event from a capture.
+ *
+ * @param Capture Capture to clear.
+ */
+void lluna_Core_Profiler_ClearCapture(struct lluna_Core_Profiler_Capture* Capture);
+
+/**
+ * @brief Moves the events recorded by every thread since the last collection into a capture.
+ *
+ * Safe to call from any thread while other threads keep recording.
+ *
+ * @param Capture Capture to append to.
+ */
+void lluna_Core_Profiler_Collect(struct lluna_Core_Profiler_Capture* Capture);
+
+/**
+ * @brief Writes a capture as Chrome trace JSON.
+ *
+ * Timestamps are written in microseconds since the first event of the capture.
+ *
+ * @param Capture Capture to write.
+ * @param Output Writer to write to.
+ */
+void lluna_Core_Profiler_WriteChromeTrace(struct lluna_Core_Profiler_Capture* Capture, struct lluna_Core_Writer* Output);
+/**
+ * @brief Writes a capture in the binary capture format.
+ *
+ * Names are written once in a table, and timestamps, threads and values as variable length integers relative to the
+ * previous event, so most events take a few bytes.
+ *
+ * @param Capture Capture to write.
+ * @param Output Writer to write to.
+ */
+void lluna_Core_Profiler_WriteBinary(struct lluna_Core_Profiler_Capture* Capture, struct lluna_Core_Writer* Output);
+/**
+ * @brief Replaces the events of a capture with those of a binary capture.
+ *
+ * @param Capture Capture to read into.
+ * @param Data Binary capture.
+ * @param Size Size of the binary capture in bytes.
+ * @return Whether or not the binary capture was valid. Invalid captures leave the capture unchanged.
+ */
+boolean lluna_Core_Profiler_ReadBinary(struct lluna_Core_Profiler_Capture* Capture, const byte* Data, uint64 Size);
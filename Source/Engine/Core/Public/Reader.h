@@ -0,0 +1,112 @@
+#pragma once
+
+/**
+ * @file Reader.h
+ * @brief Buffered line and record reader.
+ *
+ * lluna_Core_Reader reads a file descriptor in large blocks, or over a memory mapping, and splits it into delimited records.
+ * Records are returned as views into the reader buffer, without copying.
+ * Delimiters are searched 32 or 16 bytes at a time when AVX2 or SSE2 are available.
+ *
+ * Records crossing block boundaries are moved to the start of the buffer before reading the next block, and the buffer grows to fit records longer than itself.
+ * Returned views stay valid until the next read from the same reader.
+ */
+
+#include <Engine/Core/Public/Types.h>
+
+/**
+ * @brief Default size of the reader buffer.
+ */
+#define lluna_Core_Reader_DefaultCapacity (256 * 1024)
+
+/**
+ * @brief Describes a record reader.
+ */
+struct lluna_Core_Reader
+{
+        const byte* Data; /**< Handle to the readable bytes. */
+        byte* Buffer; /**< Owned buffer blocks are read into, or NULL when reading from memory. */
+
+        uint64 Capacity; /**< Size of the owned buffer. */
+        uint64 Offset; /**< Offset of the first unread byte. */
+        uint64 Size; /**< Number of valid bytes. */
+
+        int32 FileDescriptor; /**< Source of blocks. */
+        boolean Mapped; /**< True if `Data` is a memory mapping of the whole file. */
+        boolean EndOfFile; /**< True once the source has no more bytes. */
+        boolean Failed; /**< True once a read from the source failed. */
+};
+
+/**
+ * @brief Creates a reader over a file descriptor and returns a handle to it.
+ *
+ * The file descriptor is not owned by the reader and won't be closed.
+ * Created readers have to be manually destroyed.
+ *
+ * @param FileDescriptor Source of the input.
+ * @param Capacity Initial size of the buffer.
+ * @return Handle to the created reader.
+ *
+ * @see lluna_Core_Reader_Destroy
+ */
+struct lluna_Core_Reader* lluna_Core_Reader_Create(int32 FileDescriptor, uint64 Capacity);
+/**
+ * @brief Creates a reader over a memory mapping of a file and returns a handle to it.
+ *
+ * Falls back to buffered reads if the file can't be mapped, for example because it is a pipe.
+ *
+ * @param FileDescriptor Regular file to map.
+ * @return Handle to the created reader.
+ *
+ * @see lluna_Core_Reader_Destroy
+ */
+struct lluna_Core_Reader* lluna_Core_Reader_CreateMapped(int32 FileDescriptor);
+/**
+ * @brief Creates a reader over the given text and returns a handle to it.
+ *
+ * The text isn't copied and has to outlive the reader.
+ *
+ * @param Text Text to read.
+ * @return Handle to the created reader.
+ *
+ * @see lluna_Core_Reader_Destroy
+ * @see lluna_Macros_Text
+ */
+struct lluna_Core_Reader* lluna_Core_Reader_CreateFromText(struct lluna_Core_Types_Text Text);
+/**
+ * @brief Destroys the given reader.
+ *
+ * @param Handle Reader to destroy.
+ */
+void lluna_Core_Reader_Destroy(struct lluna_Core_Reader* Handle);
+
+/**
+ * @brief Reads the next record ending with the given delimiter.
+ *
+ * The delimiter is not part of the record. The last record may end at the end of the input instead.
+ *
+ * @param Handle Reader to read from.
+ * @param Delimiter Byte ending each record.
+ * @param Record View of the record, valid until the next read.
+ * @return False once there are no more records.
+ */
+boolean lluna_Core_Reader_ReadRecord(struct lluna_Core_Reader* Handle, char Delimiter, struct lluna_Core_Types_Text* Record);
+/**
+ * @brief Reads the next line.
+ *
+ * Lines end with `\n` or `\r\n`. Neither is part of the line.
+ *
+ * @param Handle Reader to read from.
+ * @param Line View of the line, valid until the next read.
+ * @return False once there are no more lines.
+ *
+ * @see lluna_Core_Reader_ReadRecord
+ */
+boolean lluna_Core_Reader_ReadLine(struct lluna_Core_Reader* Handle, struct lluna_Core_Types_Text* Line);
+/**
+ * @brief Returns the bytes left to read, reading the rest of the input.
+ *
+ * @param Handle Reader to read from.
+ * @return View of the remaining bytes, valid until the next read.
+ */
+struct lluna_Core_Types_Text lluna_Core_Reader_ReadRemaining(struct lluna_Core_Reader* Handle);
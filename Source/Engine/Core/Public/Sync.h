@@ -0,0 +1,213 @@
+#pragma once
+
+/**
+ * @file Sync.h
+ * @brief Thread synchronization primitives.
+ *
+ * Mutexes, reader-writer locks, events, semaphores and barriers built on a single 32-bit word each. Uncontended
+ * operations are a single atomic instruction, and threads that have to wait spin briefly before parking in the kernel
+ * with a futex. Primitives are plain structs that can be embedded anywhere and need no cleanup.
+ *
+ * lluna_Core_Sync_Mutex adapts how long it spins to how long it was held before, so short critical sections rarely
+ * park while long ones don't burn cores.
+ *
+ * Parking uses futexes on Linux. Other platforms fall back to yielding the core while waiting.
+ * None of the primitives are recursive.
+ */
+
+#include <Engine/Core/Public/Types.h>
+
+/**
+ * @brief Describes a mutex.
+ *
+ * Zero initialized mutexes are unlocked. Should not be written to externally.
+ */
+struct lluna_Core_Sync_Mutex
+{
+        uint32 State; /**< 0 if unlocked, 1 if locked, 2 if locked with possible waiters. */
+        uint32 Spins; /**< Running average of the rounds spun before getting the lock. */
+};
+
+/**
+ * @brief Describes a reader-writer lock.
+ *
+ * Waiting writers keep new readers out, so writers don't starve. Zero initialized locks are unlocked.
+ * Should not be written to externally.
+ */
+struct lluna_Core_Sync_RwLock
+{
+        uint32 State; /**< Number of readers or all reader bits set when write locked, and waiting flags. */
+        uint32 WriterNotify; /**< Incremented to wake up a waiting writer. */
+};
+
+/**
+ * @brief Describes an event.
+ *
+ * Zero initialized events are unsignaled and reset automatically. Should not be written to externally.
+ *
+ * @see lluna_Core_Sync_InitializeEvent
+ */
+struct lluna_Core_Sync_Event
+{
+        uint32 State; /**< 0 if unsignaled, 1 if signaled, 2 if unsignaled with possible waiters. */
+        boolean ManualReset; /**< True if waits leave the event signaled. */
+};
+
+/**
+ * @brief Describes a counting semaphore.
+ *
+ * Should not be written to externally.
+ */
+struct lluna_Core_Sync_Semaphore
+{
+        uint32 Count; /**< Number of available units. */
+        uint32 WaitingCount; /**< Number of threads parked waiting for units. */
+};
+
+/**
+ * @brief Describes a reusable barrier.
+ *
+ * Should not be written to externally.
+ */
+struct lluna_Core_Sync_Barrier
+{
+        uint32 Count; /**< Number of threads taking part. */
+        uint32 Remaining; /**< Number of threads yet to arrive in the current round. */
+        uint32 Generation; /**< Incremented each time all threads have arrived. */
+};
+
+/**
+ * @brief Initializes a mutex to unlocked.
+ *
+ * @param Mutex Mutex to initialize.
+ */
+void lluna_Core_Sync_InitializeMutex(struct lluna_Core_Sync_Mutex* Mutex);
+/**
+ * @brief Locks a mutex, waiting for it if necessary.
+ *
+ * @param Mutex Mutex to lock. Must not be locked by the calling thread.
+ */
+void lluna_Core_Sync_LockMutex(struct lluna_Core_Sync_Mutex* Mutex);
+/**
+ * @brief Locks a mutex if it isn't locked.
+ *
+ * @param Mutex Mutex to lock.
+ * @return True if the mutex was locked by this call.
+ */
+boolean lluna_Core_Sync_TryLockMutex(struct lluna_Core_Sync_Mutex* Mutex);
+/**
+ * @brief Unlocks a mutex.
+ *
+ * @param Mutex Mutex locked by the calling thread.
+ */
+void lluna_Core_Sync_UnlockMutex(struct lluna_Core_Sync_Mutex* Mutex);
+
+/**
+ * @brief Initializes a reader-writer lock to unlocked.
+ *
+ * @param Lock Lock to initialize.
+ */
+void lluna_Core_Sync_InitializeRwLock(struct lluna_Core_Sync_RwLock* Lock);
+/**
+ * @brief Locks a reader-writer lock for reading, waiting for writers if necessary.
+ *
+ * Read locks are not recursive: a thread taking a second read lock can deadlock with a waiting writer.
+ *
+ * @param Lock Lock to read lock.
+ */
+void lluna_Core_Sync_ReadLock(struct lluna_Core_Sync_RwLock* Lock);
+/**
+ * @brief Releases a read lock.
+ *
+ * @param Lock Lock read locked by the calling thread.
+ */
+void lluna_Core_Sync_ReadUnlock(struct lluna_Core_Sync_RwLock* Lock);
+/**
+ * @brief Locks a reader-writer lock for writing, waiting for readers and writers if necessary.
+ *
+ * @param Lock Lock to write lock.
+ */
+void lluna_Core_Sync_WriteLock(struct lluna_Core_Sync_RwLock* Lock);
+/**
+ * @brief Releases a write lock.
+ *
+ * @param Lock Lock write locked by the calling thread.
+ */
+void lluna_Core_Sync_WriteUnlock(struct lluna_Core_Sync_RwLock* Lock);
+
+/**
+ * @brief Initializes an event.
+ *
+ * @param Event Event to initialize.
+ * @param ManualReset True if the event stays signaled until reset, false if each signal releases a single wait.
+ * @param Signaled True if the event starts signaled.
+ */
+void lluna_Core_Sync_InitializeEvent(struct lluna_Core_Sync_Event* Event, boolean ManualReset, boolean Signaled);
+/**
+ * @brief Signals an event.
+ *
+ * Manual reset events release every waiting thread. Automatically reset events release a single waiting thread, or
+ * the next thread to wait if none is waiting.
+ *
+ * @param Event Event to signal.
+ */
+void lluna_Core_Sync_SignalEvent(struct lluna_Core_Sync_Event* Event);
+/**
+ * @brief Resets an event to unsignaled.
+ *
+ * @param Event Event to reset.
+ */
+void lluna_Core_Sync_ResetEvent(struct lluna_Core_Sync_Event* Event);
+/**
+ * @brief Waits until an event is signaled.
+ *
+ * Automatically reset events are reset by the wait.
+ *
+ * @param Event Event to wait for.
+ */
+void lluna_Core_Sync_WaitEvent(struct lluna_Core_Sync_Event* Event);
+
+/**
+ * @brief Initializes a semaphore.
+ *
+ * @param Semaphore Semaphore to initialize.
+ * @param Count Number of initially available units.
+ */
+void lluna_Core_Sync_InitializeSemaphore(struct lluna_Core_Sync_Semaphore* Semaphore, uint32 Count);
+/**
+ * @brief Takes a unit from a semaphore, waiting for one if necessary.
+ *
+ * @param Semaphore Semaphore to take from.
+ */
+void lluna_Core_Sync_AcquireSemaphore(struct lluna_Core_Sync_Semaphore* Semaphore);
+/**
+ * @brief Takes a unit from a semaphore if one is available.
+ *
+ * @param Semaphore Semaphore to take from.
+ * @return True if a unit was taken.
+ */
+boolean lluna_Core_Sync_TryAcquireSemaphore(struct lluna_Core_Sync_Semaphore* Semaphore);
+/**
+ * @brief Adds units to a semaphore, waking up as many waiting threads.
+ *
+ * @param Semaphore Semaphore to add to.
+ * @param Count Number of units to add.
+ */
+void lluna_Core_Sync_ReleaseSemaphore(struct lluna_Core_Sync_Semaphore* Semaphore, uint32 Count);
+
+/**
+ * @brief Initializes a barrier.
+ *
+ * @param Barrier Barrier to initialize.
+ * @param Count Number of threads taking part, at least 1.
+ */
+void lluna_Core_Sync_InitializeBarrier(struct lluna_Core_Sync_Barrier* Barrier, uint32 Count);
+/**
+ * @brief Waits until every thread taking part has arrived at a barrier.
+ *
+ * The barrier resets once all threads have arrived, so it can be waited on again right away.
+ *
+ * @param Barrier Barrier to wait at.
+ * @return True for exactly one thread of each round, the last to arrive.
+ */
+boolean lluna_Core_Sync_WaitBarrier(struct lluna_Core_Sync_Barrier* Barrier);
@@ -0,0 +1,111 @@
+#pragma once
+
+/**
+ * @file Utf8.h
+ * @brief UTF-8 validation, decoding and transcoding.
+ *
+ * Validation follows the vectorized lookup algorithm by Keiser and Lemire, processing 16 or 32 bytes per step when SSSE3 or AVX2 are available.
+ * Counting and transcoding assume valid input and take fast paths for runs of ASCII.
+ *
+ * All functions take sized texts. A trailing null terminator, as counted by lluna_Macros_Text, is not considered part of the text.
+ *
+ * @see lluna_Macros_TextLength
+ */
+
+#include <Engine/Core/Public/Types.h>
+
+/**
+ * @brief Code point used in place of malformed sequences.
+ */
+#define lluna_Core_Utf8_ReplacementCharacter 0xFFFD
+
+/**
+ * @brief Maximum number of bytes used to encode a single code point.
+ */
+#define lluna_Core_Utf8_MaxSequenceLength 4
+
+/**
+ * @brief Returns true if the given text is well formed UTF-8.
+ *
+ * Rejects overlong encodings, surrogates, code points above U+10FFFF and truncated sequences.
+ *
+ * @param Text Text to validate.
+ * @return Whether or not the text is valid UTF-8.
+ */
+boolean lluna_Core_Utf8_Validate(struct lluna_Core_Types_Text Text);
+/**
+ * @brief Returns the number of code points in the given text.
+ *
+ * Counts every byte that is not a continuation byte, so the result is only exact for valid UTF-8.
+ * It is never smaller than the number of code points written by lluna_Core_Utf8_ToUtf32, so it can be used to size its output.
+ *
+ * @param Text Text to count.
+ * @return Number of code points.
+ */
+uint64 lluna_Core_Utf8_CountCodePoints(struct lluna_Core_Types_Text Text);
+/**
+ * @brief Decodes the code point starting at the given offset.
+ *
+ * Malformed sequences decode to lluna_Core_Utf8_ReplacementCharacter and advance by a single byte.
+ *
+ * @param Text Text to decode from.
+ * @param Offset Byte offset of the sequence. Advanced past the decoded sequence.
+ * @return Decoded code point.
+ */
+uint32 lluna_Core_Utf8_Decode(struct lluna_Core_Types_Text Text, uint64* Offset);
+/**
+ * @brief Returns the number of bytes needed to encode the given code points as UTF-8.
+ *
+ * @param CodePoints Code points to measure.
+ * @param Count Number of code points.
+ * @return Encoded size in bytes.
+ */
+uint64 lluna_Core_Utf8_EncodedSize(const uint32* CodePoints, uint64 Count);
+/**
+ * @brief Encodes code points as UTF-8.
+ *
+ * Surrogates and code points above U+10FFFF are encoded as lluna_Core_Utf8_ReplacementCharacter.
+ * `Output` must fit lluna_Core_Utf8_EncodedSize bytes. No null terminator is written.
+ *
+ * @param CodePoints Code points to encode.
+ * @param Count Number of code points.
+ * @param Output Destination buffer.
+ * @return Number of bytes written.
+ *
+ * @see lluna_Core_Utf8_EncodedSize
+ */
+uint64 lluna_Core_Utf8_Encode(const uint32* CodePoints, uint64 Count, char* Output);
+/**
+ * @brief Transcodes UTF-8 to UTF-32.
+ *
+ * `Output` must fit lluna_Core_Utf8_CountCodePoints code points.
+ *
+ * @param Text Text to transcode.
+ * @param Output Destination buffer.
+ * @return Number of code points written.
+ *
+ * @see lluna_Core_Utf8_CountCodePoints
+ */
+uint64 lluna_Core_Utf8_ToUtf32(struct lluna_Core_Types_Text Text, uint32* Output);
+/**
+ * @brief Returns the number of UTF-16 code units needed to hold the given text.
+ *
+ * Like lluna_Core_Utf8_CountCodePoints, the result is only exact for valid UTF-8 and is an upper bound otherwise.
+ *
+ * @param Text Text to measure.
+ * @return Number of UTF-16 code units.
+ */
+uint64 lluna_Core_Utf8_CountUtf16(struct lluna_Core_Types_Text Text);
+/**
+ * @brief Transcodes UTF-8 to UTF-16.
+ *
+ * Code points outside of the basic multilingual plane are written as surrogate pairs.
+ * `Output` must fit lluna_Core_Utf8_CountUtf16 code units.
+ *
+ * @param Text Text to transcode.
+ * @param Output Destination buffer.
+ * @return Number of code units written.
+ *
+ * @see lluna_Core_Utf8_CountUtf16
+ */
+uint64 lluna_Core_Utf8_ToUtf16(struct lluna_Core_Types_Text Text, uint16* Output);
@@ -0,0 +1,178 @@
+#pragma once
+
+/**
+ * @file Writer.h
+ * @brief Buffered text and binary writer.
+ *
+ * lluna_Core_Writer appends text, numbers and raw bytes into a reusable buffer and writes it to a file descriptor in large chunks.
+ * Writes bigger than the buffer are passed through together with the buffered bytes in a single vectored write.
+ *
+ * A writer created without a file descriptor never flushes and grows its buffer instead, which makes it usable as a text builder.
+ *
+ * Once a write to the file descriptor fails, the writer is flagged as failed and further output is discarded.
+ */
+
+#include <Engine/Core/Public/Types.h>
+
+#include <stdarg.h>
+
+/**
+ * @brief File descriptor value for writers that only buffer in memory.
+ */
+#define lluna_Core_Writer_NoFile (-1)
+
+/**
+ * @brief Default size of the writer buffer.
+ */
+#define lluna_Core_Writer_DefaultCapacity (64 * 1024)
+
+/**
+ * @brief Describes a buffered writer.
+ */
+struct lluna_Core_Writer
+{
+        byte* Data; /**< Handle to the buffer. */
+
+        uint64 Capacity; /**< Size of the buffer. */
+        uint64 Offset; /**< Number of buffered bytes. */
+
+        int32 FileDescriptor; /**< Destination of flushed bytes, or lluna_Core_Writer_NoFile. */
+        boolean Failed; /**< True once a write to the destination failed. */
+};
+
+/**
+ * @brief Creates a writer and returns a handle to it.
+ *
+ * The file descriptor is not owned by the writer and won't be closed.
+ * Created writers have to be manually destroyed.
+ *
+ * @param FileDescriptor Destination of the output, or lluna_Core_Writer_NoFile to only buffer.
+ * @param Capacity Size of the buffer.
+ * @return Handle to the created writer.
+ *
+ * @see lluna_Core_Writer_Destroy
+ */
+struct lluna_Core_Writer* lluna_Core_Writer_Create(int32 FileDescriptor, uint64 Capacity);
+/**
+ * @brief Flushes and destroys the given writer.
+ *
+ * @param Handle Writer to destroy.
+ */
+void lluna_Core_Writer_Destroy(struct lluna_Core_Writer* Handle);
+
+/**
+ * @brief Writes all buffered bytes to the file descriptor.
+ *
+ * Does nothing for writers without a file descriptor.
+ *
+ * @param Handle Writer to flush.
+ * @return Whether or not all output so far was written successfully.
+ */
+boolean lluna_Core_Writer_Flush(struct lluna_Core_Writer* Handle);
+/**
+ * @brief Discards all buffered bytes.
+ *
+ * @param Handle Writer to clear.
+ */
+void lluna_Core_Writer_Clear(struct lluna_Core_Writer* Handle);
+/**
+ * @brief Returns the buffered bytes as a text.
+ *
+ * The text isn't null terminated and is only valid until the next write.
+ *
+ * @param Handle Writer to read.
+ * @return Buffered text.
+ */
+struct lluna_Core_Types_Text lluna_Core_Writer_Text(struct lluna_Core_Writer* Handle);
+
+/**
+ * @brief Returns space for at least the given number of bytes at the end of the buffer.
+ *
+ * Flushes or grows the buffer as needed. Bytes written to the returned space are kept by lluna_Core_Writer_Commit.
+ *
+ * @param Handle Writer to reserve space in.
+ * @param Size Number of bytes to reserve.
+ * @return Pointer to the reserved space.
+ *
+ * @see lluna_Core_Writer_Commit
+ */
+char* lluna_Core_Writer_Reserve(struct lluna_Core_Writer* Handle, uint64 Size);
+/**
+ * @brief Appends bytes previously written to reserved space.
+ *
+ * @param Handle Writer to commit to.
+ * @param Size Number of bytes to append. Must not exceed the reserved size.
+ *
+ * @see lluna_Core_Writer_Reserve
+ */
+void lluna_Core_Writer_Commit(struct lluna_Core_Writer* Handle, uint64 Size);
+
+/**
+ * @brief Appends raw bytes.
+ *
+ * @param Handle Writer to append to.
+ * @param Data Bytes to append.
+ * @param Size Number of bytes.
+ */
+void lluna_Core_Writer_WriteBytes(struct lluna_Core_Writer* Handle, const void* Data, uint64 Size);
+/**
+ * @brief Appends a text, without its null terminator.
+ *
+ * @param Handle Writer to append to.
+ * @param Text Text to append.
+ *
+ * @see lluna_Macros_Text
+ */
+void lluna_Core_Writer_WriteText(struct lluna_Core_Writer* Handle, struct lluna_Core_Types_Text Text);
+/**
+ * @brief Appends a single character.
+ *
+ * @param Handle Writer to append to.
+ * @param Character Character to append.
+ */
+void lluna_Core_Writer_WriteCharacter(struct lluna_Core_Writer* Handle, char Character);
+/**
+ * @brief Appends a signed integer in decimal.
+ *
+ * @param Handle Writer to append to.
+ * @param Value Value to append.
+ */
+void lluna_Core_Writer_WriteInt64(struct lluna_Core_Writer* Handle, int64 Value);
+/**
+ * @brief Appends an unsigned integer in decimal.
+ *
+ * @param Handle Writer to append to.
+ * @param Value Value to append.
+ */
+void lluna_Core_Writer_WriteUint64(struct lluna_Core_Writer* Handle, uint64 Value);
+/**
+ * @brief Appends a float with enough digits to parse back to the same value.
+ *
+ * @param Handle Writer to append to.
+ * @param Value Value to append.
+ *
+ * @see lluna_Core_Parse_Float
+ */
+void lluna_Core_Writer_WriteFloat(struct lluna_Core_Writer* Handle, float Value);
+/**
+ * @brief Appends a formatted string.
+ *
+ * Accepts the same format as lluna_Container_String_Format and formats directly into the buffer.
+ *
+ * @param Handle Writer to append to.
+ * @param Format Format string.
+ * @param ... Format arguments.
+ *
+ * @see lluna_Macros_Text
+ */
+void lluna_Core_Writer_Format(struct lluna_Core_Writer* Handle, struct lluna_Core_Types_Text Format, ...);
+/**
+ * @brief Appends a formatted string from a list of arguments.
+ *
+ * @param Handle Writer to append to.
+ * @param Format Format string.
+ * @param Args List of format arguments.
+ *
+ * @see lluna_Core_Writer_Format
+ */
+void lluna_Core_Writer_FormatList(struct lluna_Core_Writer* Handle, struct lluna_Core_Types_Text Format, va_list Args);
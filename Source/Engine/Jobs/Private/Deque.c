@@ -0,0 +1,155 @@
+#include <Engine/Jobs/Public/Deque.h>
+
+#include <Engine/Core/Public/Atomics.h>
+
+#include <stdlib.h>
+
+struct lluna_Jobs_DequeRing
+{
+        int64 Mask;
+        struct lluna_Jobs_DequeRing* Next;
+        struct lluna_Jobs_Job* Slots[];
+};
+
+static struct lluna_Jobs_DequeRing* CreateRing(int64 Capacity)
+{
+        struct lluna_Jobs_DequeRing* Ring = malloc(sizeof(struct lluna_Jobs_DequeRing) + Capacity * sizeof(struct lluna_Jobs_Job*));
+        Ring->Mask = Capacity - 1;
+        Ring->Next = NULL;
+
+        return Ring;
+}
+
+// Slots are published with release and read with acquire, so whoever takes a job also sees what was written to it.
+static struct lluna_Jobs_Job* LoadSlot(struct lluna_Jobs_DequeRing* Ring, int64 Index)
+{
+        return lluna_Core_Atomics_LoadPointer(&Ring->Slots[Index & Ring->Mask], lluna_Core_Atomics_Acquire);
+}
+
+static void StoreSlot(struct lluna_Jobs_DequeRing* Ring, int64 Index, struct lluna_Jobs_Job* Job)
+{
+        lluna_Core_Atomics_StorePointer(&Ring->Slots[Index & Ring->Mask], Job, lluna_Core_Atomics_Release);
+}
+
+// Copies live jobs into a ring twice as big. The old ring is retired rather than freed, since thieves may still read it.
+static struct lluna_Jobs_DequeRing* Grow(struct lluna_Jobs_Deque* Handle, struct lluna_Jobs_DequeRing* Ring, int64 Top, int64 Bottom)
+{
+        struct lluna_Jobs_DequeRing* Grown = CreateRing((Ring->Mask + 1) * 2);
+        for (int64 Index = Top; Index < Bottom; ++Index)
+        {
+                StoreSlot(Grown, Index, LoadSlot(Ring, Index));
+        }
+
+        Ring->Next = Handle->Retired;
+        Handle->Retired = Ring;
+        lluna_Core_Atomics_StorePointer(&Handle->Ring, Grown, lluna_Core_Atomics_Release);
+
+        return Grown;
+}
+
+struct lluna_Jobs_Deque* lluna_Jobs_Deque_Create(uint64 InitialCapacity)
+{
+        int64 Capacity = 2;
+        while ((uint64)Capacity < InitialCapacity)
+        {
+                Capacity *= 2;
+        }
+
+        struct lluna_Jobs_Deque* Handle = malloc(sizeof(struct lluna_Jobs_Deque));
+        Handle->Top = 0;
+        Handle->Bottom = 0;
+        Handle->Ring = CreateRing(Capacity);
+        Handle->Retired = NULL;
+
+        return Handle;
+}
+
+void lluna_Jobs_Deque_Destroy(struct lluna_Jobs_Deque* Handle)
+{
+        while (Handle->Retired)
+        {
+                struct lluna_Jobs_DequeRing* Next = Handle->Retired->Next;
+                free(Handle->Retired);
+                Handle->Retired = Next;
+        }
+
+        free(Handle->Ring);
+        free(Handle);
+}
+
+void lluna_Jobs_Deque_Push(struct lluna_Jobs_Deque* Handle, struct lluna_Jobs_Job* Job)
+{
+        int64 Bottom = lluna_Core_Atomics_LoadInt64(&Handle->Bottom, lluna_Core_Atomics_Relaxed);
+        int64 Top = lluna_Core_Atomics_LoadInt64(&Handle->Top, lluna_Core_Atomics_Acquire);
+        struct lluna_Jobs_DequeRing* Ring = lluna_Core_Atomics_LoadPointer(&Handle->Ring, lluna_Core_Atomics_Relaxed);
+
+        if (Bottom - Top > Ring->Mask)
+        {
+                Ring = Grow(Handle, Ring, Top, Bottom);
+        }
+
+        StoreSlot(Ring, Bottom, Job);
+        lluna_Core_Atomics_StoreInt64(&Handle->Bottom, Bottom + 1, lluna_Core_Atomics_Release);
+}
+
+struct lluna_Jobs_Job* lluna_Jobs_Deque_Pop(struct lluna_Jobs_Deque* Handle)
+{
+        int64 Bottom = lluna_Core_Atomics_LoadInt64(&Handle->Bottom, lluna_Core_Atomics_Relaxed) - 1;
+        struct lluna_Jobs_DequeRing* Ring = lluna_Core_Atomics_LoadPointer(&Handle->Ring, lluna_Core_Atomics_Relaxed);
+
+        // Claim the bottom slot before looking at the top, so a racing thief sees the claim. Sequentially consistent
+        // accesses rather than a fence order the store before the load, which also keeps thread sanitizers informed.
+        lluna_Core_Atomics_StoreInt64(&Handle->Bottom, Bottom, lluna_Core_Atomics_SequentiallyConsistent);
+        int64 Top = lluna_Core_Atomics_LoadInt64(&Handle->Top, lluna_Core_Atomics_SequentiallyConsistent);
+
+        if (Top > Bottom)
+        {
+                lluna_Core_Atomics_StoreInt64(&Handle->Bottom, Bottom + 1, lluna_Core_Atomics_Relaxed);
+                return NULL;
+        }
+
+        struct lluna_Jobs_Job* Job = LoadSlot(Ring, Bottom);
+        if (Top == Bottom)
+        {
+                // Last job: race thieves for it through the top.
+                if (!lluna_Core_Atomics_CompareExchangeInt64(&Handle->Top, &Top, Top + 1, false,
+                                                             lluna_Core_Atomics_SequentiallyConsistent, lluna_Core_Atomics_Relaxed))
+                {
+                        Job = NULL;
+                }
+                lluna_Core_Atomics_StoreInt64(&Handle->Bottom, Bottom + 1, lluna_Core_Atomics_Relaxed);
+        }
+
+        return Job;
+}
+
+boolean lluna_Jobs_Deque_Steal(struct lluna_Jobs_Deque* Handle, struct lluna_Jobs_Job** Job)
+{
+        int64 Top = lluna_Core_Atomics_LoadInt64(&Handle->Top, lluna_Core_Atomics_SequentiallyConsistent);
+        int64 Bottom = lluna_Core_Atomics_LoadInt64(&Handle->Bottom, lluna_Core_Atomics_SequentiallyConsistent);
+
+        *Job = NULL;
+        if (Top >= Bottom)
+        {
+                return true;
+        }
+
+        struct lluna_Jobs_DequeRing* Ring = lluna_Core_Atomics_LoadPointer(&Handle->Ring, lluna_Core_Atomics_Acquire);
+        struct lluna_Jobs_Job* Stolen = LoadSlot(Ring, Top);
+        if (!lluna_Core_Atomics_CompareExchangeInt64(&Handle->Top, &Top, Top + 1, false, lluna_Core_Atomics_SequentiallyConsistent, lluna_Core_Atomics_Relaxed))
+        {
+                return false;
+        }
+
+        *Job = Stolen;
+
+        return true;
+}
+
+boolean lluna_Jobs_Deque_Empty(struct lluna_Jobs_Deque* Handle)
+{
+        int64 Top = lluna_Core_Atomics_LoadInt64(&Handle->Top, lluna_Core_Atomics_Acquire);
+        int64 Bottom = lluna_Core_Atomics_LoadInt64(&Handle->Bottom, lluna_Core_Atomics_Acquire);
+
+        return Top >= Bottom;
+}
@@ -0,0 +1,445 @@
+#include <Engine/Jobs/Public/Graph.h>
+
+#include <Engine/Container/Public/Sort.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+// Number of declarations room is made for up front.
+#define InitialCapacity 16
+
+struct Task
+{
+        lluna_Jobs_Function Function;
+        void* Data;
+        uint64 Cost;
+};
+
+struct Access
+{
+        uint64 Resource;
+        uint32 Task;
+        uint32 Write;
+};
+
+struct Edge
+{
+        uint32 From;
+        uint32 To;
+};
+
+// The sort passes arguments with side effects, so the orderings are functions rather than macros.
+static inline boolean AccessLess(const struct Access* Left, const struct Access* Right)
+{
+        return Left->Resource < Right->Resource || (Left->Resource == Right->Resource && Left->Task < Right->Task);
+}
+
+static inline boolean EdgeLess(const struct Edge* Left, const struct Edge* Right)
+{
+        return Left->From < Right->From || (Left->From == Right->From && Left->To < Right->To);
+}
+
+lluna_Container_Sort_Define(SortAccesses, struct Access, AccessLess)
+lluna_Container_Sort_Define(SortEdges, struct Edge, EdgeLess)
+
+static struct Task* Tasks(struct lluna_Jobs_Graph* Handle)
+{
+        return (struct Task*)Handle->Tasks->Data;
+}
+
+static void Declare(struct lluna_Jobs_Graph* Handle, uint32 Task, const void* Resource, uint32 Write)
+{
+        struct Access Access = { (uint64)(size_t)Resource, Task, Write };
+        lluna_Container_DynamicArray_Append(Handle->Accesses, (byte*)&Access);
+        Handle->Compiled = false;
+}
+
+static void AddEdge(struct lluna_Container_DynamicArray* Edges, uint32 From, uint32 To)
+{
+        struct Edge Edge = { From, To };
+        lluna_Container_DynamicArray_Append(Edges, (byte*)&Edge);
+}
+
+// Orders the accesses of each resource by task and turns them into edges. A task reading and writing the same resource
+// counts as a writer. Readers depend on the last writer, writers on the readers since the last writer or, if there are
+// none, on the last writer itself.
+static void AddResourceEdges(struct lluna_Jobs_Graph* Handle, struct lluna_Container_DynamicArray* Edges)
+{
+        uint64 AccessCount = lluna_Container_DynamicArray_Count(Handle->Accesses);
+        if (AccessCount == 0)
+        {
+                return;
+        }
+
+        struct Access* Accesses = malloc(AccessCount * sizeof(struct Access));
+        memcpy(Accesses, Handle->Accesses->Data, AccessCount * sizeof(struct Access));
+        SortAccesses_Range(Accesses, AccessCount);
+
+        uint64 Count = 1;
+        for (uint64 Index = 1; Index < AccessCount; ++Index)
+        {
+                struct Access* Last = &Accesses[Count - 1];
+                if (Accesses[Index].Resource == Last->Resource && Accesses[Index].Task == Last->Task)
+                {
+                        Last->Write |= Accesses[Index].Write;
+                }
+                else
+                {
+                        Accesses[Count++] = Accesses[Index];
+                }
+        }
+
+        uint64 Start = 0;
+        while (Start < Count)
+        {
+                uint64 Resource = Accesses[Start].Resource;
+                struct Access* Writer = NULL;
+                uint64 ReaderStart = Start;
+
+                uint64 Index = Start;
+                for (; Index < Count && Accesses[Index].Resource == Resource; ++Index)
+                {
+                        struct Access* Access = &Accesses[Index];
+                        if (!Access->Write)
+                        {
+                                if (Writer)
+                                {
+                                        AddEdge(Edges, Writer->Task, Access->Task);
+                                }
+                                continue;
+                        }
+
+                        if (ReaderStart < Index)
+                        {
+                                for (uint64 Reader = ReaderStart; Reader < Index; ++Reader)
+                                {
+                                        AddEdge(Edges, Accesses[Reader].Task, Access->Task);
+                                }
+                        }
+                        else if (Writer)
+                        {
+                                AddEdge(Edges, Writer->Task, Access->Task);
+                        }
+
+                        Writer = Access;
+                        ReaderStart = Index + 1;
+                }
+
+                Start = Index;
+        }
+
+        free(Accesses);
+}
+
+static void ReleaseCompiled(struct lluna_Jobs_Graph* Handle)
+{
+        free(Handle->SuccessorOffsets);
+        free(Handle->Successors);
+        free(Handle->PredecessorCounts);
+        free(Handle->Priorities);
+        free(Handle->Remaining);
+        free(Handle->Ready);
+        free(Handle->Runners);
+
+        Handle->SuccessorOffsets = NULL;
+        Handle->Successors = NULL;
+        Handle->PredecessorCounts = NULL;
+        Handle->Priorities = NULL;
+        Handle->Remaining = NULL;
+        Handle->Ready = NULL;
+        Handle->Runners = NULL;
+}
+
+// Ready tasks form a binary max-heap on their priority, ties going to the task declared first.
+static boolean Precedes(struct lluna_Jobs_Graph* Handle, uint32 Left, uint32 Right)
+{
+        uint64 LeftPriority = Handle->Priorities[Left];
+        uint64 RightPriority = Handle->Priorities[Right];
+
+        return LeftPriority > RightPriority || (LeftPriority == RightPriority && Left < Right);
+}
+
+static void PushReady(struct lluna_Jobs_Graph* Handle, uint32 Task)
+{
+        uint32* Ready = Handle->Ready;
+        uint32 Index = Handle->ReadyCount++;
+        while (Index > 0)
+        {
+                uint32 Parent = (Index - 1) / 2;
+                if (!Precedes(Handle, Task, Ready[Parent]))
+                {
+                        break;
+                }
+                Ready[Index] = Ready[Parent];
+                Index = Parent;
+        }
+        Ready[Index] = Task;
+}
+
+static uint32 PopReady(struct lluna_Jobs_Graph* Handle)
+{
+        uint32* Ready = Handle->Ready;
+        uint32 Top = Ready[0];
+        uint32 Task = Ready[--Handle->ReadyCount];
+        uint32 Count = Handle->ReadyCount;
+
+        uint32 Index = 0;
+        while (2 * Index + 1 < Count)
+        {
+                uint32 Child = 2 * Index + 1;
+                if (Child + 1 < Count && Precedes(Handle, Ready[Child + 1], Ready[Child]))
+                {
+                        ++Child;
+                }
+                if (!Precedes(Handle, Ready[Child], Task))
+                {
+                        break;
+                }
+                Ready[Index] = Ready[Child];
+                Index = Child;
+        }
+        if (Count > 0)
+        {
+                Ready[Index] = Task;
+        }
+
+        return Top;
+}
+
+static void RunReady(void* Data);
+
+// Called with the ready lock held. Reserves jobs for ready tasks no running job will get to, keeping at most one job
+// per worker. Jobs can only be queued from workers, other threads run every task themselves.
+static uint32 ReserveRunners(struct lluna_Jobs_Graph* Handle, uint32 Wanted, uint32* First)
+{
+        uint32 WorkerCount = lluna_Jobs_Scheduler_WorkerCount(Handle->Scheduler);
+        uint32 TaskCount = lluna_Jobs_Graph_TaskCount(Handle);
+        if (Handle->RunnerCount >= WorkerCount || lluna_Jobs_Scheduler_WorkerIndex(Handle->Scheduler) == WorkerCount)
+        {
+                return 0;
+        }
+
+        uint32 Count = Wanted;
+        if (Count > WorkerCount - Handle->RunnerCount)
+        {
+                Count = WorkerCount - Handle->RunnerCount;
+        }
+        if (Count > TaskCount - Handle->LaunchCount)
+        {
+                Count = TaskCount - Handle->LaunchCount;
+        }
+
+        *First = Handle->LaunchCount;
+        Handle->LaunchCount += Count;
+        Handle->RunnerCount += Count;
+
+        return Count;
+}
+
+static void LaunchRunners(struct lluna_Jobs_Graph* Handle, uint32 First, uint32 Count)
+{
+        for (uint32 Index = First; Index < First + Count; ++Index)
+        {
+                Handle->Runners[Index].Function = RunReady;
+                Handle->Runners[Index].Data = Handle;
+        }
+        lluna_Jobs_Scheduler_Run(Handle->Scheduler, Handle->Runners + First, Count, &Handle->Counter);
+}
+
+// Takes the most critical ready task until none is left. Whoever finishes a task releases its successors and keeps
+// going, so ready tasks are never left without a job to run them.
+static void RunReady(void* Data)
+{
+        struct lluna_Jobs_Graph* Handle = Data;
+        struct Task* Declared = Tasks(Handle);
+
+        lluna_Core_Sync_LockMutex(&Handle->ReadyLock);
+        while (Handle->ReadyCount > 0)
+        {
+                uint32 Task = PopReady(Handle);
+                lluna_Core_Sync_UnlockMutex(&Handle->ReadyLock);
+
+                Declared[Task].Function(Declared[Task].Data);
+
+                uint32 First = 0;
+                lluna_Core_Sync_LockMutex(&Handle->ReadyLock);
+                for (uint32 Index = Handle->SuccessorOffsets[Task]; Index < Handle->SuccessorOffsets[Task + 1]; ++Index)
+                {
+                        uint32 Successor = Handle->Successors[Index];
+                        if (--Handle->Remaining[Successor] == 0)
+                        {
+                                PushReady(Handle, Successor);
+                        }
+                }
+
+                // The next ready task is left to this job.
+                uint32 Count = Handle->ReadyCount > 1 ? ReserveRunners(Handle, Handle->ReadyCount - 1, &First) : 0;
+                if (Count > 0)
+                {
+                        lluna_Core_Sync_UnlockMutex(&Handle->ReadyLock);
+                        LaunchRunners(Handle, First, Count);
+                        lluna_Core_Sync_LockMutex(&Handle->ReadyLock);
+                }
+        }
+        --Handle->RunnerCount;
+        lluna_Core_Sync_UnlockMutex(&Handle->ReadyLock);
+}
+
+struct lluna_Jobs_Graph* lluna_Jobs_Graph_Create()
+{
+        struct lluna_Jobs_Graph* Handle = calloc(1, sizeof(struct lluna_Jobs_Graph));
+        Handle->Tasks = lluna_Container_DynamicArray_Create(InitialCapacity, sizeof(struct Task));
+        Handle->Accesses = lluna_Container_DynamicArray_Create(InitialCapacity, sizeof(struct Access));
+        Handle->Dependencies = lluna_Container_DynamicArray_Create(InitialCapacity, sizeof(struct Edge));
+        lluna_Core_Sync_InitializeMutex(&Handle->ReadyLock);
+
+        return Handle;
+}
+
+void lluna_Jobs_Graph_Destroy(struct lluna_Jobs_Graph* Handle)
+{
+        ReleaseCompiled(Handle);
+        lluna_Container_DynamicArray_Destroy(Handle->Tasks);
+        lluna_Container_DynamicArray_Destroy(Handle->Accesses);
+        lluna_Container_DynamicArray_Destroy(Handle->Dependencies);
+        free(Handle);
+}
+
+uint32 lluna_Jobs_Graph_AddTask(struct lluna_Jobs_Graph* Handle, lluna_Jobs_Function Function, void* Data, uint64 Cost)
+{
+        struct Task Task = { Function, Data, Cost };
+        lluna_Container_DynamicArray_Append(Handle->Tasks, (byte*)&Task);
+        Handle->Compiled = false;
+
+        return lluna_Jobs_Graph_TaskCount(Handle) - 1;
+}
+
+void lluna_Jobs_Graph_Read(struct lluna_Jobs_Graph* Handle, uint32 Task, const void* Resource)
+{
+        Declare(Handle, Task, Resource, false);
+}
+
+void lluna_Jobs_Graph_Write(struct lluna_Jobs_Graph* Handle, uint32 Task, const void* Resource)
+{
+        Declare(Handle, Task, Resource, true);
+}
+
+void lluna_Jobs_Graph_Depend(struct lluna_Jobs_Graph* Handle, uint32 Task, uint32 Before)
+{
+        struct Edge Edge = { Before, Task };
+        lluna_Container_DynamicArray_Append(Handle->Dependencies, (byte*)&Edge);
+        Handle->Compiled = false;
+}
+
+void lluna_Jobs_Graph_Compile(struct lluna_Jobs_Graph* Handle)
+{
+        ReleaseCompiled(Handle);
+
+        uint32 TaskCount = lluna_Jobs_Graph_TaskCount(Handle);
+        struct lluna_Container_DynamicArray* Edges = lluna_Container_DynamicArray_Create(InitialCapacity, sizeof(struct Edge));
+        AddResourceEdges(Handle, Edges);
+        for (uint64 Index = 0; Index < lluna_Container_DynamicArray_Count(Handle->Dependencies); ++Index)
+        {
+                lluna_Container_DynamicArray_Append(Edges, lluna_Container_DynamicArray_Get(Handle->Dependencies, Index));
+        }
+
+        // Several resources can order the same pair of tasks, only one edge is kept.
+        struct Edge* Sorted = (struct Edge*)Edges->Data;
+        uint64 EdgeCount = lluna_Container_DynamicArray_Count(Edges);
+        SortEdges_Range(Sorted, EdgeCount);
+
+        Handle->SuccessorOffsets = calloc((uint64)TaskCount + 1, sizeof(uint32));
+        Handle->Successors = malloc((EdgeCount > 0 ? EdgeCount : 1) * sizeof(uint32));
+        Handle->PredecessorCounts = calloc(TaskCount > 0 ? TaskCount : 1, sizeof(uint32));
+        uint32 SuccessorCount = 0;
+        for (uint64 Index = 0; Index < EdgeCount; ++Index)
+        {
+                if (Index > 0 && Sorted[Index].From == Sorted[Index - 1].From && Sorted[Index].To == Sorted[Index - 1].To)
+                {
+                        continue;
+                }
+                Handle->Successors[SuccessorCount++] = Sorted[Index].To;
+                ++Handle->SuccessorOffsets[Sorted[Index].From + 1];
+                ++Handle->PredecessorCounts[Sorted[Index].To];
+        }
+        for (uint32 Task = 0; Task < TaskCount; ++Task)
+        {
+                Handle->SuccessorOffsets[Task + 1] += Handle->SuccessorOffsets[Task];
+        }
+        lluna_Container_DynamicArray_Destroy(Edges);
+
+        // Every edge goes from an earlier task to a later one, so walking backwards visits successors first.
+        Handle->Priorities = malloc((TaskCount > 0 ? TaskCount : 1) * sizeof(uint64));
+        Handle->CriticalPathCost = 0;
+        for (uint32 Task = TaskCount; Task-- > 0;)
+        {
+                uint64 Longest = 0;
+                for (uint32 Index = Handle->SuccessorOffsets[Task]; Index < Handle->SuccessorOffsets[Task + 1]; ++Index)
+                {
+                        uint64 Priority = Handle->Priorities[Handle->Successors[Index]];
+                        Longest = Priority > Longest ? Priority : Longest;
+                }
+                Handle->Priorities[Task] = Tasks(Handle)[Task].Cost + Longest;
+                if (Handle->Priorities[Task] > Handle->CriticalPathCost)
+                {
+                        Handle->CriticalPathCost = Handle->Priorities[Task];
+                }
+        }
+
+        Handle->Remaining = malloc((TaskCount > 0 ? TaskCount : 1) * sizeof(uint32));
+        Handle->Ready = malloc((TaskCount > 0 ? TaskCount : 1) * sizeof(uint32));
+        Handle->Runners = malloc((TaskCount > 0 ? TaskCount : 1) * sizeof(struct lluna_Jobs_Job));
+        Handle->Compiled = true;
+}
+
+void lluna_Jobs_Graph_Run(struct lluna_Jobs_Graph* Handle, struct lluna_Jobs_Scheduler* Scheduler)
+{
+        if (!Handle->Compiled)
+        {
+                lluna_Jobs_Graph_Compile(Handle);
+        }
+
+        uint32 TaskCount = lluna_Jobs_Graph_TaskCount(Handle);
+        if (TaskCount == 0)
+        {
+                return;
+        }
+
+        memcpy(Handle->Remaining, Handle->PredecessorCounts, TaskCount * sizeof(uint32));
+        Handle->Scheduler = Scheduler;
+        Handle->ReadyCount = 0;
+        Handle->LaunchCount = 0;
+        for (uint32 Task = 0; Task < TaskCount; ++Task)
+        {
+                if (Handle->Remaining[Task] == 0)
+                {
+                        PushReady(Handle, Task);
+                }
+        }
+
+        uint32 First = 0;
+        lluna_Core_Sync_LockMutex(&Handle->ReadyLock);
+        uint32 Count = ReserveRunners(Handle, Handle->ReadyCount, &First);
+        lluna_Core_Sync_UnlockMutex(&Handle->ReadyLock);
+
+        if (Count > 0)
+        {
+                LaunchRunners(Handle, First, Count);
+                lluna_Jobs_Scheduler_Wait(Scheduler, &Handle->Counter);
+        }
+        else
+        {
+                Handle->RunnerCount = 1;
+                RunReady(Handle);
+        }
+}
+
+uint32 lluna_Jobs_Graph_TaskCount(struct lluna_Jobs_Graph* Handle)
+{
+        return (uint32)lluna_Container_DynamicArray_Count(Handle->Tasks);
+}
+
+uint64 lluna_Jobs_Graph_CriticalPathCost(struct lluna_Jobs_Graph* Handle)
+{
+        return Handle->CriticalPathCost;
+}
@@ -0,0 +1,462 @@
+#include <Engine/Jobs/Public/Parallel.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+// Runs below this length are insertion sorted before merging.
+#define InsertionSortLimit 16
+
+struct Pass
+{
+        byte* Data;
+        byte* Buffer;
+        uint32 ElementSize;
+
+        lluna_Jobs_Parallel_ForFunction For;
+        lluna_Jobs_Parallel_CombineFunction Combine;
+        lluna_Jobs_Parallel_CompareFunction Compare;
+        void* Context;
+
+        const byte* Identity;
+        byte* Partials;
+        uint64 ChunkCount;
+        boolean Exclusive;
+};
+
+struct ChunkTask
+{
+        struct Pass* Pass;
+        uint64 Chunk;
+        uint64 Index;
+        uint64 Count;
+};
+
+// Merges the output range [First, Last) of two adjacent sorted runs starting at Start.
+struct MergeTask
+{
+        struct Pass* Pass;
+        const byte* Source;
+        byte* Destination;
+        uint64 Start;
+        uint64 LeftCount;
+        uint64 RightCount;
+        uint64 First;
+        uint64 Last;
+};
+
+static uint64 PickGrainSize(struct lluna_Jobs_Scheduler* Scheduler, uint64 Count, uint64 GrainSize)
+{
+        if (GrainSize > 0)
+        {
+                return GrainSize;
+        }
+
+        uint64 Chunks = (uint64)lluna_Jobs_Scheduler_WorkerCount(Scheduler) * lluna_Jobs_Parallel_ChunksPerWorker;
+        uint64 Size = (Count + Chunks - 1) / Chunks;
+
+        return Size > 0 ? Size : 1;
+}
+
+static void RunTasks(struct lluna_Jobs_Scheduler* Scheduler, void* Tasks, uint64 TaskSize, uint64 Count, lluna_Jobs_Function Function)
+{
+        struct lluna_Jobs_Job* Jobs = malloc(Count * sizeof(struct lluna_Jobs_Job));
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                Jobs[Index].Function = Function;
+                Jobs[Index].Data = (byte*)Tasks + Index * TaskSize;
+        }
+
+        struct lluna_Jobs_Counter Counter = { 0 };
+        lluna_Jobs_Scheduler_Run(Scheduler, Jobs, Count, &Counter);
+        lluna_Jobs_Scheduler_Wait(Scheduler, &Counter);
+
+        free(Jobs);
+}
+
+// Splits the array into chunks of GrainSize elements and runs Function on each of them.
+static void RunChunks(struct lluna_Jobs_Scheduler* Scheduler, struct Pass* Pass, uint64 Count, uint64 GrainSize, uint64 ChunkCount, lluna_Jobs_Function Function)
+{
+        struct ChunkTask* Tasks = malloc(ChunkCount * sizeof(struct ChunkTask));
+        for (uint64 Chunk = 0; Chunk < ChunkCount; ++Chunk)
+        {
+                Tasks[Chunk].Pass = Pass;
+                Tasks[Chunk].Chunk = Chunk;
+                Tasks[Chunk].Index = Chunk * GrainSize;
+                Tasks[Chunk].Count = Count - Tasks[Chunk].Index < GrainSize ? Count - Tasks[Chunk].Index : GrainSize;
+        }
+
+        RunTasks(Scheduler, Tasks, sizeof(struct ChunkTask), ChunkCount, Function);
+
+        free(Tasks);
+}
+
+static void ForChunk(void* Data)
+{
+        struct ChunkTask* Task = (struct ChunkTask*)Data;
+        struct Pass* Pass = Task->Pass;
+
+        Pass->For(Pass->Context, Pass->Data + Task->Index * Pass->ElementSize, Task->Index, Task->Count);
+}
+
+static void ReduceChunk(void* Data)
+{
+        struct ChunkTask* Task = (struct ChunkTask*)Data;
+        struct Pass* Pass = Task->Pass;
+        uint32 ElementSize = Pass->ElementSize;
+
+        byte* Partial = Pass->Partials + Task->Chunk * ElementSize;
+        memcpy(Partial, Pass->Identity, ElementSize);
+
+        byte* Element = Pass->Data + Task->Index * ElementSize;
+        for (uint64 Index = 0; Index < Task->Count; ++Index, Element += ElementSize)
+        {
+                Pass->Combine(Pass->Context, Partial, Element);
+        }
+}
+
+// Scans a chunk starting from the combination of all chunks before it, which the serial step left in its partial.
+static void ScanChunk(void* Data)
+{
+        struct ChunkTask* Task = (struct ChunkTask*)Data;
+        struct Pass* Pass = Task->Pass;
+        uint32 ElementSize = Pass->ElementSize;
+
+        byte* Running = Pass->Partials + Task->Chunk * ElementSize;
+        byte* Scratch = Pass->Partials + (Pass->ChunkCount + Task->Chunk) * ElementSize;
+
+        byte* Element = Pass->Data + Task->Index * ElementSize;
+        for (uint64 Index = 0; Index < Task->Count; ++Index, Element += ElementSize)
+        {
+                if (Pass->Exclusive)
+                {
+                        memcpy(Scratch, Element, ElementSize);
+                        memcpy(Element, Running, ElementSize);
+                        Pass->Combine(Pass->Context, Running, Scratch);
+                }
+                else
+                {
+                        Pass->Combine(Pass->Context, Running, Element);
+                        memcpy(Element, Running, ElementSize);
+                }
+        }
+}
+
+void lluna_Jobs_Parallel_For(struct lluna_Jobs_Scheduler* Scheduler, struct lluna_Container_DynamicArray* Handle, uint64 GrainSize, lluna_Jobs_Parallel_ForFunction Function, void* Context)
+{
+        uint64 Count = lluna_Container_DynamicArray_Count(Handle);
+        if (Count == 0)
+        {
+                return;
+        }
+
+        GrainSize = PickGrainSize(Scheduler, Count, GrainSize);
+
+        lluna_Container_DynamicArray_Unshare(Handle);
+
+        struct Pass Pass = { 0 };
+        Pass.Data = Handle->Data;
+        Pass.ElementSize = Handle->ElementSize;
+        Pass.For = Function;
+        Pass.Context = Context;
+
+        RunChunks(Scheduler, &Pass, Count, GrainSize, (Count + GrainSize - 1) / GrainSize, ForChunk);
+}
+
+void lluna_Jobs_Parallel_Reduce(struct lluna_Jobs_Scheduler* Scheduler, struct lluna_Container_DynamicArray* Handle, uint64 GrainSize, const byte* Identity, lluna_Jobs_Parallel_CombineFunction Function, void* Context, byte* Result)
+{
+        uint32 ElementSize = Handle->ElementSize;
+        uint64 Count = lluna_Container_DynamicArray_Count(Handle);
+
+        memcpy(Result, Identity, ElementSize);
+        if (Count == 0)
+        {
+                return;
+        }
+
+        GrainSize = PickGrainSize(Scheduler, Count, GrainSize);
+        uint64 ChunkCount = (Count + GrainSize - 1) / GrainSize;
+
+        struct Pass Pass = { 0 };
+        Pass.Data = Handle->Data;
+        Pass.ElementSize = ElementSize;
+        Pass.Combine = Function;
+        Pass.Context = Context;
+        Pass.Identity = Identity;
+        Pass.Partials = malloc(ChunkCount * ElementSize);
+
+        RunChunks(Scheduler, &Pass, Count, GrainSize, ChunkCount, ReduceChunk);
+
+        for (uint64 Chunk = 0; Chunk < ChunkCount; ++Chunk)
+        {
+                Function(Context, Result, Pass.Partials + Chunk * ElementSize);
+        }
+
+        free(Pass.Partials);
+}
+
+static void Scan(struct lluna_Jobs_Scheduler* Scheduler, struct lluna_Container_DynamicArray* Handle, uint64 GrainSize, const byte* Identity, lluna_Jobs_Parallel_CombineFunction Function, void* Context, boolean Exclusive)
+{
+        uint32 ElementSize = Handle->ElementSize;
+        uint64 Count = lluna_Container_DynamicArray_Count(Handle);
+        if (Count == 0)
+        {
+                return;
+        }
+
+        GrainSize = PickGrainSize(Scheduler, Count, GrainSize);
+        uint64 ChunkCount = (Count + GrainSize - 1) / GrainSize;
+
+        lluna_Container_DynamicArray_Unshare(Handle);
+
+        // Partials hold one total per chunk, followed by one scratch element per chunk for exclusive scans.
+        struct Pass Pass = { 0 };
+        Pass.Data = Handle->Data;
+        Pass.ElementSize = ElementSize;
+        Pass.Combine = Function;
+        Pass.Context = Context;
+        Pass.Identity = Identity;
+        Pass.Partials = malloc(2 * ChunkCount * ElementSize);
+        Pass.ChunkCount = ChunkCount;
+        Pass.Exclusive = Exclusive;
+
+        // The total of the last chunk is never needed.
+        if (ChunkCount > 1)
+        {
+                RunChunks(Scheduler, &Pass, Count, GrainSize, ChunkCount - 1, ReduceChunk);
+        }
+
+        // Turns chunk totals into the combination of all chunks before each one.
+        byte* Running = Pass.Partials + ChunkCount * ElementSize;
+        byte* Total = Running + ElementSize;
+        memcpy(Running, Identity, ElementSize);
+        for (uint64 Chunk = 0; Chunk < ChunkCount; ++Chunk)
+        {
+                byte* Partial = Pass.Partials + Chunk * ElementSize;
+                if (Chunk + 1 < ChunkCount)
+                {
+                        memcpy(Total, Partial, ElementSize);
+                }
+                memcpy(Partial, Running, ElementSize);
+                if (Chunk + 1 < ChunkCount)
+                {
+                        Function(Context, Running, Total);
+                }
+        }
+
+        RunChunks(Scheduler, &Pass, Count, GrainSize, ChunkCount, ScanChunk);
+
+        free(Pass.Partials);
+}
+
+void lluna_Jobs_Parallel_InclusiveScan(struct lluna_Jobs_Scheduler* Scheduler, struct lluna_Container_DynamicArray* Handle, uint64 GrainSize, const byte* Identity, lluna_Jobs_Parallel_CombineFunction Function, void* Context)
+{
+        Scan(Scheduler, Handle, GrainSize, Identity, Function, Context, false);
+}
+
+void lluna_Jobs_Parallel_ExclusiveScan(struct lluna_Jobs_Scheduler* Scheduler, struct lluna_Container_DynamicArray* Handle, uint64 GrainSize, const byte* Identity, lluna_Jobs_Parallel_CombineFunction Function, void* Context)
+{
+        Scan(Scheduler, Handle, GrainSize, Identity, Function, Context, true);
+}
+
+// Stable merge: on ties the element from the left run goes first.
+static void MergeRuns(struct Pass* Pass, const byte* Left, uint64 LeftCount, const byte* Right, uint64 RightCount, byte* Destination)
+{
+        uint32 ElementSize = Pass->ElementSize;
+        const byte* LeftEnd = Left + LeftCount * ElementSize;
+        const byte* RightEnd = Right + RightCount * ElementSize;
+
+        while (Left < LeftEnd && Right < RightEnd)
+        {
+                if (Pass->Compare(Pass->Context, Right, Left) < 0)
+                {
+                        memcpy(Destination, Right, ElementSize);
+                        Right += ElementSize;
+                }
+                else
+                {
+                        memcpy(Destination, Left, ElementSize);
+                        Left += ElementSize;
+                }
+                Destination += ElementSize;
+        }
+
+        memcpy(Destination, Left, LeftEnd - Left);
+        memcpy(Destination + (LeftEnd - Left), Right, RightEnd - Right);
+}
+
+// Inserts each element after the equivalent ones before it. Temporary is one element of scratch space.
+static void InsertionSort(struct Pass* Pass, byte* Data, uint64 Count, byte* Temporary)
+{
+        uint32 ElementSize = Pass->ElementSize;
+        for (uint64 Index = 1; Index < Count; ++Index)
+        {
+                byte* Element = Data + Index * ElementSize;
+
+                uint64 Position = Index;
+                while (Position > 0 && Pass->Compare(Pass->Context, Element, Data + (Position - 1) * ElementSize) < 0)
+                {
+                        --Position;
+                }
+
+                if (Position != Index)
+                {
+                        memcpy(Temporary, Element, ElementSize);
+                        memmove(Data + (Position + 1) * ElementSize, Data + Position * ElementSize, (Index - Position) * ElementSize);
+                        memcpy(Data + Position * ElementSize, Temporary, ElementSize);
+                }
+        }
+}
+
+// Bottom-up merge sort of one chunk, bouncing between the chunk and its part of the buffer.
+static void SortChunk(void* Data)
+{
+        struct ChunkTask* Task = (struct ChunkTask*)Data;
+        struct Pass* Pass = Task->Pass;
+        uint32 ElementSize = Pass->ElementSize;
+
+        byte* Source = Pass->Data + Task->Index * ElementSize;
+        byte* Destination = Pass->Buffer + Task->Index * ElementSize;
+        uint64 Count = Task->Count;
+
+        for (uint64 Start = 0; Start < Count; Start += InsertionSortLimit)
+        {
+                uint64 RunCount = Count - Start < InsertionSortLimit ? Count - Start : InsertionSortLimit;
+                InsertionSort(Pass, Source + Start * ElementSize, RunCount, Destination);
+        }
+
+        for (uint64 Width = InsertionSortLimit; Width < Count; Width *= 2)
+        {
+                for (uint64 Start = 0; Start < Count; Start += 2 * Width)
+                {
+                        uint64 LeftCount = Count - Start < Width ? Count - Start : Width;
+                        uint64 RightCount = Count - Start - LeftCount < Width ? Count - Start - LeftCount : Width;
+                        MergeRuns(Pass, Source + Start * ElementSize, LeftCount, Source + (Start + LeftCount) * ElementSize, RightCount, Destination + Start * ElementSize);
+                }
+
+                byte* Swap = Source;
+                Source = Destination;
+                Destination = Swap;
+        }
+
+        if (Source != Pass->Data + Task->Index * ElementSize)
+        {
+                memcpy(Destination, Source, Count * ElementSize);
+        }
+}
+
+// Returns how many elements of the left run are among the first Output elements of the merged runs.
+static uint64 CoRank(struct Pass* Pass, const byte* Left, uint64 LeftCount, const byte* Right, uint64 RightCount, uint64 Output)
+{
+        uint32 ElementSize = Pass->ElementSize;
+        uint64 Low = Output > RightCount ? Output - RightCount : 0;
+        uint64 High = Output < LeftCount ? Output : LeftCount;
+
+        // Smallest split where the last right element taken goes strictly before the next left element.
+        while (Low < High)
+        {
+                uint64 Middle = Low + (High - Low) / 2;
+                uint64 RightTaken = Output - Middle;
+                if (RightTaken == 0 || Pass->Compare(Pass->Context, Right + (RightTaken - 1) * ElementSize, Left + Middle * ElementSize) < 0)
+                {
+                        High = Middle;
+                }
+                else
+                {
+                        Low = Middle + 1;
+                }
+        }
+
+        return Low;
+}
+
+static void MergePiece(void* Data)
+{
+        struct MergeTask* Task = (struct MergeTask*)Data;
+        struct Pass* Pass = Task->Pass;
+        uint32 ElementSize = Pass->ElementSize;
+
+        const byte* Left = Task->Source + Task->Start * ElementSize;
+        const byte* Right = Left + Task->LeftCount * ElementSize;
+
+        uint64 LeftFirst = CoRank(Pass, Left, Task->LeftCount, Right, Task->RightCount, Task->First);
+        uint64 LeftLast = CoRank(Pass, Left, Task->LeftCount, Right, Task->RightCount, Task->Last);
+        uint64 RightFirst = Task->First - LeftFirst;
+        uint64 RightLast = Task->Last - LeftLast;
+
+        MergeRuns(Pass, Left + LeftFirst * ElementSize, LeftLast - LeftFirst, Right + RightFirst * ElementSize, RightLast - RightFirst,
+                Task->Destination + (Task->Start + Task->First) * ElementSize);
+}
+
+// Merges each pair of adjacent runs of Width elements from Source into Destination, in pieces of at most GrainSize elements.
+// Runs without a pair are copied the same way.
+static void MergeRound(struct lluna_Jobs_Scheduler* Scheduler, struct Pass* Pass, struct MergeTask* Tasks, const byte* Source, byte* Destination, uint64 Count, uint64 Width, uint64 GrainSize)
+{
+        uint64 TaskCount = 0;
+        for (uint64 Start = 0; Start < Count; Start += 2 * Width)
+        {
+                uint64 LeftCount = Count - Start < Width ? Count - Start : Width;
+                uint64 RightCount = Count - Start - LeftCount < Width ? Count - Start - LeftCount : Width;
+
+                uint64 Total = LeftCount + RightCount;
+                for (uint64 First = 0; First < Total; First += GrainSize)
+                {
+                        struct MergeTask* Task = &Tasks[TaskCount++];
+                        Task->Pass = Pass;
+                        Task->Source = Source;
+                        Task->Destination = Destination;
+                        Task->Start = Start;
+                        Task->LeftCount = LeftCount;
+                        Task->RightCount = RightCount;
+                        Task->First = First;
+                        Task->Last = Total - First < GrainSize ? Total : First + GrainSize;
+                }
+        }
+
+        RunTasks(Scheduler, Tasks, sizeof(struct MergeTask), TaskCount, MergePiece);
+}
+
+void lluna_Jobs_Parallel_Sort(struct lluna_Jobs_Scheduler* Scheduler, struct lluna_Container_DynamicArray* Handle, uint64 GrainSize, lluna_Jobs_Parallel_CompareFunction Function, void* Context)
+{
+        uint64 Count = lluna_Container_DynamicArray_Count(Handle);
+        if (Count < 2)
+        {
+                return;
+        }
+
+        GrainSize = PickGrainSize(Scheduler, Count, GrainSize);
+        uint64 ChunkCount = (Count + GrainSize - 1) / GrainSize;
+
+        lluna_Container_DynamicArray_Unshare(Handle);
+
+        struct Pass Pass = { 0 };
+        Pass.Data = Handle->Data;
+        Pass.Buffer = malloc(Count * Handle->ElementSize);
+        Pass.ElementSize = Handle->ElementSize;
+        Pass.Compare = Function;
+        Pass.Context = Context;
+
+        RunChunks(Scheduler, &Pass, Count, GrainSize, ChunkCount, SortChunk);
+
+        // Every pair of runs adds at most one piece beyond the pieces of the whole array.
+        struct MergeTask* Tasks = malloc(2 * ChunkCount * sizeof(struct MergeTask));
+
+        byte* Source = Pass.Data;
+        byte* Destination = Pass.Buffer;
+        for (uint64 Width = GrainSize; Width < Count; Width *= 2)
+        {
+                MergeRound(Scheduler, &Pass, Tasks, Source, Destination, Count, Width, GrainSize);
+
+                byte* Swap = Source;
+                Source = Destination;
+                Destination = Swap;
+        }
+
+        // A single run as wide as the array is copied back in parallel.
+        if (Source != Pass.Data)
+        {
+                MergeRound(Scheduler, &Pass, Tasks, Source, Destination, Count, Count, GrainSize);
+        }
+
+        free(Tasks);
+        free(Pass.Buffer);
+}
@@ -0,0 +1,436 @@
+#include <Engine/Jobs/Public/Scheduler.h>
+
+#include <Engine/Core/Public/Atomics.h>
+#include <Engine/Core/Public/Fiber.h>
+#include <Engine/Core/Public/Profiler.h>
+#include <Engine/Jobs/Public/Deque.h>
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// Failed rounds of looking for jobs before an idle worker goes to sleep.
+#define SpinLimit 64
+
+// Rounds of looking for jobs that only pause the core before yielding it.
+#define PauseLimit 16
+
+#define InitialDequeCapacity 256
+
+struct lluna_Jobs_Worker
+{
+        struct lluna_Jobs_Scheduler* Scheduler;
+        struct lluna_Jobs_Deque* Deque;
+        uint32 Index;
+        uint64 RandomState;
+
+        pthread_t Thread;
+        struct lluna_Jobs_Worker* Previous;
+
+        struct lluna_Core_Fiber* Fiber;
+        struct lluna_Core_Fiber* Next;
+        struct lluna_Jobs_Waiter* Suspending;
+};
+
+// Lives on the stack of the suspended job.
+struct lluna_Jobs_Waiter
+{
+        struct lluna_Core_Fiber* Fiber;
+        struct lluna_Jobs_Counter* Counter;
+
+        struct lluna_Jobs_Waiter* Next;
+};
+
+static __thread struct lluna_Jobs_Worker* CurrentWorker = NULL;
+
+// Suspended jobs can continue on another thread, so the thread local is looked up again on every use instead of
+// having its address kept around by the compiler.
+__attribute__((noinline)) static struct lluna_Jobs_Worker* GetCurrentWorker()
+{
+        return CurrentWorker;
+}
+
+static void Relax(uint32 Attempt)
+{
+        if (Attempt < PauseLimit)
+        {
+                lluna_Core_Atomics_Pause();
+        }
+        else
+        {
+                lluna_Core_Atomics_Yield();
+        }
+}
+
+static uint64 NextRandom(struct lluna_Jobs_Worker* Worker)
+{
+        Worker->RandomState ^= Worker->RandomState >> 12;
+        Worker->RandomState ^= Worker->RandomState << 25;
+        Worker->RandomState ^= Worker->RandomState >> 27;
+
+        return Worker->RandomState * 0x2545F4914F6CDD1DULL;
+}
+
+static struct lluna_Jobs_Worker* GetWorker(struct lluna_Jobs_Scheduler* Handle)
+{
+        struct lluna_Jobs_Worker* Worker = GetCurrentWorker();
+
+        return Worker && Worker->Scheduler == Handle ? Worker : NULL;
+}
+
+// Pops from the worker's own deque first, then tries a round of random victims.
+static struct lluna_Jobs_Job* FindJob(struct lluna_Jobs_Worker* Worker)
+{
+        struct lluna_Jobs_Job* Job = lluna_Jobs_Deque_Pop(Worker->Deque);
+        if (Job)
+        {
+                return Job;
+        }
+
+        struct lluna_Jobs_Scheduler* Scheduler = Worker->Scheduler;
+        for (uint32 Attempt = 1; Attempt < Scheduler->WorkerCount * 2; ++Attempt)
+        {
+                uint32 Victim = (uint32)(NextRandom(Worker) % Scheduler->WorkerCount);
+                if (Victim == Worker->Index)
+                {
+                        continue;
+                }
+
+                if (lluna_Jobs_Deque_Steal(Scheduler->Workers[Victim].Deque, &Job) && Job)
+                {
+                        return Job;
+                }
+        }
+
+        return NULL;
+}
+
+static boolean HasJobs(struct lluna_Jobs_Scheduler* Handle)
+{
+        for (uint32 Index = 0; Index < Handle->WorkerCount; ++Index)
+        {
+                if (!lluna_Jobs_Deque_Empty(Handle->Workers[Index].Deque))
+                {
+                        return true;
+                }
+        }
+
+        return false;
+}
+
+// Links a job that just suspended its fiber. The job isn't visible to other workers before its fiber switched out.
+static void Park(struct lluna_Jobs_Scheduler* Handle, struct lluna_Jobs_Waiter* Waiter)
+{
+        lluna_Core_Sync_LockMutex(&Handle->WaitingLock);
+        Waiter->Next = Handle->Waiting;
+        Handle->Waiting = Waiter;
+        lluna_Core_Sync_UnlockMutex(&Handle->WaitingLock);
+
+        lluna_Core_Atomics_FetchAddUint32(&Handle->WaitingCount, 1, lluna_Core_Atomics_SequentiallyConsistent);
+}
+
+// Finds a suspended job whose counter is done, unlinking it if Take is true.
+static struct lluna_Core_Fiber* FindReady(struct lluna_Jobs_Scheduler* Handle, boolean Take)
+{
+        if (lluna_Core_Atomics_LoadUint32(&Handle->WaitingCount, lluna_Core_Atomics_Relaxed) == 0)
+        {
+                return NULL;
+        }
+
+        struct lluna_Core_Fiber* Fiber = NULL;
+        lluna_Core_Sync_LockMutex(&Handle->WaitingLock);
+        for (struct lluna_Jobs_Waiter** Link = &Handle->Waiting; *Link; Link = &(*Link)->Next)
+        {
+                if (lluna_Jobs_Scheduler_Done((*Link)->Counter))
+                {
+                        Fiber = (*Link)->Fiber;
+                        if (Take)
+                        {
+                                *Link = (*Link)->Next;
+                                lluna_Core_Atomics_FetchSubUint32(&Handle->WaitingCount, 1, lluna_Core_Atomics_Relaxed);
+                        }
+                        break;
+                }
+        }
+        lluna_Core_Sync_UnlockMutex(&Handle->WaitingLock);
+
+        return Fiber;
+}
+
+static void Sleep(struct lluna_Jobs_Scheduler* Handle)
+{
+        // Announce sleeping before the last look at the deques and suspended jobs. Pairs with the fences in WakeUp and
+        // Execute, so either the pushing or finishing thread sees a sleeper or this thread sees the job.
+        lluna_Core_Atomics_FetchAddUint32(&Handle->SleepingCount, 1, lluna_Core_Atomics_SequentiallyConsistent);
+        lluna_Core_Atomics_Fence(lluna_Core_Atomics_SequentiallyConsistent);
+
+        if (!lluna_Core_Atomics_LoadUint32(&Handle->Stopping, lluna_Core_Atomics_Acquire) && !HasJobs(Handle) && !FindReady(Handle, false))
+        {
+                lluna_Core_Sync_AcquireSemaphore(&Handle->Sleeper);
+        }
+
+        lluna_Core_Atomics_FetchSubUint32(&Handle->SleepingCount, 1, lluna_Core_Atomics_SequentiallyConsistent);
+}
+
+// Units left over by sleepers that found jobs on their last look only cause spurious wake ups, so they are counted
+// against the sleepers still to wake.
+static void WakeUp(struct lluna_Jobs_Scheduler* Handle, uint64 Count)
+{
+        lluna_Core_Atomics_Fence(lluna_Core_Atomics_SequentiallyConsistent);
+        uint32 SleepingCount = lluna_Core_Atomics_LoadUint32(&Handle->SleepingCount, lluna_Core_Atomics_Relaxed);
+        uint32 Pending = lluna_Core_Atomics_LoadUint32(&Handle->Sleeper.Count, lluna_Core_Atomics_Relaxed);
+        if (SleepingCount <= Pending)
+        {
+                return;
+        }
+
+        lluna_Core_Sync_ReleaseSemaphore(&Handle->Sleeper, Count < SleepingCount - Pending ? (uint32)Count : SleepingCount - Pending);
+}
+
+static void Execute(struct lluna_Jobs_Scheduler* Handle, struct lluna_Jobs_Job* Job)
+{
+        struct lluna_Jobs_Counter* Counter = Job->Counter;
+
+        Job->Function(Job->Data);
+
+        if (Counter && lluna_Core_Atomics_FetchSubInt64(&Counter->Value, 1, lluna_Core_Atomics_Release) == 1)
+        {
+                // A suspended job may be waiting on this counter, so a worker has to be awake to continue it.
+                // Pairs with the fence in Sleep like WakeUp does.
+                lluna_Core_Atomics_Fence(lluna_Core_Atomics_SequentiallyConsistent);
+                if (lluna_Core_Atomics_LoadUint32(&Handle->WaitingCount, lluna_Core_Atomics_Relaxed) > 0)
+                {
+                        WakeUp(Handle, 1);
+                }
+        }
+}
+
+// Runs jobs on a worker fiber until the scheduler stops or a suspended job is ready to continue on this worker.
+// Jobs can suspend the fiber and continue it on another worker, so the worker is looked up again after each job.
+static void RunJobs(void* Data)
+{
+        struct lluna_Jobs_Scheduler* Scheduler = (struct lluna_Jobs_Scheduler*)Data;
+
+        uint32 IdleRounds = 0;
+        while (!lluna_Core_Atomics_LoadUint32(&Scheduler->Stopping, lluna_Core_Atomics_Acquire))
+        {
+                struct lluna_Jobs_Worker* Worker = GetCurrentWorker();
+                struct lluna_Core_Fiber* Ready = FindReady(Scheduler, true);
+                if (Ready)
+                {
+                        Worker->Next = Ready;
+                        return;
+                }
+
+                struct lluna_Jobs_Job* Job = FindJob(Worker);
+                if (Job)
+                {
+                        Execute(Scheduler, Job);
+                        IdleRounds = 0;
+                }
+                else if (++IdleRounds < SpinLimit)
+                {
+                        Relax(IdleRounds);
+                }
+                else
+                {
+                        Sleep(Scheduler);
+                        IdleRounds = 0;
+                }
+        }
+}
+
+static void* WorkerMain(void* Argument)
+{
+        struct lluna_Jobs_Worker* Worker = (struct lluna_Jobs_Worker*)Argument;
+        struct lluna_Jobs_Scheduler* Scheduler = Worker->Scheduler;
+        CurrentWorker = Worker;
+        lluna_Core_Profiler_NameThread("Worker");
+
+        // Switches to fibers running jobs. When a job suspends, its fiber is parked and the worker carries on with a
+        // new one. When a suspended job is ready, the running fiber returns and the worker continues the ready one.
+        while (!lluna_Core_Atomics_LoadUint32(&Scheduler->Stopping, lluna_Core_Atomics_Acquire) || Worker->Next)
+        {
+                struct lluna_Core_Fiber* Fiber = Worker->Next;
+                Worker->Next = NULL;
+                if (!Fiber && Scheduler->Fibers)
+                {
+                        Fiber = lluna_Core_Fiber_Create(Scheduler->Fibers, RunJobs, Scheduler);
+                }
+                if (!Fiber)
+                {
+                        // No stack could be allocated, so jobs run on the thread stack and wait by running other jobs
+                        // like worker 0 does, until a suspended job is ready or the scheduler stops.
+                        RunJobs(Scheduler);
+                        continue;
+                }
+
+                Worker->Fiber = Fiber;
+                lluna_Core_Fiber_Resume(Fiber);
+                Worker->Fiber = NULL;
+
+                if (lluna_Core_Fiber_Finished(Fiber))
+                {
+                        lluna_Core_Fiber_Destroy(Fiber);
+                }
+                else
+                {
+                        Park(Scheduler, Worker->Suspending);
+                        Worker->Suspending = NULL;
+                }
+        }
+
+        return NULL;
+}
+
+struct lluna_Jobs_Scheduler* lluna_Jobs_Scheduler_Create(uint32 WorkerCount)
+{
+        if (WorkerCount == 0)
+        {
+                long OnlineCores = sysconf(_SC_NPROCESSORS_ONLN);
+                WorkerCount = OnlineCores > 0 ? (uint32)OnlineCores : 1;
+        }
+
+        struct lluna_Jobs_Scheduler* Handle = malloc(sizeof(struct lluna_Jobs_Scheduler));
+        Handle->Workers = malloc(WorkerCount * sizeof(struct lluna_Jobs_Worker));
+        Handle->WorkerCount = WorkerCount;
+        Handle->SleepingCount = 0;
+        Handle->Stopping = false;
+
+        lluna_Core_Sync_InitializeSemaphore(&Handle->Sleeper, 0);
+
+        Handle->Fibers = lluna_Core_Fiber_CreatePool(0);
+        lluna_Core_Sync_InitializeMutex(&Handle->WaitingLock);
+        Handle->Waiting = NULL;
+        Handle->WaitingCount = 0;
+
+        for (uint32 Index = 0; Index < WorkerCount; ++Index)
+        {
+                struct lluna_Jobs_Worker* Worker = &Handle->Workers[Index];
+                Worker->Scheduler = Handle;
+                Worker->Deque = lluna_Jobs_Deque_Create(InitialDequeCapacity);
+                Worker->Index = Index;
+                Worker->RandomState = 0x9E3779B97F4A7C15ULL * (Index + 1);
+                Worker->Previous = NULL;
+                Worker->Fiber = NULL;
+                Worker->Next = NULL;
+                Worker->Suspending = NULL;
+        }
+
+        // The creating thread is worker 0. Remember what it was before, so nested schedulers can be destroyed in order.
+        Handle->Workers[0].Thread = pthread_self();
+        Handle->Workers[0].Previous = CurrentWorker;
+        CurrentWorker = &Handle->Workers[0];
+
+        for (uint32 Index = 1; Index < WorkerCount; ++Index)
+        {
+                pthread_create(&Handle->Workers[Index].Thread, NULL, WorkerMain, &Handle->Workers[Index]);
+        }
+
+        return Handle;
+}
+
+void lluna_Jobs_Scheduler_Destroy(struct lluna_Jobs_Scheduler* Handle)
+{
+        // Workers announced as sleeping before seeing the flag are woken up, the others see it.
+        lluna_Core_Atomics_StoreUint32(&Handle->Stopping, true, lluna_Core_Atomics_SequentiallyConsistent);
+        lluna_Core_Sync_ReleaseSemaphore(&Handle->Sleeper, Handle->WorkerCount);
+
+        for (uint32 Index = 1; Index < Handle->WorkerCount; ++Index)
+        {
+                pthread_join(Handle->Workers[Index].Thread, NULL);
+        }
+
+        CurrentWorker = Handle->Workers[0].Previous;
+
+        for (uint32 Index = 0; Index < Handle->WorkerCount; ++Index)
+        {
+                lluna_Jobs_Deque_Destroy(Handle->Workers[Index].Deque);
+        }
+        if (Handle->Fibers)
+        {
+                lluna_Core_Fiber_DestroyPool(Handle->Fibers);
+        }
+
+        free(Handle->Workers);
+        free(Handle);
+}
+
+uint32 lluna_Jobs_Scheduler_WorkerCount(struct lluna_Jobs_Scheduler* Handle)
+{
+        return Handle->WorkerCount;
+}
+
+uint32 lluna_Jobs_Scheduler_WorkerIndex(struct lluna_Jobs_Scheduler* Handle)
+{
+        struct lluna_Jobs_Worker* Worker = GetWorker(Handle);
+
+        return Worker ? Worker->Index : Handle->WorkerCount;
+}
+
+void lluna_Jobs_Scheduler_Run(struct lluna_Jobs_Scheduler* Handle, struct lluna_Jobs_Job* Jobs, uint64 Count, struct lluna_Jobs_Counter* Counter)
+{
+        if (Count == 0)
+        {
+                return;
+        }
+
+        if (Counter)
+        {
+                lluna_Core_Atomics_FetchAddInt64(&Counter->Value, (int64)Count, lluna_Core_Atomics_Relaxed);
+        }
+
+        struct lluna_Jobs_Worker* Worker = GetWorker(Handle);
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                Jobs[Index].Counter = Counter;
+                if (Worker)
+                {
+                        lluna_Jobs_Deque_Push(Worker->Deque, &Jobs[Index]);
+                }
+                else
+                {
+                        Execute(Handle, &Jobs[Index]);
+                }
+        }
+
+        if (Worker)
+        {
+                WakeUp(Handle, Count);
+        }
+}
+
+void lluna_Jobs_Scheduler_Wait(struct lluna_Jobs_Scheduler* Handle, struct lluna_Jobs_Counter* Counter)
+{
+        struct lluna_Jobs_Worker* Worker = GetWorker(Handle);
+
+        // Jobs running on the worker fiber suspend it, the worker parks it once it switched out.
+        if (Worker && Worker->Fiber && Worker->Fiber == lluna_Core_Fiber_Current() && !lluna_Jobs_Scheduler_Done(Counter))
+        {
+                struct lluna_Jobs_Waiter Waiter = { Worker->Fiber, Counter, NULL };
+                Worker->Suspending = &Waiter;
+                lluna_Core_Fiber_Yield();
+
+                return;
+        }
+
+        uint32 IdleRounds = 0;
+        while (!lluna_Jobs_Scheduler_Done(Counter))
+        {
+                struct lluna_Jobs_Job* Job = Worker ? FindJob(Worker) : NULL;
+                if (Job)
+                {
+                        Execute(Handle, Job);
+                        IdleRounds = 0;
+                }
+                else
+                {
+                        Relax(++IdleRounds);
+                }
+        }
+}
+
+boolean lluna_Jobs_Scheduler_Done(struct lluna_Jobs_Counter* Counter)
+{
+        return lluna_Core_Atomics_LoadInt64(&Counter->Value, lluna_Core_Atomics_Acquire) == 0;
+}
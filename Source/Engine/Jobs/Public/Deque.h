@@ -0,0 +1,85 @@
+#pragma once
+
+/**
+ * @file Deque.h
+ * @brief Work-stealing deque of jobs.
+ *
+ * lluna_Jobs_Deque is a Chase-Lev deque: a single owner thread pushes and pops jobs at the bottom while any other thread steals from the top.
+ * Pushes and pops are wait-free for the owner except when racing for the last job. Steals take one compare and swap.
+ *
+ * The ring of slots doubles when full. Replaced rings stay alive until the deque is destroyed, since a thief may still be reading from them.
+ * Memory orderings follow Lê et al., "Correct and Efficient Work-Stealing for Weak Memory Models", with sequentially consistent accesses in place of fences.
+ */
+
+#include <Engine/Core/Public/Types.h>
+
+struct lluna_Jobs_Job;
+struct lluna_Jobs_DequeRing;
+
+/**
+ * @brief Describes a work-stealing deque.
+ */
+struct lluna_Jobs_Deque
+{
+        int64 Top; /**< Index of the oldest job, advanced by thieves. */
+        int64 Bottom; /**< Index one past the newest job, moved by the owner. */
+
+        struct lluna_Jobs_DequeRing* Ring; /**< Current ring of slots. */
+        struct lluna_Jobs_DequeRing* Retired; /**< Replaced rings, freed on destruction. */
+};
+
+/**
+ * @brief Creates a deque and returns a handle to it.
+ *
+ * @param InitialCapacity Initial number of slots, rounded up to a power of two.
+ * @return Handle to the created deque.
+ *
+ * @see lluna_Jobs_Deque_Destroy
+ */
+struct lluna_Jobs_Deque* lluna_Jobs_Deque_Create(uint64 InitialCapacity);
+/**
+ * @brief Destroys the given deque.
+ *
+ * No other thread may be using the deque.
+ *
+ * @param Handle Deque to destroy.
+ */
+void lluna_Jobs_Deque_Destroy(struct lluna_Jobs_Deque* Handle);
+
+/**
+ * @brief Pushes a job at the bottom of the deque.
+ *
+ * Only the owner thread may push.
+ *
+ * @param Handle Deque to push to.
+ * @param Job Job to push.
+ */
+void lluna_Jobs_Deque_Push(struct lluna_Jobs_Deque* Handle, struct lluna_Jobs_Job* Job);
+/**
+ * @brief Pops the newest job from the bottom of the deque.
+ *
+ * Only the owner thread may pop.
+ *
+ * @param Handle Deque to pop from.
+ * @return Popped job, or NULL if the deque is empty.
+ */
+struct lluna_Jobs_Job* lluna_Jobs_Deque_Pop(struct lluna_Jobs_Deque* Handle);
+/**
+ * @brief Steals the oldest job from the top of the deque.
+ *
+ * Can be called from any thread.
+ *
+ * @param Handle Deque to steal from.
+ * @param Job Stolen job, or NULL if the deque is empty.
+ * @return False if another thread won a race for the job, in which case stealing again may succeed.
+ */
+boolean lluna_Jobs_Deque_Steal(struct lluna_Jobs_Deque* Handle, struct lluna_Jobs_Job** Job);
+/**
+ * @brief Returns true if the deque looks empty.
+ *
+ * The result may be stale by the time it is used.
+ *
+ * @param Handle Deque to check.
+ * @return Whether or not the deque is empty.
+ */
+boolean lluna_Jobs_Deque_Empty(struct lluna_Jobs_Deque* Handle);
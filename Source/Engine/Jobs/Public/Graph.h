@@ -0,0 +1,143 @@
+#pragma once
+
+/**
+ * @file Graph.h
+ * @brief Task graphs scheduled along their critical path.
+ *
+ * A lluna_Jobs_Graph describes the work of a frame as tasks declaring which resources they read and write. Tasks run
+ * in declaration order as far as their accesses are concerned: a task reading a resource runs after the last task
+ * that wrote it, and a task writing a resource runs after every task that accessed it before. Tasks that don't
+ * conflict run at the same time, so independent systems overlap without having to be ordered by hand.
+ *
+ * Compiling a graph turns its declarations into a dependency DAG and gives every task a priority, the cost of the most
+ * expensive path from it to the end of the frame. Ready tasks are kept in a priority queue and handed to workers of a
+ * lluna_Jobs_Scheduler highest priority first, so work on the critical path starts as early as possible. The compiled
+ * graph is kept until new declarations are made, so a graph built once can be run every frame without recompiling.
+ *
+ * Resources are identified by address and are never dereferenced.
+ *
+ * @see lluna_Jobs_Scheduler
+ */
+
+#include <Engine/Core/Public/Sync.h>
+#include <Engine/Core/Public/Types.h>
+
+#include <Engine/Container/Public/DynamicArray.h>
+#include <Engine/Jobs/Public/Scheduler.h>
+
+/**
+ * @brief Describes a task graph.
+ *
+ * Should not be written to externally.
+ *
+ * @see lluna_Jobs_Graph_Create
+ */
+struct lluna_Jobs_Graph
+{
+        struct lluna_Container_DynamicArray* Tasks; /**< Declared tasks. */
+        struct lluna_Container_DynamicArray* Accesses; /**< Declared resource accesses. */
+        struct lluna_Container_DynamicArray* Dependencies; /**< Declared explicit dependencies. */
+        boolean Compiled; /**< True if the compiled graph matches the declarations. */
+
+        uint32* SuccessorOffsets; /**< Start of the successors of each task, followed by the total number of successors. */
+        uint32* Successors; /**< Tasks depending on each task, grouped by task. */
+        uint32* PredecessorCounts; /**< Number of tasks each task depends on. */
+        uint64* Priorities; /**< Cost of the most expensive path from each task to the end of the graph. */
+        uint64 CriticalPathCost; /**< Cost of the most expensive path through the graph. */
+
+        struct lluna_Core_Sync_Mutex ReadyLock; /**< Guards the scheduling state while the graph runs. */
+        uint32* Remaining; /**< Number of unfinished dependencies of each task. */
+        uint32* Ready; /**< Heap of tasks whose dependencies are finished, by priority. */
+        uint32 ReadyCount; /**< Number of ready tasks. */
+        uint32 RunnerCount; /**< Number of jobs taking ready tasks. */
+        uint32 LaunchCount; /**< Number of jobs started in the current run. */
+        struct lluna_Jobs_Job* Runners; /**< Jobs taking ready tasks, at most one per task. */
+        struct lluna_Jobs_Scheduler* Scheduler; /**< Scheduler of the current run. */
+        struct lluna_Jobs_Counter Counter; /**< Counts unfinished jobs of the current run. */
+};
+
+/**
+ * @brief Creates an empty task graph and returns a handle to it.
+ *
+ * @return Handle to the created graph.
+ *
+ * @see lluna_Jobs_Graph_Destroy
+ */
+struct lluna_Jobs_Graph* lluna_Jobs_Graph_Create();
+/**
+ * @brief Destroys the given graph.
+ *
+ * @param Handle Graph to destroy. Must not be running.
+ */
+void lluna_Jobs_Graph_Destroy(struct lluna_Jobs_Graph* Handle);
+
+/**
+ * @brief Adds a task to the graph.
+ *
+ * @param Handle Graph to add to.
+ * @param Function Function run by the task.
+ * @param Data User data passed to the function.
+ * @param Cost Estimated cost of the task, in any unit as long as all tasks of the graph agree.
+ * @return Index of the task, counting from 0 in declaration order.
+ */
+uint32 lluna_Jobs_Graph_AddTask(struct lluna_Jobs_Graph* Handle, lluna_Jobs_Function Function, void* Data, uint64 Cost);
+/**
+ * @brief Declares that a task reads a resource.
+ *
+ * @param Handle Graph of the task.
+ * @param Task Index of the task.
+ * @param Resource Address identifying the resource.
+ */
+void lluna_Jobs_Graph_Read(struct lluna_Jobs_Graph* Handle, uint32 Task, const void* Resource);
+/**
+ * @brief Declares that a task writes a resource.
+ *
+ * Writing implies reading, so a task declaring both is ordered as a writer.
+ *
+ * @param Handle Graph of the task.
+ * @param Task Index of the task.
+ * @param Resource Address identifying the resource.
+ */
+void lluna_Jobs_Graph_Write(struct lluna_Jobs_Graph* Handle, uint32 Task, const void* Resource);
+/**
+ * @brief Declares that a task has to run after another one, regardless of resources.
+ *
+ * @param Handle Graph of the tasks.
+ * @param Task Index of the dependent task.
+ * @param Before Index of the task to run first. Must be lower than `Task`, which keeps the graph acyclic.
+ */
+void lluna_Jobs_Graph_Depend(struct lluna_Jobs_Graph* Handle, uint32 Task, uint32 Before);
+
+/**
+ * @brief Builds the dependencies and priorities of the tasks from their declarations.
+ *
+ * Only needed to compile ahead of the first run, lluna_Jobs_Graph_Run compiles graphs that changed.
+ *
+ * @param Handle Graph to compile.
+ */
+void lluna_Jobs_Graph_Compile(struct lluna_Jobs_Graph* Handle);
+/**
+ * @brief Runs every task of the graph once and waits for them to finish.
+ *
+ * Must not be called again before it returns. Called from a thread that isn't a worker of the scheduler, the tasks
+ * run serially in priority order on the calling thread.
+ *
+ * @param Handle Graph to run.
+ * @param Scheduler Scheduler to run the tasks on.
+ */
+void lluna_Jobs_Graph_Run(struct lluna_Jobs_Graph* Handle, struct lluna_Jobs_Scheduler* Scheduler);
+
+/**
+ * @brief Returns the number of tasks in the graph.
+ *
+ * @param Handle Graph to query.
+ * @return Number of tasks.
+ */
+uint32 lluna_Jobs_Graph_TaskCount(struct lluna_Jobs_Graph* Handle);
+/**
+ * @brief Returns the cost of the most expensive chain of dependent tasks, a lower bound on the duration of a run.
+ *
+ * @param Handle Compiled graph to query.
+ * @return Sum of the costs of the tasks on the critical path.
+ */
+uint64 lluna_Jobs_Graph_CriticalPathCost(struct lluna_Jobs_Graph* Handle);
@@ -0,0 +1,128 @@
+#pragma once
+
+/**
+ * @file Parallel.h
+ * @brief Data-parallel algorithms over dynamic arrays.
+ *
+ * Splits a lluna_Container_DynamicArray into chunks of consecutive elements and processes them as jobs on a lluna_Jobs_Scheduler.
+ * Every call waits for its jobs before returning, helping to run them from the calling worker.
+ *
+ * Chunks only depend on the number of elements and the grain size, never on timing, and partial results are combined in index order.
+ * Reductions and scans over associative operations therefore give exactly the same result as a serial loop, and sorting is stable.
+ *
+ * Called from threads that aren't workers of the scheduler, the algorithms run serially on the calling thread.
+ *
+ * @see lluna_Jobs_Scheduler
+ */
+
+#include <Engine/Core/Public/Types.h>
+
+#include <Engine/Container/Public/DynamicArray.h>
+#include <Engine/Jobs/Public/Scheduler.h>
+
+/**
+ * @brief Number of chunks per worker picked when no grain size is given.
+ *
+ * More chunks than workers let faster workers steal the work of slower ones.
+ */
+#define lluna_Jobs_Parallel_ChunksPerWorker 4
+
+/**
+ * @brief Function run over a chunk of consecutive elements.
+ *
+ * @param Context User data passed to the algorithm.
+ * @param Elements Handle to the first element of the chunk.
+ * @param Index Index of the first element of the chunk.
+ * @param Count Number of elements in the chunk.
+ */
+typedef void (*lluna_Jobs_Parallel_ForFunction)(void* Context, byte* Elements, uint64 Index, uint64 Count);
+
+/**
+ * @brief Function combining an element into an accumulator of the same type.
+ *
+ * Has to be associative for parallel results to match serial ones.
+ *
+ * @param Context User data passed to the algorithm.
+ * @param Accumulator Element to update.
+ * @param Element Element to combine into the accumulator, which comes after it in index order.
+ */
+typedef void (*lluna_Jobs_Parallel_CombineFunction)(void* Context, byte* Accumulator, const byte* Element);
+
+/**
+ * @brief Function ordering two elements.
+ *
+ * @param Context User data passed to the algorithm.
+ * @param Left First element.
+ * @param Right Second element.
+ * @return Negative if `Left` goes before `Right`, positive if it goes after, 0 if they are equivalent.
+ */
+typedef int32 (*lluna_Jobs_Parallel_CompareFunction)(void* Context, const byte* Left, const byte* Right);
+
+/**
+ * @brief Runs a function over all elements of the array, one chunk at a time.
+ *
+ * @param Scheduler Scheduler to run on.
+ * @param Handle Dynamic array to process.
+ * @param GrainSize Maximum number of elements per chunk, or 0 to pick one from the number of workers.
+ * @param Function Function to run on each chunk.
+ * @param Context User data passed to the function.
+ */
+void lluna_Jobs_Parallel_For(struct lluna_Jobs_Scheduler* Scheduler, struct lluna_Container_DynamicArray* Handle, uint64 GrainSize, lluna_Jobs_Parallel_ForFunction Function, void* Context);
+/**
+ * @brief Combines all elements of the array into one.
+ *
+ * Each chunk is reduced from the identity, then the partial results are combined in index order.
+ *
+ * @param Scheduler Scheduler to run on.
+ * @param Handle Dynamic array to reduce.
+ * @param GrainSize Maximum number of elements per chunk, or 0 to pick one from the number of workers.
+ * @param Identity Element that leaves others unchanged when combined, like 0 for sums.
+ * @param Function Function combining two elements.
+ * @param Context User data passed to the function.
+ * @param Result Element the result is written to.
+ */
+void lluna_Jobs_Parallel_Reduce(struct lluna_Jobs_Scheduler* Scheduler, struct lluna_Container_DynamicArray* Handle, uint64 GrainSize, const byte* Identity, lluna_Jobs_Parallel_CombineFunction Function, void* Context, byte* Result);
+/**
+ * @brief Replaces each element with the combination of itself and all elements before it.
+ *
+ * Chunks are reduced in parallel, their totals are scanned serially and the chunks are then scanned again from their offsets.
+ *
+ * @param Scheduler Scheduler to run on.
+ * @param Handle Dynamic array to scan in place.
+ * @param GrainSize Maximum number of elements per chunk, or 0 to pick one from the number of workers.
+ * @param Identity Element that leaves others unchanged when combined, like 0 for sums.
+ * @param Function Function combining two elements.
+ * @param Context User data passed to the function.
+ *
+ * @see lluna_Jobs_Parallel_ExclusiveScan
+ */
+void lluna_Jobs_Parallel_InclusiveScan(struct lluna_Jobs_Scheduler* Scheduler, struct lluna_Container_DynamicArray* Handle, uint64 GrainSize, const byte* Identity, lluna_Jobs_Parallel_CombineFunction Function, void* Context);
+/**
+ * @brief Replaces each element with the combination of all elements before it.
+ *
+ * The first element becomes the identity.
+ *
+ * @param Scheduler Scheduler to run on.
+ * @param Handle Dynamic array to scan in place.
+ * @param GrainSize Maximum number of elements per chunk, or 0 to pick one from the number of workers.
+ * @param Identity Element that leaves others unchanged when combined, like 0 for sums.
+ * @param Function Function combining two elements.
+ * @param Context User data passed to the function.
+ *
+ * @see lluna_Jobs_Parallel_InclusiveScan
+ */
+void lluna_Jobs_Parallel_ExclusiveScan(struct lluna_Jobs_Scheduler* Scheduler, struct lluna_Container_DynamicArray* Handle, uint64 GrainSize, const byte* Identity, lluna_Jobs_Parallel_CombineFunction Function, void* Context);
+/**
+ * @brief Sorts the array, keeping equivalent elements in their original order.
+ *
+ * Chunks are merge sorted in parallel, then merged pairwise. Each merge is split into independent pieces at the points
+ * where the merged output crosses chunk boundaries, so the last merges still keep every worker busy.
+ * Uses a temporary buffer the size of the array.
+ *
+ * @param Scheduler Scheduler to run on.
+ * @param Handle Dynamic array to sort.
+ * @param GrainSize Maximum number of elements per chunk, or 0 to pick one from the number of workers.
+ * @param Function Function ordering two elements.
+ * @param Context User data passed to the function.
+ */
+void lluna_Jobs_Parallel_Sort(struct lluna_Jobs_Scheduler* Scheduler, struct lluna_Container_DynamicArray* Handle, uint64 GrainSize, lluna_Jobs_Parallel_CompareFunction Function, void* Context);
@@ -0,0 +1,147 @@
+#pragma once
+
+/**
+ * @file Scheduler.h
+ * @brief Work-stealing job scheduler.
+ *
+ * lluna_Jobs_Scheduler runs jobs on a worker thread per core. The thread that creates the scheduler becomes worker 0.
+ * Each worker owns a lluna_Jobs_Deque: jobs are pushed to and popped from the deque of the thread that runs them,
+ * and idle workers steal from the deques of randomly picked victims.
+ *
+ * Completion is tracked with counters. Running jobs adds to a counter, finishing them subtracts from it,
+ * and waiting on a counter acts as a fence for everything that was run against it.
+ * Workers other than worker 0 run jobs on lluna_Core_Fiber fibers. A job waiting on a counter that isn't done suspends
+ * its fiber, and the worker carries on with other jobs on a fresh one. The suspended job continues on whichever
+ * worker first finds its counter done. Worker 0 runs other jobs while it waits, so jobs can always wait on the jobs they
+ * spawn. Threads that aren't workers only spin until the counter is done.
+ *
+ * Workers spin briefly when they run out of jobs, then sleep until new jobs are run.
+ *
+ * @see lluna_Jobs_Deque
+ * @see lluna_Core_Fiber
+ */
+
+#include <Engine/Core/Public/Fiber.h>
+#include <Engine/Core/Public/Sync.h>
+#include <Engine/Core/Public/Types.h>
+
+/**
+ * @brief Function run by a job.
+ *
+ * @param Data User data of the job.
+ */
+typedef void (*lluna_Jobs_Function)(void* Data);
+
+/**
+ * @brief Counts jobs that have been run but have not finished yet.
+ *
+ * Counters have to be zero initialized and must outlive the jobs run against them.
+ */
+struct lluna_Jobs_Counter
+{
+        int64 Value; /**< Number of unfinished jobs. */
+};
+
+/**
+ * @brief Describes a job.
+ *
+ * Jobs are not copied and have to stay alive until they finish.
+ */
+struct lluna_Jobs_Job
+{
+        lluna_Jobs_Function Function; /**< Function to run. */
+        void* Data; /**< User data passed to the function. */
+
+        struct lluna_Jobs_Counter* Counter; /**< Counter to decrement when finished, set when the job is run. */
+};
+
+struct lluna_Jobs_Worker;
+struct lluna_Jobs_Waiter;
+
+/**
+ * @brief Describes a job scheduler.
+ *
+ * Should not be written to externally.
+ */
+struct lluna_Jobs_Scheduler
+{
+        struct lluna_Jobs_Worker* Workers; /**< Worker states, one per thread. */
+        uint32 WorkerCount; /**< Number of workers, including the creating thread. */
+
+        uint32 SleepingCount; /**< Number of workers waiting for jobs. */
+        uint32 Stopping; /**< Nonzero once the scheduler is being destroyed. */
+
+        struct lluna_Core_Sync_Semaphore Sleeper; /**< Released to wake up idle workers. */
+
+        struct lluna_Core_Fiber_Pool* Fibers; /**< Stacks of the fibers workers run jobs on. */
+        struct lluna_Core_Sync_Mutex WaitingLock; /**< Guards the suspended jobs. */
+        struct lluna_Jobs_Waiter* Waiting; /**< Jobs suspended until their counter is done. */
+        uint32 WaitingCount; /**< Number of suspended jobs. */
+};
+
+/**
+ * @brief Creates a scheduler and returns a handle to it.
+ *
+ * The calling thread becomes worker 0 and has to destroy the scheduler.
+ *
+ * @param WorkerCount Number of workers including the calling thread, or 0 for one per online core.
+ * @return Handle to the created scheduler.
+ *
+ * @see lluna_Jobs_Scheduler_Destroy
+ */
+struct lluna_Jobs_Scheduler* lluna_Jobs_Scheduler_Create(uint32 WorkerCount);
+/**
+ * @brief Stops the workers and destroys the given scheduler.
+ *
+ * All run jobs have to be finished.
+ *
+ * @param Handle Scheduler to destroy.
+ */
+void lluna_Jobs_Scheduler_Destroy(struct lluna_Jobs_Scheduler* Handle);
+
+/**
+ * @brief Returns the number of workers, including the creating thread.
+ *
+ * @param Handle Scheduler to query.
+ * @return Number of workers.
+ */
+uint32 lluna_Jobs_Scheduler_WorkerCount(struct lluna_Jobs_Scheduler* Handle);
+/**
+ * @brief Returns the index of the worker running on the calling thread.
+ *
+ * @param Handle Scheduler to query.
+ * @return Worker index, or lluna_Jobs_Scheduler_WorkerCount if the calling thread isn't a worker.
+ */
+uint32 lluna_Jobs_Scheduler_WorkerIndex(struct lluna_Jobs_Scheduler* Handle);
+
+/**
+ * @brief Runs the given jobs.
+ *
+ * Adds `Count` to the counter before any job can finish.
+ * Jobs are queued on the calling worker, which includes running jobs. Calls from other threads run the jobs inline.
+ *
+ * @param Handle Scheduler to run on.
+ * @param Jobs Jobs to run.
+ * @param Count Number of jobs.
+ * @param Counter Counter tracking the jobs, or NULL.
+ *
+ * @see lluna_Jobs_Scheduler_Wait
+ */
+void lluna_Jobs_Scheduler_Run(struct lluna_Jobs_Scheduler* Handle, struct lluna_Jobs_Job* Jobs, uint64 Count, struct lluna_Jobs_Counter* Counter);
+/**
+ * @brief Waits until the given counter reaches zero, running other jobs in the meantime.
+ *
+ * Jobs running on a worker fiber are suspended instead, and can continue on another worker.
+ * Threads that aren't workers spin and yield instead of running jobs.
+ *
+ * @param Handle Scheduler to help.
+ * @param Counter Counter to wait on.
+ */
+void lluna_Jobs_Scheduler_Wait(struct lluna_Jobs_Scheduler* Handle, struct lluna_Jobs_Counter* Counter);
+/**
+ * @brief Returns true if all jobs run against the given counter have finished.
+ *
+ * @param Counter Counter to check.
+ * @return Whether or not the counter reached zero.
+ */
+boolean lluna_Jobs_Scheduler_Done(struct lluna_Jobs_Counter* Counter);
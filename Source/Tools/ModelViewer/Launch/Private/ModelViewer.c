@@ -1,13 +1,64 @@
+#include <Engine/Core/Public/Macros.h>
+#include <Engine/Core/Public/Profiler.h>
+#include <Engine/Core/Public/Writer.h>
 #include <Engine/Math/Public/FloatUtils.h>
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(LLUNA_PROFILING)
+// Profiled builds write their zones to the file named by LLUNA_PROFILER_CAPTURE, as a Chrome trace if it ends in
+// .json and as a binary capture otherwise.
+static void WriteCapture()
+{
+        const char* Path = getenv("LLUNA_PROFILER_CAPTURE");
+        FILE* File = Path ? fopen(Path, "wb") : NULL;
+        if (!File)
+        {
+                return;
+        }
+
+        struct lluna_Core_Profiler_Capture* Capture = lluna_Core_Profiler_CreateCapture();
+        lluna_Core_Profiler_Collect(Capture);
+
+        struct lluna_Core_Writer* Output = lluna_Core_Writer_Create(fileno(File), lluna_Core_Writer_DefaultCapacity);
+        uint64 Length = strlen(Path);
+        if (Length >= 5 && strcmp(Path + Length - 5, ".json") == 0)
+        {
+                lluna_Core_Profiler_WriteChromeTrace(Capture, Output);
+        }
+        else
+        {
+                lluna_Core_Profiler_WriteBinary(Capture, Output);
+        }
+
+        lluna_Core_Writer_Destroy(Output);
+        lluna_Core_Profiler_DestroyCapture(Capture);
+        fclose(File);
+}
+#endif
 
 int main(int argc, const char* argv[])
 {
-        float Left = 0.1f;
-        float Right = 0.2f;
-        float Sum = lluna_Math_FloatUtils_Add(Left, Right);
-        printf("%.2f + %.2f = %.2f\n", Left, Right, Sum);
+        lluna_Core_Profiler_NameThread("Main");
+        struct lluna_Core_Writer* Output = lluna_Core_Writer_Create(fileno(stdout), lluna_Core_Writer_DefaultCapacity);
+
+        {
+                lluna_Core_Profiler_Zone("Update");
+
+                float Left = 0.1f;
+                float Right = 0.2f;
+                float Sum = lluna_Math_FloatUtils_Add(Left, Right);
+                lluna_Core_Writer_Format(Output, lluna_Macros_Text("%.2f + %.2f = %.2f\n"), Left, Right, Sum);
+        }
+        lluna_Core_Profiler_Frame();
+
+        lluna_Core_Writer_Destroy(Output);
+
+#if defined(LLUNA_PROFILING)
+        WriteCapture();
+#endif
 
         return 0;
 }
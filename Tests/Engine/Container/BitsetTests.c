@@ -0,0 +1,267 @@
+#include <TestHelper.h>
+
+#include <Engine/Container/Public/Bitset.h>
+
+#include <stdlib.h>
+
+struct lluna_TestHelper_Session SessionState;
+
+static void Create();
+static void SetTest();
+static void Resize();
+static void SetAll();
+static void Operations();
+static void PopCount();
+static void FindFirstSet();
+static void Iterate();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Container_Bitset");
+
+        lluna_TestHelper_RunTest(&SessionState, Create);
+        lluna_TestHelper_RunTest(&SessionState, SetTest);
+        lluna_TestHelper_RunTest(&SessionState, Resize);
+        lluna_TestHelper_RunTest(&SessionState, SetAll);
+        lluna_TestHelper_RunTest(&SessionState, Operations);
+        lluna_TestHelper_RunTest(&SessionState, PopCount);
+        lluna_TestHelper_RunTest(&SessionState, FindFirstSet);
+        lluna_TestHelper_RunTest(&SessionState, Iterate);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+static uint64 NextRandom(uint64* State)
+{
+        *State ^= *State << 13;
+        *State ^= *State >> 7;
+        *State ^= *State << 17;
+
+        return *State;
+}
+
+// Fills a bitset and a boolean array with the same random bits, set with the given odds out of 8.
+static void Fill(struct lluna_Container_Bitset* Bitset, boolean* Flags, uint64* State, uint32 Odds)
+{
+        lluna_Container_Bitset_ResetAll(Bitset);
+        for (uint64 Index = 0; Index < lluna_Container_Bitset_Count(Bitset); ++Index)
+        {
+                Flags[Index] = NextRandom(State) % 8 < Odds;
+                if (Flags[Index])
+                {
+                        lluna_Container_Bitset_Set(Bitset, Index);
+                }
+        }
+}
+
+static boolean Equals(struct lluna_Container_Bitset* Bitset, const boolean* Flags)
+{
+        boolean Equal = true;
+        for (uint64 Index = 0; Index < lluna_Container_Bitset_Count(Bitset); ++Index)
+        {
+                Equal &= lluna_Container_Bitset_Test(Bitset, Index) == Flags[Index];
+        }
+
+        return Equal;
+}
+
+static void Create()
+{
+        struct lluna_Container_Bitset* Bitset = lluna_Container_Bitset_Create(100);
+
+        lluna_TestHelper_CheckEqual(lluna_Container_Bitset_Count(Bitset), 100, &SessionState, "Wrong number of bits.");
+        lluna_TestHelper_CheckEqual(lluna_Container_Bitset_PopCount(Bitset), 0, &SessionState, "New bitset has set bits.");
+
+        lluna_Container_Bitset_Destroy(Bitset);
+
+        Bitset = lluna_Container_Bitset_Create(0);
+        lluna_TestHelper_CheckEqual(lluna_Container_Bitset_FindFirstSet(Bitset, 0), 0, &SessionState, "Empty bitset has a set bit.");
+        lluna_Container_Bitset_Destroy(Bitset);
+}
+
+static void SetTest()
+{
+        struct lluna_Container_Bitset* Bitset = lluna_Container_Bitset_Create(130);
+
+        lluna_Container_Bitset_Set(Bitset, 0);
+        lluna_Container_Bitset_Set(Bitset, 63);
+        lluna_Container_Bitset_Set(Bitset, 64);
+        lluna_Container_Bitset_Set(Bitset, 129);
+        lluna_Container_Bitset_Reset(Bitset, 63);
+
+        lluna_TestHelper_CheckTrue(lluna_Container_Bitset_Test(Bitset, 0), &SessionState, "First bit is not set.");
+        lluna_TestHelper_CheckFalse(lluna_Container_Bitset_Test(Bitset, 63), &SessionState, "Reset bit is still set.");
+        lluna_TestHelper_CheckTrue(lluna_Container_Bitset_Test(Bitset, 64), &SessionState, "Bit in the second word is not set.");
+        lluna_TestHelper_CheckTrue(lluna_Container_Bitset_Test(Bitset, 129), &SessionState, "Last bit is not set.");
+        lluna_TestHelper_CheckFalse(lluna_Container_Bitset_Test(Bitset, 1), &SessionState, "Untouched bit is set.");
+        lluna_TestHelper_CheckEqual(lluna_Container_Bitset_PopCount(Bitset), 3, &SessionState, "Wrong number of set bits.");
+
+        lluna_Container_Bitset_Destroy(Bitset);
+}
+
+static void Resize()
+{
+        struct lluna_Container_Bitset* Bitset = lluna_Container_Bitset_Create(70);
+
+        lluna_Container_Bitset_SetAll(Bitset);
+        lluna_Container_Bitset_Resize(Bitset, 65);
+        lluna_TestHelper_CheckEqual(lluna_Container_Bitset_PopCount(Bitset), 65, &SessionState, "Shrinking kept bits past the end.");
+
+        lluna_Container_Bitset_Resize(Bitset, 300);
+        lluna_TestHelper_CheckEqual(lluna_Container_Bitset_PopCount(Bitset), 65, &SessionState, "Growing didn't clear the added bits.");
+        lluna_TestHelper_CheckEqual(lluna_Container_Bitset_FindFirstSet(Bitset, 65), 300, &SessionState, "Found a set bit among the added ones.");
+
+        lluna_Container_Bitset_Destroy(Bitset);
+}
+
+static void SetAll()
+{
+        struct lluna_Container_Bitset* Bitset = lluna_Container_Bitset_Create(1000);
+
+        lluna_Container_Bitset_SetAll(Bitset);
+        lluna_TestHelper_CheckEqual(lluna_Container_Bitset_PopCount(Bitset), 1000, &SessionState, "Setting all bits set bits past the end.");
+
+        lluna_Container_Bitset_ResetAll(Bitset);
+        lluna_TestHelper_CheckEqual(lluna_Container_Bitset_PopCount(Bitset), 0, &SessionState, "Resetting all bits left some set.");
+
+        lluna_Container_Bitset_Destroy(Bitset);
+}
+
+static void Operations()
+{
+        uint64 State = 0x9E3779B97F4A7C15ULL;
+        boolean Correct = true;
+
+        // Sizes around the vector widths, to cover the loops and their tails.
+        uint64 Counts[] = { 1, 63, 64, 65, 255, 256, 257, 511, 512, 513, 1000, 4099 };
+        for (uint32 Size = 0; Size < sizeof(Counts) / sizeof(Counts[0]); ++Size)
+        {
+                uint64 Count = Counts[Size];
+                struct lluna_Container_Bitset* Left = lluna_Container_Bitset_Create(Count);
+                struct lluna_Container_Bitset* Right = lluna_Container_Bitset_Create(Count);
+                boolean* LeftFlags = malloc(Count * sizeof(boolean));
+                boolean* RightFlags = malloc(Count * sizeof(boolean));
+
+                for (uint32 Operation = 0; Operation < 4; ++Operation)
+                {
+                        Fill(Left, LeftFlags, &State, 4);
+                        Fill(Right, RightFlags, &State, 4);
+
+                        for (uint64 Index = 0; Index < Count; ++Index)
+                        {
+                                boolean Expected[] = {
+                                        LeftFlags[Index] && RightFlags[Index],
+                                        LeftFlags[Index] || RightFlags[Index],
+                                        LeftFlags[Index] && !RightFlags[Index],
+                                        LeftFlags[Index] != RightFlags[Index],
+                                };
+                                LeftFlags[Index] = Expected[Operation];
+                        }
+
+                        switch (Operation)
+                        {
+                        case 0:
+                                lluna_Container_Bitset_And(Left, Right);
+                                break;
+                        case 1:
+                                lluna_Container_Bitset_Or(Left, Right);
+                                break;
+                        case 2:
+                                lluna_Container_Bitset_AndNot(Left, Right);
+                                break;
+                        default:
+                                lluna_Container_Bitset_Xor(Left, Right);
+                                break;
+                        }
+
+                        Correct &= Equals(Left, LeftFlags);
+                }
+
+                free(RightFlags);
+                free(LeftFlags);
+                lluna_Container_Bitset_Destroy(Right);
+                lluna_Container_Bitset_Destroy(Left);
+        }
+
+        lluna_TestHelper_CheckTrue(Correct, &SessionState, "Set operations don't match the per bit results.");
+}
+
+static void PopCount()
+{
+        uint64 State = 0x2545F4914F6CDD1DULL;
+        boolean Correct = true;
+
+        for (uint64 Count = 0; Count < 2000; Count += 37)
+        {
+                struct lluna_Container_Bitset* Bitset = lluna_Container_Bitset_Create(Count);
+                boolean* Flags = malloc((Count > 0 ? Count : 1) * sizeof(boolean));
+
+                Fill(Bitset, Flags, &State, 1 + Count % 8);
+
+                uint64 Expected = 0;
+                for (uint64 Index = 0; Index < Count; ++Index)
+                {
+                        Expected += Flags[Index];
+                }
+                Correct &= lluna_Container_Bitset_PopCount(Bitset) == Expected;
+
+                free(Flags);
+                lluna_Container_Bitset_Destroy(Bitset);
+        }
+
+        lluna_TestHelper_CheckTrue(Correct, &SessionState, "Population counts are wrong.");
+}
+
+static void FindFirstSet()
+{
+        struct lluna_Container_Bitset* Bitset = lluna_Container_Bitset_Create(2000);
+
+        lluna_TestHelper_CheckEqual(lluna_Container_Bitset_FindFirstSet(Bitset, 0), 2000, &SessionState, "Found a set bit in a clear bitset.");
+
+        lluna_Container_Bitset_Set(Bitset, 5);
+        lluna_Container_Bitset_Set(Bitset, 1500);
+        lluna_Container_Bitset_Set(Bitset, 1999);
+
+        lluna_TestHelper_CheckEqual(lluna_Container_Bitset_FindFirstSet(Bitset, 0), 5, &SessionState, "Wrong first set bit.");
+        lluna_TestHelper_CheckEqual(lluna_Container_Bitset_FindFirstSet(Bitset, 5), 5, &SessionState, "Start bit is not considered.");
+        lluna_TestHelper_CheckEqual(lluna_Container_Bitset_FindFirstSet(Bitset, 6), 1500, &SessionState, "Didn't skip the empty words.");
+        lluna_TestHelper_CheckEqual(lluna_Container_Bitset_FindFirstSet(Bitset, 1501), 1999, &SessionState, "Didn't find the last bit.");
+        lluna_TestHelper_CheckEqual(lluna_Container_Bitset_FindFirstSet(Bitset, 2000), 2000, &SessionState, "Found a set bit past the end.");
+
+        lluna_Container_Bitset_Destroy(Bitset);
+}
+
+static void Iterate()
+{
+        uint64 State = 0x9E3779B97F4A7C15ULL;
+        struct lluna_Container_Bitset* Bitset = lluna_Container_Bitset_Create(3000);
+        boolean* Flags = malloc(3000 * sizeof(boolean));
+
+        Fill(Bitset, Flags, &State, 1);
+
+        // Visits have to match the set flags in order, which FindFirstSet also has to agree with.
+        boolean Correct = true;
+        uint64 Expected = 0;
+        uint64 Index;
+        struct lluna_Container_Bitset_Iterator Iterator = lluna_Container_Bitset_Begin(Bitset);
+        while (lluna_Container_Bitset_Next(&Iterator, &Index))
+        {
+                while (Expected < 3000 && !Flags[Expected])
+                {
+                        ++Expected;
+                }
+                Correct &= Index == Expected;
+                Correct &= lluna_Container_Bitset_FindFirstSet(Bitset, Index == 0 ? 0 : Index - 1) == Index || Flags[Index - 1];
+                ++Expected;
+        }
+        while (Expected < 3000 && !Flags[Expected])
+        {
+                ++Expected;
+        }
+
+        lluna_TestHelper_CheckTrue(Correct, &SessionState, "Iteration visited the wrong bits.");
+        lluna_TestHelper_CheckEqual(Expected, 3000, &SessionState, "Iteration missed set bits.");
+
+        free(Flags);
+        lluna_Container_Bitset_Destroy(Bitset);
+}
@@ -0,0 +1,263 @@
+#include <TestHelper.h>
+
+#include <Engine/Container/Public/ConcurrentHashMap.h>
+#include <Engine/Core/Public/Atomics.h>
+
+#include <pthread.h>
+#include <stdint.h>
+
+struct lluna_TestHelper_Session SessionState;
+
+static void Create();
+static void InsertFind();
+static void FindOrInsert();
+static void Remove();
+static void Growth();
+static void Churn();
+static void ConcurrentWriters();
+static void ConcurrentReaders();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Container_ConcurrentHashMap");
+
+        lluna_TestHelper_RunTest(&SessionState, Create);
+        lluna_TestHelper_RunTest(&SessionState, InsertFind);
+        lluna_TestHelper_RunTest(&SessionState, FindOrInsert);
+        lluna_TestHelper_RunTest(&SessionState, Remove);
+        lluna_TestHelper_RunTest(&SessionState, Growth);
+        lluna_TestHelper_RunTest(&SessionState, Churn);
+        lluna_TestHelper_RunTest(&SessionState, ConcurrentWriters);
+        lluna_TestHelper_RunTest(&SessionState, ConcurrentReaders);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+// Values are made from keys, so they can be checked without a reference table. Never NULL for non-zero keys.
+static void* ValueOf(uint64 Key)
+{
+        return (void*)(uintptr_t)(Key * 8);
+}
+
+static void Create()
+{
+        struct lluna_Container_ConcurrentHashMap* Map = lluna_Container_ConcurrentHashMap_Create(0);
+
+        lluna_TestHelper_CheckEqual(lluna_Container_ConcurrentHashMap_Count(Map), 0, &SessionState, "New map is not empty.");
+        lluna_TestHelper_CheckTrue(lluna_Container_ConcurrentHashMap_Find(Map, 1) == NULL, &SessionState, "Found a key in an empty map.");
+
+        lluna_Container_ConcurrentHashMap_Destroy(Map);
+}
+
+static void InsertFind()
+{
+        struct lluna_Container_ConcurrentHashMap* Map = lluna_Container_ConcurrentHashMap_Create(16);
+
+        boolean Correct = true;
+        for (uint64 Key = 1; Key <= 100; ++Key)
+        {
+                Correct &= lluna_Container_ConcurrentHashMap_Insert(Map, Key, ValueOf(Key)) == NULL;
+        }
+        for (uint64 Key = 1; Key <= 100; ++Key)
+        {
+                Correct &= lluna_Container_ConcurrentHashMap_Find(Map, Key) == ValueOf(Key);
+        }
+
+        lluna_TestHelper_CheckTrue(Correct, &SessionState, "Inserted keys were not found.");
+        lluna_TestHelper_CheckTrue(lluna_Container_ConcurrentHashMap_Find(Map, 101) == NULL, &SessionState, "Found a missing key.");
+        lluna_TestHelper_CheckTrue(lluna_Container_ConcurrentHashMap_Insert(Map, 7, ValueOf(70)) == ValueOf(7), &SessionState, "Replacing didn't return the previous value.");
+        lluna_TestHelper_CheckTrue(lluna_Container_ConcurrentHashMap_Find(Map, 7) == ValueOf(70), &SessionState, "Value was not replaced.");
+        lluna_TestHelper_CheckEqual(lluna_Container_ConcurrentHashMap_Count(Map), 100, &SessionState, "Wrong number of entries.");
+
+        lluna_Container_ConcurrentHashMap_Destroy(Map);
+}
+
+static void FindOrInsert()
+{
+        struct lluna_Container_ConcurrentHashMap* Map = lluna_Container_ConcurrentHashMap_Create(16);
+
+        lluna_TestHelper_CheckTrue(lluna_Container_ConcurrentHashMap_FindOrInsert(Map, 5, ValueOf(5)) == ValueOf(5), &SessionState, "Inserted value was not returned.");
+        lluna_TestHelper_CheckTrue(lluna_Container_ConcurrentHashMap_FindOrInsert(Map, 5, ValueOf(6)) == ValueOf(5), &SessionState, "Existing value was not returned.");
+        lluna_TestHelper_CheckTrue(lluna_Container_ConcurrentHashMap_Find(Map, 5) == ValueOf(5), &SessionState, "Existing value was replaced.");
+        lluna_TestHelper_CheckEqual(lluna_Container_ConcurrentHashMap_Count(Map), 1, &SessionState, "Wrong number of entries.");
+
+        lluna_Container_ConcurrentHashMap_Destroy(Map);
+}
+
+static void Remove()
+{
+        struct lluna_Container_ConcurrentHashMap* Map = lluna_Container_ConcurrentHashMap_Create(16);
+        for (uint64 Key = 1; Key <= 10; ++Key)
+        {
+                lluna_Container_ConcurrentHashMap_Insert(Map, Key, ValueOf(Key));
+        }
+
+        lluna_TestHelper_CheckTrue(lluna_Container_ConcurrentHashMap_Remove(Map, 3) == ValueOf(3), &SessionState, "Removing didn't return the value.");
+        lluna_TestHelper_CheckTrue(lluna_Container_ConcurrentHashMap_Remove(Map, 3) == NULL, &SessionState, "Removed a key twice.");
+        lluna_TestHelper_CheckTrue(lluna_Container_ConcurrentHashMap_Remove(Map, 11) == NULL, &SessionState, "Removed a missing key.");
+        lluna_TestHelper_CheckTrue(lluna_Container_ConcurrentHashMap_Find(Map, 3) == NULL, &SessionState, "Removed key was found.");
+        lluna_TestHelper_CheckTrue(lluna_Container_ConcurrentHashMap_Find(Map, 4) == ValueOf(4), &SessionState, "Removing lost another key.");
+        lluna_TestHelper_CheckEqual(lluna_Container_ConcurrentHashMap_Count(Map), 9, &SessionState, "Wrong number of entries.");
+
+        lluna_TestHelper_CheckTrue(lluna_Container_ConcurrentHashMap_FindOrInsert(Map, 3, ValueOf(3)) == ValueOf(3), &SessionState, "Removed key was not inserted again.");
+        lluna_TestHelper_CheckEqual(lluna_Container_ConcurrentHashMap_Count(Map), 10, &SessionState, "Wrong number of entries.");
+
+        lluna_Container_ConcurrentHashMap_Destroy(Map);
+}
+
+static void Growth()
+{
+        struct lluna_Container_ConcurrentHashMap* Map = lluna_Container_ConcurrentHashMap_Create(0);
+
+        // Checks every key after each insert, so lookups are made in the middle of migrations.
+        boolean Correct = true;
+        for (uint64 Key = 1; Key <= 5000; ++Key)
+        {
+                lluna_Container_ConcurrentHashMap_Insert(Map, Key, ValueOf(Key));
+                if (Key % 97 == 0)
+                {
+                        for (uint64 Inserted = 1; Inserted <= Key; ++Inserted)
+                        {
+                                Correct &= lluna_Container_ConcurrentHashMap_Find(Map, Inserted) == ValueOf(Inserted);
+                        }
+                        Correct &= lluna_Container_ConcurrentHashMap_Find(Map, Key + 1) == NULL;
+                }
+        }
+
+        lluna_TestHelper_CheckTrue(Correct, &SessionState, "Keys were lost while growing.");
+        lluna_TestHelper_CheckEqual(lluna_Container_ConcurrentHashMap_Count(Map), 5000, &SessionState, "Wrong number of entries.");
+
+        lluna_Container_ConcurrentHashMap_Destroy(Map);
+}
+
+static void Churn()
+{
+        struct lluna_Container_ConcurrentHashMap* Map = lluna_Container_ConcurrentHashMap_Create(0);
+
+        // A sliding window of keys, so removed slots pile up and force resizes to the same size.
+        boolean Correct = true;
+        for (uint64 Key = 1; Key <= 20000; ++Key)
+        {
+                lluna_Container_ConcurrentHashMap_Insert(Map, Key, ValueOf(Key));
+                if (Key > 50)
+                {
+                        Correct &= lluna_Container_ConcurrentHashMap_Remove(Map, Key - 50) == ValueOf(Key - 50);
+                }
+                Correct &= lluna_Container_ConcurrentHashMap_Find(Map, Key > 50 ? Key - 49 : 1) == ValueOf(Key > 50 ? Key - 49 : 1);
+        }
+
+        lluna_TestHelper_CheckTrue(Correct, &SessionState, "Keys were lost while churning.");
+        lluna_TestHelper_CheckEqual(lluna_Container_ConcurrentHashMap_Count(Map), 50, &SessionState, "Wrong number of entries.");
+
+        lluna_Container_ConcurrentHashMap_Destroy(Map);
+}
+
+#define ThreadCount 4
+#define KeysPerThread 20000
+
+struct Worker
+{
+        struct lluna_Container_ConcurrentHashMap* Map;
+        uint64 Index;
+        boolean Correct;
+        uint32* Stop;
+};
+
+static void* Write(void* Context)
+{
+        struct Worker* Worker = Context;
+
+        // Each thread owns a range of keys, inserts all of them, removes the odd ones and interns shared keys.
+        uint64 First = 1 + Worker->Index * KeysPerThread;
+        for (uint64 Key = First; Key < First + KeysPerThread; ++Key)
+        {
+                Worker->Correct &= lluna_Container_ConcurrentHashMap_Insert(Worker->Map, Key, ValueOf(Key)) == NULL;
+                Worker->Correct &= lluna_Container_ConcurrentHashMap_FindOrInsert(Worker->Map, 1000000 + Key % 100, ValueOf(Key)) != NULL;
+        }
+        for (uint64 Key = First + 1; Key < First + KeysPerThread; Key += 2)
+        {
+                Worker->Correct &= lluna_Container_ConcurrentHashMap_Remove(Worker->Map, Key) == ValueOf(Key);
+        }
+
+        return NULL;
+}
+
+static void ConcurrentWriters()
+{
+        struct lluna_Container_ConcurrentHashMap* Map = lluna_Container_ConcurrentHashMap_Create(0);
+        struct Worker Workers[ThreadCount];
+        pthread_t Threads[ThreadCount];
+
+        for (uint64 Index = 0; Index < ThreadCount; ++Index)
+        {
+                Workers[Index] = (struct Worker){ Map, Index, true, NULL };
+                pthread_create(&Threads[Index], NULL, Write, &Workers[Index]);
+        }
+
+        boolean Correct = true;
+        for (uint64 Index = 0; Index < ThreadCount; ++Index)
+        {
+                pthread_join(Threads[Index], NULL);
+                Correct &= Workers[Index].Correct;
+        }
+        for (uint64 Key = 1; Key <= ThreadCount * KeysPerThread; ++Key)
+        {
+                Correct &= lluna_Container_ConcurrentHashMap_Find(Map, Key) == ((Key - 1) % 2 == 0 ? ValueOf(Key) : NULL);
+        }
+
+        lluna_TestHelper_CheckTrue(Correct, &SessionState, "Concurrent writes were lost.");
+        lluna_TestHelper_CheckEqual(lluna_Container_ConcurrentHashMap_Count(Map), ThreadCount * KeysPerThread / 2 + 100, &SessionState, "Wrong number of entries.");
+
+        lluna_Container_ConcurrentHashMap_Destroy(Map);
+}
+
+static void* Read(void* Context)
+{
+        struct Worker* Worker = Context;
+
+        // Stable keys must always be found, even while the writer makes the tables grow under them.
+        while (!lluna_Core_Atomics_LoadUint32(Worker->Stop, lluna_Core_Atomics_Acquire))
+        {
+                for (uint64 Key = 1; Key <= 1000; ++Key)
+                {
+                        Worker->Correct &= lluna_Container_ConcurrentHashMap_Find(Worker->Map, Key) == ValueOf(Key);
+                }
+        }
+
+        return NULL;
+}
+
+static void ConcurrentReaders()
+{
+        struct lluna_Container_ConcurrentHashMap* Map = lluna_Container_ConcurrentHashMap_Create(0);
+        struct Worker Workers[ThreadCount];
+        pthread_t Threads[ThreadCount];
+        uint32 Stop = false;
+
+        for (uint64 Key = 1; Key <= 1000; ++Key)
+        {
+                lluna_Container_ConcurrentHashMap_Insert(Map, Key, ValueOf(Key));
+        }
+        for (uint64 Index = 0; Index < ThreadCount; ++Index)
+        {
+                Workers[Index] = (struct Worker){ Map, Index, true, &Stop };
+                pthread_create(&Threads[Index], NULL, Read, &Workers[Index]);
+        }
+
+        for (uint64 Key = 1001; Key <= 200000; ++Key)
+        {
+                lluna_Container_ConcurrentHashMap_Insert(Map, Key, ValueOf(Key));
+        }
+        lluna_Core_Atomics_StoreUint32(&Stop, true, lluna_Core_Atomics_Release);
+
+        boolean Correct = true;
+        for (uint64 Index = 0; Index < ThreadCount; ++Index)
+        {
+                pthread_join(Threads[Index], NULL);
+                Correct &= Workers[Index].Correct;
+        }
+
+        lluna_TestHelper_CheckTrue(Correct, &SessionState, "Readers missed keys during resizes.");
+
+        lluna_Container_ConcurrentHashMap_Destroy(Map);
+}
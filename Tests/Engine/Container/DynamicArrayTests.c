@@ -9,6 +9,9 @@ struct lluna_TestHelper_Session SessionState;
 static void Create();
 static void CreateFromData();
 static void Destroy();
+static void Share();
+static void CopyOnWrite();
+static void Unshare();
 static void Empty();
 static void Count();
 static void Capacity();
@@ -24,6 +27,10 @@ static void Remove();
 static void RemoveStable();
 static void RemoveFirst();
 static void RemoveLast();
+static void RemoveIf();
+static void RemoveIfUnordered();
+static void RemoveIndices();
+static void RemoveIndicesUnordered();
 static void Clear();
 static void ForEach();
 static void ReversedForEach();
@@ -35,6 +42,9 @@ int main(int argc, const char* argv[])
         lluna_TestHelper_RunTest(&SessionState, Create);
         lluna_TestHelper_RunTest(&SessionState, CreateFromData);
         lluna_TestHelper_RunTest(&SessionState, Destroy);
+        lluna_TestHelper_RunTest(&SessionState, Share);
+        lluna_TestHelper_RunTest(&SessionState, CopyOnWrite);
+        lluna_TestHelper_RunTest(&SessionState, Unshare);
         lluna_TestHelper_RunTest(&SessionState, Empty);
         lluna_TestHelper_RunTest(&SessionState, Count);
         lluna_TestHelper_RunTest(&SessionState, Capacity);
@@ -50,6 +60,10 @@ int main(int argc, const char* argv[])
         lluna_TestHelper_RunTest(&SessionState, RemoveStable);
         lluna_TestHelper_RunTest(&SessionState, RemoveFirst);
         lluna_TestHelper_RunTest(&SessionState, RemoveLast);
+        lluna_TestHelper_RunTest(&SessionState, RemoveIf);
+        lluna_TestHelper_RunTest(&SessionState, RemoveIfUnordered);
+        lluna_TestHelper_RunTest(&SessionState, RemoveIndices);
+        lluna_TestHelper_RunTest(&SessionState, RemoveIndicesUnordered);
         lluna_TestHelper_RunTest(&SessionState, Clear);
         lluna_TestHelper_RunTest(&SessionState, ForEach);
         lluna_TestHelper_RunTest(&SessionState, ReversedForEach);
@@ -78,7 +92,7 @@ static void CreateFromData()
         uint32 Data[] = { 3, 14, 15, 92 };
         uint32 ElementSize = sizeof(Data[0]);
 
-        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData(Data, sizeof(Data), ElementSize);
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData((byte*)Data, sizeof(Data), ElementSize);
 
         lluna_TestHelper_CheckNotEqual(DynamicArray, NULL, &SessionState, "Create returned NULL.");
         lluna_TestHelper_CheckNotEqual(DynamicArray->Data, NULL, &SessionState, "Create set Data to NULL.");
@@ -113,7 +127,7 @@ static void Empty()
         lluna_TestHelper_CheckTrue(IsEmpty, &SessionState, "Empty did not return true for empty array.");
 
         uint32 Element = 42;
-        lluna_Container_DynamicArray_Append(DynamicArray, &Element);
+        lluna_Container_DynamicArray_Append(DynamicArray, (byte*)&Element);
 
         IsEmpty = lluna_Container_DynamicArray_Empty(DynamicArray);
         lluna_TestHelper_CheckFalse(IsEmpty, &SessionState, "Empty did not return false for non-empty array.");
@@ -126,7 +140,7 @@ static void Count()
         uint32 Data[] = { 3, 14, 15, 92 };
         uint32 ElementSize = sizeof(Data[0]);
 
-        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData(Data, sizeof(Data), ElementSize);
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData((byte*)Data, sizeof(Data), ElementSize);
 
         lluna_TestHelper_CheckEqual(lluna_Container_DynamicArray_Count(DynamicArray), sizeof(Data) / ElementSize, &SessionState, "Count did not return the correct number of elements.");
 
@@ -167,9 +181,9 @@ static void Shrink()
         uint32 ElementSize = Data[0];
 
         struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_Create(InitialSize, ElementSize);
-        for (int i = 0; i < lluna_Container_DynamicArray_Count(DynamicArray); ++i)
+        for (uint64 i = 0; i < lluna_Container_DynamicArray_Count(DynamicArray); ++i)
         {
-                lluna_Container_DynamicArray_Append(DynamicArray, &Data[i]);
+                lluna_Container_DynamicArray_Append(DynamicArray, (byte*)&Data[i]);
         }
 
         lluna_Container_DynamicArray_Shrink(DynamicArray);
@@ -184,7 +198,7 @@ static void First()
         uint32 Data[] = { 42, 3, 14 };
         uint32 ElementSize = sizeof(Data[0]);
 
-        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData(Data, sizeof(Data), ElementSize);
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData((byte*)Data, sizeof(Data), ElementSize);
 
         uint32* ReturnedPointer = (uint32*)lluna_Container_DynamicArray_First(DynamicArray);
 
@@ -198,7 +212,7 @@ static void Last()
         uint32 Data[] = { 42, 3, 14 };
         uint32 ElementSize = sizeof(Data[0]);
 
-        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData(Data, sizeof(Data), ElementSize);
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData((byte*)Data, sizeof(Data), ElementSize);
 
         uint32* ReturnedPointer = (uint32*)lluna_Container_DynamicArray_Last(DynamicArray);
 
@@ -212,9 +226,9 @@ static void Get()
         uint32 Data[] = { 42, 3, 14 };
         uint32 ElementSize = sizeof(Data[0]);
 
-        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData(Data, sizeof(Data), ElementSize);
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData((byte*)Data, sizeof(Data), ElementSize);
 
-        for (int i = 0; i < lluna_Container_DynamicArray_Count(DynamicArray); ++i)
+        for (uint64 i = 0; i < lluna_Container_DynamicArray_Count(DynamicArray); ++i)
         {
                 uint32* ReturnedPointer = (uint32*)lluna_Container_DynamicArray_Get(DynamicArray, i);
                 lluna_TestHelper_CheckEqual(*ReturnedPointer, Data[i], &SessionState, "Get did not return the correct pointer.");
@@ -231,9 +245,9 @@ static void Append()
 
         struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_Create(InitialSize, ElementSize);
 
-        for (int i = 0; i < sizeof(Data) / ElementSize; ++i)
+        for (uint64 i = 0; i < sizeof(Data) / ElementSize; ++i)
         {
-                lluna_Container_DynamicArray_Append(DynamicArray, &Data[i]);
+                lluna_Container_DynamicArray_Append(DynamicArray, (byte*)&Data[i]);
 
                 uint32* ReturnedPointer = (uint32*)lluna_Container_DynamicArray_Last(DynamicArray);
                 lluna_TestHelper_CheckEqual(*ReturnedPointer, Data[i], &SessionState, "Appended value was not found at the end of the array");
@@ -251,9 +265,9 @@ static void Prepend()
 
         struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_Create(InitialSize, ElementSize);
 
-        for (int i = 0; i < sizeof(Data) / ElementSize; ++i)
+        for (uint64 i = 0; i < sizeof(Data) / ElementSize; ++i)
         {
-                lluna_Container_DynamicArray_Prepend(DynamicArray, &Data[i]);
+                lluna_Container_DynamicArray_Prepend(DynamicArray, (byte*)&Data[i]);
 
                 uint32* ReturnedPointer = (uint32*)lluna_Container_DynamicArray_First(DynamicArray);
                 lluna_TestHelper_CheckEqual(*ReturnedPointer, Data[i], &SessionState, "Prepended value was not found at the start of the array");
@@ -269,12 +283,12 @@ static void Insert()
         uint32 ExpectedData[] = { 14, 42, 3, 14, 15, 14 };
         uint32 ElementSize = sizeof(Data[0]);
 
-        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData(Data, sizeof(Data), ElementSize);
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData((byte*)Data, sizeof(Data), ElementSize);
 
         uint32 Element = 14;
-        lluna_Container_DynamicArray_Insert(DynamicArray, &Element, 3);
-        lluna_Container_DynamicArray_Insert(DynamicArray, &Element, 2);
-        lluna_Container_DynamicArray_Insert(DynamicArray, &Element, 0);
+        lluna_Container_DynamicArray_Insert(DynamicArray, (byte*)&Element, 3);
+        lluna_Container_DynamicArray_Insert(DynamicArray, (byte*)&Element, 2);
+        lluna_Container_DynamicArray_Insert(DynamicArray, (byte*)&Element, 0);
 
         lluna_TestHelper_CheckEqual(DynamicArray->Offset, sizeof(ExpectedData), &SessionState, "Multiple inserts did not properly change the offset.");
         lluna_TestHelper_CheckEqual(memcmp(DynamicArray->Data, ExpectedData, sizeof(ExpectedData)), 0, &SessionState, "Insert did not place new elements at correct indices.");
@@ -288,7 +302,7 @@ static void Remove()
         uint32 ExpectedData[] = { 42, 3, 92, 15 };
         uint32 ElementSize = sizeof(Data[0]);
 
-        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData(Data, sizeof(Data), ElementSize);
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData((byte*)Data, sizeof(Data), ElementSize);
 
         lluna_Container_DynamicArray_Remove(DynamicArray, 2);
 
@@ -304,7 +318,7 @@ static void RemoveStable()
         uint32 ExpectedData[] = { 42, 3, 15, 16 };
         uint32 ElementSize = sizeof(Data[0]);
 
-        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData(Data, sizeof(Data), ElementSize);
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData((byte*)Data, sizeof(Data), ElementSize);
 
         lluna_Container_DynamicArray_RemoveStable(DynamicArray, 2);
 
@@ -320,7 +334,7 @@ static void RemoveFirst()
         uint32 ExpectedData[] = { 3, 14, 15, 16 };
         uint32 ElementSize = sizeof(Data[0]);
 
-        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData(Data, sizeof(Data), ElementSize);
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData((byte*)Data, sizeof(Data), ElementSize);
 
         lluna_Container_DynamicArray_RemoveFirst(DynamicArray);
 
@@ -336,7 +350,7 @@ static void RemoveLast()
         uint32 ExpectedData[] = { 42, 3, 14, 15 };
         uint32 ElementSize = sizeof(Data[0]);
 
-        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData(Data, sizeof(Data), ElementSize);
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData((byte*)Data, sizeof(Data), ElementSize);
 
         lluna_Container_DynamicArray_RemoveLast(DynamicArray);
 
@@ -346,12 +360,96 @@ static void RemoveLast()
         lluna_Container_DynamicArray_Destroy(DynamicArray);
 }
 
+static boolean IsOdd(void* Context, const byte* Element)
+{
+        ++*(uint32*)Context;
+
+        return *(const uint32*)Element % 2 == 1;
+}
+
+static void RemoveIf()
+{
+        uint32 Data[] = { 1, 42, 3, 14, 15, 92, 6, 5, 35 };
+        uint32 ExpectedData[] = { 42, 14, 92, 6 };
+        uint32 ElementSize = sizeof(Data[0]);
+        uint32 Calls = 0;
+
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData((byte*)Data, sizeof(Data), ElementSize);
+
+        uint64 Removed = lluna_Container_DynamicArray_RemoveIf(DynamicArray, IsOdd, &Calls);
+
+        lluna_TestHelper_CheckEqual(Removed, 5, &SessionState, "Remove if returned the wrong number of removed elements.");
+        lluna_TestHelper_CheckEqual(Calls, 9, &SessionState, "Predicate was not called once per element.");
+        lluna_TestHelper_CheckEqual(DynamicArray->Offset, sizeof(ExpectedData), &SessionState, "Offset was not correctly updated after remove if.");
+        lluna_TestHelper_CheckEqual(memcmp(ExpectedData, DynamicArray->Data, sizeof(ExpectedData)), 0, &SessionState, "Array data did not match expected data after remove if.");
+
+        Removed = lluna_Container_DynamicArray_RemoveIf(DynamicArray, IsOdd, &Calls);
+
+        lluna_TestHelper_CheckEqual(Removed, 0, &SessionState, "Remove if removed elements not matching the predicate.");
+        lluna_TestHelper_CheckEqual(DynamicArray->Offset, sizeof(ExpectedData), &SessionState, "Offset changed when nothing was removed.");
+
+        lluna_Container_DynamicArray_Destroy(DynamicArray);
+}
+
+static void RemoveIfUnordered()
+{
+        uint32 Data[] = { 1, 42, 3, 14, 15, 92, 6, 5, 35 };
+        uint32 ExpectedData[] = { 6, 42, 92, 14 };
+        uint32 ElementSize = sizeof(Data[0]);
+        uint32 Calls = 0;
+
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData((byte*)Data, sizeof(Data), ElementSize);
+
+        uint64 Removed = lluna_Container_DynamicArray_RemoveIfUnordered(DynamicArray, IsOdd, &Calls);
+
+        lluna_TestHelper_CheckEqual(Removed, 5, &SessionState, "Remove if unordered returned the wrong number of removed elements.");
+        lluna_TestHelper_CheckEqual(Calls, 9, &SessionState, "Predicate was not called once per element.");
+        lluna_TestHelper_CheckEqual(DynamicArray->Offset, sizeof(ExpectedData), &SessionState, "Offset was not correctly updated after remove if unordered.");
+        lluna_TestHelper_CheckEqual(memcmp(ExpectedData, DynamicArray->Data, sizeof(ExpectedData)), 0, &SessionState, "Array data did not match expected data after remove if unordered.");
+
+        lluna_Container_DynamicArray_Destroy(DynamicArray);
+}
+
+static void RemoveIndices()
+{
+        uint32 Data[] = { 42, 3, 14, 15, 92, 6, 5, 35 };
+        uint32 ExpectedData[] = { 3, 14, 6, 5 };
+        uint64 Indices[] = { 0, 3, 4, 7 };
+        uint32 ElementSize = sizeof(Data[0]);
+
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData((byte*)Data, sizeof(Data), ElementSize);
+
+        lluna_Container_DynamicArray_RemoveIndices(DynamicArray, Indices, 4);
+
+        lluna_TestHelper_CheckEqual(DynamicArray->Offset, sizeof(ExpectedData), &SessionState, "Offset was not correctly updated after remove indices.");
+        lluna_TestHelper_CheckEqual(memcmp(ExpectedData, DynamicArray->Data, sizeof(ExpectedData)), 0, &SessionState, "Array data did not match expected data after remove indices.");
+
+        lluna_Container_DynamicArray_Destroy(DynamicArray);
+}
+
+static void RemoveIndicesUnordered()
+{
+        uint32 Data[] = { 42, 3, 14, 15, 92, 6, 5, 35 };
+        uint32 ExpectedData[] = { 5, 3, 14, 6 };
+        uint64 Indices[] = { 0, 3, 4, 7 };
+        uint32 ElementSize = sizeof(Data[0]);
+
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData((byte*)Data, sizeof(Data), ElementSize);
+
+        lluna_Container_DynamicArray_RemoveIndicesUnordered(DynamicArray, Indices, 4);
+
+        lluna_TestHelper_CheckEqual(DynamicArray->Offset, sizeof(ExpectedData), &SessionState, "Offset was not correctly updated after remove indices unordered.");
+        lluna_TestHelper_CheckEqual(memcmp(ExpectedData, DynamicArray->Data, sizeof(ExpectedData)), 0, &SessionState, "Array data did not match expected data after remove indices unordered.");
+
+        lluna_Container_DynamicArray_Destroy(DynamicArray);
+}
+
 static void Clear()
 {
         uint32 Data[] = { 42, 3, 14, 15, 16 };
         uint32 ElementSize = sizeof(Data[0]);
 
-        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData(Data, sizeof(Data), ElementSize);
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData((byte*)Data, sizeof(Data), ElementSize);
 
         lluna_Container_DynamicArray_Clear(DynamicArray);
 
@@ -366,7 +464,7 @@ static void ForEach()
         uint32 ElementSize = sizeof(Data[0]);
         uint32 ElementCount = sizeof(Data) / ElementSize;
 
-        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData(Data, sizeof(Data), ElementSize);
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData((byte*)Data, sizeof(Data), ElementSize);
 
         uint32* Iterator;
         uint64 Index = 0;
@@ -387,7 +485,7 @@ static void ReversedForEach()
         uint32 ElementSize = sizeof(Data[0]);
         uint32 ElementCount = sizeof(Data) / ElementSize;
 
-        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData(Data, sizeof(Data), ElementSize);
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData((byte*)Data, sizeof(Data), ElementSize);
 
         uint32* Iterator;
         uint64 Index = ElementCount - 1;
@@ -401,3 +499,68 @@ static void ReversedForEach()
 
         lluna_Container_DynamicArray_Destroy(DynamicArray);
 }
+
+static void Share()
+{
+        uint32 Data[] = { 3, 14, 15, 92 };
+
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData((byte*)Data, sizeof(Data), sizeof(Data[0]));
+        lluna_TestHelper_CheckFalse(lluna_Container_DynamicArray_Shared(DynamicArray), &SessionState, "New array was shared.");
+
+        struct lluna_Container_DynamicArray* Snapshot = lluna_Container_DynamicArray_Share(DynamicArray);
+
+        lluna_TestHelper_CheckEqual(Snapshot->Data, DynamicArray->Data, &SessionState, "Share copied the elements.");
+        lluna_TestHelper_CheckEqual(Snapshot->Offset, DynamicArray->Offset, &SessionState, "Share did not keep Offset.");
+        lluna_TestHelper_CheckTrue(lluna_Container_DynamicArray_Shared(DynamicArray), &SessionState, "Shared array was not marked as shared.");
+
+        lluna_Container_DynamicArray_Destroy(DynamicArray);
+        lluna_TestHelper_CheckFalse(lluna_Container_DynamicArray_Shared(Snapshot), &SessionState, "Last array was still marked as shared.");
+        lluna_TestHelper_CheckEqual(memcmp(Data, Snapshot->Data, sizeof(Data)), 0, &SessionState, "Destroying a shared array freed the elements.");
+
+        lluna_Container_DynamicArray_Destroy(Snapshot);
+}
+
+static void CopyOnWrite()
+{
+        uint32 Data[] = { 3, 14, 15, 92 };
+        uint32 Element = 65;
+
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData((byte*)Data, sizeof(Data), sizeof(Data[0]));
+        lluna_Container_DynamicArray_Resize(DynamicArray, 8);
+        struct lluna_Container_DynamicArray* Snapshot = lluna_Container_DynamicArray_Share(DynamicArray);
+
+        lluna_Container_DynamicArray_Append(DynamicArray, (byte*)&Element);
+
+        lluna_TestHelper_CheckNotEqual(Snapshot->Data, DynamicArray->Data, &SessionState, "Append did not copy the elements of a shared array.");
+        lluna_TestHelper_CheckEqual(lluna_Container_DynamicArray_Count(DynamicArray), 5, &SessionState, "Append did not add the element.");
+        lluna_TestHelper_CheckEqual(lluna_Container_DynamicArray_Count(Snapshot), 4, &SessionState, "Append modified the shared array.");
+        lluna_TestHelper_CheckEqual(memcmp(Data, DynamicArray->Data, sizeof(Data)), 0, &SessionState, "Append did not keep the copied elements.");
+        lluna_TestHelper_CheckEqual(memcmp(Data, Snapshot->Data, sizeof(Data)), 0, &SessionState, "Append modified the shared elements.");
+
+        struct lluna_Container_DynamicArray* Other = lluna_Container_DynamicArray_Share(Snapshot);
+        lluna_Container_DynamicArray_RemoveStable(Other, 0);
+
+        lluna_TestHelper_CheckEqual(*(uint32*)lluna_Container_DynamicArray_Get(Other, 0), 14, &SessionState, "RemoveStable did not remove the element.");
+        lluna_TestHelper_CheckEqual(memcmp(Data, Snapshot->Data, sizeof(Data)), 0, &SessionState, "RemoveStable modified the shared elements.");
+
+        lluna_Container_DynamicArray_Destroy(DynamicArray);
+        lluna_Container_DynamicArray_Destroy(Snapshot);
+        lluna_Container_DynamicArray_Destroy(Other);
+}
+
+static void Unshare()
+{
+        uint32 Data[] = { 3, 14, 15, 92 };
+
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_CreateFromData((byte*)Data, sizeof(Data), sizeof(Data[0]));
+        struct lluna_Container_DynamicArray* Snapshot = lluna_Container_DynamicArray_Share(DynamicArray);
+
+        lluna_Container_DynamicArray_Unshare(DynamicArray);
+        *(uint32*)lluna_Container_DynamicArray_Get(DynamicArray, 0) = 1;
+
+        lluna_TestHelper_CheckFalse(lluna_Container_DynamicArray_Shared(DynamicArray), &SessionState, "Unshare did not give the array its own elements.");
+        lluna_TestHelper_CheckEqual(*(uint32*)lluna_Container_DynamicArray_Get(Snapshot, 0), 3, &SessionState, "Writing an unshared array modified the shared elements.");
+
+        lluna_Container_DynamicArray_Destroy(DynamicArray);
+        lluna_Container_DynamicArray_Destroy(Snapshot);
+}
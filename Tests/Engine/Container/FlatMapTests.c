@@ -0,0 +1,289 @@
+#include <TestHelper.h>
+
+#include <Engine/Container/Public/FlatMap.h>
+
+#include <stdlib.h>
+
+struct lluna_TestHelper_Session SessionState;
+
+static void Create();
+static void InsertFind();
+static void InsertReplaces();
+static void Remove();
+static void LowerBound();
+static void StageCommit();
+static void Set();
+static void Freeze();
+static void ModifyFrozen();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Container_FlatMap");
+
+        lluna_TestHelper_RunTest(&SessionState, Create);
+        lluna_TestHelper_RunTest(&SessionState, InsertFind);
+        lluna_TestHelper_RunTest(&SessionState, InsertReplaces);
+        lluna_TestHelper_RunTest(&SessionState, Remove);
+        lluna_TestHelper_RunTest(&SessionState, LowerBound);
+        lluna_TestHelper_RunTest(&SessionState, StageCommit);
+        lluna_TestHelper_RunTest(&SessionState, Set);
+        lluna_TestHelper_RunTest(&SessionState, Freeze);
+        lluna_TestHelper_RunTest(&SessionState, ModifyFrozen);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+static uint64 NextRandom(uint64* State)
+{
+        *State ^= *State << 13;
+        *State ^= *State >> 7;
+        *State ^= *State << 17;
+
+        return *State;
+}
+
+static boolean IsSorted(struct lluna_Container_FlatMap* Map)
+{
+        boolean Sorted = true;
+        for (uint64 Index = 1; Index < lluna_Container_FlatMap_Count(Map); ++Index)
+        {
+                Sorted &= lluna_Container_FlatMap_KeyAt(Map, Index - 1) < lluna_Container_FlatMap_KeyAt(Map, Index);
+        }
+
+        return Sorted;
+}
+
+static void Create()
+{
+        struct lluna_Container_FlatMap* Map = lluna_Container_FlatMap_Create(0, sizeof(uint32));
+
+        lluna_TestHelper_CheckEqual(lluna_Container_FlatMap_Count(Map), 0, &SessionState, "New map is not empty.");
+        lluna_TestHelper_CheckFalse(lluna_Container_FlatMap_Contains(Map, 0), &SessionState, "Empty map contains a key.");
+        lluna_TestHelper_CheckTrue(lluna_Container_FlatMap_Find(Map, 0) == NULL, &SessionState, "Found a value in an empty map.");
+        lluna_TestHelper_CheckFalse(Map->Frozen, &SessionState, "New map is frozen.");
+
+        lluna_Container_FlatMap_Destroy(Map);
+}
+
+static void InsertFind()
+{
+        struct lluna_Container_FlatMap* Map = lluna_Container_FlatMap_Create(4, sizeof(uint32));
+
+        for (uint32 Value = 0; Value < 1000; ++Value)
+        {
+                lluna_Container_FlatMap_Insert(Map, (Value * 7919) % 1000 * 3, (byte*)&Value);
+        }
+
+        lluna_TestHelper_CheckEqual(lluna_Container_FlatMap_Count(Map), 1000, &SessionState, "Wrong number of entries.");
+        lluna_TestHelper_CheckTrue(IsSorted(Map), &SessionState, "Keys are not sorted.");
+
+        boolean Found = true;
+        for (uint32 Value = 0; Value < 1000; ++Value)
+        {
+                uint32* Stored = (uint32*)lluna_Container_FlatMap_Find(Map, (Value * 7919) % 1000 * 3);
+                Found &= Stored != NULL && *Stored == Value;
+                Found &= !lluna_Container_FlatMap_Contains(Map, (uint64)Value * 3 + 1);
+        }
+        lluna_TestHelper_CheckTrue(Found, &SessionState, "Lookups returned wrong values.");
+
+        lluna_Container_FlatMap_Destroy(Map);
+}
+
+static void InsertReplaces()
+{
+        struct lluna_Container_FlatMap* Map = lluna_Container_FlatMap_Create(4, sizeof(uint32));
+        uint32 First = 1;
+        uint32 Second = 2;
+
+        lluna_Container_FlatMap_Insert(Map, 42, (byte*)&First);
+        lluna_Container_FlatMap_Insert(Map, 42, (byte*)&Second);
+
+        lluna_TestHelper_CheckEqual(lluna_Container_FlatMap_Count(Map), 1, &SessionState, "Inserting an existing key added an entry.");
+        lluna_TestHelper_CheckEqual(*(uint32*)lluna_Container_FlatMap_Find(Map, 42), 2, &SessionState, "Inserting an existing key didn't replace its value.");
+
+        lluna_Container_FlatMap_Destroy(Map);
+}
+
+static void Remove()
+{
+        struct lluna_Container_FlatMap* Map = lluna_Container_FlatMap_Create(4, sizeof(uint32));
+
+        for (uint32 Value = 0; Value < 100; ++Value)
+        {
+                lluna_Container_FlatMap_Insert(Map, Value, (byte*)&Value);
+        }
+
+        boolean Removed = true;
+        for (uint32 Value = 0; Value < 100; Value += 2)
+        {
+                Removed &= lluna_Container_FlatMap_Remove(Map, Value);
+        }
+        lluna_TestHelper_CheckTrue(Removed, &SessionState, "Removing existing keys failed.");
+        lluna_TestHelper_CheckFalse(lluna_Container_FlatMap_Remove(Map, 2), &SessionState, "Removed a missing key.");
+        lluna_TestHelper_CheckEqual(lluna_Container_FlatMap_Count(Map), 50, &SessionState, "Wrong number of entries after removing.");
+
+        boolean Kept = true;
+        for (uint32 Value = 1; Value < 100; Value += 2)
+        {
+                uint32* Stored = (uint32*)lluna_Container_FlatMap_Find(Map, Value);
+                Kept &= Stored != NULL && *Stored == Value && !lluna_Container_FlatMap_Contains(Map, Value - 1);
+        }
+        lluna_TestHelper_CheckTrue(Kept, &SessionState, "Removing broke the other entries.");
+
+        lluna_Container_FlatMap_Destroy(Map);
+}
+
+static void LowerBound()
+{
+        struct lluna_Container_FlatMap* Map = lluna_Container_FlatMap_Create(4, 0);
+
+        lluna_TestHelper_CheckEqual(lluna_Container_FlatMap_LowerBound(Map, 5), 0, &SessionState, "Lower bound in an empty map is wrong.");
+
+        for (uint64 Key = 10; Key <= 100; Key += 10)
+        {
+                lluna_Container_FlatMap_Insert(Map, Key, NULL);
+        }
+
+        lluna_TestHelper_CheckEqual(lluna_Container_FlatMap_LowerBound(Map, 0), 0, &SessionState, "Lower bound before the first key is wrong.");
+        lluna_TestHelper_CheckEqual(lluna_Container_FlatMap_LowerBound(Map, 10), 0, &SessionState, "Lower bound of the first key is wrong.");
+        lluna_TestHelper_CheckEqual(lluna_Container_FlatMap_LowerBound(Map, 55), 5, &SessionState, "Lower bound between keys is wrong.");
+        lluna_TestHelper_CheckEqual(lluna_Container_FlatMap_LowerBound(Map, 60), 5, &SessionState, "Lower bound of a key is wrong.");
+        lluna_TestHelper_CheckEqual(lluna_Container_FlatMap_LowerBound(Map, 101), 10, &SessionState, "Lower bound past the last key is wrong.");
+
+        lluna_Container_FlatMap_Destroy(Map);
+}
+
+static void StageCommit()
+{
+        struct lluna_Container_FlatMap* Map = lluna_Container_FlatMap_Create(4, sizeof(uint64));
+        uint8* Present = calloc(4096, sizeof(uint8));
+        uint64* Expected = calloc(4096, sizeof(uint64));
+        uint64 State = 0x9E3779B97F4A7C15ULL;
+
+        // Several batches, each with duplicates and keys already in the map.
+        for (uint32 Batch = 0; Batch < 8; ++Batch)
+        {
+                for (uint32 Index = 0; Index < 700; ++Index)
+                {
+                        uint64 Key = NextRandom(&State) % 4096;
+                        uint64 Value = NextRandom(&State);
+                        lluna_Container_FlatMap_Stage(Map, Key, (byte*)&Value);
+                        Present[Key] = 1;
+                        Expected[Key] = Value;
+                }
+                lluna_Container_FlatMap_Commit(Map);
+        }
+
+        uint64 ExpectedCount = 0;
+        boolean Matches = true;
+        for (uint64 Key = 0; Key < 4096; ++Key)
+        {
+                ExpectedCount += Present[Key];
+
+                uint64* Stored = (uint64*)lluna_Container_FlatMap_Find(Map, Key);
+                Matches &= Present[Key] ? Stored != NULL && *Stored == Expected[Key] : Stored == NULL;
+        }
+        lluna_TestHelper_CheckEqual(lluna_Container_FlatMap_Count(Map), ExpectedCount, &SessionState, "Committing lost or duplicated keys.");
+        lluna_TestHelper_CheckTrue(IsSorted(Map), &SessionState, "Committed keys are not sorted.");
+        lluna_TestHelper_CheckTrue(Matches, &SessionState, "Committed values are wrong, or the last staged value didn't win.");
+
+        free(Expected);
+        free(Present);
+        lluna_Container_FlatMap_Destroy(Map);
+}
+
+static void Set()
+{
+        struct lluna_Container_FlatMap* Set = lluna_Container_FlatMap_Create(4, 0);
+
+        lluna_Container_FlatMap_Insert(Set, 3, NULL);
+        lluna_Container_FlatMap_Stage(Set, 1, NULL);
+        lluna_Container_FlatMap_Stage(Set, 3, NULL);
+        lluna_Container_FlatMap_Stage(Set, 2, NULL);
+
+        lluna_TestHelper_CheckFalse(lluna_Container_FlatMap_Contains(Set, 1), &SessionState, "Staged key is visible before committing.");
+
+        lluna_Container_FlatMap_Commit(Set);
+
+        lluna_TestHelper_CheckEqual(lluna_Container_FlatMap_Count(Set), 3, &SessionState, "Wrong number of keys in the set.");
+        lluna_TestHelper_CheckTrue(lluna_Container_FlatMap_Contains(Set, 1) && lluna_Container_FlatMap_Contains(Set, 2) && lluna_Container_FlatMap_Contains(Set, 3), &SessionState, "Set is missing keys.");
+        lluna_TestHelper_CheckTrue(lluna_Container_FlatMap_ValueAt(Set, 0) == NULL, &SessionState, "Set has values.");
+
+        lluna_Container_FlatMap_Destroy(Set);
+}
+
+static void Freeze()
+{
+        boolean Correct = true;
+        for (uint64 Count = 0; Count < 300; ++Count)
+        {
+                struct lluna_Container_FlatMap* Plain = lluna_Container_FlatMap_Create(Count, sizeof(uint64));
+                struct lluna_Container_FlatMap* Eytzinger = lluna_Container_FlatMap_Create(Count, sizeof(uint64));
+
+                for (uint64 Index = 0; Index < Count; ++Index)
+                {
+                        uint64 Key = Index * 2 + 1;
+                        lluna_Container_FlatMap_Stage(Plain, Key, (byte*)&Index);
+                        lluna_Container_FlatMap_Stage(Eytzinger, Key, (byte*)&Index);
+                }
+                lluna_Container_FlatMap_Freeze(Plain, false);
+                lluna_Container_FlatMap_Freeze(Eytzinger, true);
+
+                Correct &= Plain->Frozen && Eytzinger->Frozen && Plain->Layout == NULL && Eytzinger->Layout != NULL;
+
+                // Odd keys are present, even keys fall in every gap and past both ends.
+                for (uint64 Key = 0; Key <= Count * 2 + 1; ++Key)
+                {
+                        uint64 Index = lluna_Container_FlatMap_IndexOf(Eytzinger, Key);
+                        Correct &= Index == lluna_Container_FlatMap_IndexOf(Plain, Key);
+                        Correct &= Key % 2 == 1 ? Index == Key / 2 : Index == Count;
+                }
+
+                lluna_Container_FlatMap_Destroy(Eytzinger);
+                lluna_Container_FlatMap_Destroy(Plain);
+        }
+        lluna_TestHelper_CheckTrue(Correct, &SessionState, "Frozen lookups are wrong.");
+}
+
+static void ModifyFrozen()
+{
+        struct lluna_Container_FlatMap* Map = lluna_Container_FlatMap_Create(100, sizeof(uint64));
+        for (uint64 Index = 0; Index < 100; ++Index)
+        {
+                uint64 Key = Index * 2 + 1;
+                lluna_Container_FlatMap_Stage(Map, Key, (byte*)&Key);
+        }
+        lluna_Container_FlatMap_Freeze(Map, true);
+
+        // Inserting before every key and removing from the middle moves every index the layout knew.
+        uint64 Inserted = 0;
+        lluna_Container_FlatMap_Insert(Map, Inserted, (byte*)&Inserted);
+        lluna_TestHelper_CheckFalse(Map->Frozen, &SessionState, "Inserting didn't thaw the map.");
+        lluna_TestHelper_CheckTrue(Map->Layout == NULL, &SessionState, "Inserting kept the stale layout.");
+        lluna_TestHelper_CheckTrue(lluna_Container_FlatMap_Remove(Map, 51), &SessionState, "Removing a key failed.");
+
+        boolean Correct = true;
+        for (uint64 Key = 0; Key <= 201; ++Key)
+        {
+                uint64* Value = (uint64*)lluna_Container_FlatMap_Find(Map, Key);
+                boolean Present = Key == 0 || (Key % 2 == 1 && Key < 200 && Key != 51);
+                Correct &= Present ? Value != NULL && *Value == Key : Value == NULL;
+        }
+        lluna_TestHelper_CheckTrue(Correct, &SessionState, "Lookups after modifying a frozen map are wrong.");
+
+        // Freezing again rebuilds the layout from the modified keys.
+        lluna_Container_FlatMap_Freeze(Map, true);
+        lluna_Container_FlatMap_Remove(Map, 1);
+        lluna_Container_FlatMap_Freeze(Map, true);
+        lluna_TestHelper_CheckTrue(Map->Frozen && Map->Layout != NULL, &SessionState, "Map didn't freeze again.");
+        Correct = true;
+        for (uint64 Key = 0; Key <= 201; ++Key)
+        {
+                uint64* Value = (uint64*)lluna_Container_FlatMap_Find(Map, Key);
+                boolean Present = Key == 0 || (Key % 2 == 1 && Key < 200 && Key != 51 && Key != 1);
+                Correct &= Present ? Value != NULL && *Value == Key : Value == NULL;
+        }
+        lluna_TestHelper_CheckTrue(Correct, &SessionState, "Lookups after freezing again are wrong.");
+
+        lluna_Container_FlatMap_Destroy(Map);
+}
@@ -0,0 +1,174 @@
+#include <TestHelper.h>
+
+#include <Engine/Container/Public/List.h>
+
+struct lluna_TestHelper_Session SessionState;
+
+struct Item
+{
+        uint32 Value;
+        struct lluna_Container_List_Node Node;
+};
+
+static void Initialize();
+static void Push();
+static void Remove();
+static void Pop();
+static void MoveToFront();
+static void Splice();
+static void Concatenate();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Container_List");
+
+        lluna_TestHelper_RunTest(&SessionState, Initialize);
+        lluna_TestHelper_RunTest(&SessionState, Push);
+        lluna_TestHelper_RunTest(&SessionState, Remove);
+        lluna_TestHelper_RunTest(&SessionState, Pop);
+        lluna_TestHelper_RunTest(&SessionState, MoveToFront);
+        lluna_TestHelper_RunTest(&SessionState, Splice);
+        lluna_TestHelper_RunTest(&SessionState, Concatenate);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+// Checks the values of the list in both directions.
+static boolean Matches(struct lluna_Container_List* List, const uint32* Expected, uint32 Count)
+{
+        boolean Equal = lluna_Container_List_Count(List) == Count;
+
+        uint32 Index = 0;
+        for (struct lluna_Container_List_Node* Node = lluna_Container_List_First(List); Node && Index < Count; Node = lluna_Container_List_Next(List, Node))
+        {
+                Equal &= lluna_Macros_ContainerOf(Node, struct Item, Node)->Value == Expected[Index++];
+        }
+        for (struct lluna_Container_List_Node* Node = lluna_Container_List_Last(List); Node && Index > 0; Node = lluna_Container_List_Previous(List, Node))
+        {
+                Equal &= lluna_Macros_ContainerOf(Node, struct Item, Node)->Value == Expected[--Index];
+        }
+
+        return Equal && Index == 0;
+}
+
+static void Fill(struct lluna_Container_List* List, struct Item* Items, uint32 Count)
+{
+        lluna_Container_List_Initialize(List);
+        for (uint32 Index = 0; Index < Count; ++Index)
+        {
+                Items[Index].Value = Index;
+                lluna_Container_List_PushBack(List, &Items[Index].Node);
+        }
+}
+
+static void Initialize()
+{
+        struct lluna_Container_List List;
+        lluna_Container_List_Initialize(&List);
+
+        lluna_TestHelper_CheckTrue(lluna_Container_List_Empty(&List), &SessionState, "New list is not empty.");
+        lluna_TestHelper_CheckEqual(lluna_Container_List_Count(&List), 0, &SessionState, "New list has nodes.");
+        lluna_TestHelper_CheckTrue(lluna_Container_List_First(&List) == NULL && lluna_Container_List_Last(&List) == NULL, &SessionState, "New list has a first or last node.");
+}
+
+static void Push()
+{
+        struct lluna_Container_List List;
+        struct Item Items[4] = { { .Value = 0 }, { .Value = 1 }, { .Value = 2 }, { .Value = 3 } };
+        uint32 Expected[] = { 2, 0, 1, 3 };
+
+        lluna_Container_List_Initialize(&List);
+        lluna_Container_List_PushBack(&List, &Items[0].Node);
+        lluna_Container_List_PushBack(&List, &Items[3].Node);
+        lluna_Container_List_InsertBefore(&Items[3].Node, &Items[1].Node);
+        lluna_Container_List_PushFront(&List, &Items[2].Node);
+
+        lluna_TestHelper_CheckFalse(lluna_Container_List_Empty(&List), &SessionState, "List with nodes is empty.");
+        lluna_TestHelper_CheckTrue(Matches(&List, Expected, 4), &SessionState, "Nodes are not in insertion order.");
+}
+
+static void Remove()
+{
+        struct lluna_Container_List List;
+        struct Item Items[5];
+        uint32 Expected[] = { 1, 2, 3 };
+
+        Fill(&List, Items, 5);
+        lluna_Container_List_Remove(&Items[0].Node);
+        lluna_Container_List_Remove(&Items[4].Node);
+
+        lluna_TestHelper_CheckTrue(Matches(&List, Expected, 3), &SessionState, "Removing broke the list.");
+        lluna_TestHelper_CheckTrue(Items[0].Node.Next == NULL && Items[0].Node.Previous == NULL, &SessionState, "Removed node kept its links.");
+}
+
+static void Pop()
+{
+        struct lluna_Container_List List;
+        struct Item Items[3];
+        uint32 Expected[] = { 1 };
+
+        Fill(&List, Items, 3);
+
+        lluna_TestHelper_CheckTrue(lluna_Container_List_PopFront(&List) == &Items[0].Node, &SessionState, "Pop front returned the wrong node.");
+        lluna_TestHelper_CheckTrue(lluna_Container_List_PopBack(&List) == &Items[2].Node, &SessionState, "Pop back returned the wrong node.");
+        lluna_TestHelper_CheckTrue(Matches(&List, Expected, 1), &SessionState, "Popping broke the list.");
+
+        lluna_Container_List_PopBack(&List);
+        lluna_TestHelper_CheckTrue(lluna_Container_List_PopFront(&List) == NULL, &SessionState, "Popped a node from an empty list.");
+}
+
+static void MoveToFront()
+{
+        struct lluna_Container_List List;
+        struct Item Items[4];
+        uint32 Expected[] = { 3, 2, 0, 1 };
+
+        Fill(&List, Items, 4);
+        lluna_Container_List_MoveToFront(&List, &Items[2].Node);
+        lluna_Container_List_MoveToFront(&List, &Items[3].Node);
+        lluna_Container_List_MoveToFront(&List, &Items[3].Node);
+
+        lluna_TestHelper_CheckTrue(Matches(&List, Expected, 4), &SessionState, "Nodes were not moved to the front.");
+}
+
+static void Splice()
+{
+        struct lluna_Container_List First;
+        struct lluna_Container_List Second;
+        struct Item FirstItems[4];
+        struct Item SecondItems[3];
+        uint32 ExpectedFirst[] = { 0, 1, 2, 3 };
+        uint32 ExpectedSecond[] = { 2 };
+
+        Fill(&First, FirstItems, 4);
+        Fill(&Second, SecondItems, 3);
+
+        // Moves 0 and 1 of the second list between 0 and 1 of the first one, then undoes it.
+        lluna_Container_List_Splice(&FirstItems[1].Node, &SecondItems[0].Node, &SecondItems[1].Node);
+        lluna_TestHelper_CheckEqual(lluna_Container_List_Count(&First), 6, &SessionState, "Range was not spliced in.");
+        lluna_TestHelper_CheckTrue(Matches(&Second, ExpectedSecond, 1), &SessionState, "Range was not spliced out.");
+
+        lluna_Container_List_Splice(&SecondItems[2].Node, &SecondItems[0].Node, &SecondItems[1].Node);
+        lluna_TestHelper_CheckTrue(Matches(&First, ExpectedFirst, 4), &SessionState, "Splicing back broke the first list.");
+
+        // Within the same list, moving the last two nodes to the front.
+        uint32 ExpectedRotated[] = { 2, 3, 0, 1 };
+        lluna_Container_List_Splice(First.Sentinel.Next, &FirstItems[2].Node, &FirstItems[3].Node);
+        lluna_TestHelper_CheckTrue(Matches(&First, ExpectedRotated, 4), &SessionState, "Splicing within a list broke it.");
+}
+
+static void Concatenate()
+{
+        struct lluna_Container_List First;
+        struct lluna_Container_List Second;
+        struct Item FirstItems[2];
+        struct Item SecondItems[2];
+        uint32 Expected[] = { 0, 1, 0, 1 };
+
+        Fill(&First, FirstItems, 2);
+        Fill(&Second, SecondItems, 2);
+        lluna_Container_List_Concatenate(&First, &Second);
+
+        lluna_TestHelper_CheckTrue(Matches(&First, Expected, 4), &SessionState, "Lists were not concatenated.");
+        lluna_TestHelper_CheckTrue(lluna_Container_List_Empty(&Second), &SessionState, "Concatenated list is not empty.");
+}
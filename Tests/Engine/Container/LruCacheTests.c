@@ -0,0 +1,203 @@
+#include <TestHelper.h>
+
+#include <Engine/Container/Public/LruCache.h>
+
+struct lluna_TestHelper_Session SessionState;
+
+struct Glyph
+{
+        uint32 Codepoint;
+        boolean Evicted;
+        struct lluna_Container_LruCache_Entry Entry;
+};
+
+static void Create();
+static void InsertFind();
+static void Budget();
+static void Touch();
+static void Replace();
+static void Remove();
+static void Oversized();
+static void Many();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Container_LruCache");
+
+        lluna_TestHelper_RunTest(&SessionState, Create);
+        lluna_TestHelper_RunTest(&SessionState, InsertFind);
+        lluna_TestHelper_RunTest(&SessionState, Budget);
+        lluna_TestHelper_RunTest(&SessionState, Touch);
+        lluna_TestHelper_RunTest(&SessionState, Replace);
+        lluna_TestHelper_RunTest(&SessionState, Remove);
+        lluna_TestHelper_RunTest(&SessionState, Oversized);
+        lluna_TestHelper_RunTest(&SessionState, Many);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+static void MarkEvicted(void* Context, struct lluna_Container_LruCache_Entry* Entry)
+{
+        lluna_Macros_ContainerOf(Entry, struct Glyph, Entry)->Evicted = true;
+        ++*(uint32*)Context;
+}
+
+static void Fill(struct lluna_Container_LruCache* Cache, struct Glyph* Glyphs, uint32 Count)
+{
+        for (uint32 Index = 0; Index < Count; ++Index)
+        {
+                Glyphs[Index].Codepoint = Index;
+                Glyphs[Index].Evicted = false;
+                lluna_Container_LruCache_Insert(Cache, &Glyphs[Index].Entry, Index, 10);
+        }
+}
+
+static void Create()
+{
+        uint32 Evictions = 0;
+        struct lluna_Container_LruCache* Cache = lluna_Container_LruCache_Create(100, MarkEvicted, &Evictions);
+
+        lluna_TestHelper_CheckEqual(lluna_Container_LruCache_Count(Cache), 0, &SessionState, "New cache is not empty.");
+        lluna_TestHelper_CheckEqual(lluna_Container_LruCache_Size(Cache), 0, &SessionState, "New cache has a size.");
+        lluna_TestHelper_CheckTrue(lluna_Container_LruCache_Find(Cache, 0) == NULL, &SessionState, "Found an entry in an empty cache.");
+
+        lluna_Container_LruCache_Destroy(Cache);
+}
+
+static void InsertFind()
+{
+        uint32 Evictions = 0;
+        struct lluna_Container_LruCache* Cache = lluna_Container_LruCache_Create(100, MarkEvicted, &Evictions);
+        struct Glyph Glyphs[5];
+
+        Fill(Cache, Glyphs, 5);
+
+        boolean Found = true;
+        for (uint32 Index = 0; Index < 5; ++Index)
+        {
+                Found &= lluna_Container_LruCache_Find(Cache, Index) == &Glyphs[Index].Entry;
+        }
+
+        lluna_TestHelper_CheckTrue(Found, &SessionState, "Entries were not found by key.");
+        lluna_TestHelper_CheckTrue(lluna_Container_LruCache_Peek(Cache, 5) == NULL, &SessionState, "Found a missing key.");
+        lluna_TestHelper_CheckEqual(lluna_Container_LruCache_Size(Cache), 50, &SessionState, "Wrong total size.");
+        lluna_TestHelper_CheckEqual(Evictions, 0, &SessionState, "Evicted entries within the budget.");
+
+        lluna_Container_LruCache_Destroy(Cache);
+
+        lluna_TestHelper_CheckEqual(Evictions, 5, &SessionState, "Destroying didn't evict every entry.");
+}
+
+static void Budget()
+{
+        uint32 Evictions = 0;
+        struct lluna_Container_LruCache* Cache = lluna_Container_LruCache_Create(30, MarkEvicted, &Evictions);
+        struct Glyph Glyphs[5];
+
+        Fill(Cache, Glyphs, 5);
+
+        lluna_TestHelper_CheckEqual(lluna_Container_LruCache_Count(Cache), 3, &SessionState, "Cache went over its budget.");
+        lluna_TestHelper_CheckTrue(Glyphs[0].Evicted && Glyphs[1].Evicted && !Glyphs[2].Evicted, &SessionState, "Evicted entries are not the least recently used.");
+        lluna_TestHelper_CheckTrue(lluna_Container_LruCache_Peek(Cache, 0) == NULL, &SessionState, "Evicted entry is still indexed.");
+
+        lluna_Container_LruCache_SetBudget(Cache, 10);
+        lluna_TestHelper_CheckEqual(lluna_Container_LruCache_Count(Cache), 1, &SessionState, "Lowering the budget didn't evict.");
+        lluna_TestHelper_CheckFalse(Glyphs[4].Evicted, &SessionState, "Lowering the budget evicted the most recent entry.");
+
+        lluna_Container_LruCache_Destroy(Cache);
+}
+
+static void Touch()
+{
+        uint32 Evictions = 0;
+        struct lluna_Container_LruCache* Cache = lluna_Container_LruCache_Create(30, MarkEvicted, &Evictions);
+        struct Glyph Glyphs[4];
+
+        Fill(Cache, Glyphs, 3);
+        lluna_Container_LruCache_Find(Cache, 0);
+        lluna_Container_LruCache_Peek(Cache, 1);
+
+        Glyphs[3].Evicted = false;
+        lluna_Container_LruCache_Insert(Cache, &Glyphs[3].Entry, 3, 10);
+
+        lluna_TestHelper_CheckFalse(Glyphs[0].Evicted, &SessionState, "Found entry was evicted.");
+        lluna_TestHelper_CheckTrue(Glyphs[1].Evicted, &SessionState, "Peeking changed the recency.");
+
+        lluna_Container_LruCache_Destroy(Cache);
+}
+
+static void Replace()
+{
+        uint32 Evictions = 0;
+        struct lluna_Container_LruCache* Cache = lluna_Container_LruCache_Create(100, MarkEvicted, &Evictions);
+        struct Glyph Old = { .Codepoint = 1, .Evicted = false };
+        struct Glyph New = { .Codepoint = 1, .Evicted = false };
+
+        lluna_Container_LruCache_Insert(Cache, &Old.Entry, 1, 10);
+        lluna_Container_LruCache_Insert(Cache, &New.Entry, 1, 20);
+
+        lluna_TestHelper_CheckTrue(Old.Evicted, &SessionState, "Replaced entry was not evicted.");
+        lluna_TestHelper_CheckTrue(lluna_Container_LruCache_Find(Cache, 1) == &New.Entry, &SessionState, "Key doesn't find the new entry.");
+        lluna_TestHelper_CheckEqual(lluna_Container_LruCache_Size(Cache), 20, &SessionState, "Replaced entry still counts against the budget.");
+
+        lluna_Container_LruCache_Destroy(Cache);
+}
+
+static void Remove()
+{
+        uint32 Evictions = 0;
+        struct lluna_Container_LruCache* Cache = lluna_Container_LruCache_Create(100, MarkEvicted, &Evictions);
+        struct Glyph Glyphs[3];
+
+        Fill(Cache, Glyphs, 3);
+        lluna_Container_LruCache_Remove(Cache, &Glyphs[1].Entry);
+
+        lluna_TestHelper_CheckFalse(Glyphs[1].Evicted, &SessionState, "Removing called the eviction callback.");
+        lluna_TestHelper_CheckTrue(lluna_Container_LruCache_Peek(Cache, 1) == NULL, &SessionState, "Removed entry is still indexed.");
+        lluna_TestHelper_CheckEqual(lluna_Container_LruCache_Size(Cache), 20, &SessionState, "Removed entry still counts against the budget.");
+
+        lluna_Container_LruCache_Destroy(Cache);
+}
+
+static void Oversized()
+{
+        uint32 Evictions = 0;
+        struct lluna_Container_LruCache* Cache = lluna_Container_LruCache_Create(100, MarkEvicted, &Evictions);
+        struct Glyph Small = { .Codepoint = 1, .Evicted = false };
+        struct Glyph Huge = { .Codepoint = 2, .Evicted = false };
+
+        lluna_Container_LruCache_Insert(Cache, &Small.Entry, 1, 10);
+        lluna_Container_LruCache_Insert(Cache, &Huge.Entry, 2, 1000);
+
+        lluna_TestHelper_CheckTrue(Small.Evicted && Huge.Evicted, &SessionState, "Entry larger than the budget was kept.");
+        lluna_TestHelper_CheckEqual(lluna_Container_LruCache_Count(Cache), 0, &SessionState, "Cache is not empty.");
+
+        lluna_Container_LruCache_Destroy(Cache);
+}
+
+static void Many()
+{
+        uint32 Evictions = 0;
+        struct lluna_Container_LruCache* Cache = lluna_Container_LruCache_Create(5000 * 10, MarkEvicted, &Evictions);
+        static struct Glyph Glyphs[10000];
+
+        // Spreads keys over the high bits too, and grows the buckets several times.
+        for (uint32 Index = 0; Index < 10000; ++Index)
+        {
+                Glyphs[Index].Codepoint = Index;
+                Glyphs[Index].Evicted = false;
+                lluna_Container_LruCache_Insert(Cache, &Glyphs[Index].Entry, (uint64)Index << 40 | Index, 10);
+        }
+
+        boolean Correct = true;
+        for (uint32 Index = 0; Index < 10000; ++Index)
+        {
+                struct lluna_Container_LruCache_Entry* Entry = lluna_Container_LruCache_Peek(Cache, (uint64)Index << 40 | Index);
+                Correct &= Index < 5000 ? Entry == NULL && Glyphs[Index].Evicted : Entry == &Glyphs[Index].Entry;
+        }
+
+        lluna_TestHelper_CheckEqual(lluna_Container_LruCache_Count(Cache), 5000, &SessionState, "Wrong number of entries.");
+        lluna_TestHelper_CheckTrue(Correct, &SessionState, "Wrong entries were kept.");
+
+        lluna_Container_LruCache_Destroy(Cache);
+}
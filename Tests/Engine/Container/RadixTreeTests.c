@@ -0,0 +1,351 @@
+#include <TestHelper.h>
+
+#include <Engine/Container/Public/RadixTree.h>
+
+#include <stdio.h>
+#include <string.h>
+
+struct lluna_TestHelper_Session SessionState;
+
+static void Create();
+static void InsertFind();
+static void Replace();
+static void NestedKeys();
+static void LongPrefixes();
+static void Growth();
+static void Remove();
+static void LongestPrefix();
+static void VisitPrefix();
+static void Random();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Container_RadixTree");
+
+        lluna_TestHelper_RunTest(&SessionState, Create);
+        lluna_TestHelper_RunTest(&SessionState, InsertFind);
+        lluna_TestHelper_RunTest(&SessionState, Replace);
+        lluna_TestHelper_RunTest(&SessionState, NestedKeys);
+        lluna_TestHelper_RunTest(&SessionState, LongPrefixes);
+        lluna_TestHelper_RunTest(&SessionState, Growth);
+        lluna_TestHelper_RunTest(&SessionState, Remove);
+        lluna_TestHelper_RunTest(&SessionState, LongestPrefix);
+        lluna_TestHelper_RunTest(&SessionState, VisitPrefix);
+        lluna_TestHelper_RunTest(&SessionState, Random);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+static struct lluna_Core_Types_Text View(const char* Text)
+{
+        return (struct lluna_Core_Types_Text){ Text, strlen(Text) };
+}
+
+static const char* Paths[] = {
+        "Assets/Textures/Stone.png",
+        "Assets/Textures/Sand.png",
+        "Assets/Textures/Snow.png",
+        "Assets/Meshes/Rock.mesh",
+        "Assets/Meshes/Rock.mesh.lod1",
+        "Assets",
+        "Config/Video/Resolution",
+        "Config/Video/VSync",
+        "Config/Audio/Volume",
+        "",
+};
+
+#define PathCount (sizeof(Paths) / sizeof(Paths[0]))
+
+static void Fill(struct lluna_Container_RadixTree* Tree)
+{
+        for (uint64 Index = 0; Index < PathCount; ++Index)
+        {
+                lluna_Container_RadixTree_Insert(Tree, View(Paths[Index]), (void*)Paths[Index]);
+        }
+}
+
+static void Create()
+{
+        struct lluna_Container_RadixTree* Tree = lluna_Container_RadixTree_Create();
+
+        lluna_TestHelper_CheckEqual(lluna_Container_RadixTree_Count(Tree), 0, &SessionState, "New tree is not empty.");
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_Find(Tree, lluna_Macros_Text("Assets")) == NULL, &SessionState, "Found a key in an empty tree.");
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_Remove(Tree, lluna_Macros_Text("Assets")) == NULL, &SessionState, "Removed a key from an empty tree.");
+
+        lluna_Container_RadixTree_Destroy(Tree);
+}
+
+static void InsertFind()
+{
+        struct lluna_Container_RadixTree* Tree = lluna_Container_RadixTree_Create();
+        Fill(Tree);
+
+        boolean Found = true;
+        for (uint64 Index = 0; Index < PathCount; ++Index)
+        {
+                Found &= lluna_Container_RadixTree_Find(Tree, View(Paths[Index])) == Paths[Index];
+        }
+
+        lluna_TestHelper_CheckEqual(lluna_Container_RadixTree_Count(Tree), PathCount, &SessionState, "Wrong number of keys.");
+        lluna_TestHelper_CheckTrue(Found, &SessionState, "Inserted keys were not found.");
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_Find(Tree, lluna_Macros_Text("Assets/Textures/Stone.png")) == Paths[0], &SessionState, "Null terminator is part of the key.");
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_Find(Tree, lluna_Macros_Text("Assets/Textures")) == NULL, &SessionState, "Found a prefix that isn't a key.");
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_Find(Tree, lluna_Macros_Text("Assets/Textures/Stone.pngx")) == NULL, &SessionState, "Found a key extending another one.");
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_Find(Tree, lluna_Macros_Text("Assets/Textures/Stane.png")) == NULL, &SessionState, "Found a missing key.");
+
+        lluna_Container_RadixTree_Destroy(Tree);
+}
+
+static void Replace()
+{
+        struct lluna_Container_RadixTree* Tree = lluna_Container_RadixTree_Create();
+        int First = 1;
+        int Second = 2;
+
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_Insert(Tree, lluna_Macros_Text("Key"), &First) == NULL, &SessionState, "New key returned a value.");
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_Insert(Tree, lluna_Macros_Text("Key"), &Second) == &First, &SessionState, "Replaced key didn't return its value.");
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_Find(Tree, lluna_Macros_Text("Key")) == &Second, &SessionState, "Value was not replaced.");
+        lluna_TestHelper_CheckEqual(lluna_Container_RadixTree_Count(Tree), 1, &SessionState, "Replacing added a key.");
+
+        lluna_Container_RadixTree_Destroy(Tree);
+}
+
+static void NestedKeys()
+{
+        struct lluna_Container_RadixTree* Tree = lluna_Container_RadixTree_Create();
+        const char* Keys[] = { "abcd", "ab", "abc", "a", "" };
+
+        boolean Found = true;
+        for (uint64 Index = 0; Index < 5; ++Index)
+        {
+                lluna_Container_RadixTree_Insert(Tree, View(Keys[Index]), (void*)Keys[Index]);
+                for (uint64 Inserted = 0; Inserted <= Index; ++Inserted)
+                {
+                        Found &= lluna_Container_RadixTree_Find(Tree, View(Keys[Inserted])) == Keys[Inserted];
+                }
+        }
+
+        lluna_TestHelper_CheckTrue(Found, &SessionState, "Keys that are prefixes of each other were not found.");
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_Find(Tree, lluna_Macros_Text("abcde")) == NULL, &SessionState, "Found a missing key.");
+
+        lluna_Container_RadixTree_Destroy(Tree);
+}
+
+static void LongPrefixes()
+{
+        struct lluna_Container_RadixTree* Tree = lluna_Container_RadixTree_Create();
+        const char* Keys[] = {
+                "Source/Engine/Container/Private/RadixTree.c",
+                "Source/Engine/Container/Private/RedBlackTree.c",
+                "Source/Engine/Container/Public/RadixTree.h",
+                "Source/Engine/Core/Private/Hash.c",
+                "Source/Engine/Container/Private",
+        };
+
+        // Prefixes are longer than what nodes store, and are split past their stored part.
+        boolean Found = true;
+        for (uint64 Index = 0; Index < 5; ++Index)
+        {
+                lluna_Container_RadixTree_Insert(Tree, View(Keys[Index]), (void*)Keys[Index]);
+        }
+        for (uint64 Index = 0; Index < 5; ++Index)
+        {
+                Found &= lluna_Container_RadixTree_Find(Tree, View(Keys[Index])) == Keys[Index];
+        }
+
+        lluna_TestHelper_CheckTrue(Found, &SessionState, "Keys with long shared prefixes were not found.");
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_Find(Tree, lluna_Macros_Text("Source/Engine/Container/Privatx/RadixTree.c")) == NULL, &SessionState, "Found a key differing past the stored prefix.");
+
+        for (uint64 Index = 0; Index < 5; ++Index)
+        {
+                Found &= lluna_Container_RadixTree_Remove(Tree, View(Keys[Index])) == Keys[Index];
+                for (uint64 Remaining = Index + 1; Remaining < 5; ++Remaining)
+                {
+                        Found &= lluna_Container_RadixTree_Find(Tree, View(Keys[Remaining])) == Keys[Remaining];
+                }
+        }
+
+        lluna_TestHelper_CheckTrue(Found, &SessionState, "Removing broke merged prefixes.");
+        lluna_TestHelper_CheckTrue(Tree->Root == NULL, &SessionState, "Empty tree kept nodes.");
+
+        lluna_Container_RadixTree_Destroy(Tree);
+}
+
+static void Growth()
+{
+        struct lluna_Container_RadixTree* Tree = lluna_Container_RadixTree_Create();
+        char Keys[256][3];
+
+        // Every byte value below the same node, growing it through every node type and back.
+        for (uint32 Index = 0; Index < 256; ++Index)
+        {
+                Keys[Index][0] = 'k';
+                Keys[Index][1] = (char)(Index * 37 % 256);
+                Keys[Index][2] = 'v';
+                lluna_Container_RadixTree_Insert(Tree, (struct lluna_Core_Types_Text){ Keys[Index], 3 }, Keys[Index]);
+        }
+
+        boolean Found = true;
+        for (uint32 Index = 0; Index < 256; ++Index)
+        {
+                Found &= lluna_Container_RadixTree_Find(Tree, (struct lluna_Core_Types_Text){ Keys[Index], 3 }) == Keys[Index];
+        }
+        lluna_TestHelper_CheckTrue(Found, &SessionState, "Keys were lost while growing nodes.");
+
+        for (uint32 Index = 0; Index < 250; ++Index)
+        {
+                Found &= lluna_Container_RadixTree_Remove(Tree, (struct lluna_Core_Types_Text){ Keys[Index], 3 }) == Keys[Index];
+        }
+        for (uint32 Index = 250; Index < 256; ++Index)
+        {
+                Found &= lluna_Container_RadixTree_Find(Tree, (struct lluna_Core_Types_Text){ Keys[Index], 3 }) == Keys[Index];
+        }
+        lluna_TestHelper_CheckTrue(Found, &SessionState, "Keys were lost while shrinking nodes.");
+        lluna_TestHelper_CheckEqual(lluna_Container_RadixTree_Count(Tree), 6, &SessionState, "Wrong number of keys.");
+
+        lluna_Container_RadixTree_Destroy(Tree);
+}
+
+static void Remove()
+{
+        struct lluna_Container_RadixTree* Tree = lluna_Container_RadixTree_Create();
+        Fill(Tree);
+
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_Remove(Tree, lluna_Macros_Text("Assets")) == Paths[5], &SessionState, "Removing didn't return the value.");
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_Remove(Tree, lluna_Macros_Text("Assets")) == NULL, &SessionState, "Removed a key twice.");
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_Remove(Tree, lluna_Macros_Text("Assets/Meshes")) == NULL, &SessionState, "Removed a prefix that isn't a key.");
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_Find(Tree, lluna_Macros_Text("Assets")) == NULL, &SessionState, "Removed key was found.");
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_Find(Tree, lluna_Macros_Text("Assets/Meshes/Rock.mesh")) == Paths[3], &SessionState, "Removing lost another key.");
+        lluna_TestHelper_CheckEqual(lluna_Container_RadixTree_Count(Tree), PathCount - 1, &SessionState, "Wrong number of keys.");
+
+        lluna_Container_RadixTree_Clear(Tree);
+        lluna_TestHelper_CheckEqual(lluna_Container_RadixTree_Count(Tree), 0, &SessionState, "Cleared tree is not empty.");
+
+        lluna_Container_RadixTree_Destroy(Tree);
+}
+
+static void LongestPrefix()
+{
+        struct lluna_Container_RadixTree* Tree = lluna_Container_RadixTree_Create();
+        Fill(Tree);
+
+        uint64 Length = 0;
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_LongestPrefix(Tree, lluna_Macros_Text("Assets/Meshes/Rock.mesh.lod2"), &Length) == Paths[3], &SessionState, "Wrong longest prefix.");
+        lluna_TestHelper_CheckEqual(Length, strlen(Paths[3]), &SessionState, "Wrong longest prefix length.");
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_LongestPrefix(Tree, lluna_Macros_Text("Assets/Meshes/Rock.mesh.lod1"), NULL) == Paths[4], &SessionState, "Key is not its own longest prefix.");
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_LongestPrefix(Tree, lluna_Macros_Text("Assets/Sounds/Wind.ogg"), NULL) == Paths[5], &SessionState, "Shorter key was not matched.");
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_LongestPrefix(Tree, lluna_Macros_Text("Shaders/Sky.glsl"), NULL) == Paths[9], &SessionState, "Empty key was not matched.");
+
+        lluna_Container_RadixTree_Remove(Tree, lluna_Macros_Text(""));
+        lluna_TestHelper_CheckTrue(lluna_Container_RadixTree_LongestPrefix(Tree, lluna_Macros_Text("Shaders/Sky.glsl"), &Length) == NULL, &SessionState, "Matched without a prefix key.");
+
+        lluna_Container_RadixTree_Destroy(Tree);
+}
+
+struct Collector
+{
+        char Keys[16][64];
+        uint32 Count;
+        uint32 Limit;
+};
+
+static boolean Collect(void* Context, struct lluna_Core_Types_Text Key, void* Value)
+{
+        struct Collector* Collector = Context;
+        snprintf(Collector->Keys[Collector->Count++], 64, "%.*s", (int)Key.Size, Key.Data);
+
+        return Collector->Count < Collector->Limit;
+}
+
+static void VisitPrefix()
+{
+        struct lluna_Container_RadixTree* Tree = lluna_Container_RadixTree_Create();
+        Fill(Tree);
+
+        struct Collector Collector = { .Limit = 16 };
+        lluna_Container_RadixTree_VisitPrefix(Tree, lluna_Macros_Text("Assets/"), Collect, &Collector);
+
+        lluna_TestHelper_CheckEqual(Collector.Count, 5, &SessionState, "Wrong number of visited keys.");
+        lluna_TestHelper_CheckTrue(strcmp(Collector.Keys[0], "Assets/Meshes/Rock.mesh") == 0 && strcmp(Collector.Keys[1], "Assets/Meshes/Rock.mesh.lod1") == 0 && strcmp(Collector.Keys[4], "Assets/Textures/Stone.png") == 0, &SessionState, "Keys were not visited in order.");
+
+        Collector = (struct Collector){ .Limit = 16 };
+        lluna_Container_RadixTree_VisitPrefix(Tree, lluna_Macros_Text("Config/Vid"), Collect, &Collector);
+        lluna_TestHelper_CheckEqual(Collector.Count, 2, &SessionState, "Prefix ending inside a node visited the wrong keys.");
+
+        Collector = (struct Collector){ .Limit = 16 };
+        lluna_Container_RadixTree_VisitPrefix(Tree, lluna_Macros_Text("Config/Video/Resolution/Width"), Collect, &Collector);
+        lluna_TestHelper_CheckEqual(Collector.Count, 0, &SessionState, "Visited keys shorter than the prefix.");
+
+        Collector = (struct Collector){ .Limit = 3 };
+        lluna_TestHelper_CheckFalse(lluna_Container_RadixTree_VisitPrefix(Tree, lluna_Macros_Text(""), Collect, &Collector), &SessionState, "Stopped visit was not reported.");
+        lluna_TestHelper_CheckTrue(Collector.Count == 3 && Collector.Keys[0][0] == '\0' && strcmp(Collector.Keys[1], "Assets") == 0, &SessionState, "Visit didn't stop or start with the shortest keys.");
+
+        lluna_Container_RadixTree_Destroy(Tree);
+}
+
+static void Random()
+{
+        struct lluna_Container_RadixTree* Tree = lluna_Container_RadixTree_Create();
+        static char Keys[2048][12];
+        static boolean Present[2048];
+
+        // Short keys over a small alphabet, so they often share prefixes or are prefixes of each other.
+        uint64 State = 0x9E3779B97F4A7C15ULL;
+        for (uint32 Index = 0; Index < 2048; ++Index)
+        {
+                State ^= State << 13;
+                State ^= State >> 7;
+                State ^= State << 17;
+                uint32 Length = (uint32)(State % 12);
+                for (uint32 Character = 0; Character < Length; ++Character)
+                {
+                        Keys[Index][Character] = "ab/c"[(State >> (8 + Character * 2)) & 3];
+                }
+                Keys[Index][Length] = '\0';
+        }
+
+        boolean Correct = true;
+        uint64 Count = 0;
+        for (uint32 Step = 0; Step < 20000; ++Step)
+        {
+                State ^= State << 13;
+                State ^= State >> 7;
+                State ^= State << 17;
+                uint32 Index = (uint32)(State % 2048);
+
+                // Duplicate keys share the value of their first index.
+                uint32 First = 0;
+                while (strcmp(Keys[First], Keys[Index]) != 0)
+                {
+                        ++First;
+                }
+
+                if ((State >> 32) & 1)
+                {
+                        Correct &= lluna_Container_RadixTree_Insert(Tree, View(Keys[First]), Keys[First]) == (Present[First] ? Keys[First] : NULL);
+                        Count += !Present[First];
+                        Present[First] = true;
+                }
+                else
+                {
+                        Correct &= lluna_Container_RadixTree_Remove(Tree, View(Keys[First])) == (Present[First] ? Keys[First] : NULL);
+                        Count -= Present[First];
+                        Present[First] = false;
+                }
+        }
+
+        for (uint32 Index = 0; Index < 2048; ++Index)
+        {
+                uint32 First = 0;
+                while (strcmp(Keys[First], Keys[Index]) != 0)
+                {
+                        ++First;
+                }
+                Correct &= lluna_Container_RadixTree_Find(Tree, View(Keys[Index])) == (Present[First] ? Keys[First] : NULL);
+        }
+
+        lluna_TestHelper_CheckTrue(Correct, &SessionState, "Tree disagrees with the reference.");
+        lluna_TestHelper_CheckEqual(lluna_Container_RadixTree_Count(Tree), Count, &SessionState, "Wrong number of keys.");
+
+        lluna_Container_RadixTree_Destroy(Tree);
+}
@@ -1,6 +1,9 @@
 #include <TestHelper.h>
 
 #include <Engine/Container/Public/RedBlackTree.h>
+#include <Engine/Core/Public/Atomics.h>
+
+#include <pthread.h>
 
 struct lluna_TestHelper_Session SessionState;
 
@@ -17,6 +20,9 @@ static void Insert();
 static void Remove();
 static void ForEach();
 static void ReversedForEach();
+static void Publish();
+static void LowerBound();
+static void ConcurrentSnapshots();
 
 int main(int argc, const char* argv[])
 {
@@ -35,6 +41,9 @@ int main(int argc, const char* argv[])
         lluna_TestHelper_RunTest(&SessionState, Remove);
         lluna_TestHelper_RunTest(&SessionState, ForEach);
         lluna_TestHelper_RunTest(&SessionState, ReversedForEach);
+        lluna_TestHelper_RunTest(&SessionState, Publish);
+        lluna_TestHelper_RunTest(&SessionState, LowerBound);
+        lluna_TestHelper_RunTest(&SessionState, ConcurrentSnapshots);
 
         lluna_TestHelper_FinishSession(&SessionState);
 }
@@ -461,3 +470,190 @@ static void ReversedForEach()
         }
         free(Holders);
 }
+
+static uint32 DataOf(struct lluna_Container_RedBlackTree_Node* Node)
+{
+        return lluna_Macros_ContainerOf(Node, struct Holder, RedBlackTree)->Data;
+}
+
+static int32 CompareData(void* Context, struct lluna_Container_RedBlackTree_Node* Node)
+{
+        uint32 Key = *(uint32*)Context;
+        return DataOf(Node) < Key ? -1 : DataOf(Node) > Key;
+}
+
+static void Publish()
+{
+        uint32 Data[] = { 50, 15, 68, 5, 75, 6, 1, 2, 8, 10 };
+        uint32 OrderedData[] = { 1, 2, 5, 6, 8, 10, 15, 50, 68, 75 };
+        uint64 ElementCount = sizeof(Data) / sizeof(Data[0]);
+        struct Holder* Holders = malloc(ElementCount * sizeof(struct Holder));
+
+        struct lluna_Core_Epoch* Epoch = lluna_Core_Epoch_Create();
+        struct lluna_Container_RedBlackTree* Handle = lluna_Container_RedBlackTree_Create();
+
+        lluna_TestHelper_CheckEqual(lluna_Container_RedBlackTree_Acquire(Handle)->Count, 0, &SessionState, "Unpublished tree did not have an empty snapshot.");
+
+        for (uint64 i = 0; i < ElementCount; ++i)
+        {
+                Holders[i].Data = Data[i];
+                InsertHolder(Handle, &Holders[i]);
+        }
+        lluna_Container_RedBlackTree_Publish(Handle, Epoch);
+        lluna_Container_RedBlackTree_Remove(Handle, &Holders[0].RedBlackTree);
+
+        struct lluna_Container_RedBlackTree_Snapshot* Snapshot = lluna_Container_RedBlackTree_Acquire(Handle);
+        lluna_TestHelper_CheckEqual(Snapshot->Count, ElementCount, &SessionState, "Snapshot did not have the correct number of nodes.");
+        boolean Ordered = true;
+        for (uint64 i = 0; i < Snapshot->Count; ++i)
+        {
+                Ordered &= DataOf(Snapshot->Nodes[i]) == OrderedData[i];
+        }
+        lluna_TestHelper_CheckTrue(Ordered, &SessionState, "Snapshot did not list the nodes in order.");
+
+        lluna_Container_RedBlackTree_Publish(Handle, Epoch);
+        lluna_TestHelper_CheckEqual(lluna_Container_RedBlackTree_Acquire(Handle)->Count, ElementCount - 1, &SessionState, "Republishing did not pick up the removal.");
+
+        lluna_Container_RedBlackTree_Destroy(Handle);
+        lluna_Core_Epoch_Destroy(Epoch);
+        free(Holders);
+}
+
+static void LowerBound()
+{
+        uint32 Data[] = { 50, 15, 68, 5, 75, 6, 1, 2, 8, 10 };
+        uint64 ElementCount = sizeof(Data) / sizeof(Data[0]);
+        struct Holder* Holders = malloc(ElementCount * sizeof(struct Holder));
+
+        struct lluna_Core_Epoch* Epoch = lluna_Core_Epoch_Create();
+        struct lluna_Container_RedBlackTree* Handle = lluna_Container_RedBlackTree_Create();
+        for (uint64 i = 0; i < ElementCount; ++i)
+        {
+                Holders[i].Data = Data[i];
+                InsertHolder(Handle, &Holders[i]);
+        }
+        lluna_Container_RedBlackTree_Publish(Handle, Epoch);
+
+        struct lluna_Container_RedBlackTree_Snapshot* Snapshot = lluna_Container_RedBlackTree_Acquire(Handle);
+        uint32 Key = 8;
+        uint64 Index = lluna_Container_RedBlackTree_LowerBound(Snapshot, CompareData, &Key);
+        lluna_TestHelper_CheckEqual(DataOf(Snapshot->Nodes[Index]), 8, &SessionState, "LowerBound did not find an existing key.");
+
+        Key = 11;
+        Index = lluna_Container_RedBlackTree_LowerBound(Snapshot, CompareData, &Key);
+        lluna_TestHelper_CheckEqual(DataOf(Snapshot->Nodes[Index]), 15, &SessionState, "LowerBound did not find the next key of a missing one.");
+
+        Key = 0;
+        lluna_TestHelper_CheckEqual(lluna_Container_RedBlackTree_LowerBound(Snapshot, CompareData, &Key), 0, &SessionState, "LowerBound did not find the first node.");
+        Key = 100;
+        lluna_TestHelper_CheckEqual(lluna_Container_RedBlackTree_LowerBound(Snapshot, CompareData, &Key), ElementCount, &SessionState, "LowerBound found a node past the last one.");
+
+        lluna_Container_RedBlackTree_Destroy(Handle);
+        lluna_Core_Epoch_Destroy(Epoch);
+        free(Holders);
+}
+
+#define ReaderCount 4
+#define Poison 0xFFFFFFFF
+
+struct Reader
+{
+        struct lluna_Container_RedBlackTree* Tree;
+        struct lluna_Core_Epoch* Epoch;
+        uint32* Stop;
+        boolean Correct;
+};
+
+// Poisons holders before freeing them, so readers using freed nodes notice even without a sanitizer.
+static void FreeHolder(void* Pointer)
+{
+        lluna_Core_Atomics_StoreUint32(&((struct Holder*)Pointer)->Data, Poison, lluna_Core_Atomics_Relaxed);
+        free(Pointer);
+}
+
+static void* ReadSnapshots(void* Argument)
+{
+        struct Reader* Reader = Argument;
+        struct lluna_Core_Epoch_Participant Participant;
+        lluna_Core_Epoch_Register(Reader->Epoch, &Participant);
+
+        while (!lluna_Core_Atomics_LoadUint32(Reader->Stop, lluna_Core_Atomics_Acquire))
+        {
+                lluna_Core_Epoch_Enter(&Participant);
+                struct lluna_Container_RedBlackTree_Snapshot* Snapshot = lluna_Container_RedBlackTree_Acquire(Reader->Tree);
+                for (uint64 i = 0; i < Snapshot->Count; ++i)
+                {
+                        uint32 Data = lluna_Core_Atomics_LoadUint32(&lluna_Macros_ContainerOf(Snapshot->Nodes[i], struct Holder, RedBlackTree)->Data, lluna_Core_Atomics_Relaxed);
+                        Reader->Correct &= Data != Poison && (i == 0 || DataOf(Snapshot->Nodes[i - 1]) < Data);
+                }
+                lluna_Core_Epoch_Leave(&Participant);
+        }
+
+        lluna_Core_Epoch_Unregister(&Participant);
+
+        return NULL;
+}
+
+// A single writer keeps inserting and removing keys while readers walk the published snapshots.
+static void ConcurrentSnapshots()
+{
+        uint32 KeyCount = 256;
+        struct Holder** Holders = calloc(KeyCount, sizeof(struct Holder*));
+
+        struct lluna_Core_Epoch* Epoch = lluna_Core_Epoch_Create();
+        struct lluna_Container_RedBlackTree* Handle = lluna_Container_RedBlackTree_Create();
+
+        struct Reader Readers[ReaderCount];
+        pthread_t Threads[ReaderCount];
+        uint32 Stop = false;
+        for (uint32 Index = 0; Index < ReaderCount; ++Index)
+        {
+                Readers[Index] = (struct Reader){ Handle, Epoch, &Stop, true };
+                pthread_create(&Threads[Index], NULL, ReadSnapshots, &Readers[Index]);
+        }
+
+        uint64 RandomState = 0x9E3779B97F4A7C15ULL;
+        for (uint32 Batch = 0; Batch < 2000; ++Batch)
+        {
+                for (uint32 Change = 0; Change < 16; ++Change)
+                {
+                        RandomState ^= RandomState << 13;
+                        RandomState ^= RandomState >> 7;
+                        RandomState ^= RandomState << 17;
+                        uint32 Key = RandomState % KeyCount;
+
+                        if (Holders[Key])
+                        {
+                                lluna_Container_RedBlackTree_Remove(Handle, &Holders[Key]->RedBlackTree);
+                                lluna_Core_Epoch_Retire(Epoch, Holders[Key], FreeHolder);
+                                Holders[Key] = NULL;
+                        }
+                        else
+                        {
+                                Holders[Key] = malloc(sizeof(struct Holder));
+                                Holders[Key]->Data = Key;
+                                InsertHolder(Handle, Holders[Key]);
+                        }
+                }
+
+                lluna_Container_RedBlackTree_Publish(Handle, Epoch);
+        }
+        lluna_Core_Atomics_StoreUint32(&Stop, true, lluna_Core_Atomics_Release);
+
+        boolean Correct = true;
+        for (uint32 Index = 0; Index < ReaderCount; ++Index)
+        {
+                pthread_join(Threads[Index], NULL);
+                Correct &= Readers[Index].Correct;
+        }
+
+        lluna_TestHelper_CheckTrue(Correct, &SessionState, "Readers saw unordered or freed nodes.");
+
+        lluna_Container_RedBlackTree_Destroy(Handle);
+        lluna_Core_Epoch_Destroy(Epoch);
+        for (uint32 Key = 0; Key < KeyCount; ++Key)
+        {
+                free(Holders[Key]);
+        }
+        free(Holders);
+}
@@ -0,0 +1,162 @@
+#include <TestHelper.h>
+
+#include <Engine/Container/Public/SlotMap.h>
+
+struct lluna_TestHelper_Session SessionState;
+
+static void Create();
+static void InsertGet();
+static void Remove();
+static void StaleKeys();
+static void KeyAt();
+static void Clear();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Container_SlotMap");
+
+        lluna_TestHelper_RunTest(&SessionState, Create);
+        lluna_TestHelper_RunTest(&SessionState, InsertGet);
+        lluna_TestHelper_RunTest(&SessionState, Remove);
+        lluna_TestHelper_RunTest(&SessionState, StaleKeys);
+        lluna_TestHelper_RunTest(&SessionState, KeyAt);
+        lluna_TestHelper_RunTest(&SessionState, Clear);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+static void Create()
+{
+        struct lluna_Container_SlotMap* SlotMap = lluna_Container_SlotMap_Create(0, sizeof(uint32));
+        struct lluna_Container_SlotMap_Key Invalid = { lluna_Container_SlotMap_InvalidIndex, 0 };
+
+        lluna_TestHelper_CheckEqual(lluna_Container_SlotMap_Count(SlotMap), 0, &SessionState, "New slot map is not empty.");
+        lluna_TestHelper_CheckFalse(lluna_Container_SlotMap_Contains(SlotMap, Invalid), &SessionState, "Invalid key is contained.");
+        lluna_TestHelper_CheckTrue(lluna_Container_SlotMap_Get(SlotMap, Invalid) == NULL, &SessionState, "Invalid key has a value.");
+
+        lluna_Container_SlotMap_Destroy(SlotMap);
+}
+
+static void InsertGet()
+{
+        struct lluna_Container_SlotMap* SlotMap = lluna_Container_SlotMap_Create(2, sizeof(uint32));
+        struct lluna_Container_SlotMap_Key Keys[100];
+
+        for (uint32 Value = 0; Value < 100; ++Value)
+        {
+                Keys[Value] = lluna_Container_SlotMap_Insert(SlotMap, (byte*)&Value);
+        }
+
+        boolean Found = true;
+        for (uint32 Value = 0; Value < 100; ++Value)
+        {
+                uint32* Stored = (uint32*)lluna_Container_SlotMap_Get(SlotMap, Keys[Value]);
+                Found &= Stored != NULL && *Stored == Value;
+        }
+
+        lluna_TestHelper_CheckEqual(lluna_Container_SlotMap_Count(SlotMap), 100, &SessionState, "Wrong number of values.");
+        lluna_TestHelper_CheckTrue(Found, &SessionState, "Keys didn't find their values.");
+
+        lluna_Container_SlotMap_Destroy(SlotMap);
+}
+
+static void Remove()
+{
+        struct lluna_Container_SlotMap* SlotMap = lluna_Container_SlotMap_Create(2, sizeof(uint32));
+        struct lluna_Container_SlotMap_Key Keys[100];
+
+        for (uint32 Value = 0; Value < 100; ++Value)
+        {
+                Keys[Value] = lluna_Container_SlotMap_Insert(SlotMap, (byte*)&Value);
+        }
+
+        boolean Removed = true;
+        for (uint32 Value = 0; Value < 100; Value += 3)
+        {
+                Removed &= lluna_Container_SlotMap_Remove(SlotMap, Keys[Value]);
+        }
+        lluna_TestHelper_CheckTrue(Removed, &SessionState, "Removing valid keys failed.");
+        lluna_TestHelper_CheckFalse(lluna_Container_SlotMap_Remove(SlotMap, Keys[0]), &SessionState, "Removed a key twice.");
+        lluna_TestHelper_CheckEqual(lluna_Container_SlotMap_Count(SlotMap), 66, &SessionState, "Wrong number of values after removing.");
+
+        // Removal moves values around, but the remaining keys still have to find theirs.
+        boolean Found = true;
+        for (uint32 Value = 0; Value < 100; ++Value)
+        {
+                uint32* Stored = (uint32*)lluna_Container_SlotMap_Get(SlotMap, Keys[Value]);
+                Found &= Value % 3 == 0 ? Stored == NULL : Stored != NULL && *Stored == Value;
+        }
+        lluna_TestHelper_CheckTrue(Found, &SessionState, "Removing broke the remaining keys.");
+
+        lluna_Container_SlotMap_Destroy(SlotMap);
+}
+
+static void StaleKeys()
+{
+        struct lluna_Container_SlotMap* SlotMap = lluna_Container_SlotMap_Create(2, sizeof(uint32));
+        uint32 First = 1;
+        uint32 Second = 2;
+
+        struct lluna_Container_SlotMap_Key Old = lluna_Container_SlotMap_Insert(SlotMap, (byte*)&First);
+        lluna_Container_SlotMap_Remove(SlotMap, Old);
+        struct lluna_Container_SlotMap_Key New = lluna_Container_SlotMap_Insert(SlotMap, (byte*)&Second);
+
+        lluna_TestHelper_CheckEqual(New.Index, Old.Index, &SessionState, "Freed slot was not reused.");
+        lluna_TestHelper_CheckTrue(New.Generation != Old.Generation, &SessionState, "Reused slot kept its generation.");
+        lluna_TestHelper_CheckFalse(lluna_Container_SlotMap_Contains(SlotMap, Old), &SessionState, "Stale key is still valid.");
+        lluna_TestHelper_CheckFalse(lluna_Container_SlotMap_Remove(SlotMap, Old), &SessionState, "Stale key removed the new value.");
+        lluna_TestHelper_CheckEqual(*(uint32*)lluna_Container_SlotMap_Get(SlotMap, New), 2, &SessionState, "New key doesn't find its value.");
+
+        lluna_Container_SlotMap_Destroy(SlotMap);
+}
+
+static void KeyAt()
+{
+        struct lluna_Container_SlotMap* SlotMap = lluna_Container_SlotMap_Create(2, sizeof(uint32));
+        struct lluna_Container_SlotMap_Key Keys[10];
+
+        for (uint32 Value = 0; Value < 10; ++Value)
+        {
+                Keys[Value] = lluna_Container_SlotMap_Insert(SlotMap, (byte*)&Value);
+        }
+        lluna_Container_SlotMap_Remove(SlotMap, Keys[4]);
+
+        boolean Matches = true;
+        for (uint64 Index = 0; Index < lluna_Container_SlotMap_Count(SlotMap); ++Index)
+        {
+                uint32 Value = *(uint32*)lluna_Container_DynamicArray_Get(SlotMap->Values, Index);
+                struct lluna_Container_SlotMap_Key Key = lluna_Container_SlotMap_KeyAt(SlotMap, Index);
+                Matches &= Key.Index == Keys[Value].Index && Key.Generation == Keys[Value].Generation;
+        }
+        lluna_TestHelper_CheckTrue(Matches, &SessionState, "Dense values don't map back to their keys.");
+
+        lluna_Container_SlotMap_Destroy(SlotMap);
+}
+
+static void Clear()
+{
+        struct lluna_Container_SlotMap* SlotMap = lluna_Container_SlotMap_Create(2, sizeof(uint32));
+        struct lluna_Container_SlotMap_Key Keys[10];
+
+        for (uint32 Value = 0; Value < 10; ++Value)
+        {
+                Keys[Value] = lluna_Container_SlotMap_Insert(SlotMap, (byte*)&Value);
+        }
+        lluna_Container_SlotMap_Clear(SlotMap);
+
+        boolean Invalidated = true;
+        for (uint32 Value = 0; Value < 10; ++Value)
+        {
+                Invalidated &= !lluna_Container_SlotMap_Contains(SlotMap, Keys[Value]);
+        }
+
+        lluna_TestHelper_CheckEqual(lluna_Container_SlotMap_Count(SlotMap), 0, &SessionState, "Cleared slot map is not empty.");
+        lluna_TestHelper_CheckTrue(Invalidated, &SessionState, "Keys are still valid after clearing.");
+
+        uint32 Value = 42;
+        struct lluna_Container_SlotMap_Key Key = lluna_Container_SlotMap_Insert(SlotMap, (byte*)&Value);
+        lluna_TestHelper_CheckTrue(Key.Index < 10, &SessionState, "Cleared slots were not reused.");
+        lluna_TestHelper_CheckEqual(*(uint32*)lluna_Container_SlotMap_Get(SlotMap, Key), 42, &SessionState, "Key inserted after clearing doesn't find its value.");
+
+        lluna_Container_SlotMap_Destroy(SlotMap);
+}
@@ -0,0 +1,387 @@
+#include <TestHelper.h>
+
+#include <Engine/Container/Public/Sort.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+struct lluna_TestHelper_Session SessionState;
+
+static void SortPatterns();
+static void SortSmall();
+static void SortStructs();
+static void SortDynamicArray();
+static void Radix32();
+static void Radix64();
+static void RadixKeyStable();
+static void RadixScratch();
+static void SortCopyOnWrite();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Container_Sort");
+
+        lluna_TestHelper_RunTest(&SessionState, SortPatterns);
+        lluna_TestHelper_RunTest(&SessionState, SortSmall);
+        lluna_TestHelper_RunTest(&SessionState, SortStructs);
+        lluna_TestHelper_RunTest(&SessionState, SortDynamicArray);
+        lluna_TestHelper_RunTest(&SessionState, Radix32);
+        lluna_TestHelper_RunTest(&SessionState, Radix64);
+        lluna_TestHelper_RunTest(&SessionState, RadixKeyStable);
+        lluna_TestHelper_RunTest(&SessionState, RadixScratch);
+        lluna_TestHelper_RunTest(&SessionState, SortCopyOnWrite);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+lluna_Container_Sort_Define(SortUint32, uint32, lluna_Container_Sort_LessValue)
+
+struct Entry
+{
+        uint64 Key;
+        uint32 Order;
+        uint32 Padding;
+};
+
+#define EntryLess(Left, Right) ((Left)->Key < (Right)->Key)
+
+lluna_Container_Sort_Define(SortEntries, struct Entry, EntryLess)
+
+static uint64 NextRandom(uint64* State)
+{
+        *State ^= *State << 13;
+        *State ^= *State >> 7;
+        *State ^= *State << 17;
+
+        return *State;
+}
+
+static int CompareUint32(const void* Left, const void* Right)
+{
+        uint32 LeftValue = *(const uint32*)Left;
+        uint32 RightValue = *(const uint32*)Right;
+
+        return (LeftValue > RightValue) - (LeftValue < RightValue);
+}
+
+static int CompareUint64(const void* Left, const void* Right)
+{
+        uint64 LeftValue = *(const uint64*)Left;
+        uint64 RightValue = *(const uint64*)Right;
+
+        return (LeftValue > RightValue) - (LeftValue < RightValue);
+}
+
+// Sorts a copy with both the generated sort and qsort and compares the results.
+static boolean SortMatchesQsort(const uint32* Values, uint64 Count)
+{
+        uint32* Sorted = malloc((Count + 1) * sizeof(uint32));
+        uint32* Expected = malloc((Count + 1) * sizeof(uint32));
+        memcpy(Sorted, Values, Count * sizeof(uint32));
+        memcpy(Expected, Values, Count * sizeof(uint32));
+
+        SortUint32_Range(Sorted, Count);
+        qsort(Expected, Count, sizeof(uint32), CompareUint32);
+
+        boolean Matches = memcmp(Sorted, Expected, Count * sizeof(uint32)) == 0;
+
+        free(Expected);
+        free(Sorted);
+
+        return Matches;
+}
+
+static void SortPatterns()
+{
+        const uint64 Count = 100000;
+        uint32* Values = malloc(Count * sizeof(uint32));
+        uint64 State = 0x9E3779B97F4A7C15ULL;
+
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                Values[Index] = (uint32)NextRandom(&State);
+        }
+        lluna_TestHelper_CheckTrue(SortMatchesQsort(Values, Count), &SessionState, "Random values sorted wrong.");
+
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                Values[Index] = (uint32)Index;
+        }
+        lluna_TestHelper_CheckTrue(SortMatchesQsort(Values, Count), &SessionState, "Sorted values sorted wrong.");
+
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                Values[Index] = (uint32)(Count - Index);
+        }
+        lluna_TestHelper_CheckTrue(SortMatchesQsort(Values, Count), &SessionState, "Reversed values sorted wrong.");
+
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                Values[Index] = 7;
+        }
+        lluna_TestHelper_CheckTrue(SortMatchesQsort(Values, Count), &SessionState, "Equal values sorted wrong.");
+
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                Values[Index] = (uint32)(NextRandom(&State) % 4);
+        }
+        lluna_TestHelper_CheckTrue(SortMatchesQsort(Values, Count), &SessionState, "Few distinct values sorted wrong.");
+
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                Values[Index] = (uint32)(Index < Count / 2 ? Index : Count - Index);
+        }
+        lluna_TestHelper_CheckTrue(SortMatchesQsort(Values, Count), &SessionState, "Organ pipe values sorted wrong.");
+
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                Values[Index] = (uint32)(Index % 2 == 0 ? Index : Count + Index);
+        }
+        lluna_TestHelper_CheckTrue(SortMatchesQsort(Values, Count), &SessionState, "Interleaved values sorted wrong.");
+
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                Values[Index] = (uint32)Index;
+        }
+        for (uint64 Swap = 0; Swap < 10; ++Swap)
+        {
+                uint64 Left = NextRandom(&State) % Count;
+                uint64 Right = NextRandom(&State) % Count;
+                uint32 Temporary = Values[Left];
+                Values[Left] = Values[Right];
+                Values[Right] = Temporary;
+        }
+        lluna_TestHelper_CheckTrue(SortMatchesQsort(Values, Count), &SessionState, "Nearly sorted values sorted wrong.");
+
+        free(Values);
+}
+
+static void SortSmall()
+{
+        uint32 Values[200];
+        uint64 State = 0x2545F4914F6CDD1DULL;
+
+        boolean Correct = true;
+        for (uint64 Count = 0; Count < 200; ++Count)
+        {
+                for (uint64 Index = 0; Index < Count; ++Index)
+                {
+                        Values[Index] = (uint32)(NextRandom(&State) % 50);
+                }
+                Correct &= SortMatchesQsort(Values, Count);
+        }
+        lluna_TestHelper_CheckTrue(Correct, &SessionState, "Sorting short ranges failed.");
+}
+
+static void SortStructs()
+{
+        const uint64 Count = 50000;
+        struct Entry* Entries = malloc(Count * sizeof(struct Entry));
+        uint64 State = 0x9E3779B97F4A7C15ULL;
+
+        uint64 OrderSum = 0;
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                Entries[Index].Key = NextRandom(&State) % 1000;
+                Entries[Index].Order = (uint32)Index;
+                Entries[Index].Padding = 0;
+                OrderSum += Index;
+        }
+
+        SortEntries_Range(Entries, Count);
+
+        boolean Sorted = true;
+        uint64 SortedOrderSum = Entries[0].Order;
+        for (uint64 Index = 1; Index < Count; ++Index)
+        {
+                Sorted &= Entries[Index - 1].Key <= Entries[Index].Key;
+                SortedOrderSum += Entries[Index].Order;
+        }
+        lluna_TestHelper_CheckTrue(Sorted, &SessionState, "Structs are not sorted by key.");
+        lluna_TestHelper_CheckEqual(SortedOrderSum, OrderSum, &SessionState, "Sorting lost or duplicated structs.");
+
+        free(Entries);
+}
+
+static void SortDynamicArray()
+{
+        struct lluna_Container_DynamicArray* Array = lluna_Container_DynamicArray_Create(16, sizeof(uint32));
+        uint32 Values[] = { 5, 3, 9, 1, 1, 8 };
+        uint32 Expected[] = { 1, 1, 3, 5, 8, 9 };
+
+        for (uint32 Index = 0; Index < 6; ++Index)
+        {
+                lluna_Container_DynamicArray_Append(Array, (byte*)&Values[Index]);
+        }
+
+        SortUint32(Array);
+        lluna_TestHelper_CheckTrue(memcmp(Array->Data, Expected, sizeof(Expected)) == 0, &SessionState, "Dynamic array sorted wrong.");
+        lluna_TestHelper_CheckEqual(lluna_Container_DynamicArray_Count(Array), 6, &SessionState, "Sorting changed the element count.");
+
+        lluna_Container_DynamicArray_Destroy(Array);
+}
+
+static void Radix32()
+{
+        const uint64 Count = 100000;
+        struct lluna_Container_DynamicArray* Array = lluna_Container_DynamicArray_Create(Count, sizeof(uint32));
+        uint32* Expected = malloc(Count * sizeof(uint32));
+        uint64 State = 0x9E3779B97F4A7C15ULL;
+
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                Expected[Index] = (uint32)NextRandom(&State);
+                lluna_Container_DynamicArray_Append(Array, (byte*)&Expected[Index]);
+        }
+
+        lluna_Container_Sort_Radix32(Array, NULL);
+        qsort(Expected, Count, sizeof(uint32), CompareUint32);
+        lluna_TestHelper_CheckTrue(memcmp(Array->Data, Expected, Count * sizeof(uint32)) == 0, &SessionState, "32 bit radix sort is wrong.");
+
+        // Small keys leave the high bytes equal, which skips their passes.
+        lluna_Container_DynamicArray_Clear(Array);
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                Expected[Index] = (uint32)(NextRandom(&State) % 300);
+                lluna_Container_DynamicArray_Append(Array, (byte*)&Expected[Index]);
+        }
+
+        lluna_Container_Sort_Radix32(Array, NULL);
+        qsort(Expected, Count, sizeof(uint32), CompareUint32);
+        lluna_TestHelper_CheckTrue(memcmp(Array->Data, Expected, Count * sizeof(uint32)) == 0, &SessionState, "32 bit radix sort with skipped passes is wrong.");
+
+        free(Expected);
+        lluna_Container_DynamicArray_Destroy(Array);
+}
+
+static void Radix64()
+{
+        const uint64 Count = 100000;
+        struct lluna_Container_DynamicArray* Array = lluna_Container_DynamicArray_Create(Count, sizeof(uint64));
+        uint64* Expected = malloc(Count * sizeof(uint64));
+        uint64 State = 0x2545F4914F6CDD1DULL;
+
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                Expected[Index] = NextRandom(&State);
+                lluna_Container_DynamicArray_Append(Array, (byte*)&Expected[Index]);
+        }
+
+        lluna_Container_Sort_Radix64(Array, NULL);
+        qsort(Expected, Count, sizeof(uint64), CompareUint64);
+        lluna_TestHelper_CheckTrue(memcmp(Array->Data, Expected, Count * sizeof(uint64)) == 0, &SessionState, "64 bit radix sort is wrong.");
+
+        free(Expected);
+        lluna_Container_DynamicArray_Destroy(Array);
+}
+
+struct Pair
+{
+        uint32 Payload;
+        uint32 Key;
+};
+
+static void RadixKeyStable()
+{
+        const uint64 Count = 50000;
+        struct lluna_Container_DynamicArray* Pairs = lluna_Container_DynamicArray_Create(Count, sizeof(struct Pair));
+        struct lluna_Container_DynamicArray* Entries = lluna_Container_DynamicArray_Create(Count, sizeof(struct Entry));
+        uint64 State = 0x9E3779B97F4A7C15ULL;
+
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                struct Pair Pair = { (uint32)Index, (uint32)(NextRandom(&State) % 5000) };
+                lluna_Container_DynamicArray_Append(Pairs, (byte*)&Pair);
+
+                struct Entry Entry = { NextRandom(&State) % 5000 * 0x100000001ULL, (uint32)Index, 0 };
+                lluna_Container_DynamicArray_Append(Entries, (byte*)&Entry);
+        }
+
+        lluna_Container_Sort_RadixKey32(Pairs, sizeof(uint32), NULL);
+        lluna_Container_Sort_RadixKey64(Entries, 0, NULL);
+
+        boolean PairsStable = true;
+        boolean EntriesStable = true;
+        for (uint64 Index = 1; Index < Count; ++Index)
+        {
+                struct Pair* PreviousPair = (struct Pair*)lluna_Container_DynamicArray_Get(Pairs, Index - 1);
+                struct Pair* CurrentPair = (struct Pair*)lluna_Container_DynamicArray_Get(Pairs, Index);
+                PairsStable &= PreviousPair->Key < CurrentPair->Key || (PreviousPair->Key == CurrentPair->Key && PreviousPair->Payload < CurrentPair->Payload);
+
+                struct Entry* PreviousEntry = (struct Entry*)lluna_Container_DynamicArray_Get(Entries, Index - 1);
+                struct Entry* CurrentEntry = (struct Entry*)lluna_Container_DynamicArray_Get(Entries, Index);
+                EntriesStable &= PreviousEntry->Key < CurrentEntry->Key || (PreviousEntry->Key == CurrentEntry->Key && PreviousEntry->Order < CurrentEntry->Order);
+        }
+        lluna_TestHelper_CheckTrue(PairsStable, &SessionState, "Radix sort of 32 bit keys with payloads is wrong or unstable.");
+        lluna_TestHelper_CheckTrue(EntriesStable, &SessionState, "Radix sort of 64 bit keys with payloads is wrong or unstable.");
+
+        lluna_Container_DynamicArray_Destroy(Entries);
+        lluna_Container_DynamicArray_Destroy(Pairs);
+}
+
+static void RadixScratch()
+{
+        struct lluna_Container_DynamicArray* Array = lluna_Container_DynamicArray_Create(1000, sizeof(uint64));
+        struct lluna_Container_DynamicArray* Scratch = lluna_Container_DynamicArray_Create(1, sizeof(byte));
+        uint64 State = 0x2545F4914F6CDD1DULL;
+
+        for (uint64 Index = 0; Index < 1000; ++Index)
+        {
+                uint64 Value = NextRandom(&State);
+                lluna_Container_DynamicArray_Append(Array, (byte*)&Value);
+        }
+
+        lluna_Container_Sort_Radix64(Array, Scratch);
+
+        boolean Sorted = true;
+        for (uint64 Index = 1; Index < 1000; ++Index)
+        {
+                Sorted &= *(uint64*)lluna_Container_DynamicArray_Get(Array, Index - 1) <= *(uint64*)lluna_Container_DynamicArray_Get(Array, Index);
+        }
+        lluna_TestHelper_CheckTrue(Sorted, &SessionState, "Radix sort with scratch space is wrong.");
+        lluna_TestHelper_CheckTrue(lluna_Container_DynamicArray_Capacity(Scratch) >= 1000 * sizeof(uint64), &SessionState, "Scratch space didn't grow.");
+
+        lluna_Container_DynamicArray_Destroy(Scratch);
+        lluna_Container_DynamicArray_Destroy(Array);
+}
+
+static void SortCopyOnWrite()
+{
+        struct lluna_Container_DynamicArray* Array = lluna_Container_DynamicArray_Create(16, sizeof(uint32));
+        struct lluna_Container_DynamicArray* Scratch = lluna_Container_DynamicArray_Create(64, sizeof(byte));
+        uint32 Values[] = { 5, 3, 9, 1, 1, 8 };
+        uint32 Expected[] = { 1, 1, 3, 5, 8, 9 };
+        byte Marks[64];
+        memset(Marks, 0xAB, sizeof(Marks));
+
+        for (uint32 Index = 0; Index < 6; ++Index)
+        {
+                lluna_Container_DynamicArray_Append(Array, (byte*)&Values[Index]);
+        }
+        for (uint32 Index = 0; Index < 64; ++Index)
+        {
+                lluna_Container_DynamicArray_Append(Scratch, &Marks[Index]);
+        }
+
+        struct lluna_Container_DynamicArray* Copy = lluna_Container_DynamicArray_Share(Array);
+        SortUint32(Copy);
+        lluna_TestHelper_CheckTrue(memcmp(Copy->Data, Expected, sizeof(Expected)) == 0, &SessionState, "Shared array sorted wrong.");
+        lluna_TestHelper_CheckTrue(memcmp(Array->Data, Values, sizeof(Values)) == 0, &SessionState, "Sorting a copy changed the original.");
+        lluna_Container_DynamicArray_Destroy(Copy);
+
+        Copy = lluna_Container_DynamicArray_Share(Array);
+        lluna_Container_Sort_Radix32(Copy, NULL);
+        lluna_TestHelper_CheckTrue(memcmp(Copy->Data, Expected, sizeof(Expected)) == 0, &SessionState, "Shared array radix sorted wrong.");
+        lluna_TestHelper_CheckTrue(memcmp(Array->Data, Values, sizeof(Values)) == 0, &SessionState, "Radix sorting a copy changed the original.");
+        lluna_Container_DynamicArray_Destroy(Copy);
+
+        // Scratch space shared with another array is copied before being written to.
+        struct lluna_Container_DynamicArray* SharedScratch = lluna_Container_DynamicArray_Share(Scratch);
+        lluna_Container_Sort_Radix32(Array, SharedScratch);
+        lluna_TestHelper_CheckTrue(memcmp(Array->Data, Expected, sizeof(Expected)) == 0, &SessionState, "Radix sort with shared scratch space is wrong.");
+        lluna_TestHelper_CheckTrue(memcmp(Scratch->Data, Marks, sizeof(Marks)) == 0, &SessionState, "Radix sort wrote to shared scratch space.");
+
+        lluna_Container_DynamicArray_Destroy(SharedScratch);
+        lluna_Container_DynamicArray_Destroy(Scratch);
+        lluna_Container_DynamicArray_Destroy(Array);
+}
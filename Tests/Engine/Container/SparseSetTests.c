@@ -0,0 +1,142 @@
+#include <TestHelper.h>
+
+#include <Engine/Container/Public/SparseSet.h>
+
+struct lluna_TestHelper_Session SessionState;
+
+static void Create();
+static void InsertGet();
+static void InsertReplaces();
+static void Remove();
+static void IdsOnly();
+static void Clear();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Container_SparseSet");
+
+        lluna_TestHelper_RunTest(&SessionState, Create);
+        lluna_TestHelper_RunTest(&SessionState, InsertGet);
+        lluna_TestHelper_RunTest(&SessionState, InsertReplaces);
+        lluna_TestHelper_RunTest(&SessionState, Remove);
+        lluna_TestHelper_RunTest(&SessionState, IdsOnly);
+        lluna_TestHelper_RunTest(&SessionState, Clear);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+static void Create()
+{
+        struct lluna_Container_SparseSet* SparseSet = lluna_Container_SparseSet_Create(0, sizeof(uint32));
+
+        lluna_TestHelper_CheckEqual(lluna_Container_SparseSet_Count(SparseSet), 0, &SessionState, "New sparse set is not empty.");
+        lluna_TestHelper_CheckFalse(lluna_Container_SparseSet_Contains(SparseSet, 0), &SessionState, "Empty sparse set contains an id.");
+        lluna_TestHelper_CheckTrue(lluna_Container_SparseSet_Get(SparseSet, 1000) == NULL, &SessionState, "Id past the sparse array has a value.");
+
+        lluna_Container_SparseSet_Destroy(SparseSet);
+}
+
+static void InsertGet()
+{
+        struct lluna_Container_SparseSet* SparseSet = lluna_Container_SparseSet_Create(2, sizeof(uint32));
+
+        for (uint32 Value = 0; Value < 100; ++Value)
+        {
+                lluna_Container_SparseSet_Insert(SparseSet, (Value * 37) % 100 * 5, (byte*)&Value);
+        }
+
+        boolean Found = true;
+        for (uint32 Value = 0; Value < 100; ++Value)
+        {
+                uint32 Id = (Value * 37) % 100 * 5;
+                uint32* Stored = (uint32*)lluna_Container_SparseSet_Get(SparseSet, Id);
+                Found &= Stored != NULL && *Stored == Value && lluna_Container_SparseSet_IdAt(SparseSet, Value) == Id;
+                Found &= !lluna_Container_SparseSet_Contains(SparseSet, Value * 5 + 1);
+        }
+
+        lluna_TestHelper_CheckEqual(lluna_Container_SparseSet_Count(SparseSet), 100, &SessionState, "Wrong number of ids.");
+        lluna_TestHelper_CheckTrue(Found, &SessionState, "Ids didn't find their values.");
+
+        lluna_Container_SparseSet_Destroy(SparseSet);
+}
+
+static void InsertReplaces()
+{
+        struct lluna_Container_SparseSet* SparseSet = lluna_Container_SparseSet_Create(2, sizeof(uint32));
+        uint32 First = 1;
+        uint32 Second = 2;
+
+        lluna_Container_SparseSet_Insert(SparseSet, 7, (byte*)&First);
+        lluna_Container_SparseSet_Insert(SparseSet, 7, (byte*)&Second);
+
+        lluna_TestHelper_CheckEqual(lluna_Container_SparseSet_Count(SparseSet), 1, &SessionState, "Inserting an existing id added an entry.");
+        lluna_TestHelper_CheckEqual(*(uint32*)lluna_Container_SparseSet_Get(SparseSet, 7), 2, &SessionState, "Inserting an existing id didn't replace its value.");
+
+        lluna_Container_SparseSet_Destroy(SparseSet);
+}
+
+static void Remove()
+{
+        struct lluna_Container_SparseSet* SparseSet = lluna_Container_SparseSet_Create(2, sizeof(uint32));
+
+        for (uint32 Value = 0; Value < 100; ++Value)
+        {
+                lluna_Container_SparseSet_Insert(SparseSet, Value, (byte*)&Value);
+        }
+
+        boolean Removed = true;
+        for (uint32 Value = 0; Value < 100; Value += 2)
+        {
+                Removed &= lluna_Container_SparseSet_Remove(SparseSet, Value);
+        }
+        lluna_TestHelper_CheckTrue(Removed, &SessionState, "Removing ids in the set failed.");
+        lluna_TestHelper_CheckFalse(lluna_Container_SparseSet_Remove(SparseSet, 0), &SessionState, "Removed an id twice.");
+        lluna_TestHelper_CheckFalse(lluna_Container_SparseSet_Remove(SparseSet, 1000), &SessionState, "Removed an id past the sparse array.");
+        lluna_TestHelper_CheckEqual(lluna_Container_SparseSet_Count(SparseSet), 50, &SessionState, "Wrong number of ids after removing.");
+
+        boolean Found = true;
+        for (uint32 Value = 0; Value < 100; ++Value)
+        {
+                uint32* Stored = (uint32*)lluna_Container_SparseSet_Get(SparseSet, Value);
+                Found &= Value % 2 == 0 ? Stored == NULL : Stored != NULL && *Stored == Value;
+        }
+        lluna_TestHelper_CheckTrue(Found, &SessionState, "Removing broke the remaining ids.");
+
+        lluna_Container_SparseSet_Destroy(SparseSet);
+}
+
+static void IdsOnly()
+{
+        struct lluna_Container_SparseSet* SparseSet = lluna_Container_SparseSet_Create(2, 0);
+
+        lluna_Container_SparseSet_Insert(SparseSet, 3, NULL);
+        lluna_Container_SparseSet_Insert(SparseSet, 9, NULL);
+
+        lluna_TestHelper_CheckTrue(SparseSet->Values == NULL, &SessionState, "Sparse set without values allocated them.");
+        lluna_TestHelper_CheckTrue(lluna_Container_SparseSet_Contains(SparseSet, 3) && lluna_Container_SparseSet_Contains(SparseSet, 9), &SessionState, "Sparse set is missing ids.");
+        lluna_TestHelper_CheckTrue(lluna_Container_SparseSet_Get(SparseSet, 3) == NULL, &SessionState, "Sparse set without values returned one.");
+
+        lluna_Container_SparseSet_Destroy(SparseSet);
+}
+
+static void Clear()
+{
+        struct lluna_Container_SparseSet* SparseSet = lluna_Container_SparseSet_Create(2, sizeof(uint32));
+
+        for (uint32 Value = 0; Value < 10; ++Value)
+        {
+                lluna_Container_SparseSet_Insert(SparseSet, Value * 3, (byte*)&Value);
+        }
+        lluna_Container_SparseSet_Clear(SparseSet);
+
+        boolean Cleared = true;
+        for (uint32 Id = 0; Id < 30; ++Id)
+        {
+                Cleared &= !lluna_Container_SparseSet_Contains(SparseSet, Id);
+        }
+
+        lluna_TestHelper_CheckEqual(lluna_Container_SparseSet_Count(SparseSet), 0, &SessionState, "Cleared sparse set is not empty.");
+        lluna_TestHelper_CheckTrue(Cleared, &SessionState, "Ids are still in the set after clearing.");
+
+        lluna_Container_SparseSet_Destroy(SparseSet);
+}
@@ -11,8 +11,11 @@ static void Create();
 static void CreateFromText();
 static void CreateFormatted();
 static void Destroy();
+static void Share();
+static void CopyOnWrite();
 static void Empty();
 static void Length();
+static void CodePointCount();
 static void Capacity();
 static void Resize();
 static void Shrink();
@@ -25,6 +28,7 @@ static void Last();
 static void Get();
 static void Append();
 static void AppendText();
+static void AppendUtf32();
 static void Assign();
 static void AssignText();
 static void Format();
@@ -41,8 +45,11 @@ int main(int argc, const char* argv[])
         lluna_TestHelper_RunTest(&SessionState, CreateFromText);
         lluna_TestHelper_RunTest(&SessionState, CreateFormatted);
         lluna_TestHelper_RunTest(&SessionState, Destroy);
+        lluna_TestHelper_RunTest(&SessionState, Share);
+        lluna_TestHelper_RunTest(&SessionState, CopyOnWrite);
         lluna_TestHelper_RunTest(&SessionState, Empty);
         lluna_TestHelper_RunTest(&SessionState, Length);
+        lluna_TestHelper_RunTest(&SessionState, CodePointCount);
         lluna_TestHelper_RunTest(&SessionState, Capacity);
         lluna_TestHelper_RunTest(&SessionState, Resize);
         lluna_TestHelper_RunTest(&SessionState, Shrink);
@@ -55,6 +62,7 @@ int main(int argc, const char* argv[])
         lluna_TestHelper_RunTest(&SessionState, Get);
         lluna_TestHelper_RunTest(&SessionState, Append);
         lluna_TestHelper_RunTest(&SessionState, AppendText);
+        lluna_TestHelper_RunTest(&SessionState, AppendUtf32);
         lluna_TestHelper_RunTest(&SessionState, Assign);
         lluna_TestHelper_RunTest(&SessionState, AssignText);
         lluna_TestHelper_RunTest(&SessionState, Format);
@@ -158,6 +166,19 @@ static void Length()
 #undef Text
 }
 
+static void CodePointCount()
+{
+#define Text "Lluna \xF0\x9F\x8C\x99 plena"
+
+        struct lluna_Container_String* String = lluna_Container_String_CreateFromText(lluna_Macros_Text(Text));
+
+        lluna_TestHelper_CheckEqual(lluna_Container_String_CodePointCount(String), 13, &SessionState, "CodePointCount did not return the correct number of code points.")
+
+        lluna_Container_String_Destroy(String);
+
+#undef Text
+}
+
 static void Capacity()
 {
         uint64 InitialSize = 64;
@@ -371,6 +392,29 @@ static void AppendText()
 #undef Result
 }
 
+static void AppendUtf32()
+{
+#define Text "Lluna "
+#define Result "Lluna \xF0\x9F\x8C\x99 \xC3\xBA"
+
+        uint32 CodePoints[] = { 0x1F319, ' ', 0xFA };
+        uint64 Size = sizeof(Result);
+
+        struct lluna_Container_String* String = lluna_Container_String_CreateFromText(lluna_Macros_Text(Text));
+
+        lluna_Container_String_AppendUtf32(String, CodePoints, sizeof(CodePoints) / sizeof(CodePoints[0]));
+
+        lluna_TestHelper_CheckTrue(lluna_Container_String_EqualsText(String, lluna_Macros_Text(Result)), &SessionState, "AppendUtf32 did not set Data to correct string.");
+        lluna_TestHelper_CheckTrue(String->AllocatedSize >= Size, &SessionState, "AppendUtf32 did not allocate enough space.");
+        lluna_TestHelper_CheckEqual(String->Offset, Size - 1, &SessionState, "AppendUtf32 did not properly set Offset.");
+        lluna_TestHelper_CheckEqual(String->Data[String->Offset], '\0', &SessionState, "AppendUtf32 did not properly NULL terminate the string.");
+
+        lluna_Container_String_Destroy(String);
+
+#undef Text
+#undef Result
+}
+
 static void Assign()
 {
 #define Text "The quick brown fox jumps over the lazy dog."
@@ -503,3 +547,47 @@ static void ReversedForEach()
 
 #undef Text
 }
+
+static void Share()
+{
+        struct lluna_Container_String* String = lluna_Container_String_CreateFromText(lluna_Macros_Text("Shared text"));
+        lluna_TestHelper_CheckFalse(lluna_Container_String_Shared(String), &SessionState, "New string was shared.");
+
+        struct lluna_Container_String* Snapshot = lluna_Container_String_Share(String);
+
+        lluna_TestHelper_CheckEqual(Snapshot->Data, String->Data, &SessionState, "Share copied the characters.");
+        lluna_TestHelper_CheckTrue(lluna_Container_String_Shared(String), &SessionState, "Shared string was not marked as shared.");
+        lluna_TestHelper_CheckTrue(lluna_Container_String_EqualsText(Snapshot, lluna_Macros_Text("Shared text")), &SessionState, "Share did not keep the contents.");
+
+        lluna_Container_String_Destroy(String);
+        lluna_TestHelper_CheckFalse(lluna_Container_String_Shared(Snapshot), &SessionState, "Last string was still marked as shared.");
+        lluna_TestHelper_CheckTrue(lluna_Container_String_EqualsText(Snapshot, lluna_Macros_Text("Shared text")), &SessionState, "Destroying a shared string freed the characters.");
+
+        lluna_Container_String_Destroy(Snapshot);
+}
+
+static void CopyOnWrite()
+{
+        struct lluna_Container_String* String = lluna_Container_String_CreateFromText(lluna_Macros_Text("Frame"));
+        struct lluna_Container_String* Snapshot = lluna_Container_String_Share(String);
+
+        lluna_Container_String_AppendText(String, lluna_Macros_Text(" 2"));
+
+        lluna_TestHelper_CheckNotEqual(Snapshot->Data, String->Data, &SessionState, "Writing did not copy the characters.");
+        lluna_TestHelper_CheckTrue(lluna_Container_String_EqualsText(String, lluna_Macros_Text("Frame 2")), &SessionState, "Writing did not modify the written string.");
+        lluna_TestHelper_CheckTrue(lluna_Container_String_EqualsText(Snapshot, lluna_Macros_Text("Frame")), &SessionState, "Writing modified the shared string.");
+        lluna_TestHelper_CheckFalse(lluna_Container_String_Shared(Snapshot), &SessionState, "Copied string was still marked as shared.");
+
+        lluna_Container_String_Assign(String, Snapshot);
+        lluna_TestHelper_CheckEqual(Snapshot->Data, String->Data, &SessionState, "Assign copied the characters.");
+
+        lluna_Container_String_Clear(Snapshot);
+        lluna_TestHelper_CheckTrue(lluna_Container_String_EqualsText(String, lluna_Macros_Text("Frame")), &SessionState, "Clearing modified the shared string.");
+        lluna_TestHelper_CheckTrue(lluna_Container_String_Empty(Snapshot), &SessionState, "Clear did not empty the string.");
+
+        lluna_Container_String_Unshare(String);
+        lluna_TestHelper_CheckFalse(lluna_Container_String_Shared(String), &SessionState, "Unshare did not give the string its own characters.");
+
+        lluna_Container_String_Destroy(String);
+        lluna_Container_String_Destroy(Snapshot);
+}
@@ -0,0 +1,196 @@
+#include <TestHelper.h>
+
+#include <Engine/Container/Public/StructOfArrays.h>
+
+#include <stddef.h>
+#include <string.h>
+
+struct lluna_TestHelper_Session SessionState;
+
+struct Particle
+{
+        float Position[3];
+        uint8 Flags;
+        double Lifetime;
+        uint32 Color;
+};
+
+static const struct lluna_Container_StructOfArrays_Field ParticleFields[] = {
+        { sizeof(float[3]), _Alignof(float), offsetof(struct Particle, Position) },
+        { sizeof(uint8), _Alignof(uint8), offsetof(struct Particle, Flags) },
+        { sizeof(double), 128, offsetof(struct Particle, Lifetime) },
+        { sizeof(uint32), _Alignof(uint32), offsetof(struct Particle, Color) },
+};
+
+static void Create();
+static void Append();
+static void Grow();
+static void Remove();
+static void Alignment();
+static void Structs();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Container_StructOfArrays");
+
+        lluna_TestHelper_RunTest(&SessionState, Create);
+        lluna_TestHelper_RunTest(&SessionState, Append);
+        lluna_TestHelper_RunTest(&SessionState, Grow);
+        lluna_TestHelper_RunTest(&SessionState, Remove);
+        lluna_TestHelper_RunTest(&SessionState, Alignment);
+        lluna_TestHelper_RunTest(&SessionState, Structs);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+static struct Particle MakeParticle(uint32 Index)
+{
+        struct Particle Particle;
+        memset(&Particle, 0, sizeof(Particle));
+        Particle.Position[0] = (float)Index;
+        Particle.Position[1] = (float)Index * 2.0f;
+        Particle.Position[2] = (float)Index * 3.0f;
+        Particle.Flags = (uint8)Index;
+        Particle.Lifetime = Index * 0.5;
+        Particle.Color = Index * 0x01010101u;
+
+        return Particle;
+}
+
+static boolean Matches(struct lluna_Container_StructOfArrays* Particles, uint64 Index, uint32 Expected)
+{
+        struct Particle Particle = MakeParticle(Expected);
+
+        return memcmp(lluna_Container_StructOfArrays_Get(Particles, 0, Index), Particle.Position, sizeof(Particle.Position)) == 0
+                && *lluna_Container_StructOfArrays_Get(Particles, 1, Index) == Particle.Flags
+                && *(double*)lluna_Container_StructOfArrays_Get(Particles, 2, Index) == Particle.Lifetime
+                && *(uint32*)lluna_Container_StructOfArrays_Get(Particles, 3, Index) == Particle.Color;
+}
+
+static void Create()
+{
+        struct lluna_Container_StructOfArrays* Particles = lluna_Container_StructOfArrays_Create(ParticleFields, 4, 0);
+
+        lluna_TestHelper_CheckEqual(lluna_Container_StructOfArrays_Count(Particles), 0, &SessionState, "New structure of arrays is not empty.");
+        lluna_TestHelper_CheckTrue(Particles->Capacity > 0, &SessionState, "New structure of arrays has no memory.");
+        lluna_TestHelper_CheckEqual(Particles->FieldCount, 4, &SessionState, "Wrong number of fields.");
+
+        lluna_Container_StructOfArrays_Destroy(Particles);
+}
+
+static void Append()
+{
+        struct lluna_Container_StructOfArrays* Particles = lluna_Container_StructOfArrays_Create(ParticleFields, 4, 4);
+
+        struct Particle Particle = MakeParticle(7);
+        uint64 First = lluna_Container_StructOfArrays_Append(Particles, (byte*)&Particle);
+        uint64 Second = lluna_Container_StructOfArrays_Append(Particles, NULL);
+
+        lluna_TestHelper_CheckEqual(First, 0, &SessionState, "First element has the wrong index.");
+        lluna_TestHelper_CheckEqual(Second, 1, &SessionState, "Second element has the wrong index.");
+        lluna_TestHelper_CheckTrue(Matches(Particles, 0, 7), &SessionState, "Appended fields don't match the structure.");
+        lluna_TestHelper_CheckTrue(Matches(Particles, 1, 0), &SessionState, "Element appended without a structure is not zeroed.");
+
+        lluna_Container_StructOfArrays_Destroy(Particles);
+}
+
+static void Grow()
+{
+        struct lluna_Container_StructOfArrays* Particles = lluna_Container_StructOfArrays_Create(ParticleFields, 4, 1);
+
+        for (uint32 Index = 0; Index < 1000; ++Index)
+        {
+                struct Particle Particle = MakeParticle(Index);
+                lluna_Container_StructOfArrays_Append(Particles, (byte*)&Particle);
+        }
+
+        boolean Kept = true;
+        for (uint32 Index = 0; Index < 1000; ++Index)
+        {
+                Kept &= Matches(Particles, Index, Index);
+        }
+
+        lluna_TestHelper_CheckEqual(lluna_Container_StructOfArrays_Count(Particles), 1000, &SessionState, "Wrong number of elements.");
+        lluna_TestHelper_CheckTrue(Particles->Capacity >= 1000, &SessionState, "Capacity is smaller than the number of elements.");
+        lluna_TestHelper_CheckTrue(Kept, &SessionState, "Growing lost element fields.");
+
+        lluna_Container_StructOfArrays_Destroy(Particles);
+}
+
+static void Remove()
+{
+        struct lluna_Container_StructOfArrays* Particles = lluna_Container_StructOfArrays_Create(ParticleFields, 4, 4);
+
+        for (uint32 Index = 0; Index < 5; ++Index)
+        {
+                struct Particle Particle = MakeParticle(Index);
+                lluna_Container_StructOfArrays_Append(Particles, (byte*)&Particle);
+        }
+
+        lluna_Container_StructOfArrays_Remove(Particles, 1);
+        lluna_Container_StructOfArrays_Remove(Particles, 3);
+
+        lluna_TestHelper_CheckEqual(lluna_Container_StructOfArrays_Count(Particles), 3, &SessionState, "Wrong number of elements after removing.");
+        lluna_TestHelper_CheckTrue(Matches(Particles, 0, 0) && Matches(Particles, 1, 4) && Matches(Particles, 2, 2), &SessionState, "Remove didn't move the last element into the gap in every stream.");
+
+        lluna_Container_StructOfArrays_Destroy(Particles);
+}
+
+static void Alignment()
+{
+        struct lluna_Container_StructOfArrays* Particles = lluna_Container_StructOfArrays_Create(ParticleFields, 4, 3);
+
+        boolean Aligned = true;
+        for (uint32 Pass = 0; Pass < 2; ++Pass)
+        {
+                for (uint32 Field = 0; Field < 4; ++Field)
+                {
+                        uint64 Address = (uint64)(size_t)lluna_Container_StructOfArrays_Stream(Particles, Field);
+                        Aligned &= Address % lluna_Container_StructOfArrays_StreamAlignment == 0;
+                }
+                Aligned &= (uint64)(size_t)lluna_Container_StructOfArrays_Stream(Particles, 2) % 128 == 0;
+
+                lluna_Container_StructOfArrays_Reserve(Particles, 777);
+        }
+
+        lluna_TestHelper_CheckTrue(Aligned, &SessionState, "Streams are not aligned.");
+        lluna_TestHelper_CheckEqual(Particles->Capacity, 777, &SessionState, "Reserve didn't set the capacity.");
+
+        lluna_Container_StructOfArrays_Destroy(Particles);
+}
+
+static void Structs()
+{
+        struct lluna_Container_StructOfArrays* Particles = lluna_Container_StructOfArrays_Create(ParticleFields, 4, 1);
+        struct Particle Input[100];
+        struct Particle Output[100];
+
+        for (uint32 Index = 0; Index < 100; ++Index)
+        {
+                Input[Index] = MakeParticle(Index);
+        }
+        memset(Output, 0, sizeof(Output));
+
+        struct Particle First = MakeParticle(1000);
+        lluna_Container_StructOfArrays_Append(Particles, (byte*)&First);
+        lluna_Container_StructOfArrays_AppendStructs(Particles, (byte*)Input, 100, sizeof(struct Particle));
+        lluna_Container_StructOfArrays_CopyToStructs(Particles, 1, 100, (byte*)Output, sizeof(struct Particle));
+
+        boolean Converted = true;
+        boolean CopiedBack = true;
+        for (uint32 Index = 0; Index < 100; ++Index)
+        {
+                Converted &= Matches(Particles, Index + 1, Index);
+                CopiedBack &= memcmp(Input[Index].Position, Output[Index].Position, sizeof(Input[Index].Position)) == 0
+                        && Input[Index].Flags == Output[Index].Flags
+                        && Input[Index].Lifetime == Output[Index].Lifetime
+                        && Input[Index].Color == Output[Index].Color;
+        }
+
+        lluna_TestHelper_CheckEqual(lluna_Container_StructOfArrays_Count(Particles), 101, &SessionState, "Wrong number of elements after appending structures.");
+        lluna_TestHelper_CheckTrue(Matches(Particles, 0, 1000), &SessionState, "Appending structures overwrote existing elements.");
+        lluna_TestHelper_CheckTrue(Converted, &SessionState, "Appended structures don't match.");
+        lluna_TestHelper_CheckTrue(CopiedBack, &SessionState, "Structures copied back don't match the originals.");
+
+        lluna_Container_StructOfArrays_Destroy(Particles);
+}
@@ -0,0 +1,287 @@
+#include <TestHelper.h>
+
+#include <Engine/Core/Public/Atomics.h>
+
+#include <pthread.h>
+
+#define ThreadCount 4
+#define IterationCount 100000
+#define MessageCount 20000
+
+struct lluna_TestHelper_Session SessionState;
+
+static void LoadStore();
+static void CompareExchange();
+static void FetchOperations();
+static void Pointers();
+static void ConcurrentFetchAdd();
+static void ConcurrentCompareExchange();
+static void ExchangeLock();
+static void MessagePassing();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Core_Atomics");
+
+        lluna_TestHelper_RunTest(&SessionState, LoadStore);
+        lluna_TestHelper_RunTest(&SessionState, CompareExchange);
+        lluna_TestHelper_RunTest(&SessionState, FetchOperations);
+        lluna_TestHelper_RunTest(&SessionState, Pointers);
+        lluna_TestHelper_RunTest(&SessionState, ConcurrentFetchAdd);
+        lluna_TestHelper_RunTest(&SessionState, ConcurrentCompareExchange);
+        lluna_TestHelper_RunTest(&SessionState, ExchangeLock);
+        lluna_TestHelper_RunTest(&SessionState, MessagePassing);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+static void RunThreads(void* (*Function)(void*), void* Argument)
+{
+        pthread_t Threads[ThreadCount];
+        for (uint32 Index = 0; Index < ThreadCount; ++Index)
+        {
+                pthread_create(&Threads[Index], NULL, Function, Argument);
+        }
+        for (uint32 Index = 0; Index < ThreadCount; ++Index)
+        {
+                pthread_join(Threads[Index], NULL);
+        }
+}
+
+static void LoadStore()
+{
+        uint32 Value32 = 0;
+        uint64 Value64 = 0;
+        int64 Signed64 = 0;
+
+        lluna_Core_Atomics_StoreUint32(&Value32, 0xDEADBEEF, lluna_Core_Atomics_Release);
+        lluna_Core_Atomics_StoreUint64(&Value64, 0x0123456789ABCDEFULL, lluna_Core_Atomics_Relaxed);
+        lluna_Core_Atomics_StoreInt64(&Signed64, -42, lluna_Core_Atomics_SequentiallyConsistent);
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Atomics_LoadUint32(&Value32, lluna_Core_Atomics_Acquire), 0xDEADBEEF, &SessionState, "Wrong 32-bit value.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Atomics_LoadUint64(&Value64, lluna_Core_Atomics_Relaxed), 0x0123456789ABCDEFULL, &SessionState, "Wrong 64-bit value.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Atomics_LoadInt64(&Signed64, lluna_Core_Atomics_SequentiallyConsistent), -42, &SessionState, "Wrong signed value.");
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Atomics_ExchangeUint64(&Value64, 7, lluna_Core_Atomics_AcquireRelease), 0x0123456789ABCDEFULL, &SessionState,
+                                    "Exchange did not return the previous value.");
+        lluna_TestHelper_CheckEqual(Value64, 7, &SessionState, "Exchange did not store the new value.");
+}
+
+static void CompareExchange()
+{
+        uint64 Value = 5;
+        uint64 Expected = 4;
+
+        boolean Replaced = lluna_Core_Atomics_CompareExchangeUint64(&Value, &Expected, 6, false, lluna_Core_Atomics_AcquireRelease, lluna_Core_Atomics_Acquire);
+        lluna_TestHelper_CheckFalse(Replaced, &SessionState, "Replaced a value that wasn't expected.");
+        lluna_TestHelper_CheckEqual(Expected, 5, &SessionState, "Failure did not update the expected value.");
+        lluna_TestHelper_CheckEqual(Value, 5, &SessionState, "Failure changed the value.");
+
+        Replaced = lluna_Core_Atomics_CompareExchangeUint64(&Value, &Expected, 6, false, lluna_Core_Atomics_AcquireRelease, lluna_Core_Atomics_Acquire);
+        lluna_TestHelper_CheckTrue(Replaced, &SessionState, "Did not replace the expected value.");
+        lluna_TestHelper_CheckEqual(Value, 6, &SessionState, "Success did not store the new value.");
+
+        // Weak exchanges may fail spuriously, but not forever.
+        uint32 Value32 = 1;
+        uint32 Expected32 = 1;
+        while (!lluna_Core_Atomics_CompareExchangeUint32(&Value32, &Expected32, 2, true, lluna_Core_Atomics_Acquire, lluna_Core_Atomics_Relaxed))
+        {
+        }
+        lluna_TestHelper_CheckEqual(Value32, 2, &SessionState, "Weak exchange did not store the new value.");
+}
+
+static void FetchOperations()
+{
+        uint32 Value32 = 0xF0;
+        uint64 Value64 = 10;
+        int64 Signed64 = 0;
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Atomics_FetchOrUint32(&Value32, 0x0F, lluna_Core_Atomics_Relaxed), 0xF0, &SessionState, "Or returned the wrong value.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Atomics_FetchAndUint32(&Value32, 0x3C, lluna_Core_Atomics_Relaxed), 0xFF, &SessionState, "And returned the wrong value.");
+        lluna_TestHelper_CheckEqual(Value32, 0x3C, &SessionState, "Bit operations stored the wrong value.");
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Atomics_FetchAddUint64(&Value64, 5, lluna_Core_Atomics_Relaxed), 10, &SessionState, "Add returned the wrong value.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Atomics_FetchSubUint64(&Value64, 3, lluna_Core_Atomics_Relaxed), 15, &SessionState, "Sub returned the wrong value.");
+        lluna_TestHelper_CheckEqual(Value64, 12, &SessionState, "Arithmetic stored the wrong value.");
+
+        lluna_Core_Atomics_FetchSubInt64(&Signed64, 3, lluna_Core_Atomics_Release);
+        lluna_TestHelper_CheckEqual(Signed64, -3, &SessionState, "Signed sub stored the wrong value.");
+}
+
+static void Pointers()
+{
+        uint32 First = 1;
+        uint32 Second = 2;
+        uint32* Pointer = NULL;
+
+        lluna_Core_Atomics_StorePointer(&Pointer, &First, lluna_Core_Atomics_Release);
+        lluna_TestHelper_CheckEqual(lluna_Core_Atomics_LoadPointer(&Pointer, lluna_Core_Atomics_Acquire), &First, &SessionState, "Wrong pointer loaded.");
+        lluna_TestHelper_CheckEqual(*lluna_Core_Atomics_LoadPointer(&Pointer, lluna_Core_Atomics_Acquire), 1, &SessionState, "Pointer type was lost.");
+
+        uint32* Expected = &Second;
+        lluna_TestHelper_CheckFalse(lluna_Core_Atomics_CompareExchangePointer(&Pointer, &Expected, &Second, false, lluna_Core_Atomics_AcquireRelease,
+                                                                              lluna_Core_Atomics_Acquire),
+                                    &SessionState, "Replaced a pointer that wasn't expected.");
+        lluna_TestHelper_CheckEqual(Expected, &First, &SessionState, "Failure did not update the expected pointer.");
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Atomics_ExchangePointer(&Pointer, &Second, lluna_Core_Atomics_AcquireRelease), &First, &SessionState,
+                                    "Exchange did not return the previous pointer.");
+        lluna_TestHelper_CheckEqual(Pointer, &Second, &SessionState, "Exchange did not store the new pointer.");
+}
+
+struct Counters
+{
+        uint32 Value32;
+        uint64 Value64;
+        int64 Signed64;
+};
+
+static void* AddAll(void* Argument)
+{
+        struct Counters* Counters = Argument;
+        for (uint32 Iteration = 0; Iteration < IterationCount; ++Iteration)
+        {
+                lluna_Core_Atomics_FetchAddUint32(&Counters->Value32, 1, lluna_Core_Atomics_Relaxed);
+                lluna_Core_Atomics_FetchAddUint64(&Counters->Value64, 3, lluna_Core_Atomics_AcquireRelease);
+                lluna_Core_Atomics_FetchSubInt64(&Counters->Signed64, 1, lluna_Core_Atomics_Relaxed);
+        }
+
+        return NULL;
+}
+
+static void ConcurrentFetchAdd()
+{
+        struct Counters Counters = { 0 };
+        RunThreads(AddAll, &Counters);
+
+        lluna_TestHelper_CheckEqual(Counters.Value32, ThreadCount * IterationCount, &SessionState, "32-bit increments were lost.");
+        lluna_TestHelper_CheckEqual(Counters.Value64, 3ULL * ThreadCount * IterationCount, &SessionState, "64-bit increments were lost.");
+        lluna_TestHelper_CheckEqual(Counters.Signed64, -(int64)ThreadCount * IterationCount, &SessionState, "Signed decrements were lost.");
+}
+
+// Doubles as a 64-bit increment, checking that both halves of the value change together.
+static void* CompareExchangeAll(void* Argument)
+{
+        struct Counters* Counters = Argument;
+        for (uint32 Iteration = 0; Iteration < IterationCount; ++Iteration)
+        {
+                uint64 Expected = lluna_Core_Atomics_LoadUint64(&Counters->Value64, lluna_Core_Atomics_Relaxed);
+                while (!lluna_Core_Atomics_CompareExchangeUint64(&Counters->Value64, &Expected, Expected + 0x100000001ULL, true, lluna_Core_Atomics_AcquireRelease,
+                                                                 lluna_Core_Atomics_Relaxed))
+                {
+                }
+        }
+
+        return NULL;
+}
+
+static void ConcurrentCompareExchange()
+{
+        struct Counters Counters = { 0 };
+        RunThreads(CompareExchangeAll, &Counters);
+
+        lluna_TestHelper_CheckEqual(Counters.Value64, 0x100000001ULL * ThreadCount * IterationCount, &SessionState, "Exchanges were lost.");
+}
+
+struct Guarded
+{
+        uint32 Lock;
+        uint64 Value;
+        uint32 Inside;
+        boolean Overlapped;
+};
+
+static void* LockedIncrement(void* Argument)
+{
+        struct Guarded* Guarded = Argument;
+        for (uint32 Iteration = 0; Iteration < IterationCount; ++Iteration)
+        {
+                for (uint32 Attempt = 0; lluna_Core_Atomics_ExchangeUint32(&Guarded->Lock, 1, lluna_Core_Atomics_Acquire); ++Attempt)
+                {
+                        if (Attempt < 16)
+                        {
+                                lluna_Core_Atomics_Pause();
+                        }
+                        else
+                        {
+                                lluna_Core_Atomics_Yield();
+                        }
+                }
+
+                // Plain accesses, only the acquire and release of the lock order them between threads.
+                Guarded->Overlapped |= Guarded->Inside++ != 0;
+                ++Guarded->Value;
+                --Guarded->Inside;
+
+                lluna_Core_Atomics_StoreUint32(&Guarded->Lock, 0, lluna_Core_Atomics_Release);
+        }
+
+        return NULL;
+}
+
+static void ExchangeLock()
+{
+        struct Guarded Guarded = { 0 };
+        RunThreads(LockedIncrement, &Guarded);
+
+        lluna_TestHelper_CheckFalse(Guarded.Overlapped, &SessionState, "Two threads held the lock at once.");
+        lluna_TestHelper_CheckEqual(Guarded.Value, ThreadCount * IterationCount, &SessionState, "Increments were lost.");
+}
+
+struct Mailbox
+{
+        uint64 Payload[4];
+        uint32 Sequence;
+        boolean Correct;
+};
+
+// Sequence numbers are even while the mailbox is empty and odd while it holds a message.
+static void* Receive(void* Argument)
+{
+        struct Mailbox* Mailbox = Argument;
+        for (uint32 Message = 0; Message < MessageCount; ++Message)
+        {
+                uint32 Full = Message * 2 + 1;
+                while (lluna_Core_Atomics_LoadUint32(&Mailbox->Sequence, lluna_Core_Atomics_Acquire) != Full)
+                {
+                        lluna_Core_Atomics_Yield();
+                }
+
+                for (uint32 Index = 0; Index < 4; ++Index)
+                {
+                        Mailbox->Correct &= Mailbox->Payload[Index] == (uint64)Message * 4 + Index;
+                }
+
+                lluna_Core_Atomics_StoreUint32(&Mailbox->Sequence, Full + 1, lluna_Core_Atomics_Release);
+        }
+
+        return NULL;
+}
+
+static void MessagePassing()
+{
+        struct Mailbox Mailbox = { { 0 }, 0, true };
+
+        pthread_t Receiver;
+        pthread_create(&Receiver, NULL, Receive, &Mailbox);
+
+        for (uint32 Message = 0; Message < MessageCount; ++Message)
+        {
+                uint32 Empty = Message * 2;
+                while (lluna_Core_Atomics_LoadUint32(&Mailbox.Sequence, lluna_Core_Atomics_Acquire) != Empty)
+                {
+                        lluna_Core_Atomics_Yield();
+                }
+
+                for (uint32 Index = 0; Index < 4; ++Index)
+                {
+                        Mailbox.Payload[Index] = (uint64)Message * 4 + Index;
+                }
+
+                lluna_Core_Atomics_StoreUint32(&Mailbox.Sequence, Empty + 1, lluna_Core_Atomics_Release);
+        }
+
+        pthread_join(Receiver, NULL);
+
+        lluna_TestHelper_CheckTrue(Mailbox.Correct, &SessionState, "Receiver saw a message before it was written.");
+}
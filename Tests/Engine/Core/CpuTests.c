@@ -0,0 +1,115 @@
+#include <TestHelper.h>
+
+#include <Engine/Core/Public/Cpu.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+struct lluna_TestHelper_Session SessionState;
+
+static void LevelOverride();
+static void Detection();
+static void Levels();
+static void Supports();
+static void Dispatch();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Core_Cpu");
+
+        // Features are detected once per process, so the override has to be in place before anything queries them.
+        setenv("LLUNA_CPU_LEVEL", "x86-64", 1);
+
+        lluna_TestHelper_RunTest(&SessionState, LevelOverride);
+        lluna_TestHelper_RunTest(&SessionState, Detection);
+        lluna_TestHelper_RunTest(&SessionState, Levels);
+        lluna_TestHelper_RunTest(&SessionState, Supports);
+        lluna_TestHelper_RunTest(&SessionState, Dispatch);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+static void First()
+{
+}
+
+static void Second()
+{
+}
+
+static void Third()
+{
+}
+
+static void LevelOverride()
+{
+        const struct lluna_Core_Cpu_Info* Info = lluna_Core_Cpu_GetInfo();
+
+        lluna_TestHelper_CheckEqual(Info->Features & ~Info->DetectedFeatures, 0, &SessionState, "Reported a feature that wasn't detected.");
+        lluna_TestHelper_CheckEqual(Info->Features & ~(lluna_Core_Cpu_Sse2 | lluna_Core_Cpu_Neon), 0, &SessionState,
+                                    "Override did not hide features above its level.");
+        lluna_TestHelper_CheckTrue(Info->Level <= lluna_Core_Cpu_LevelX86_64, &SessionState, "Level is above the override.");
+        lluna_TestHelper_CheckFalse(lluna_Core_Cpu_Supports(lluna_Core_Cpu_Avx2), &SessionState, "Override did not hide AVX2.");
+}
+
+static void Detection()
+{
+        const struct lluna_Core_Cpu_Info* Info = lluna_Core_Cpu_GetInfo();
+
+        lluna_TestHelper_CheckEqual(Info, lluna_Core_Cpu_GetInfo(), &SessionState, "Processor was described twice.");
+#if defined(__x86_64__)
+        lluna_TestHelper_CheckTrue(Info->DetectedFeatures & lluna_Core_Cpu_Sse2, &SessionState, "SSE2 is part of every x86-64 processor.");
+        lluna_TestHelper_CheckNotEqual(strlen(Info->Vendor), 0, &SessionState, "Vendor was not detected.");
+        lluna_TestHelper_CheckEqual(Info->Level, lluna_Core_Cpu_LevelX86_64, &SessionState, "Override level was not reported.");
+#elif defined(__aarch64__)
+        lluna_TestHelper_CheckTrue(Info->DetectedFeatures & lluna_Core_Cpu_Neon, &SessionState, "NEON is part of every AArch64 processor.");
+#endif
+
+        // AVX2 can't be used unless the operating system saves AVX registers, which implies AVX support.
+        if (Info->DetectedFeatures & lluna_Core_Cpu_Avx2)
+        {
+                lluna_TestHelper_CheckTrue(Info->DetectedFeatures & lluna_Core_Cpu_Avx, &SessionState, "AVX2 reported without AVX.");
+        }
+        if (Info->DetectedFeatures & lluna_Core_Cpu_Avx512F)
+        {
+                lluna_TestHelper_CheckTrue(Info->DetectedFeatures & lluna_Core_Cpu_Avx, &SessionState, "AVX-512 reported without AVX.");
+        }
+}
+
+static void Levels()
+{
+        const struct lluna_Core_Cpu_Info* Info = lluna_Core_Cpu_GetInfo();
+
+        if (Info->Level >= lluna_Core_Cpu_LevelX86_64)
+        {
+                lluna_TestHelper_CheckTrue(Info->Features & lluna_Core_Cpu_Sse2, &SessionState, "Level reported without its features.");
+        }
+        else
+        {
+                lluna_TestHelper_CheckFalse(Info->Features & lluna_Core_Cpu_Sse2, &SessionState, "Level not reported with its features.");
+        }
+}
+
+static void Supports()
+{
+        const struct lluna_Core_Cpu_Info* Info = lluna_Core_Cpu_GetInfo();
+
+        lluna_TestHelper_CheckTrue(lluna_Core_Cpu_Supports(0), &SessionState, "No features should always be supported.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Cpu_Supports(Info->Features), true, &SessionState, "Usable features were not supported.");
+        lluna_TestHelper_CheckFalse(lluna_Core_Cpu_Supports(lluna_Core_Cpu_Sse2 | lluna_Core_Cpu_Avx512F), &SessionState,
+                                    "Supported features some of which were hidden.");
+}
+
+static void Dispatch()
+{
+        const struct lluna_Core_Cpu_Kernel Kernels[] = {
+                { lluna_Core_Cpu_Avx2 | lluna_Core_Cpu_Fma, First },
+                { lluna_Core_Cpu_Sse2, Second },
+                { 0, Third },
+        };
+
+        lluna_Core_Cpu_Function Expected = lluna_Core_Cpu_Supports(lluna_Core_Cpu_Sse2) ? Second : Third;
+        lluna_TestHelper_CheckTrue(lluna_Core_Cpu_Dispatch(Kernels, 3) == Expected, &SessionState, "Did not pick the first usable kernel.");
+        lluna_TestHelper_CheckTrue(lluna_Core_Cpu_Dispatch(Kernels, 1) == NULL, &SessionState, "Picked a kernel that isn't usable.");
+        lluna_TestHelper_CheckTrue(lluna_Core_Cpu_Dispatch(Kernels + 2, 1) == Third, &SessionState, "Did not pick the fallback.");
+}
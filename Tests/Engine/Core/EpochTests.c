@@ -0,0 +1,230 @@
+#include <TestHelper.h>
+
+#include <Engine/Core/Public/Atomics.h>
+#include <Engine/Core/Public/Epoch.h>
+
+#include <pthread.h>
+#include <stdlib.h>
+
+struct lluna_TestHelper_Session SessionState;
+
+static void Create();
+static void EnterLeave();
+static void Reclaim();
+static void ReadersHoldBack();
+static void Unregister();
+static void Destroy();
+static void ConcurrentReaders();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Core_Epoch");
+
+        lluna_TestHelper_RunTest(&SessionState, Create);
+        lluna_TestHelper_RunTest(&SessionState, EnterLeave);
+        lluna_TestHelper_RunTest(&SessionState, Reclaim);
+        lluna_TestHelper_RunTest(&SessionState, ReadersHoldBack);
+        lluna_TestHelper_RunTest(&SessionState, Unregister);
+        lluna_TestHelper_RunTest(&SessionState, Destroy);
+        lluna_TestHelper_RunTest(&SessionState, ConcurrentReaders);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+static uint64 FreedCount;
+
+static void CountFree(void* Pointer)
+{
+        ++FreedCount;
+}
+
+static void Create()
+{
+        struct lluna_Core_Epoch* Epoch = lluna_Core_Epoch_Create();
+
+        lluna_TestHelper_CheckNotEqual(Epoch, NULL, &SessionState, "Create returned NULL.");
+        lluna_TestHelper_CheckEqual(Epoch->Participants, NULL, &SessionState, "New domain has participants.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Epoch_Reclaim(Epoch), 0, &SessionState, "Empty domain freed something.");
+
+        lluna_Core_Epoch_Destroy(Epoch);
+}
+
+static void EnterLeave()
+{
+        struct lluna_Core_Epoch* Epoch = lluna_Core_Epoch_Create();
+        struct lluna_Core_Epoch_Participant Participant;
+        lluna_Core_Epoch_Register(Epoch, &Participant);
+
+        lluna_Core_Epoch_Enter(&Participant);
+        lluna_TestHelper_CheckNotEqual(Participant.Local, 0, &SessionState, "Enter did not mark the participant active.");
+        lluna_Core_Epoch_Enter(&Participant);
+        lluna_Core_Epoch_Leave(&Participant);
+        lluna_TestHelper_CheckNotEqual(Participant.Local, 0, &SessionState, "Leaving a nested section left the outer one.");
+        lluna_Core_Epoch_Leave(&Participant);
+        lluna_TestHelper_CheckEqual(Participant.Local, 0, &SessionState, "Leave did not mark the participant inactive.");
+
+        lluna_Core_Epoch_Destroy(Epoch);
+}
+
+static void Reclaim()
+{
+        struct lluna_Core_Epoch* Epoch = lluna_Core_Epoch_Create();
+        struct lluna_Core_Epoch_Participant Participant;
+        lluna_Core_Epoch_Register(Epoch, &Participant);
+
+        FreedCount = 0;
+        lluna_Core_Epoch_Retire(Epoch, NULL, CountFree);
+        lluna_Core_Epoch_Retire(Epoch, NULL, CountFree);
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Epoch_Reclaim(Epoch), 0, &SessionState, "Memory was freed one epoch after being retired.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Epoch_Reclaim(Epoch), 2, &SessionState, "Memory was not freed two epochs after being retired.");
+        lluna_TestHelper_CheckEqual(FreedCount, 2, &SessionState, "Free functions were not called.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Epoch_Reclaim(Epoch), 0, &SessionState, "Memory was freed twice.");
+
+        lluna_Core_Epoch_Destroy(Epoch);
+}
+
+static void ReadersHoldBack()
+{
+        struct lluna_Core_Epoch* Epoch = lluna_Core_Epoch_Create();
+        struct lluna_Core_Epoch_Participant Reader;
+        struct lluna_Core_Epoch_Participant Idle;
+        lluna_Core_Epoch_Register(Epoch, &Reader);
+        lluna_Core_Epoch_Register(Epoch, &Idle);
+
+        FreedCount = 0;
+        lluna_Core_Epoch_Enter(&Reader);
+        lluna_Core_Epoch_Retire(Epoch, NULL, CountFree);
+        for (uint32 Round = 0; Round < 8; ++Round)
+        {
+                lluna_Core_Epoch_Reclaim(Epoch);
+        }
+        lluna_TestHelper_CheckEqual(FreedCount, 0, &SessionState, "Memory was freed while a reader could be using it.");
+
+        lluna_Core_Epoch_Leave(&Reader);
+        lluna_Core_Epoch_Reclaim(Epoch);
+        lluna_Core_Epoch_Reclaim(Epoch);
+        lluna_TestHelper_CheckEqual(FreedCount, 1, &SessionState, "Memory was not freed after the reader left.");
+
+        lluna_Core_Epoch_Destroy(Epoch);
+}
+
+static void Unregister()
+{
+        struct lluna_Core_Epoch* Epoch = lluna_Core_Epoch_Create();
+        struct lluna_Core_Epoch_Participant Participants[3];
+        for (uint32 Index = 0; Index < 3; ++Index)
+        {
+                lluna_Core_Epoch_Register(Epoch, &Participants[Index]);
+        }
+
+        lluna_Core_Epoch_Unregister(&Participants[1]);
+
+        uint32 Count = 0;
+        boolean Found = false;
+        for (struct lluna_Core_Epoch_Participant* Participant = Epoch->Participants; Participant; Participant = Participant->Next)
+        {
+                Found |= Participant == &Participants[1];
+                ++Count;
+        }
+
+        lluna_TestHelper_CheckEqual(Count, 2, &SessionState, "Wrong number of participants.");
+        lluna_TestHelper_CheckFalse(Found, &SessionState, "Unregistered participant is still registered.");
+
+        lluna_Core_Epoch_Destroy(Epoch);
+}
+
+static void Destroy()
+{
+        struct lluna_Core_Epoch* Epoch = lluna_Core_Epoch_Create();
+
+        FreedCount = 0;
+        lluna_Core_Epoch_Retire(Epoch, NULL, CountFree);
+        lluna_Core_Epoch_Destroy(Epoch);
+
+        lluna_TestHelper_CheckEqual(FreedCount, 1, &SessionState, "Destroy did not free retired memory.");
+}
+
+#define ReaderCount 4
+#define BlockMagic 0x6C6C756E61ULL
+
+struct Block
+{
+        uint64 Magic;
+};
+
+struct Reader
+{
+        struct lluna_Core_Epoch* Epoch;
+        struct Block** Shared;
+        uint32* Stop;
+        boolean Correct;
+};
+
+// Clears the block before freeing it, so readers using freed blocks notice even without a sanitizer.
+static void FreeBlock(void* Pointer)
+{
+        lluna_Core_Atomics_StoreUint64(&((struct Block*)Pointer)->Magic, 0, lluna_Core_Atomics_Relaxed);
+        free(Pointer);
+}
+
+static void* Read(void* Argument)
+{
+        struct Reader* Reader = Argument;
+        struct lluna_Core_Epoch_Participant Participant;
+        lluna_Core_Epoch_Register(Reader->Epoch, &Participant);
+
+        while (!lluna_Core_Atomics_LoadUint32(Reader->Stop, lluna_Core_Atomics_Acquire))
+        {
+                lluna_Core_Epoch_Enter(&Participant);
+                struct Block* Block = lluna_Core_Atomics_LoadPointer(Reader->Shared, lluna_Core_Atomics_Acquire);
+                for (uint32 Check = 0; Check < 16; ++Check)
+                {
+                        Reader->Correct &= lluna_Core_Atomics_LoadUint64(&Block->Magic, lluna_Core_Atomics_Relaxed) == BlockMagic;
+                }
+                lluna_Core_Epoch_Leave(&Participant);
+        }
+
+        lluna_Core_Epoch_Unregister(&Participant);
+
+        return NULL;
+}
+
+static void ConcurrentReaders()
+{
+        struct lluna_Core_Epoch* Epoch = lluna_Core_Epoch_Create();
+        struct Block* Shared = malloc(sizeof(struct Block));
+        Shared->Magic = BlockMagic;
+
+        struct Reader Readers[ReaderCount];
+        pthread_t Threads[ReaderCount];
+        uint32 Stop = false;
+        for (uint32 Index = 0; Index < ReaderCount; ++Index)
+        {
+                Readers[Index] = (struct Reader){ Epoch, &Shared, &Stop, true };
+                pthread_create(&Threads[Index], NULL, Read, &Readers[Index]);
+        }
+
+        for (uint32 Round = 0; Round < 20000; ++Round)
+        {
+                struct Block* Block = malloc(sizeof(struct Block));
+                Block->Magic = BlockMagic;
+
+                struct Block* Replaced = lluna_Core_Atomics_ExchangePointer(&Shared, Block, lluna_Core_Atomics_AcquireRelease);
+                lluna_Core_Epoch_Retire(Epoch, Replaced, FreeBlock);
+                lluna_Core_Epoch_Reclaim(Epoch);
+        }
+        lluna_Core_Atomics_StoreUint32(&Stop, true, lluna_Core_Atomics_Release);
+
+        boolean Correct = true;
+        for (uint32 Index = 0; Index < ReaderCount; ++Index)
+        {
+                pthread_join(Threads[Index], NULL);
+                Correct &= Readers[Index].Correct;
+        }
+
+        lluna_TestHelper_CheckTrue(Correct, &SessionState, "Readers saw freed memory.");
+
+        free(Shared);
+        lluna_Core_Epoch_Destroy(Epoch);
+}
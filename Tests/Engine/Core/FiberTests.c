@@ -0,0 +1,283 @@
+#include <TestHelper.h>
+
+#include <Engine/Core/Public/Fiber.h>
+
+#include <pthread.h>
+#include <string.h>
+
+#define YieldCount 1000
+
+struct lluna_TestHelper_Session SessionState;
+
+static void ResumeYield();
+static void Nested();
+static void Registers();
+static void StackReuse();
+static void LargeFrames();
+static void Migration();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Core_Fiber");
+
+        lluna_TestHelper_RunTest(&SessionState, ResumeYield);
+        lluna_TestHelper_RunTest(&SessionState, Nested);
+        lluna_TestHelper_RunTest(&SessionState, Registers);
+        lluna_TestHelper_RunTest(&SessionState, StackReuse);
+        lluna_TestHelper_RunTest(&SessionState, LargeFrames);
+        lluna_TestHelper_RunTest(&SessionState, Migration);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+struct Steps
+{
+        struct lluna_Core_Fiber* Fiber;
+        uint32 Count;
+        boolean SawItself;
+};
+
+static void CountSteps(void* Data)
+{
+        struct Steps* Steps = Data;
+        for (uint32 Step = 0; Step < YieldCount; ++Step)
+        {
+                Steps->SawItself = lluna_Core_Fiber_Current() == Steps->Fiber;
+                ++Steps->Count;
+                lluna_Core_Fiber_Yield();
+        }
+}
+
+static void ResumeYield()
+{
+        struct lluna_Core_Fiber_Pool* Pool = lluna_Core_Fiber_CreatePool(0);
+        struct Steps Steps = { 0 };
+        Steps.Fiber = lluna_Core_Fiber_Create(Pool, CountSteps, &Steps);
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Fiber_Current(), NULL, &SessionState, "Thread reported a running fiber.");
+        lluna_TestHelper_CheckEqual(Steps.Count, 0, &SessionState, "Fiber started before being resumed.");
+
+        uint32 Resumes = 0;
+        while (!lluna_Core_Fiber_Finished(Steps.Fiber))
+        {
+                lluna_Core_Fiber_Resume(Steps.Fiber);
+                lluna_TestHelper_CheckEqual(Steps.Count, Resumes < YieldCount ? Resumes + 1 : YieldCount, &SessionState,
+                                            "Fiber did not run until its next yield.");
+                ++Resumes;
+        }
+
+        lluna_TestHelper_CheckEqual(Resumes, YieldCount + 1, &SessionState, "Fiber finished at the wrong time.");
+        lluna_TestHelper_CheckTrue(Steps.SawItself, &SessionState, "Fiber was not reported as running.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Fiber_Current(), NULL, &SessionState, "Thread still reported a running fiber.");
+
+        lluna_Core_Fiber_Destroy(Steps.Fiber);
+        lluna_Core_Fiber_DestroyPool(Pool);
+}
+
+struct Chain
+{
+        struct lluna_Core_Fiber_Pool* Pool;
+        char Log[16];
+        uint32 Length;
+};
+
+static void Inner(void* Data)
+{
+        struct Chain* Chain = Data;
+        Chain->Log[Chain->Length++] = 'b';
+        lluna_Core_Fiber_Yield();
+        Chain->Log[Chain->Length++] = 'd';
+}
+
+static void Outer(void* Data)
+{
+        struct Chain* Chain = Data;
+        struct lluna_Core_Fiber* Fiber = lluna_Core_Fiber_Create(Chain->Pool, Inner, Chain);
+
+        Chain->Log[Chain->Length++] = 'a';
+        lluna_Core_Fiber_Resume(Fiber);
+        Chain->Log[Chain->Length++] = 'c';
+
+        // Yielding from the outer fiber goes back to the thread, not to the inner fiber.
+        lluna_Core_Fiber_Yield();
+        lluna_Core_Fiber_Resume(Fiber);
+        Chain->Log[Chain->Length++] = 'e';
+
+        lluna_Core_Fiber_Destroy(Fiber);
+}
+
+static void Nested()
+{
+        struct Chain Chain = { 0 };
+        Chain.Pool = lluna_Core_Fiber_CreatePool(0);
+
+        struct lluna_Core_Fiber* Fiber = lluna_Core_Fiber_Create(Chain.Pool, Outer, &Chain);
+        lluna_Core_Fiber_Resume(Fiber);
+        lluna_TestHelper_CheckEqual(strcmp(Chain.Log, "abc"), 0, &SessionState, "Nested fibers ran out of order.");
+
+        lluna_Core_Fiber_Resume(Fiber);
+        lluna_TestHelper_CheckEqual(strcmp(Chain.Log, "abcde"), 0, &SessionState, "Nested fibers did not finish in order.");
+        lluna_TestHelper_CheckTrue(lluna_Core_Fiber_Finished(Fiber), &SessionState, "Outer fiber did not finish.");
+
+        lluna_Core_Fiber_Destroy(Fiber);
+        lluna_Core_Fiber_DestroyPool(Chain.Pool);
+}
+
+struct Sums
+{
+        uint64 Integer;
+        double Real;
+};
+
+static void Accumulate(void* Data)
+{
+        struct Sums* Sums = Data;
+        uint64 Integer = 0;
+        double Real = 0.0;
+        for (uint32 Step = 1; Step <= YieldCount; ++Step)
+        {
+                Integer += Step * Step;
+                Real += 1.0 / Step;
+                lluna_Core_Fiber_Yield();
+        }
+
+        Sums->Integer = Integer;
+        Sums->Real = Real;
+}
+
+// Both sides keep values in callee-saved registers across switches, which must come back untouched.
+static void Registers()
+{
+        struct lluna_Core_Fiber_Pool* Pool = lluna_Core_Fiber_CreatePool(0);
+        struct Sums Sums = { 0 };
+        struct lluna_Core_Fiber* Fiber = lluna_Core_Fiber_Create(Pool, Accumulate, &Sums);
+
+        uint64 Integer = 0;
+        double Real = 0.0;
+        for (uint32 Step = 1; !lluna_Core_Fiber_Finished(Fiber); ++Step)
+        {
+                Integer += Step * Step;
+                Real += 1.0 / Step;
+                lluna_Core_Fiber_Resume(Fiber);
+        }
+        Integer -= (uint64)(YieldCount + 1) * (YieldCount + 1);
+        Real -= 1.0 / (YieldCount + 1);
+
+        lluna_TestHelper_CheckEqual(Sums.Integer, Integer, &SessionState, "Fiber integer registers were corrupted.");
+        lluna_TestHelper_CheckTrue(Sums.Real == Real, &SessionState, "Fiber floating point registers were corrupted.");
+
+        lluna_Core_Fiber_Destroy(Fiber);
+        lluna_Core_Fiber_DestroyPool(Pool);
+}
+
+static void Nothing(void* Data)
+{
+}
+
+static void StackReuse()
+{
+        struct lluna_Core_Fiber_Pool* Pool = lluna_Core_Fiber_CreatePool(0);
+
+        struct lluna_Core_Fiber* First = lluna_Core_Fiber_Create(Pool, Nothing, NULL);
+        lluna_Core_Fiber_Resume(First);
+        lluna_Core_Fiber_Destroy(First);
+        lluna_TestHelper_CheckEqual(Pool->FreeCount, 1, &SessionState, "Stack was not returned to the pool.");
+
+        struct lluna_Core_Fiber* Second = lluna_Core_Fiber_Create(Pool, Nothing, NULL);
+        lluna_TestHelper_CheckEqual(Second, First, &SessionState, "Free stack was not reused.");
+        lluna_TestHelper_CheckEqual(Pool->FreeCount, 0, &SessionState, "Reused stack was left in the pool.");
+        lluna_TestHelper_CheckFalse(lluna_Core_Fiber_Finished(Second), &SessionState, "Reused fiber was already finished.");
+
+        lluna_Core_Fiber_Resume(Second);
+        lluna_TestHelper_CheckTrue(lluna_Core_Fiber_Finished(Second), &SessionState, "Reused fiber did not run.");
+
+        lluna_Core_Fiber_Destroy(Second);
+        lluna_Core_Fiber_DestroyPool(Pool);
+}
+
+static uint64 Recurse(volatile byte* Previous, uint32 Depth)
+{
+        volatile byte Frame[1024];
+        memset((byte*)Frame, (int)Depth, sizeof(Frame));
+        if (Depth == 0)
+        {
+                return Frame[0] + (Previous ? Previous[0] : 0);
+        }
+
+        return Recurse(Frame, Depth - 1) + Frame[sizeof(Frame) - 1];
+}
+
+static void UseStack(void* Data)
+{
+        *(uint64*)Data = Recurse(NULL, 128);
+}
+
+static void LargeFrames()
+{
+        struct lluna_Core_Fiber_Pool* Pool = lluna_Core_Fiber_CreatePool(0);
+        uint64 Result = 0;
+
+        struct lluna_Core_Fiber* Fiber = lluna_Core_Fiber_Create(Pool, UseStack, &Result);
+        lluna_Core_Fiber_Resume(Fiber);
+
+        lluna_TestHelper_CheckEqual(Result, Recurse(NULL, 128), &SessionState, "Deep calls gave a different result on a fiber.");
+
+        lluna_Core_Fiber_Destroy(Fiber);
+        lluna_Core_Fiber_DestroyPool(Pool);
+}
+
+struct Travel
+{
+        struct lluna_Core_Fiber* Fiber;
+        uint32 Threads[2];
+        boolean Moved;
+};
+
+static __thread uint32 ThreadTag = 0;
+
+// Compilers assume code stays on the same thread, so thread identities can't be cached across a yield.
+__attribute__((noinline)) static uint32 GetThreadTag()
+{
+        return ThreadTag;
+}
+
+static void RecordThread(void* Data)
+{
+        struct Travel* Travel = Data;
+        Travel->Threads[0] = GetThreadTag();
+        lluna_Core_Fiber_Yield();
+        Travel->Threads[1] = GetThreadTag();
+        Travel->Moved = lluna_Core_Fiber_Current() == Travel->Fiber;
+}
+
+static void* ResumeElsewhere(void* Argument)
+{
+        struct Travel* Travel = Argument;
+        ThreadTag = 2;
+        lluna_Core_Fiber_Resume(Travel->Fiber);
+
+        return NULL;
+}
+
+static void Migration()
+{
+        struct lluna_Core_Fiber_Pool* Pool = lluna_Core_Fiber_CreatePool(0);
+        struct Travel Travel = { 0 };
+        Travel.Fiber = lluna_Core_Fiber_Create(Pool, RecordThread, &Travel);
+
+        ThreadTag = 1;
+        lluna_Core_Fiber_Resume(Travel.Fiber);
+
+        pthread_t Thread;
+        pthread_create(&Thread, NULL, ResumeElsewhere, &Travel);
+        pthread_join(Thread, NULL);
+
+        lluna_TestHelper_CheckEqual(Travel.Threads[0], 1, &SessionState, "Fiber did not start on this thread.");
+        lluna_TestHelper_CheckEqual(Travel.Threads[1], 2, &SessionState, "Fiber did not continue on the other thread.");
+        lluna_TestHelper_CheckTrue(Travel.Moved, &SessionState, "Fiber was not reported as running on the other thread.");
+        lluna_TestHelper_CheckTrue(lluna_Core_Fiber_Finished(Travel.Fiber), &SessionState, "Fiber did not finish on the other thread.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Fiber_Current(), NULL, &SessionState, "Thread reported a running fiber.");
+
+        lluna_Core_Fiber_Destroy(Travel.Fiber);
+        lluna_Core_Fiber_DestroyPool(Pool);
+}
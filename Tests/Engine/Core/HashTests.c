@@ -0,0 +1,148 @@
+#include <TestHelper.h>
+
+#include <Engine/Core/Public/Hash.h>
+#include <Engine/Core/Public/Macros.h>
+
+#include <string.h>
+
+struct lluna_TestHelper_Session SessionState;
+
+static void Bytes();
+static void BytesWithSeed();
+static void Text();
+static void Streaming();
+static void StreamingDigestIsRepeatable();
+static void Crc32c();
+static void Crc32cIncremental();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Core_Hash");
+
+        lluna_TestHelper_RunTest(&SessionState, Bytes);
+        lluna_TestHelper_RunTest(&SessionState, BytesWithSeed);
+        lluna_TestHelper_RunTest(&SessionState, Text);
+        lluna_TestHelper_RunTest(&SessionState, Streaming);
+        lluna_TestHelper_RunTest(&SessionState, StreamingDigestIsRepeatable);
+        lluna_TestHelper_RunTest(&SessionState, Crc32c);
+        lluna_TestHelper_RunTest(&SessionState, Crc32cIncremental);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+static void FillPattern(byte* Data, uint64 Size)
+{
+        for (uint64 Index = 0; Index < Size; ++Index)
+        {
+                Data[Index] = (byte)(Index * 31 + 7);
+        }
+}
+
+// Expected values come from the reference XXH3 implementation, covering every input size class.
+static const uint64 PatternSizes[] = { 3, 8, 16, 100, 200, 1000, 5000 };
+static const uint64 PatternHashes[] = {
+        0x15F7093B173D005CULL, 0xDEC6A9A43575982EULL, 0x7E484C18D74895D0ULL, 0x8C97158042FBF926ULL,
+        0x12FDB864685F344DULL, 0x989765D0EA7A5ECDULL, 0x559FFF92C2B7F8EEULL
+};
+static const uint64 PatternSeededHashes[] = {
+        0xC346703E89724621ULL, 0x7C0157EB7F10B31EULL, 0x8009E9A002635E50ULL, 0xF6EE393A1C5034E5ULL,
+        0x53A1B2C224F74B53ULL, 0x618E4762E4106F72ULL, 0x89178E6D78B92FD6ULL
+};
+#define PatternSeed 0x4C6C756E61ULL
+
+static void Bytes()
+{
+        static byte Data[5000];
+        FillPattern(Data, sizeof(Data));
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Hash_Bytes(NULL, 0, 0), 0x2D06800538D394C2ULL, &SessionState, "Bytes returned a wrong hash for empty input.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Hash_Bytes("abc", 3, 0), 0x78AF5F94892F3950ULL, &SessionState, "Bytes returned a wrong hash for \"abc\".");
+
+        for (uint32 Index = 0; Index < sizeof(PatternSizes) / sizeof(PatternSizes[0]); ++Index)
+        {
+                lluna_TestHelper_CheckEqual(lluna_Core_Hash_Bytes(Data, PatternSizes[Index], 0), PatternHashes[Index], &SessionState, "Bytes returned a wrong hash.");
+        }
+}
+
+static void BytesWithSeed()
+{
+        static byte Data[5000];
+        FillPattern(Data, sizeof(Data));
+
+        for (uint32 Index = 0; Index < sizeof(PatternSizes) / sizeof(PatternSizes[0]); ++Index)
+        {
+                lluna_TestHelper_CheckEqual(lluna_Core_Hash_Bytes(Data, PatternSizes[Index], PatternSeed), PatternSeededHashes[Index], &SessionState, "Bytes returned a wrong seeded hash.");
+        }
+}
+
+static void Text()
+{
+        lluna_TestHelper_CheckEqual(lluna_Core_Hash_Text(lluna_Macros_Text("Lluna plena"), 0), 0x414DFEB35C56D9EEULL, &SessionState, "Text returned a wrong hash.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Hash_Text(lluna_Macros_Text("abc"), 0), lluna_Core_Hash_Bytes("abc", 3, 0), &SessionState, "Text hashed the null terminator.");
+}
+
+static void Streaming()
+{
+        static byte Data[5000];
+        FillPattern(Data, sizeof(Data));
+
+        // Odd chunk sizes make updates straddle the internal buffer and block boundaries.
+        const uint64 ChunkSizes[] = { 1, 7, 63, 64, 65, 255, 256, 257, 1500 };
+        for (uint32 Chunk = 0; Chunk < sizeof(ChunkSizes) / sizeof(ChunkSizes[0]); ++Chunk)
+        {
+                for (uint32 Index = 0; Index < sizeof(PatternSizes) / sizeof(PatternSizes[0]); ++Index)
+                {
+                        struct lluna_Core_Hash_State State;
+                        lluna_Core_Hash_Initialize(&State, PatternSeed);
+
+                        for (uint64 Offset = 0; Offset < PatternSizes[Index]; Offset += ChunkSizes[Chunk])
+                        {
+                                uint64 Size = PatternSizes[Index] - Offset < ChunkSizes[Chunk] ? PatternSizes[Index] - Offset : ChunkSizes[Chunk];
+                                lluna_Core_Hash_Update(&State, Data + Offset, Size);
+                        }
+
+                        lluna_TestHelper_CheckEqual(lluna_Core_Hash_Digest(&State), PatternSeededHashes[Index], &SessionState, "Digest differs from the one shot hash.");
+                }
+        }
+}
+
+static void StreamingDigestIsRepeatable()
+{
+        static byte Data[1000];
+        FillPattern(Data, sizeof(Data));
+
+        struct lluna_Core_Hash_State State;
+        lluna_Core_Hash_Initialize(&State, 0);
+        lluna_TestHelper_CheckEqual(lluna_Core_Hash_Digest(&State), 0x2D06800538D394C2ULL, &SessionState, "Digest of an empty state is wrong.");
+
+        lluna_Core_Hash_Update(&State, Data, 500);
+        lluna_TestHelper_CheckEqual(lluna_Core_Hash_Digest(&State), lluna_Core_Hash_Bytes(Data, 500, 0), &SessionState, "Digest of a partial input is wrong.");
+
+        lluna_Core_Hash_Update(&State, Data + 500, 500);
+        lluna_TestHelper_CheckEqual(lluna_Core_Hash_Digest(&State), PatternHashes[5], &SessionState, "Digest after continuing is wrong.");
+}
+
+static void Crc32c()
+{
+        lluna_TestHelper_CheckEqual(lluna_Core_Hash_Crc32c(0, NULL, 0), 0, &SessionState, "Crc32c of empty input is not 0.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Hash_Crc32c(0, "123456789", 9), 0xE3069283U, &SessionState, "Crc32c returned a wrong check value.");
+
+        byte Zeros[32];
+        memset(Zeros, 0, sizeof(Zeros));
+        lluna_TestHelper_CheckEqual(lluna_Core_Hash_Crc32c(0, Zeros, sizeof(Zeros)), 0x8A9136AAU, &SessionState, "Crc32c returned a wrong checksum for zeros.");
+}
+
+static void Crc32cIncremental()
+{
+        static byte Data[1000];
+        FillPattern(Data, sizeof(Data));
+
+        uint32 Checksum = 0;
+        for (uint64 Offset = 0; Offset < sizeof(Data); Offset += 37)
+        {
+                uint64 Size = sizeof(Data) - Offset < 37 ? sizeof(Data) - Offset : 37;
+                Checksum = lluna_Core_Hash_Crc32c(Checksum, Data + Offset, Size);
+        }
+
+        lluna_TestHelper_CheckEqual(Checksum, lluna_Core_Hash_Crc32c(0, Data, sizeof(Data)), &SessionState, "Crc32c differs when computed incrementally.");
+}
@@ -0,0 +1,283 @@
+#include <TestHelper.h>
+
+// Containers only track their memory when the build enables tracking.
+#if defined(LLUNA_MEMORY_TRACKING)
+#define TrackedBuild
+#endif
+
+// The macros are tested whether or not the build enables memory tracking.
+#if !defined(LLUNA_MEMORY_TRACKING)
+#define LLUNA_MEMORY_TRACKING
+#endif
+
+#include <Engine/Core/Public/Memory.h>
+#include <Engine/Container/Public/DynamicArray.h>
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define ThreadCount 4
+#define AllocationsPerThread 1000
+
+struct lluna_TestHelper_Session SessionState;
+
+static void AllocateAndFree();
+static void Reallocate();
+static void Scopes();
+static void Budgets();
+static void Threads();
+static void Containers();
+static void Tags();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Core_Memory");
+
+        lluna_TestHelper_RunTest(&SessionState, AllocateAndFree);
+        lluna_TestHelper_RunTest(&SessionState, Reallocate);
+        lluna_TestHelper_RunTest(&SessionState, Scopes);
+        lluna_TestHelper_RunTest(&SessionState, Budgets);
+        lluna_TestHelper_RunTest(&SessionState, Threads);
+        lluna_TestHelper_RunTest(&SessionState, Containers);
+        // Fills the tag table, so it runs last.
+        lluna_TestHelper_RunTest(&SessionState, Tags);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+static struct lluna_Core_Memory_Stats StatsOf(uint32 Tag)
+{
+        struct lluna_Core_Memory_Stats Stats;
+        memset(&Stats, 0, sizeof(Stats));
+        lluna_Core_Memory_GetStats(Tag, &Stats);
+
+        return Stats;
+}
+
+static void AllocateAndFree()
+{
+        uint32 Tag = lluna_Core_Memory_RegisterTag("Tests", "AllocateAndFree");
+
+        byte* Small = lluna_Core_Memory_Allocate(10, Tag);
+        byte* Large = lluna_Core_Memory_Allocate(1000, Tag);
+        byte* Empty = lluna_Core_Memory_Allocate(0, Tag);
+        lluna_TestHelper_CheckEqual((uintptr_t)Small % 16, 0, &SessionState, "Allocation is not aligned like malloc.");
+        memset(Small, 1, 10);
+        memset(Large, 2, 1000);
+
+        struct lluna_Core_Memory_Stats Stats = StatsOf(Tag);
+        lluna_TestHelper_CheckEqual(strcmp(Stats.Module, "Tests"), 0, &SessionState, "Module was not kept.");
+        lluna_TestHelper_CheckEqual(strcmp(Stats.Name, "AllocateAndFree"), 0, &SessionState, "Name was not kept.");
+        lluna_TestHelper_CheckEqual(Stats.CurrentBytes, 1010, &SessionState, "Wrong current bytes.");
+        lluna_TestHelper_CheckEqual(Stats.PeakBytes, 1010, &SessionState, "Wrong peak bytes.");
+        lluna_TestHelper_CheckEqual(Stats.TotalBytes, 1010, &SessionState, "Wrong total bytes.");
+        lluna_TestHelper_CheckEqual(Stats.Allocations, 3, &SessionState, "Wrong number of allocations.");
+        lluna_TestHelper_CheckEqual(Stats.Histogram[0], 1, &SessionState, "Empty allocation in the wrong bucket.");
+        lluna_TestHelper_CheckEqual(Stats.Histogram[4], 1, &SessionState, "10 bytes in the wrong bucket.");
+        lluna_TestHelper_CheckEqual(Stats.Histogram[10], 1, &SessionState, "1000 bytes in the wrong bucket.");
+
+        lluna_Core_Memory_Free(Small);
+        lluna_Core_Memory_Free(Large);
+        lluna_Core_Memory_Free(Empty);
+        lluna_Core_Memory_Free(NULL);
+
+        Stats = StatsOf(Tag);
+        lluna_TestHelper_CheckEqual(Stats.CurrentBytes, 0, &SessionState, "Frees were not counted.");
+        lluna_TestHelper_CheckEqual(Stats.PeakBytes, 1010, &SessionState, "Peak was lowered by frees.");
+        lluna_TestHelper_CheckEqual(Stats.Frees, 3, &SessionState, "Wrong number of frees.");
+}
+
+static void Reallocate()
+{
+        uint32 Tag = lluna_Core_Memory_RegisterTag("Tests", "Reallocate");
+
+        byte* Data = lluna_Core_Memory_Reallocate(NULL, 100, Tag);
+        for (uint32 Index = 0; Index < 100; ++Index)
+        {
+                Data[Index] = (byte)Index;
+        }
+
+        Data = lluna_Core_Memory_Reallocate(Data, 300, Tag);
+        struct lluna_Core_Memory_Stats Stats = StatsOf(Tag);
+        lluna_TestHelper_CheckEqual(Data[99], 99, &SessionState, "Contents were not kept.");
+        lluna_TestHelper_CheckEqual(Stats.CurrentBytes, 300, &SessionState, "Growth was not counted.");
+        lluna_TestHelper_CheckEqual(Stats.TotalBytes, 300, &SessionState, "Growth was not added to the total.");
+        lluna_TestHelper_CheckEqual(Stats.Allocations, 1, &SessionState, "Reallocation from NULL was not an allocation.");
+        lluna_TestHelper_CheckEqual(Stats.Reallocations, 1, &SessionState, "Reallocation was not counted.");
+
+        Data = lluna_Core_Memory_Reallocate(Data, 50, Tag);
+        Stats = StatsOf(Tag);
+        lluna_TestHelper_CheckEqual(Stats.CurrentBytes, 50, &SessionState, "Shrinking was not counted.");
+        lluna_TestHelper_CheckEqual(Stats.PeakBytes, 300, &SessionState, "Peak was lowered by shrinking.");
+        lluna_TestHelper_CheckEqual(Stats.TotalBytes, 300, &SessionState, "Shrinking changed the total.");
+
+        lluna_Core_Memory_Free(Data);
+        lluna_TestHelper_CheckEqual(StatsOf(Tag).CurrentBytes, 0, &SessionState, "Free after reallocations was miscounted.");
+}
+
+static void Scopes()
+{
+        uint32 Owner = lluna_Core_Memory_RegisterTag("Tests", "ScopeOwner");
+        uint32 Outer = lluna_Core_Memory_RegisterTag("Tests", "OuterScope");
+        uint32 Inner = lluna_Core_Memory_RegisterTag("Tests", "InnerScope");
+
+        uint32 Previous = lluna_Core_Memory_EnterScope(Outer);
+        lluna_TestHelper_CheckEqual(Previous, lluna_Core_Memory_Untagged, &SessionState, "Thread started in a scope.");
+        void* First = lluna_Core_Memory_Allocate(64, Owner);
+
+        uint32 Nested = lluna_Core_Memory_EnterScope(Inner);
+        void* Second = lluna_Core_Memory_Allocate(32, Owner);
+        void* Same = lluna_Core_Memory_Allocate(16, Inner);
+        lluna_Core_Memory_LeaveScope(Nested);
+        lluna_Core_Memory_LeaveScope(Previous);
+
+        lluna_TestHelper_CheckEqual(StatsOf(Owner).CurrentBytes, 96, &SessionState, "Scopes replaced the allocation tag.");
+        lluna_TestHelper_CheckEqual(StatsOf(Outer).CurrentBytes, 64, &SessionState, "Outer scope was miscounted.");
+        lluna_TestHelper_CheckEqual(StatsOf(Inner).CurrentBytes, 48, &SessionState, "Inner scope was miscounted.");
+        lluna_TestHelper_CheckEqual(StatsOf(Inner).Allocations, 2, &SessionState, "Scope tag counted an allocation twice.");
+
+        // Memory is freed from the tags it was allocated with, whatever the scope of the freeing thread.
+        Previous = lluna_Core_Memory_EnterScope(Outer);
+        lluna_Core_Memory_Free(Second);
+        lluna_Core_Memory_Free(Same);
+        lluna_Core_Memory_LeaveScope(Previous);
+        lluna_Core_Memory_Free(First);
+
+        lluna_TestHelper_CheckEqual(StatsOf(Owner).CurrentBytes, 0, &SessionState, "Owner tag was not freed.");
+        lluna_TestHelper_CheckEqual(StatsOf(Outer).CurrentBytes, 0, &SessionState, "Outer scope was not freed.");
+        lluna_TestHelper_CheckEqual(StatsOf(Inner).CurrentBytes, 0, &SessionState, "Inner scope was not freed.");
+        lluna_TestHelper_CheckEqual(StatsOf(Outer).Frees, 1, &SessionState, "Freeing scope was charged.");
+}
+
+static void Tags()
+{
+        struct lluna_Core_Memory_Stats Stats;
+
+        lluna_TestHelper_CheckTrue(lluna_Core_Memory_GetStats(lluna_Core_Memory_String, &Stats), &SessionState, "Built-in tag is missing.");
+        lluna_TestHelper_CheckEqual(strcmp(Stats.Module, "Container"), 0, &SessionState, "Wrong built-in module.");
+        lluna_TestHelper_CheckEqual(strcmp(Stats.Name, "String"), 0, &SessionState, "Wrong built-in name.");
+
+        uint32 Tag = lluna_Core_Memory_RegisterTag("Tests", "Tags");
+        lluna_TestHelper_CheckEqual(lluna_Core_Memory_RegisterTag("Tests", "Tags"), Tag, &SessionState, "Tag was registered twice.");
+        lluna_TestHelper_CheckNotEqual(lluna_Core_Memory_RegisterTag("Other", "Tags"), Tag, &SessionState, "Modules share tags.");
+        lluna_TestHelper_CheckEqual(Tag + 2, lluna_Core_Memory_TagCount(), &SessionState, "Wrong number of tags.");
+
+        // Unknown tags are counted as untagged.
+        uint64 Untagged = StatsOf(lluna_Core_Memory_Untagged).Allocations;
+        void* Pointer = lluna_Core_Memory_Allocate(8, lluna_Core_Memory_MaxTags + 1);
+        lluna_TestHelper_CheckEqual(StatsOf(lluna_Core_Memory_Untagged).Allocations, Untagged + 1, &SessionState, "Unknown tag was not untagged.");
+        lluna_Core_Memory_Free(Pointer);
+        lluna_TestHelper_CheckFalse(lluna_Core_Memory_GetStats(lluna_Core_Memory_TagCount(), &Stats), &SessionState, "Read an unknown tag.");
+
+        static char Names[lluna_Core_Memory_MaxTags][8];
+        for (uint32 Index = 0; Index < lluna_Core_Memory_MaxTags; ++Index)
+        {
+                snprintf(Names[Index], sizeof(Names[Index]), "Fill%u", Index);
+                lluna_Core_Memory_RegisterTag("Tests", Names[Index]);
+        }
+        lluna_TestHelper_CheckEqual(lluna_Core_Memory_TagCount(), lluna_Core_Memory_MaxTags, &SessionState, "Registered too many tags.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Memory_RegisterTag("Tests", "Overflow"), lluna_Core_Memory_Untagged, &SessionState,
+                                    "Full table returned a tag.");
+}
+
+static boolean Contains(struct lluna_Core_Types_Text Text, const char* Part)
+{
+        uint64 Length = strlen(Part);
+        for (uint64 Offset = 0; Offset + Length <= Text.Size; ++Offset)
+        {
+                if (memcmp(Text.Data + Offset, Part, Length) == 0)
+                {
+                        return true;
+                }
+        }
+
+        return false;
+}
+
+static void Budgets()
+{
+        uint32 Tag = lluna_Core_Memory_RegisterTag("Tests", "Budgets");
+        lluna_Core_Memory_RegisterTag("Tests", "Untouched");
+        lluna_Core_Memory_SetBudget(Tag, 100);
+
+        void* Pointer = lluna_Core_Memory_Allocate(80, Tag);
+        lluna_TestHelper_CheckFalse(lluna_Core_Memory_OverBudget(Tag), &SessionState, "Under budget reported over.");
+        void* Other = lluna_Core_Memory_Allocate(40, Tag);
+        lluna_Core_Memory_Free(Other);
+        lluna_TestHelper_CheckTrue(lluna_Core_Memory_OverBudget(Tag), &SessionState, "Peak over budget was not reported.");
+
+        struct lluna_Core_Writer* Output = lluna_Core_Writer_Create(lluna_Core_Writer_NoFile, lluna_Core_Writer_DefaultCapacity);
+        lluna_Core_Memory_Report(Output);
+        struct lluna_Core_Types_Text Report = lluna_Core_Writer_Text(Output);
+        lluna_TestHelper_CheckTrue(Contains(Report, "Budgets"), &SessionState, "Tag is missing from the report.");
+        lluna_TestHelper_CheckTrue(Contains(Report, "over budget"), &SessionState, "Report did not mark the tag.");
+        lluna_TestHelper_CheckTrue(Contains(Report, "Tests/Budgets sizes:"), &SessionState, "Histogram is missing from the report.");
+        lluna_TestHelper_CheckFalse(Contains(Report, "Untouched"), &SessionState, "Report listed a tag that never allocated.");
+
+        lluna_Core_Memory_ResetPeak(Tag);
+        lluna_TestHelper_CheckEqual(StatsOf(Tag).PeakBytes, 80, &SessionState, "Peak was not reset to the current bytes.");
+        lluna_TestHelper_CheckFalse(lluna_Core_Memory_OverBudget(Tag), &SessionState, "Reset peak is still over budget.");
+
+        lluna_Core_Writer_Destroy(Output);
+        lluna_Core_Memory_Free(Pointer);
+}
+
+static void* AllocateThread(void* Argument)
+{
+        uint32 Tag = *(uint32*)Argument;
+        void* Pointers[AllocationsPerThread];
+
+        for (uint32 Index = 0; Index < AllocationsPerThread; ++Index)
+        {
+                Pointers[Index] = lluna_Core_Memory_Allocate(Index % 100, Tag);
+        }
+        for (uint32 Index = 0; Index < AllocationsPerThread; ++Index)
+        {
+                lluna_Core_Memory_Free(Pointers[Index]);
+        }
+
+        return NULL;
+}
+
+static void Threads()
+{
+        uint32 Tag = lluna_Core_Memory_RegisterTag("Tests", "Threads");
+
+        pthread_t Threads[ThreadCount];
+        for (uint32 Thread = 0; Thread < ThreadCount; ++Thread)
+        {
+                pthread_create(&Threads[Thread], NULL, AllocateThread, &Tag);
+        }
+        for (uint32 Thread = 0; Thread < ThreadCount; ++Thread)
+        {
+                pthread_join(Threads[Thread], NULL);
+        }
+
+        uint64 Bytes = 0;
+        for (uint32 Index = 0; Index < AllocationsPerThread; ++Index)
+        {
+                Bytes += Index % 100;
+        }
+
+        struct lluna_Core_Memory_Stats Stats = StatsOf(Tag);
+        lluna_TestHelper_CheckEqual(Stats.Allocations, ThreadCount * AllocationsPerThread, &SessionState, "Allocations were lost.");
+        lluna_TestHelper_CheckEqual(Stats.Frees, ThreadCount * AllocationsPerThread, &SessionState, "Frees were lost.");
+        lluna_TestHelper_CheckEqual(Stats.TotalBytes, ThreadCount * Bytes, &SessionState, "Bytes were lost.");
+        lluna_TestHelper_CheckEqual(Stats.CurrentBytes, 0, &SessionState, "Current bytes drifted.");
+        lluna_TestHelper_CheckTrue(Stats.PeakBytes >= Bytes && Stats.PeakBytes <= ThreadCount * Bytes, &SessionState, "Peak is out of range.");
+}
+
+static void Containers()
+{
+#if defined(TrackedBuild)
+        uint64 Before = StatsOf(lluna_Core_Memory_DynamicArray).CurrentBytes;
+
+        struct lluna_Container_DynamicArray* Array = lluna_Container_DynamicArray_Create(16, sizeof(uint32));
+        lluna_TestHelper_CheckTrue(StatsOf(lluna_Core_Memory_DynamicArray).CurrentBytes > Before, &SessionState, "Array memory was not tagged.");
+
+        lluna_Container_DynamicArray_Destroy(Array);
+        lluna_TestHelper_CheckEqual(StatsOf(lluna_Core_Memory_DynamicArray).CurrentBytes, Before, &SessionState, "Array memory was not freed.");
+#endif
+}
@@ -0,0 +1,224 @@
+#include <TestHelper.h>
+
+#include <Engine/Container/Public/DynamicArray.h>
+#include <Engine/Core/Public/Macros.h>
+#include <Engine/Core/Public/Parse.h>
+
+#include <math.h>
+#include <string.h>
+
+struct lluna_TestHelper_Session SessionState;
+
+static void Int64();
+static void Int64Limits();
+static void Uint64();
+static void Float();
+static void FloatExponent();
+static void FloatRounding();
+static void FloatLongMantissa();
+static void FloatOutOfRange();
+static void FloatSpecial();
+static void FloatInvalid();
+static void FloatArray();
+static void FloatArrayStopsOnInvalidToken();
+
+static boolean SameBits(float Left, float Right)
+{
+        return memcmp(&Left, &Right, sizeof(float)) == 0;
+}
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Core_Parse");
+
+        lluna_TestHelper_RunTest(&SessionState, Int64);
+        lluna_TestHelper_RunTest(&SessionState, Int64Limits);
+        lluna_TestHelper_RunTest(&SessionState, Uint64);
+        lluna_TestHelper_RunTest(&SessionState, Float);
+        lluna_TestHelper_RunTest(&SessionState, FloatExponent);
+        lluna_TestHelper_RunTest(&SessionState, FloatRounding);
+        lluna_TestHelper_RunTest(&SessionState, FloatLongMantissa);
+        lluna_TestHelper_RunTest(&SessionState, FloatOutOfRange);
+        lluna_TestHelper_RunTest(&SessionState, FloatSpecial);
+        lluna_TestHelper_RunTest(&SessionState, FloatInvalid);
+        lluna_TestHelper_RunTest(&SessionState, FloatArray);
+        lluna_TestHelper_RunTest(&SessionState, FloatArrayStopsOnInvalidToken);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+static void Int64()
+{
+        int64 Value = 0;
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Int64(lluna_Macros_Text("1234567890123"), &Value), 13, &SessionState, "Int64 did not consume all digits.");
+        lluna_TestHelper_CheckEqual(Value, 1234567890123LL, &SessionState, "Int64 did not parse the proper value.");
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Int64(lluna_Macros_Text("-42 17"), &Value), 3, &SessionState, "Int64 did not stop at whitespace.");
+        lluna_TestHelper_CheckEqual(Value, -42, &SessionState, "Int64 did not parse a negative value.");
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Int64(lluna_Macros_Text("+7"), &Value), 2, &SessionState, "Int64 did not accept a plus sign.");
+        lluna_TestHelper_CheckEqual(Value, 7, &SessionState, "Int64 did not parse a value with a plus sign.");
+
+        Value = 3;
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Int64(lluna_Macros_Text("-"), &Value), 0, &SessionState, "Int64 accepted a lone sign.");
+        lluna_TestHelper_CheckEqual(Value, 3, &SessionState, "Int64 modified the value on failure.");
+}
+
+static void Int64Limits()
+{
+        int64 Value = 0;
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Int64(lluna_Macros_Text("9223372036854775807"), &Value), 19, &SessionState, "Int64 rejected the maximum value.");
+        lluna_TestHelper_CheckEqual(Value, 9223372036854775807LL, &SessionState, "Int64 did not parse the maximum value.");
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Int64(lluna_Macros_Text("-9223372036854775808"), &Value), 20, &SessionState, "Int64 rejected the minimum value.");
+        lluna_TestHelper_CheckEqual(Value, -9223372036854775807LL - 1, &SessionState, "Int64 did not parse the minimum value.");
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Int64(lluna_Macros_Text("9223372036854775808"), &Value), 0, &SessionState, "Int64 accepted an overflowing value.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Int64(lluna_Macros_Text("00000000000000000000000042"), &Value), 26, &SessionState, "Int64 rejected leading zeros.");
+        lluna_TestHelper_CheckEqual(Value, 42, &SessionState, "Int64 did not parse a value with leading zeros.");
+}
+
+static void Uint64()
+{
+        uint64 Value = 0;
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Uint64(lluna_Macros_Text("18446744073709551615"), &Value), 20, &SessionState, "Uint64 rejected the maximum value.");
+        lluna_TestHelper_CheckEqual(Value, 18446744073709551615ULL, &SessionState, "Uint64 did not parse the maximum value.");
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Uint64(lluna_Macros_Text("18446744073709551616"), &Value), 0, &SessionState, "Uint64 accepted an overflowing value.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Uint64(lluna_Macros_Text("-1"), &Value), 0, &SessionState, "Uint64 accepted a negative value.");
+}
+
+static void Float()
+{
+        float Value = 0.0f;
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Float(lluna_Macros_Text("3.14159"), &Value), 7, &SessionState, "Float did not consume all characters.");
+        lluna_TestHelper_CheckTrue(SameBits(Value, 3.14159f), &SessionState, "Float did not parse the proper value.");
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Float(lluna_Macros_Text("-0.5,"), &Value), 4, &SessionState, "Float did not stop at a separator.");
+        lluna_TestHelper_CheckTrue(SameBits(Value, -0.5f), &SessionState, "Float did not parse a negative value.");
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Float(lluna_Macros_Text(".25"), &Value), 3, &SessionState, "Float rejected a value without integer digits.");
+        lluna_TestHelper_CheckTrue(SameBits(Value, 0.25f), &SessionState, "Float did not parse a value without integer digits.");
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Float(lluna_Macros_Text("7."), &Value), 2, &SessionState, "Float rejected a value without fraction digits.");
+        lluna_TestHelper_CheckTrue(SameBits(Value, 7.0f), &SessionState, "Float did not parse a value without fraction digits.");
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Float(lluna_Macros_Text("-0"), &Value), 2, &SessionState, "Float rejected negative zero.");
+        lluna_TestHelper_CheckTrue(SameBits(Value, -0.0f), &SessionState, "Float did not keep the sign of zero.");
+}
+
+static void FloatExponent()
+{
+        float Value = 0.0f;
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Float(lluna_Macros_Text("6.02214076e23"), &Value), 13, &SessionState, "Float did not consume the exponent.");
+        lluna_TestHelper_CheckTrue(SameBits(Value, 6.02214076e23f), &SessionState, "Float did not parse a positive exponent.");
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Float(lluna_Macros_Text("1.6E-19"), &Value), 7, &SessionState, "Float did not consume an uppercase exponent.");
+        lluna_TestHelper_CheckTrue(SameBits(Value, 1.6e-19f), &SessionState, "Float did not parse a negative exponent.");
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Float(lluna_Macros_Text("2e"), &Value), 1, &SessionState, "Float consumed an exponent without digits.");
+        lluna_TestHelper_CheckTrue(SameBits(Value, 2.0f), &SessionState, "Float did not parse the value before an empty exponent.");
+}
+
+static void FloatRounding()
+{
+        float Value = 0.0f;
+
+        // 2^24 + 1 is halfway between two floats and rounds to even, 2^24 + 3 rounds up.
+        lluna_Core_Parse_Float(lluna_Macros_Text("16777217"), &Value);
+        lluna_TestHelper_CheckTrue(SameBits(Value, 16777216.0f), &SessionState, "Float did not round a halfway value to even.");
+
+        lluna_Core_Parse_Float(lluna_Macros_Text("16777219"), &Value);
+        lluna_TestHelper_CheckTrue(SameBits(Value, 16777220.0f), &SessionState, "Float did not round a halfway value up to even.");
+
+        lluna_Core_Parse_Float(lluna_Macros_Text("1.4e-45"), &Value);
+        lluna_TestHelper_CheckTrue(SameBits(Value, 1.4e-45f), &SessionState, "Float did not parse the smallest subnormal.");
+
+        lluna_Core_Parse_Float(lluna_Macros_Text("3.4028234e38"), &Value);
+        lluna_TestHelper_CheckTrue(SameBits(Value, 3.4028234e38f), &SessionState, "Float did not parse the largest float.");
+}
+
+static void FloatLongMantissa()
+{
+        float Value = 0.0f;
+
+        // Exactly halfway between 1 and the next float, then barely above it through a digit far past the 19th.
+        lluna_Core_Parse_Float(lluna_Macros_Text("1.000000059604644775390625"), &Value);
+        lluna_TestHelper_CheckTrue(SameBits(Value, 1.0f), &SessionState, "Float did not round an exact long halfway value to even.");
+
+        lluna_Core_Parse_Float(lluna_Macros_Text("1.00000005960464477539062500000000000000000001"), &Value);
+        lluna_TestHelper_CheckTrue(SameBits(Value, 1.00000011920928955078125f), &SessionState, "Float did not round up a value slightly above halfway.");
+
+        lluna_Core_Parse_Float(lluna_Macros_Text("0.00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000123e300"), &Value);
+        lluna_TestHelper_CheckTrue(SameBits(Value, 1.23f), &SessionState, "Float did not handle many leading zeros.");
+}
+
+static void FloatOutOfRange()
+{
+        float Value = 0.0f;
+
+        lluna_Core_Parse_Float(lluna_Macros_Text("1e39"), &Value);
+        lluna_TestHelper_CheckTrue(SameBits(Value, INFINITY), &SessionState, "Float did not overflow to infinity.");
+
+        lluna_Core_Parse_Float(lluna_Macros_Text("-1e-50"), &Value);
+        lluna_TestHelper_CheckTrue(SameBits(Value, -0.0f), &SessionState, "Float did not underflow to zero.");
+
+        lluna_Core_Parse_Float(lluna_Macros_Text("1e999999999999"), &Value);
+        lluna_TestHelper_CheckTrue(SameBits(Value, INFINITY), &SessionState, "Float did not handle a huge exponent.");
+}
+
+static void FloatSpecial()
+{
+        float Value = 0.0f;
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Float(lluna_Macros_Text("-Infinity"), &Value), 9, &SessionState, "Float did not consume infinity.");
+        lluna_TestHelper_CheckTrue(SameBits(Value, -INFINITY), &SessionState, "Float did not parse negative infinity.");
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Float(lluna_Macros_Text("inf"), &Value), 3, &SessionState, "Float did not consume inf.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Float(lluna_Macros_Text("NaN"), &Value), 3, &SessionState, "Float did not consume nan.");
+        lluna_TestHelper_CheckTrue(Value != Value, &SessionState, "Float did not parse nan.");
+}
+
+static void FloatInvalid()
+{
+        float Value = 1.0f;
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Float(lluna_Macros_Text(""), &Value), 0, &SessionState, "Float accepted empty text.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Float(lluna_Macros_Text("."), &Value), 0, &SessionState, "Float accepted a lone point.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Float(lluna_Macros_Text("-e5"), &Value), 0, &SessionState, "Float accepted a value without digits.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Parse_Float(lluna_Macros_Text(" 1"), &Value), 0, &SessionState, "Float skipped leading whitespace.");
+        lluna_TestHelper_CheckTrue(SameBits(Value, 1.0f), &SessionState, "Float modified the value on failure.");
+}
+
+static void FloatArray()
+{
+        float Expected[] = { 1.0f, -2.5f, 3e-3f, 0.125f, 1e10f };
+
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_Create(2, sizeof(float));
+
+        struct lluna_Core_Types_Text Text = lluna_Macros_Text("  1 -2.5\t3e-3\n0.125\r\n1e10 ");
+        uint64 Consumed = lluna_Core_Parse_FloatArray(Text, DynamicArray);
+
+        lluna_TestHelper_CheckEqual(Consumed, lluna_Macros_TextLength(Text), &SessionState, "FloatArray did not consume the whole text.");
+        lluna_TestHelper_CheckEqual(lluna_Container_DynamicArray_Count(DynamicArray), 5, &SessionState, "FloatArray did not append every value.");
+        lluna_TestHelper_CheckEqual(memcmp(DynamicArray->Data, Expected, sizeof(Expected)), 0, &SessionState, "FloatArray did not parse the proper values.");
+
+        lluna_Container_DynamicArray_Destroy(DynamicArray);
+}
+
+static void FloatArrayStopsOnInvalidToken()
+{
+        struct lluna_Container_DynamicArray* DynamicArray = lluna_Container_DynamicArray_Create(2, sizeof(float));
+
+        uint64 Consumed = lluna_Core_Parse_FloatArray(lluna_Macros_Text("0.5 1.5 2/3 4"), DynamicArray);
+
+        lluna_TestHelper_CheckEqual(Consumed, 8, &SessionState, "FloatArray did not stop before the invalid token.");
+        lluna_TestHelper_CheckEqual(lluna_Container_DynamicArray_Count(DynamicArray), 2, &SessionState, "FloatArray appended past the invalid token.");
+
+        lluna_Container_DynamicArray_Destroy(DynamicArray);
+}
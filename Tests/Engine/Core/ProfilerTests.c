@@ -0,0 +1,310 @@
+#include <TestHelper.h>
+
+// The macros are tested whether or not the build enables profiling.
+#if !defined(LLUNA_PROFILING)
+#define LLUNA_PROFILING
+#endif
+
+#include <Engine/Core/Public/Profiler.h>
+
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+#define ThreadCount 4
+#define ZonesPerThread 100
+
+struct lluna_TestHelper_Session SessionState;
+
+static void Zones();
+static void Threads();
+static void Overflow();
+static void Timestamps();
+static void ChromeTrace();
+static void BinaryRoundTrip();
+static void InvalidBinary();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Core_Profiler");
+
+        lluna_TestHelper_RunTest(&SessionState, Zones);
+        lluna_TestHelper_RunTest(&SessionState, Threads);
+        lluna_TestHelper_RunTest(&SessionState, Overflow);
+        lluna_TestHelper_RunTest(&SessionState, Timestamps);
+        lluna_TestHelper_RunTest(&SessionState, ChromeTrace);
+        lluna_TestHelper_RunTest(&SessionState, BinaryRoundTrip);
+        lluna_TestHelper_RunTest(&SessionState, InvalidBinary);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+// Collects whatever earlier tests left behind, so each test starts from empty rings.
+static struct lluna_Core_Profiler_Capture* StartCapture()
+{
+        struct lluna_Core_Profiler_Capture* Capture = lluna_Core_Profiler_CreateCapture();
+        lluna_Core_Profiler_Collect(Capture);
+        lluna_Core_Profiler_ClearCapture(Capture);
+
+        return Capture;
+}
+
+static void RecordFrame(int64 Value)
+{
+        lluna_Core_Profiler_Begin("Outer");
+        {
+                lluna_Core_Profiler_Zone("Inner");
+                lluna_Core_Profiler_Count("Counter", Value);
+        }
+        lluna_Core_Profiler_End();
+        lluna_Core_Profiler_Frame();
+}
+
+static void Zones()
+{
+        struct lluna_Core_Profiler_Capture* Capture = StartCapture();
+
+        RecordFrame(-42);
+        lluna_Core_Profiler_Collect(Capture);
+
+        const uint32 Types[6] = {
+                lluna_Core_Profiler_EventBegin, lluna_Core_Profiler_EventBegin, lluna_Core_Profiler_EventCounter,
+                lluna_Core_Profiler_EventEnd, lluna_Core_Profiler_EventEnd, lluna_Core_Profiler_EventFrame
+        };
+        const char* Names[6] = { "Outer", "Inner", "Counter", NULL, NULL, NULL };
+
+        lluna_TestHelper_CheckEqual(Capture->Count, 6, &SessionState, "Wrong number of events.");
+        lluna_TestHelper_CheckEqual(Capture->Dropped, 0, &SessionState, "Events were dropped.");
+        for (uint32 Index = 0; Index < 6 && Index < Capture->Count; ++Index)
+        {
+                struct lluna_Core_Profiler_Event* Event = &Capture->Events[Index];
+                lluna_TestHelper_CheckEqual(Event->Type, Types[Index], &SessionState, "Events out of order.");
+                lluna_TestHelper_CheckEqual(Event->Name, Names[Index], &SessionState, "Name was not kept.");
+                lluna_TestHelper_CheckEqual(Event->Thread, Capture->Events[0].Thread, &SessionState, "Events came from different threads.");
+                if (Index > 0)
+                {
+                        lluna_TestHelper_CheckTrue(Event->Timestamp >= Capture->Events[Index - 1].Timestamp, &SessionState, "Time went backwards.");
+                }
+        }
+        lluna_TestHelper_CheckEqual(Capture->Events[2].Value, -42, &SessionState, "Counter value was not kept.");
+
+        lluna_Core_Profiler_Collect(Capture);
+        lluna_TestHelper_CheckEqual(Capture->Count, 6, &SessionState, "Events were collected twice.");
+
+        lluna_Core_Profiler_DestroyCapture(Capture);
+}
+
+static void* RecordThread(void* Argument)
+{
+        lluna_Core_Profiler_NameThread((const char*)Argument);
+        for (uint32 Zone = 0; Zone < ZonesPerThread; ++Zone)
+        {
+                lluna_Core_Profiler_Begin("Work");
+                lluna_Core_Profiler_End();
+        }
+
+        return NULL;
+}
+
+static void Threads()
+{
+        static const char* ThreadNames[ThreadCount] = { "First", "Second", "Third", "Fourth" };
+        struct lluna_Core_Profiler_Capture* Capture = StartCapture();
+
+        pthread_t Threads[ThreadCount];
+        for (uint32 Thread = 0; Thread < ThreadCount; ++Thread)
+        {
+                pthread_create(&Threads[Thread], NULL, RecordThread, (void*)ThreadNames[Thread]);
+        }
+        for (uint32 Thread = 0; Thread < ThreadCount; ++Thread)
+        {
+                pthread_join(Threads[Thread], NULL);
+        }
+        lluna_Core_Profiler_Collect(Capture);
+
+        lluna_TestHelper_CheckEqual(Capture->Count, ThreadCount * (2 * ZonesPerThread + 1), &SessionState, "Events were lost.");
+
+        // Each thread's events are collected together, starting with its name.
+        uint32 Named = 0;
+        for (uint64 Index = 0; Index < Capture->Count; ++Index)
+        {
+                struct lluna_Core_Profiler_Event* Event = &Capture->Events[Index];
+                if (Event->Type != lluna_Core_Profiler_EventThreadName)
+                {
+                        continue;
+                }
+
+                ++Named;
+                lluna_TestHelper_CheckTrue(Index + 2 * ZonesPerThread < Capture->Count, &SessionState, "Thread events were split.");
+                for (uint64 Offset = 1; Offset <= 2 * ZonesPerThread && Index + Offset < Capture->Count; ++Offset)
+                {
+                        lluna_TestHelper_CheckEqual(Capture->Events[Index + Offset].Thread, Event->Thread, &SessionState, "Thread events were mixed.");
+                }
+                for (uint64 Other = 0; Other < Index; ++Other)
+                {
+                        lluna_TestHelper_CheckNotEqual(Capture->Events[Other].Thread, Event->Thread, &SessionState, "Threads shared an index.");
+                }
+        }
+        lluna_TestHelper_CheckEqual(Named, ThreadCount, &SessionState, "Thread names were lost.");
+
+        lluna_Core_Profiler_DestroyCapture(Capture);
+}
+
+static void Overflow()
+{
+        struct lluna_Core_Profiler_Capture* Capture = StartCapture();
+
+        for (uint32 Index = 0; Index < lluna_Core_Profiler_RingCapacity + 10; ++Index)
+        {
+                lluna_Core_Profiler_Count("Index", Index);
+        }
+        lluna_Core_Profiler_Collect(Capture);
+
+        lluna_TestHelper_CheckEqual(Capture->Count, lluna_Core_Profiler_RingCapacity, &SessionState, "Full ring kept recording.");
+        lluna_TestHelper_CheckEqual(Capture->Dropped, 10, &SessionState, "Dropped events were not counted.");
+        lluna_TestHelper_CheckEqual(Capture->Events[Capture->Count - 1].Value, lluna_Core_Profiler_RingCapacity - 1, &SessionState,
+                                    "Dropped the oldest events instead of the newest.");
+
+        // Collecting makes room again, and the ring wraps around.
+        lluna_Core_Profiler_ClearCapture(Capture);
+        for (uint32 Index = 0; Index < 100; ++Index)
+        {
+                lluna_Core_Profiler_Count("Index", Index);
+        }
+        lluna_Core_Profiler_Collect(Capture);
+        lluna_TestHelper_CheckEqual(Capture->Count, 100, &SessionState, "Ring did not recover.");
+        lluna_TestHelper_CheckEqual(Capture->Dropped, 0, &SessionState, "Dropped count was not reset.");
+        lluna_TestHelper_CheckEqual(Capture->Events[99].Value, 99, &SessionState, "Wrapped events were not kept.");
+
+        lluna_Core_Profiler_DestroyCapture(Capture);
+}
+
+static void Timestamps()
+{
+        double TicksPerSecond = lluna_Core_Profiler_TicksPerSecond();
+        lluna_TestHelper_CheckTrue(TicksPerSecond > 1e6, &SessionState, "Timer is too coarse.");
+
+        struct timespec Sleep = { 0, 20000000 };
+        uint64 Start = lluna_Core_Profiler_Now();
+        nanosleep(&Sleep, NULL);
+        double Elapsed = (double)(lluna_Core_Profiler_Now() - Start) / TicksPerSecond;
+
+        lluna_TestHelper_CheckTrue(Elapsed >= 0.015 && Elapsed < 1.0, &SessionState, "Ticks don't match the elapsed time.");
+}
+
+static boolean Contains(struct lluna_Core_Types_Text Text, const char* Part)
+{
+        uint64 Length = strlen(Part);
+        for (uint64 Offset = 0; Offset + Length <= Text.Size; ++Offset)
+        {
+                if (memcmp(Text.Data + Offset, Part, Length) == 0)
+                {
+                        return true;
+                }
+        }
+
+        return false;
+}
+
+static void ChromeTrace()
+{
+        struct lluna_Core_Profiler_Capture* Capture = StartCapture();
+
+        lluna_Core_Profiler_NameThread("Main");
+        lluna_Core_Profiler_Begin("Say \"hi\"\n");
+        lluna_Core_Profiler_Count("Entities", 1024);
+        lluna_Core_Profiler_End();
+        lluna_Core_Profiler_Frame();
+        lluna_Core_Profiler_Collect(Capture);
+
+        struct lluna_Core_Writer* Output = lluna_Core_Writer_Create(lluna_Core_Writer_NoFile, 64);
+        lluna_Core_Profiler_WriteChromeTrace(Capture, Output);
+        struct lluna_Core_Types_Text Text = lluna_Core_Writer_Text(Output);
+
+        lluna_TestHelper_CheckTrue(Contains(Text, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":["), &SessionState, "Missing trace header.");
+        lluna_TestHelper_CheckTrue(Contains(Text, "\"ph\":\"M\",\"name\":\"thread_name\",\"args\":{\"name\":\"Main\"}"), &SessionState,
+                                   "Missing thread name.");
+        lluna_TestHelper_CheckTrue(Contains(Text, "\"ph\":\"B\",\"name\":\"Say \\\"hi\\\"\\u000a\""), &SessionState, "Name was not escaped.");
+        lluna_TestHelper_CheckTrue(Contains(Text, "\"ph\":\"C\",\"name\":\"Entities\",\"args\":{\"value\":1024}"), &SessionState,
+                                   "Missing counter.");
+        lluna_TestHelper_CheckTrue(Contains(Text, "\"ph\":\"E\""), &SessionState, "Missing end of zone.");
+        lluna_TestHelper_CheckTrue(Contains(Text, "\"ph\":\"i\",\"s\":\"g\",\"name\":\"Frame\""), &SessionState, "Missing frame marker.");
+        lluna_TestHelper_CheckTrue(Contains(Text, "\"ts\":0.000}"), &SessionState, "Time does not start at the first event.");
+        lluna_TestHelper_CheckTrue(Text.Size >= 3 && memcmp(Text.Data + Text.Size - 3, "]}\n", 3) == 0, &SessionState, "Trace was not closed.");
+
+        lluna_Core_Writer_Destroy(Output);
+        lluna_Core_Profiler_DestroyCapture(Capture);
+}
+
+static void BinaryRoundTrip()
+{
+        struct lluna_Core_Profiler_Capture* Capture = StartCapture();
+
+        lluna_Core_Profiler_NameThread("Main");
+        for (int64 Frame = 0; Frame < 100; ++Frame)
+        {
+                RecordFrame(Frame * 1000 - 50000);
+        }
+        lluna_Core_Profiler_Collect(Capture);
+        Capture->Dropped = 7;
+
+        struct lluna_Core_Writer* Output = lluna_Core_Writer_Create(lluna_Core_Writer_NoFile, 64);
+        lluna_Core_Profiler_WriteBinary(Capture, Output);
+        struct lluna_Core_Types_Text Binary = lluna_Core_Writer_Text(Output);
+
+        lluna_TestHelper_CheckTrue(Binary.Size < Capture->Count * 8, &SessionState, "Binary capture is not compact.");
+
+        struct lluna_Core_Profiler_Capture* Read = lluna_Core_Profiler_CreateCapture();
+        lluna_TestHelper_CheckTrue(lluna_Core_Profiler_ReadBinary(Read, (const byte*)Binary.Data, Binary.Size), &SessionState,
+                                   "Binary capture was not read.");
+        lluna_TestHelper_CheckEqual(Read->Count, Capture->Count, &SessionState, "Event count changed.");
+        lluna_TestHelper_CheckEqual(Read->Dropped, 7, &SessionState, "Dropped count changed.");
+        lluna_TestHelper_CheckTrue(Read->TicksPerSecond == Capture->TicksPerSecond, &SessionState, "Rate changed.");
+
+        for (uint64 Index = 0; Index < Capture->Count && Index < Read->Count; ++Index)
+        {
+                struct lluna_Core_Profiler_Event* Expected = &Capture->Events[Index];
+                struct lluna_Core_Profiler_Event* Event = &Read->Events[Index];
+
+                lluna_TestHelper_CheckEqual(Event->Timestamp, Expected->Timestamp, &SessionState, "Timestamp changed.");
+                lluna_TestHelper_CheckEqual(Event->Type, Expected->Type, &SessionState, "Type changed.");
+                lluna_TestHelper_CheckEqual(Event->Thread, Expected->Thread, &SessionState, "Thread changed.");
+                lluna_TestHelper_CheckEqual(Event->Value, Expected->Value, &SessionState, "Value changed.");
+                lluna_TestHelper_CheckTrue(Expected->Name ? Event->Name && strcmp(Event->Name, Expected->Name) == 0 : !Event->Name, &SessionState,
+                                           "Name changed.");
+        }
+
+        lluna_Core_Writer_Destroy(Output);
+        lluna_Core_Profiler_DestroyCapture(Read);
+        lluna_Core_Profiler_DestroyCapture(Capture);
+}
+
+static void InvalidBinary()
+{
+        struct lluna_Core_Profiler_Capture* Capture = StartCapture();
+
+        RecordFrame(1);
+        lluna_Core_Profiler_Collect(Capture);
+
+        struct lluna_Core_Writer* Output = lluna_Core_Writer_Create(lluna_Core_Writer_NoFile, 64);
+        lluna_Core_Profiler_WriteBinary(Capture, Output);
+        struct lluna_Core_Types_Text Binary = lluna_Core_Writer_Text(Output);
+
+        // Every truncation has to be rejected without touching the capture.
+        struct lluna_Core_Profiler_Capture* Read = lluna_Core_Profiler_CreateCapture();
+        lluna_TestHelper_CheckTrue(lluna_Core_Profiler_ReadBinary(Read, (const byte*)Binary.Data, Binary.Size), &SessionState,
+                                   "Binary capture was not read.");
+        for (uint64 Size = 0; Size < Binary.Size; ++Size)
+        {
+                lluna_TestHelper_CheckFalse(lluna_Core_Profiler_ReadBinary(Read, (const byte*)Binary.Data, Size), &SessionState,
+                                            "Truncated capture was read.");
+        }
+        lluna_TestHelper_CheckEqual(Read->Count, Capture->Count, &SessionState, "Rejected capture changed the events.");
+
+        byte Corrupted[4] = { 'L', 'L', 'P', 'X' };
+        lluna_TestHelper_CheckFalse(lluna_Core_Profiler_ReadBinary(Read, Corrupted, sizeof(Corrupted)), &SessionState, "Wrong magic was read.");
+
+        lluna_Core_Writer_Destroy(Output);
+        lluna_Core_Profiler_DestroyCapture(Read);
+        lluna_Core_Profiler_DestroyCapture(Capture);
+}
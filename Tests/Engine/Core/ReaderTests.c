@@ -0,0 +1,203 @@
+#include <TestHelper.h>
+
+#include <Engine/Core/Public/Macros.h>
+#include <Engine/Core/Public/Reader.h>
+
+#include <stdio.h>
+#include <string.h>
+
+struct lluna_TestHelper_Session SessionState;
+
+static void ReadLines();
+static void ReadLinesWithCarriageReturns();
+static void ReadRecords();
+static void ReadEmpty();
+static void ReadAcrossBlocks();
+static void ReadLongRecords();
+static void ReadMapped();
+static void ReadRemaining();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Core_Reader");
+
+        lluna_TestHelper_RunTest(&SessionState, ReadLines);
+        lluna_TestHelper_RunTest(&SessionState, ReadLinesWithCarriageReturns);
+        lluna_TestHelper_RunTest(&SessionState, ReadRecords);
+        lluna_TestHelper_RunTest(&SessionState, ReadEmpty);
+        lluna_TestHelper_RunTest(&SessionState, ReadAcrossBlocks);
+        lluna_TestHelper_RunTest(&SessionState, ReadLongRecords);
+        lluna_TestHelper_RunTest(&SessionState, ReadMapped);
+        lluna_TestHelper_RunTest(&SessionState, ReadRemaining);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+static boolean TextEquals(struct lluna_Core_Types_Text Text, const char* Expected)
+{
+        return Text.Size == strlen(Expected) && memcmp(Text.Data, Expected, Text.Size) == 0;
+}
+
+static FILE* CreateFile(const char* Contents, uint64 Size)
+{
+        FILE* File = tmpfile();
+        if (File)
+        {
+                fwrite(Contents, 1, Size, File);
+                fflush(File);
+                fseek(File, 0, SEEK_SET);
+        }
+
+        return File;
+}
+
+static void ReadLines()
+{
+        struct lluna_Core_Reader* Reader = lluna_Core_Reader_CreateFromText(lluna_Macros_Text("first\n\nthird\nlast"));
+        struct lluna_Core_Types_Text Line;
+
+        lluna_TestHelper_CheckTrue(lluna_Core_Reader_ReadLine(Reader, &Line) && TextEquals(Line, "first"), &SessionState, "First line is wrong.");
+        lluna_TestHelper_CheckTrue(lluna_Core_Reader_ReadLine(Reader, &Line) && TextEquals(Line, ""), &SessionState, "Empty line is wrong.");
+        lluna_TestHelper_CheckTrue(lluna_Core_Reader_ReadLine(Reader, &Line) && TextEquals(Line, "third"), &SessionState, "Third line is wrong.");
+        lluna_TestHelper_CheckTrue(lluna_Core_Reader_ReadLine(Reader, &Line) && TextEquals(Line, "last"), &SessionState, "Unterminated last line is wrong.");
+        lluna_TestHelper_CheckFalse(lluna_Core_Reader_ReadLine(Reader, &Line), &SessionState, "Read past the end.");
+
+        lluna_Core_Reader_Destroy(Reader);
+}
+
+static void ReadLinesWithCarriageReturns()
+{
+        struct lluna_Core_Reader* Reader = lluna_Core_Reader_CreateFromText(lluna_Macros_Text("v 1 2 3\r\nf 1 2 3\r\n"));
+        struct lluna_Core_Types_Text Line;
+
+        lluna_TestHelper_CheckTrue(lluna_Core_Reader_ReadLine(Reader, &Line) && TextEquals(Line, "v 1 2 3"), &SessionState, "Carriage return was kept.");
+        lluna_TestHelper_CheckTrue(lluna_Core_Reader_ReadLine(Reader, &Line) && TextEquals(Line, "f 1 2 3"), &SessionState, "Second line is wrong.");
+        lluna_TestHelper_CheckFalse(lluna_Core_Reader_ReadLine(Reader, &Line), &SessionState, "Trailing newline produced an extra line.");
+
+        lluna_Core_Reader_Destroy(Reader);
+}
+
+static void ReadRecords()
+{
+        struct lluna_Core_Reader* Reader = lluna_Core_Reader_CreateFromText(lluna_Macros_Text("a,bc,,d"));
+        struct lluna_Core_Types_Text Record;
+        const char* Expected[] = { "a", "bc", "", "d" };
+
+        for (uint32 Index = 0; Index < 4; ++Index)
+        {
+                lluna_TestHelper_CheckTrue(lluna_Core_Reader_ReadRecord(Reader, ',', &Record) && TextEquals(Record, Expected[Index]), &SessionState, "Record is wrong.");
+        }
+        lluna_TestHelper_CheckFalse(lluna_Core_Reader_ReadRecord(Reader, ',', &Record), &SessionState, "Read past the end.");
+
+        lluna_Core_Reader_Destroy(Reader);
+}
+
+static void ReadEmpty()
+{
+        struct lluna_Core_Types_Text Line;
+
+        struct lluna_Core_Reader* Reader = lluna_Core_Reader_CreateFromText(lluna_Macros_Text(""));
+        lluna_TestHelper_CheckFalse(lluna_Core_Reader_ReadLine(Reader, &Line), &SessionState, "Read a line from empty text.");
+        lluna_Core_Reader_Destroy(Reader);
+
+        FILE* File = tmpfile();
+        lluna_TestHelper_CheckTrue(File != NULL, &SessionState, "Couldn't create a temporary file.");
+
+        Reader = lluna_Core_Reader_CreateMapped(fileno(File));
+        lluna_TestHelper_CheckFalse(lluna_Core_Reader_ReadLine(Reader, &Line), &SessionState, "Read a line from an empty file.");
+        lluna_Core_Reader_Destroy(Reader);
+
+        fclose(File);
+}
+
+static void ReadAcrossBlocks()
+{
+        static char Contents[8192];
+        uint64 Size = 0;
+        for (uint32 Index = 0; Index < 500; ++Index)
+        {
+                Size += sprintf(Contents + Size, "line %u\n", Index);
+        }
+
+        FILE* File = CreateFile(Contents, Size);
+        lluna_TestHelper_CheckTrue(File != NULL, &SessionState, "Couldn't create a temporary file.");
+
+        // A tiny buffer makes most lines straddle block boundaries.
+        struct lluna_Core_Reader* Reader = lluna_Core_Reader_Create(fileno(File), 7);
+        struct lluna_Core_Types_Text Line;
+        char Expected[32];
+
+        uint32 Count = 0;
+        while (lluna_Core_Reader_ReadLine(Reader, &Line))
+        {
+                sprintf(Expected, "line %u", Count);
+                lluna_TestHelper_CheckTrue(TextEquals(Line, Expected), &SessionState, "Line crossing a block boundary is wrong.");
+                ++Count;
+        }
+        lluna_TestHelper_CheckEqual(Count, 500, &SessionState, "Wrong number of lines.");
+        lluna_TestHelper_CheckFalse(Reader->Failed, &SessionState, "Reader failed.");
+
+        lluna_Core_Reader_Destroy(Reader);
+        fclose(File);
+}
+
+static void ReadLongRecords()
+{
+        static char Contents[3 * 1000];
+        memset(Contents, 'x', sizeof(Contents));
+        Contents[999] = ';';
+        Contents[1999] = ';';
+
+        FILE* File = CreateFile(Contents, sizeof(Contents));
+        lluna_TestHelper_CheckTrue(File != NULL, &SessionState, "Couldn't create a temporary file.");
+
+        struct lluna_Core_Reader* Reader = lluna_Core_Reader_Create(fileno(File), 64);
+        struct lluna_Core_Types_Text Record;
+
+        for (uint32 Index = 0; Index < 3; ++Index)
+        {
+                lluna_TestHelper_CheckTrue(lluna_Core_Reader_ReadRecord(Reader, ';', &Record), &SessionState, "Missing record.");
+                lluna_TestHelper_CheckEqual(Record.Size, Index < 2 ? 999 : 1000, &SessionState, "Record longer than the buffer has the wrong size.");
+                lluna_TestHelper_CheckTrue(Record.Data[0] == 'x' && Record.Data[Record.Size - 1] == 'x', &SessionState, "Record longer than the buffer has the wrong contents.");
+        }
+        lluna_TestHelper_CheckFalse(lluna_Core_Reader_ReadRecord(Reader, ';', &Record), &SessionState, "Read past the end.");
+
+        lluna_Core_Reader_Destroy(Reader);
+        fclose(File);
+}
+
+static void ReadMapped()
+{
+        const char Contents[] = "mapped\nfile\n";
+
+        FILE* File = CreateFile(Contents, sizeof(Contents) - 1);
+        lluna_TestHelper_CheckTrue(File != NULL, &SessionState, "Couldn't create a temporary file.");
+
+        struct lluna_Core_Reader* Reader = lluna_Core_Reader_CreateMapped(fileno(File));
+        struct lluna_Core_Types_Text Line;
+
+        lluna_TestHelper_CheckTrue(lluna_Core_Reader_ReadLine(Reader, &Line) && TextEquals(Line, "mapped"), &SessionState, "First mapped line is wrong.");
+        lluna_TestHelper_CheckTrue(lluna_Core_Reader_ReadLine(Reader, &Line) && TextEquals(Line, "file"), &SessionState, "Second mapped line is wrong.");
+        lluna_TestHelper_CheckFalse(lluna_Core_Reader_ReadLine(Reader, &Line), &SessionState, "Read past the end of the mapping.");
+
+        lluna_Core_Reader_Destroy(Reader);
+        fclose(File);
+}
+
+static void ReadRemaining()
+{
+        const char Contents[] = "header\nbody of the file";
+
+        FILE* File = CreateFile(Contents, sizeof(Contents) - 1);
+        lluna_TestHelper_CheckTrue(File != NULL, &SessionState, "Couldn't create a temporary file.");
+
+        struct lluna_Core_Reader* Reader = lluna_Core_Reader_Create(fileno(File), 4);
+        struct lluna_Core_Types_Text Line;
+
+        lluna_TestHelper_CheckTrue(lluna_Core_Reader_ReadLine(Reader, &Line) && TextEquals(Line, "header"), &SessionState, "Header line is wrong.");
+        lluna_TestHelper_CheckTrue(TextEquals(lluna_Core_Reader_ReadRemaining(Reader), "body of the file"), &SessionState, "Remaining bytes are wrong.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Reader_ReadRemaining(Reader).Size, 0, &SessionState, "Remaining bytes were returned twice.");
+
+        lluna_Core_Reader_Destroy(Reader);
+        fclose(File);
+}
@@ -0,0 +1,299 @@
+#include <TestHelper.h>
+
+#include <Engine/Core/Public/Atomics.h>
+#include <Engine/Core/Public/Sync.h>
+
+#include <pthread.h>
+#include <sched.h>
+
+#define ThreadCount 4
+#define IterationCount 20000
+
+struct lluna_TestHelper_Session SessionState;
+
+static void Mutex();
+static void MutexContention();
+static void RwLock();
+static void AutoResetEvent();
+static void ManualResetEvent();
+static void Semaphore();
+static void Barrier();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Core_Sync");
+
+        lluna_TestHelper_RunTest(&SessionState, Mutex);
+        lluna_TestHelper_RunTest(&SessionState, MutexContention);
+        lluna_TestHelper_RunTest(&SessionState, RwLock);
+        lluna_TestHelper_RunTest(&SessionState, AutoResetEvent);
+        lluna_TestHelper_RunTest(&SessionState, ManualResetEvent);
+        lluna_TestHelper_RunTest(&SessionState, Semaphore);
+        lluna_TestHelper_RunTest(&SessionState, Barrier);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+static void RunThreads(void* (*Function)(void*), void* Argument)
+{
+        pthread_t Threads[ThreadCount];
+        for (uint32 Index = 0; Index < ThreadCount; ++Index)
+        {
+                pthread_create(&Threads[Index], NULL, Function, Argument);
+        }
+        for (uint32 Index = 0; Index < ThreadCount; ++Index)
+        {
+                pthread_join(Threads[Index], NULL);
+        }
+}
+
+static void Mutex()
+{
+        struct lluna_Core_Sync_Mutex Mutex;
+        lluna_Core_Sync_InitializeMutex(&Mutex);
+
+        lluna_TestHelper_CheckTrue(lluna_Core_Sync_TryLockMutex(&Mutex), &SessionState, "Could not lock an unlocked mutex.");
+        lluna_TestHelper_CheckFalse(lluna_Core_Sync_TryLockMutex(&Mutex), &SessionState, "Locked a locked mutex.");
+        lluna_Core_Sync_UnlockMutex(&Mutex);
+
+        lluna_Core_Sync_LockMutex(&Mutex);
+        lluna_TestHelper_CheckFalse(lluna_Core_Sync_TryLockMutex(&Mutex), &SessionState, "LockMutex did not lock the mutex.");
+        lluna_Core_Sync_UnlockMutex(&Mutex);
+        lluna_TestHelper_CheckEqual(Mutex.State, 0, &SessionState, "UnlockMutex did not unlock the mutex.");
+}
+
+struct Counted
+{
+        struct lluna_Core_Sync_Mutex Mutex;
+        struct lluna_Core_Sync_RwLock Lock;
+        uint64 Values[2];
+        uint32 Torn;
+};
+
+static void* IncrementLocked(void* Argument)
+{
+        struct Counted* Counted = Argument;
+        for (uint32 Iteration = 0; Iteration < IterationCount; ++Iteration)
+        {
+                lluna_Core_Sync_LockMutex(&Counted->Mutex);
+                ++Counted->Values[0];
+                lluna_Core_Sync_UnlockMutex(&Counted->Mutex);
+        }
+
+        return NULL;
+}
+
+static void MutexContention()
+{
+        struct Counted Counted = { 0 };
+        RunThreads(IncrementLocked, &Counted);
+
+        lluna_TestHelper_CheckEqual(Counted.Values[0], ThreadCount * IterationCount, &SessionState, "Increments were lost.");
+        lluna_TestHelper_CheckEqual(Counted.Mutex.State, 0, &SessionState, "Mutex was left locked.");
+}
+
+// Writers keep both values equal, readers check that they never see them differ.
+static void* ReadWrite(void* Argument)
+{
+        struct Counted* Counted = Argument;
+        for (uint32 Iteration = 0; Iteration < IterationCount; ++Iteration)
+        {
+                if (Iteration % 8 == 0)
+                {
+                        lluna_Core_Sync_WriteLock(&Counted->Lock);
+                        ++Counted->Values[0];
+                        ++Counted->Values[1];
+                        lluna_Core_Sync_WriteUnlock(&Counted->Lock);
+                }
+                else
+                {
+                        lluna_Core_Sync_ReadLock(&Counted->Lock);
+                        boolean Torn = Counted->Values[0] != Counted->Values[1];
+                        lluna_Core_Sync_ReadUnlock(&Counted->Lock);
+
+                        if (Torn)
+                        {
+                                lluna_Core_Atomics_StoreUint32(&Counted->Torn, true, lluna_Core_Atomics_Relaxed);
+                        }
+                }
+        }
+
+        return NULL;
+}
+
+static void RwLock()
+{
+        struct Counted Counted = { 0 };
+        lluna_Core_Sync_InitializeRwLock(&Counted.Lock);
+
+        lluna_Core_Sync_ReadLock(&Counted.Lock);
+        lluna_Core_Sync_ReadLock(&Counted.Lock);
+        lluna_TestHelper_CheckEqual(Counted.Lock.State, 2, &SessionState, "Readers did not share the lock.");
+        lluna_Core_Sync_ReadUnlock(&Counted.Lock);
+        lluna_Core_Sync_ReadUnlock(&Counted.Lock);
+
+        RunThreads(ReadWrite, &Counted);
+
+        lluna_TestHelper_CheckFalse(Counted.Torn, &SessionState, "A reader saw a write in progress.");
+        lluna_TestHelper_CheckEqual(Counted.Values[0], ThreadCount * IterationCount / 8, &SessionState, "Writes were lost.");
+        lluna_TestHelper_CheckEqual(Counted.Lock.State, 0, &SessionState, "Lock was left locked.");
+}
+
+struct Signals
+{
+        struct lluna_Core_Sync_Event Event;
+        uint32 Released;
+};
+
+static void* WaitEvent(void* Argument)
+{
+        struct Signals* Signals = Argument;
+        lluna_Core_Sync_WaitEvent(&Signals->Event);
+        lluna_Core_Atomics_FetchAddUint32(&Signals->Released, 1, lluna_Core_Atomics_Relaxed);
+
+        return NULL;
+}
+
+static void AutoResetEvent()
+{
+        struct Signals Signals = { 0 };
+        lluna_Core_Sync_InitializeEvent(&Signals.Event, false, true);
+
+        lluna_Core_Sync_WaitEvent(&Signals.Event);
+        lluna_TestHelper_CheckEqual(Signals.Event.State, 0, &SessionState, "Wait did not reset the event.");
+
+        pthread_t Threads[ThreadCount];
+        for (uint32 Index = 0; Index < ThreadCount; ++Index)
+        {
+                pthread_create(&Threads[Index], NULL, WaitEvent, &Signals);
+        }
+
+        // Each signal releases one waiter, possibly one that hasn't started waiting yet.
+        for (uint32 Index = 0; Index < ThreadCount; ++Index)
+        {
+                uint32 Released = Index;
+                lluna_Core_Sync_SignalEvent(&Signals.Event);
+                while (lluna_Core_Atomics_LoadUint32(&Signals.Released, lluna_Core_Atomics_Relaxed) == Released)
+                {
+                        sched_yield();
+                }
+        }
+
+        for (uint32 Index = 0; Index < ThreadCount; ++Index)
+        {
+                pthread_join(Threads[Index], NULL);
+        }
+
+        lluna_TestHelper_CheckEqual(Signals.Released, ThreadCount, &SessionState, "Signals did not release every waiter.");
+}
+
+static void ManualResetEvent()
+{
+        struct Signals Signals = { 0 };
+        lluna_Core_Sync_InitializeEvent(&Signals.Event, true, false);
+
+        pthread_t Threads[ThreadCount];
+        for (uint32 Index = 0; Index < ThreadCount; ++Index)
+        {
+                pthread_create(&Threads[Index], NULL, WaitEvent, &Signals);
+        }
+
+        lluna_Core_Sync_SignalEvent(&Signals.Event);
+        for (uint32 Index = 0; Index < ThreadCount; ++Index)
+        {
+                pthread_join(Threads[Index], NULL);
+        }
+
+        lluna_TestHelper_CheckEqual(Signals.Released, ThreadCount, &SessionState, "A signal did not release every waiter.");
+        lluna_TestHelper_CheckEqual(Signals.Event.State, 1, &SessionState, "Waits reset a manual reset event.");
+
+        lluna_Core_Sync_ResetEvent(&Signals.Event);
+        lluna_TestHelper_CheckEqual(Signals.Event.State, 0, &SessionState, "ResetEvent did not reset the event.");
+}
+
+struct Queue
+{
+        struct lluna_Core_Sync_Semaphore Items;
+        uint32 Consumed;
+};
+
+static void* Consume(void* Argument)
+{
+        struct Queue* Queue = Argument;
+        for (uint32 Iteration = 0; Iteration < IterationCount; ++Iteration)
+        {
+                lluna_Core_Sync_AcquireSemaphore(&Queue->Items);
+                lluna_Core_Atomics_FetchAddUint32(&Queue->Consumed, 1, lluna_Core_Atomics_Relaxed);
+        }
+
+        return NULL;
+}
+
+static void Semaphore()
+{
+        struct Queue Queue = { 0 };
+        lluna_Core_Sync_InitializeSemaphore(&Queue.Items, 1);
+
+        lluna_TestHelper_CheckTrue(lluna_Core_Sync_TryAcquireSemaphore(&Queue.Items), &SessionState, "Could not take an available unit.");
+        lluna_TestHelper_CheckFalse(lluna_Core_Sync_TryAcquireSemaphore(&Queue.Items), &SessionState, "Took a unit that wasn't available.");
+
+        pthread_t Threads[ThreadCount];
+        for (uint32 Index = 0; Index < ThreadCount; ++Index)
+        {
+                pthread_create(&Threads[Index], NULL, Consume, &Queue);
+        }
+
+        for (uint32 Iteration = 0; Iteration < IterationCount; ++Iteration)
+        {
+                lluna_Core_Sync_ReleaseSemaphore(&Queue.Items, ThreadCount);
+        }
+
+        for (uint32 Index = 0; Index < ThreadCount; ++Index)
+        {
+                pthread_join(Threads[Index], NULL);
+        }
+
+        lluna_TestHelper_CheckEqual(Queue.Consumed, ThreadCount * IterationCount, &SessionState, "Units were lost.");
+        lluna_TestHelper_CheckEqual(Queue.Items.Count, 0, &SessionState, "Units were left over.");
+}
+
+#define RoundCount 1000
+
+struct Rounds
+{
+        struct lluna_Core_Sync_Barrier Barrier;
+        uint32 Arrived[RoundCount];
+        uint32 LastCount;
+        uint32 Early;
+};
+
+static void* ArriveEachRound(void* Argument)
+{
+        struct Rounds* Rounds = Argument;
+        for (uint32 Round = 0; Round < RoundCount; ++Round)
+        {
+                lluna_Core_Atomics_FetchAddUint32(&Rounds->Arrived[Round], 1, lluna_Core_Atomics_Relaxed);
+                if (lluna_Core_Sync_WaitBarrier(&Rounds->Barrier))
+                {
+                        lluna_Core_Atomics_FetchAddUint32(&Rounds->LastCount, 1, lluna_Core_Atomics_Relaxed);
+                }
+                if (lluna_Core_Atomics_LoadUint32(&Rounds->Arrived[Round], lluna_Core_Atomics_Relaxed) != ThreadCount)
+                {
+                        lluna_Core_Atomics_StoreUint32(&Rounds->Early, true, lluna_Core_Atomics_Relaxed);
+                }
+        }
+
+        return NULL;
+}
+
+static void Barrier()
+{
+        struct Rounds Rounds = { 0 };
+        lluna_Core_Sync_InitializeBarrier(&Rounds.Barrier, ThreadCount);
+
+        RunThreads(ArriveEachRound, &Rounds);
+
+        lluna_TestHelper_CheckFalse(Rounds.Early, &SessionState, "A thread left the barrier before every thread arrived.");
+        lluna_TestHelper_CheckEqual(Rounds.LastCount, RoundCount, &SessionState, "Wrong number of threads were told they arrived last.");
+        lluna_TestHelper_CheckEqual(Rounds.Barrier.Remaining, ThreadCount, &SessionState, "Barrier was not reset.");
+}
@@ -0,0 +1,224 @@
+#include <TestHelper.h>
+
+#include <Engine/Core/Public/Macros.h>
+#include <Engine/Core/Public/Utf8.h>
+
+#include <string.h>
+
+struct lluna_TestHelper_Session SessionState;
+
+static void Validate();
+static void ValidateRejectsMalformed();
+static void ValidateAcrossBlocks();
+static void CountCodePoints();
+static void Decode();
+static void DecodeMalformed();
+static void EncodedSize();
+static void Encode();
+static void ToUtf32();
+static void ToUtf32Long();
+static void CountUtf16();
+static void ToUtf16();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Core_Utf8");
+
+        lluna_TestHelper_RunTest(&SessionState, Validate);
+        lluna_TestHelper_RunTest(&SessionState, ValidateRejectsMalformed);
+        lluna_TestHelper_RunTest(&SessionState, ValidateAcrossBlocks);
+        lluna_TestHelper_RunTest(&SessionState, CountCodePoints);
+        lluna_TestHelper_RunTest(&SessionState, Decode);
+        lluna_TestHelper_RunTest(&SessionState, DecodeMalformed);
+        lluna_TestHelper_RunTest(&SessionState, EncodedSize);
+        lluna_TestHelper_RunTest(&SessionState, Encode);
+        lluna_TestHelper_RunTest(&SessionState, ToUtf32);
+        lluna_TestHelper_RunTest(&SessionState, ToUtf32Long);
+        lluna_TestHelper_RunTest(&SessionState, CountUtf16);
+        lluna_TestHelper_RunTest(&SessionState, ToUtf16);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+static void Validate()
+{
+        lluna_TestHelper_CheckTrue(lluna_Core_Utf8_Validate(lluna_Macros_Text("")), &SessionState, "Validate rejected empty text.");
+        lluna_TestHelper_CheckTrue(lluna_Core_Utf8_Validate(lluna_Macros_Text("lluna")), &SessionState, "Validate rejected ASCII text.");
+        lluna_TestHelper_CheckTrue(lluna_Core_Utf8_Validate(lluna_Macros_Text("ll\xC3\xBAna")), &SessionState, "Validate rejected a two byte sequence.");
+        lluna_TestHelper_CheckTrue(lluna_Core_Utf8_Validate(lluna_Macros_Text("\xE2\x82\xAC 10")), &SessionState, "Validate rejected a three byte sequence.");
+        lluna_TestHelper_CheckTrue(lluna_Core_Utf8_Validate(lluna_Macros_Text("\xF0\x9F\x8C\x99")), &SessionState, "Validate rejected a four byte sequence.");
+        lluna_TestHelper_CheckTrue(lluna_Core_Utf8_Validate(lluna_Macros_Text("\xF4\x8F\xBF\xBF")), &SessionState, "Validate rejected U+10FFFF.");
+        lluna_TestHelper_CheckTrue(lluna_Core_Utf8_Validate(lluna_Macros_Text("\xED\x9F\xBF")), &SessionState, "Validate rejected U+D7FF.");
+}
+
+static void ValidateRejectsMalformed()
+{
+        lluna_TestHelper_CheckFalse(lluna_Core_Utf8_Validate(lluna_Macros_Text("\x80")), &SessionState, "Validate accepted a lone continuation byte.");
+        lluna_TestHelper_CheckFalse(lluna_Core_Utf8_Validate(lluna_Macros_Text("\xC3")), &SessionState, "Validate accepted a truncated sequence.");
+        lluna_TestHelper_CheckFalse(lluna_Core_Utf8_Validate(lluna_Macros_Text("\xC3" "a")), &SessionState, "Validate accepted a missing continuation.");
+        lluna_TestHelper_CheckFalse(lluna_Core_Utf8_Validate(lluna_Macros_Text("\xC0\xAF")), &SessionState, "Validate accepted an overlong two byte sequence.");
+        lluna_TestHelper_CheckFalse(lluna_Core_Utf8_Validate(lluna_Macros_Text("\xE0\x80\xAF")), &SessionState, "Validate accepted an overlong three byte sequence.");
+        lluna_TestHelper_CheckFalse(lluna_Core_Utf8_Validate(lluna_Macros_Text("\xF0\x80\x80\xAF")), &SessionState, "Validate accepted an overlong four byte sequence.");
+        lluna_TestHelper_CheckFalse(lluna_Core_Utf8_Validate(lluna_Macros_Text("\xED\xA0\x80")), &SessionState, "Validate accepted a surrogate.");
+        lluna_TestHelper_CheckFalse(lluna_Core_Utf8_Validate(lluna_Macros_Text("\xF4\x90\x80\x80")), &SessionState, "Validate accepted a code point above U+10FFFF.");
+        lluna_TestHelper_CheckFalse(lluna_Core_Utf8_Validate(lluna_Macros_Text("\xF8\x88\x80\x80\x80")), &SessionState, "Validate accepted a five byte sequence.");
+        lluna_TestHelper_CheckFalse(lluna_Core_Utf8_Validate(lluna_Macros_Text("\xE2\x82\xAC\xAC")), &SessionState, "Validate accepted a trailing continuation.");
+}
+
+static void ValidateAcrossBlocks()
+{
+        const char* Sequences[] = { "\xC3\xBA", "\xE2\x82\xAC", "\xF0\x9F\x8C\x99" };
+        const char* Malformed[] = { "\xC3", "\xE2\x82", "\xF0\x9F\x8C", "\xED\xA0\x80", "\xBF" };
+        char Buffer[128];
+
+        // Place every sequence at every offset of the first blocks, so that sequences straddle vector boundaries.
+        for (uint32 Position = 0; Position < 70; ++Position)
+        {
+                for (uint32 Index = 0; Index < sizeof(Sequences) / sizeof(Sequences[0]); ++Index)
+                {
+                        uint64 Length = strlen(Sequences[Index]);
+                        memset(Buffer, 'a', sizeof(Buffer));
+                        memcpy(Buffer + Position, Sequences[Index], Length);
+
+                        struct lluna_Core_Types_Text Text = { Buffer, sizeof(Buffer) };
+                        lluna_TestHelper_CheckTrue(lluna_Core_Utf8_Validate(Text), &SessionState, "Validate rejected a valid sequence crossing a block boundary.");
+
+                        Text.Size = Position + Length;
+                        lluna_TestHelper_CheckTrue(lluna_Core_Utf8_Validate(Text), &SessionState, "Validate rejected a valid sequence at the end of the text.");
+                }
+
+                for (uint32 Index = 0; Index < sizeof(Malformed) / sizeof(Malformed[0]); ++Index)
+                {
+                        uint64 Length = strlen(Malformed[Index]);
+                        memset(Buffer, 'a', sizeof(Buffer));
+                        memcpy(Buffer + Position, Malformed[Index], Length);
+
+                        struct lluna_Core_Types_Text Text = { Buffer, sizeof(Buffer) };
+                        lluna_TestHelper_CheckFalse(lluna_Core_Utf8_Validate(Text), &SessionState, "Validate accepted a malformed sequence crossing a block boundary.");
+
+                        Text.Size = Position + Length;
+                        lluna_TestHelper_CheckFalse(lluna_Core_Utf8_Validate(Text), &SessionState, "Validate accepted a malformed sequence at the end of the text.");
+                }
+        }
+}
+
+static void CountCodePoints()
+{
+        lluna_TestHelper_CheckEqual(lluna_Core_Utf8_CountCodePoints(lluna_Macros_Text("")), 0, &SessionState, "CountCodePoints did not return 0 for empty text.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Utf8_CountCodePoints(lluna_Macros_Text("lluna")), 5, &SessionState, "CountCodePoints did not count ASCII text properly.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Utf8_CountCodePoints(lluna_Macros_Text("ll\xC3\xBAna \xE2\x82\xAC \xF0\x9F\x8C\x99")), 9, &SessionState, "CountCodePoints did not count multibyte sequences properly.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Utf8_CountCodePoints(lluna_Macros_Text("\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC")), 8, &SessionState, "CountCodePoints did not count a full block properly.");
+}
+
+static void Decode()
+{
+        struct lluna_Core_Types_Text Text = lluna_Macros_Text("a\xC3\xBA\xE2\x82\xAC\xF0\x9F\x8C\x99");
+        uint64 Offset = 0;
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Utf8_Decode(Text, &Offset), 'a', &SessionState, "Decode did not decode ASCII properly.");
+        lluna_TestHelper_CheckEqual(Offset, 1, &SessionState, "Decode did not advance past ASCII.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Utf8_Decode(Text, &Offset), 0xFA, &SessionState, "Decode did not decode a two byte sequence properly.");
+        lluna_TestHelper_CheckEqual(Offset, 3, &SessionState, "Decode did not advance past a two byte sequence.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Utf8_Decode(Text, &Offset), 0x20AC, &SessionState, "Decode did not decode a three byte sequence properly.");
+        lluna_TestHelper_CheckEqual(Offset, 6, &SessionState, "Decode did not advance past a three byte sequence.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Utf8_Decode(Text, &Offset), 0x1F319, &SessionState, "Decode did not decode a four byte sequence properly.");
+        lluna_TestHelper_CheckEqual(Offset, 10, &SessionState, "Decode did not advance past a four byte sequence.");
+}
+
+static void DecodeMalformed()
+{
+        struct lluna_Core_Types_Text Text = lluna_Macros_Text("\xC0\xAF" "a\xE2\x82");
+        uint64 Offset = 0;
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Utf8_Decode(Text, &Offset), lluna_Core_Utf8_ReplacementCharacter, &SessionState, "Decode did not replace an overlong sequence.");
+        lluna_TestHelper_CheckEqual(Offset, 1, &SessionState, "Decode did not advance a single byte on a malformed sequence.");
+
+        Offset = 3;
+        lluna_TestHelper_CheckEqual(lluna_Core_Utf8_Decode(Text, &Offset), lluna_Core_Utf8_ReplacementCharacter, &SessionState, "Decode did not replace a truncated sequence.");
+        lluna_TestHelper_CheckEqual(Offset, 4, &SessionState, "Decode did not advance a single byte on a truncated sequence.");
+}
+
+static void EncodedSize()
+{
+        uint32 CodePoints[] = { 'a', 0xFA, 0x20AC, 0x1F319, 0xD800, 0x110000 };
+
+        lluna_TestHelper_CheckEqual(lluna_Core_Utf8_EncodedSize(CodePoints, 4), 10, &SessionState, "EncodedSize did not return the proper size.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Utf8_EncodedSize(CodePoints + 4, 2), 6, &SessionState, "EncodedSize did not count replacements.");
+}
+
+static void Encode()
+{
+        uint32 CodePoints[] = { 'a', 0xFA, 0x20AC, 0x1F319, 0xDC00 };
+        const char Expected[] = "a\xC3\xBA\xE2\x82\xAC\xF0\x9F\x8C\x99\xEF\xBF\xBD";
+        char Output[32];
+
+        uint64 Size = lluna_Core_Utf8_Encode(CodePoints, sizeof(CodePoints) / sizeof(CodePoints[0]), Output);
+
+        lluna_TestHelper_CheckEqual(Size, sizeof(Expected) - 1, &SessionState, "Encode did not return the proper size.");
+        lluna_TestHelper_CheckEqual(memcmp(Output, Expected, Size), 0, &SessionState, "Encode did not encode properly.");
+}
+
+static void ToUtf32()
+{
+        struct lluna_Core_Types_Text Text = lluna_Macros_Text("a\xC3\xBA\xE2\x82\xAC\xF0\x9F\x8C\x99");
+        uint32 Expected[] = { 'a', 0xFA, 0x20AC, 0x1F319 };
+        uint32 Output[4];
+
+        uint64 Count = lluna_Core_Utf8_ToUtf32(Text, Output);
+
+        lluna_TestHelper_CheckEqual(Count, 4, &SessionState, "ToUtf32 did not return the proper count.");
+        lluna_TestHelper_CheckEqual(memcmp(Output, Expected, sizeof(Expected)), 0, &SessionState, "ToUtf32 did not transcode properly.");
+}
+
+static void ToUtf32Long()
+{
+        char Input[200];
+        uint32 Output[200];
+
+        // Long ASCII runs with sequences sprinkled in exercise both the vector and the scalar paths.
+        uint64 Size = 0;
+        uint32 Expected = 0;
+        for (uint32 Index = 0; Index < 40; ++Index)
+        {
+                if (Index % 7 == 3)
+                {
+                        memcpy(Input + Size, "\xE2\x82\xAC", 3);
+                        Size += 3;
+                }
+                else
+                {
+                        Input[Size++] = (char)('a' + Index % 26);
+                }
+                ++Expected;
+        }
+        memset(Input + Size, 'z', 64);
+        Size += 64;
+        Expected += 64;
+
+        struct lluna_Core_Types_Text Text = { Input, Size };
+        uint64 Count = lluna_Core_Utf8_ToUtf32(Text, Output);
+
+        lluna_TestHelper_CheckEqual(Count, Expected, &SessionState, "ToUtf32 did not return the proper count.");
+        lluna_TestHelper_CheckEqual(Count, lluna_Core_Utf8_CountCodePoints(Text), &SessionState, "ToUtf32 and CountCodePoints disagree.");
+        lluna_TestHelper_CheckEqual(Output[3], 0x20AC, &SessionState, "ToUtf32 did not transcode a sequence properly.");
+        lluna_TestHelper_CheckEqual(Output[4], 'e', &SessionState, "ToUtf32 did not transcode ASCII after a sequence properly.");
+        lluna_TestHelper_CheckEqual(Output[Count - 1], 'z', &SessionState, "ToUtf32 did not transcode the trailing run properly.");
+}
+
+static void CountUtf16()
+{
+        lluna_TestHelper_CheckEqual(lluna_Core_Utf8_CountUtf16(lluna_Macros_Text("a\xC3\xBA\xE2\x82\xAC")), 3, &SessionState, "CountUtf16 did not count basic plane code points properly.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Utf8_CountUtf16(lluna_Macros_Text("\xF0\x9F\x8C\x99")), 2, &SessionState, "CountUtf16 did not count a surrogate pair.");
+}
+
+static void ToUtf16()
+{
+        struct lluna_Core_Types_Text Text = lluna_Macros_Text("a\xC3\xBA\xE2\x82\xAC\xF0\x9F\x8C\x99");
+        uint16 Expected[] = { 'a', 0xFA, 0x20AC, 0xD83C, 0xDF19 };
+        uint16 Output[5];
+
+        uint64 Count = lluna_Core_Utf8_ToUtf16(Text, Output);
+
+        lluna_TestHelper_CheckEqual(Count, 5, &SessionState, "ToUtf16 did not return the proper count.");
+        lluna_TestHelper_CheckEqual(memcmp(Output, Expected, sizeof(Expected)), 0, &SessionState, "ToUtf16 did not transcode properly.");
+}
@@ -0,0 +1,175 @@
+#include <TestHelper.h>
+
+#include <Engine/Core/Public/Macros.h>
+#include <Engine/Core/Public/Writer.h>
+
+#include <stdio.h>
+#include <string.h>
+
+struct lluna_TestHelper_Session SessionState;
+
+static void WriteText();
+static void WriteNumbers();
+static void WriteFloat();
+static void Format();
+static void FormatGrows();
+static void ReserveAndCommit();
+static void FlushToFile();
+static void WriteBytesLargerThanBuffer();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Core_Writer");
+
+        lluna_TestHelper_RunTest(&SessionState, WriteText);
+        lluna_TestHelper_RunTest(&SessionState, WriteNumbers);
+        lluna_TestHelper_RunTest(&SessionState, WriteFloat);
+        lluna_TestHelper_RunTest(&SessionState, Format);
+        lluna_TestHelper_RunTest(&SessionState, FormatGrows);
+        lluna_TestHelper_RunTest(&SessionState, ReserveAndCommit);
+        lluna_TestHelper_RunTest(&SessionState, FlushToFile);
+        lluna_TestHelper_RunTest(&SessionState, WriteBytesLargerThanBuffer);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+static boolean TextEquals(struct lluna_Core_Types_Text Text, const char* Expected)
+{
+        return Text.Size == strlen(Expected) && memcmp(Text.Data, Expected, Text.Size) == 0;
+}
+
+static void WriteText()
+{
+        struct lluna_Core_Writer* Writer = lluna_Core_Writer_Create(lluna_Core_Writer_NoFile, 4);
+
+        lluna_Core_Writer_WriteText(Writer, lluna_Macros_Text("Lluna"));
+        lluna_Core_Writer_WriteCharacter(Writer, ' ');
+        lluna_Core_Writer_WriteBytes(Writer, "plena", 5);
+
+        lluna_TestHelper_CheckTrue(TextEquals(lluna_Core_Writer_Text(Writer), "Lluna plena"), &SessionState, "Writer doesn't hold the written text.");
+
+        lluna_Core_Writer_Clear(Writer);
+        lluna_TestHelper_CheckEqual(lluna_Core_Writer_Text(Writer).Size, 0, &SessionState, "Clear didn't discard the buffered text.");
+
+        lluna_Core_Writer_Destroy(Writer);
+}
+
+static void WriteNumbers()
+{
+        struct lluna_Core_Writer* Writer = lluna_Core_Writer_Create(lluna_Core_Writer_NoFile, 0);
+
+        lluna_Core_Writer_WriteInt64(Writer, 0);
+        lluna_Core_Writer_WriteCharacter(Writer, ' ');
+        lluna_Core_Writer_WriteInt64(Writer, -42);
+        lluna_Core_Writer_WriteCharacter(Writer, ' ');
+        lluna_Core_Writer_WriteInt64(Writer, -9223372036854775807LL - 1);
+        lluna_Core_Writer_WriteCharacter(Writer, ' ');
+        lluna_Core_Writer_WriteUint64(Writer, 18446744073709551615ULL);
+        lluna_Core_Writer_WriteCharacter(Writer, ' ');
+        lluna_Core_Writer_WriteUint64(Writer, 1000);
+
+        lluna_TestHelper_CheckTrue(TextEquals(lluna_Core_Writer_Text(Writer), "0 -42 -9223372036854775808 18446744073709551615 1000"), &SessionState, "Integers were written wrong.");
+
+        lluna_Core_Writer_Destroy(Writer);
+}
+
+static void WriteFloat()
+{
+        struct lluna_Core_Writer* Writer = lluna_Core_Writer_Create(lluna_Core_Writer_NoFile, 0);
+
+        lluna_Core_Writer_WriteFloat(Writer, 0.1f);
+        lluna_Core_Writer_WriteCharacter(Writer, ' ');
+        lluna_Core_Writer_WriteFloat(Writer, -2.5f);
+        lluna_Core_Writer_WriteCharacter(Writer, ' ');
+        lluna_Core_Writer_WriteFloat(Writer, 16777216.0f);
+        lluna_Core_Writer_WriteCharacter(Writer, ' ');
+        lluna_Core_Writer_WriteFloat(Writer, 3.14159265f);
+
+        lluna_TestHelper_CheckTrue(TextEquals(lluna_Core_Writer_Text(Writer), "0.1 -2.5 16777216 3.1415927"), &SessionState, "Floats were written wrong.");
+
+        lluna_Core_Writer_Destroy(Writer);
+}
+
+static void Format()
+{
+        struct lluna_Core_Writer* Writer = lluna_Core_Writer_Create(lluna_Core_Writer_NoFile, 64);
+
+        lluna_Core_Writer_Format(Writer, lluna_Macros_Text("v %.2f %.2f %.2f\n"), 1.0, -0.5, 0.25);
+        lluna_Core_Writer_Format(Writer, lluna_Macros_Text("f %d/%d"), 1, 2);
+
+        lluna_TestHelper_CheckTrue(TextEquals(lluna_Core_Writer_Text(Writer), "v 1.00 -0.50 0.25\nf 1/2"), &SessionState, "Format wrote the wrong text.");
+
+        lluna_Core_Writer_Destroy(Writer);
+}
+
+static void FormatGrows()
+{
+        struct lluna_Core_Writer* Writer = lluna_Core_Writer_Create(lluna_Core_Writer_NoFile, 0);
+
+        lluna_Core_Writer_WriteText(Writer, lluna_Macros_Text("Format: "));
+        lluna_Core_Writer_Format(Writer, lluna_Macros_Text("%s %s %s"), "a string longer than the whole buffer", "and", "then some");
+
+        lluna_TestHelper_CheckTrue(TextEquals(lluna_Core_Writer_Text(Writer), "Format: a string longer than the whole buffer and then some"), &SessionState, "Format didn't grow the buffer.");
+
+        lluna_Core_Writer_Destroy(Writer);
+}
+
+static void ReserveAndCommit()
+{
+        struct lluna_Core_Writer* Writer = lluna_Core_Writer_Create(lluna_Core_Writer_NoFile, 0);
+
+        lluna_Core_Writer_WriteText(Writer, lluna_Macros_Text("["));
+        char* Output = lluna_Core_Writer_Reserve(Writer, 100);
+        memcpy(Output, "reserved", 8);
+        lluna_Core_Writer_Commit(Writer, 8);
+        lluna_Core_Writer_WriteText(Writer, lluna_Macros_Text("]"));
+
+        lluna_TestHelper_CheckTrue(TextEquals(lluna_Core_Writer_Text(Writer), "[reserved]"), &SessionState, "Committed bytes were not kept.");
+
+        lluna_Core_Writer_Destroy(Writer);
+}
+
+static boolean FileEquals(FILE* File, const char* Expected)
+{
+        static char Contents[4096];
+        fseek(File, 0, SEEK_SET);
+        size_t Size = fread(Contents, 1, sizeof(Contents), File);
+
+        return Size == strlen(Expected) && memcmp(Contents, Expected, Size) == 0;
+}
+
+static void FlushToFile()
+{
+        FILE* File = tmpfile();
+        lluna_TestHelper_CheckTrue(File != NULL, &SessionState, "Couldn't create a temporary file.");
+
+        struct lluna_Core_Writer* Writer = lluna_Core_Writer_Create(fileno(File), 16);
+        for (int32 Index = 0; Index < 10; ++Index)
+        {
+                lluna_Core_Writer_Format(Writer, lluna_Macros_Text("line %d\n"), Index);
+        }
+        lluna_TestHelper_CheckTrue(lluna_Core_Writer_Flush(Writer), &SessionState, "Flush failed.");
+        lluna_TestHelper_CheckEqual(lluna_Core_Writer_Text(Writer).Size, 0, &SessionState, "Flush didn't empty the buffer.");
+        lluna_Core_Writer_Destroy(Writer);
+
+        lluna_TestHelper_CheckTrue(FileEquals(File, "line 0\nline 1\nline 2\nline 3\nline 4\nline 5\nline 6\nline 7\nline 8\nline 9\n"), &SessionState, "File doesn't hold the written lines.");
+
+        fclose(File);
+}
+
+static void WriteBytesLargerThanBuffer()
+{
+        FILE* File = tmpfile();
+        lluna_TestHelper_CheckTrue(File != NULL, &SessionState, "Couldn't create a temporary file.");
+
+        struct lluna_Core_Writer* Writer = lluna_Core_Writer_Create(fileno(File), 32);
+        lluna_Core_Writer_WriteText(Writer, lluna_Macros_Text("head "));
+        lluna_Core_Writer_WriteText(Writer, lluna_Macros_Text("a chunk of bytes that is bigger than the buffer"));
+        lluna_TestHelper_CheckEqual(lluna_Core_Writer_Text(Writer).Size, 0, &SessionState, "Large bytes were buffered.");
+        lluna_Core_Writer_WriteText(Writer, lluna_Macros_Text(" tail"));
+        lluna_Core_Writer_Destroy(Writer);
+
+        lluna_TestHelper_CheckTrue(FileEquals(File, "head a chunk of bytes that is bigger than the buffer tail"), &SessionState, "File doesn't hold the written bytes in order.");
+
+        fclose(File);
+}
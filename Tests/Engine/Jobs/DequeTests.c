@@ -0,0 +1,162 @@
+#include <TestHelper.h>
+
+#include <Engine/Core/Public/Atomics.h>
+#include <Engine/Jobs/Public/Deque.h>
+#include <Engine/Jobs/Public/Scheduler.h>
+
+#include <pthread.h>
+
+struct lluna_TestHelper_Session SessionState;
+
+static void PushPop();
+static void Steal();
+static void Grow();
+static void ConcurrentSteal();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Jobs_Deque");
+
+        lluna_TestHelper_RunTest(&SessionState, PushPop);
+        lluna_TestHelper_RunTest(&SessionState, Steal);
+        lluna_TestHelper_RunTest(&SessionState, Grow);
+        lluna_TestHelper_RunTest(&SessionState, ConcurrentSteal);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+static void PushPop()
+{
+        struct lluna_Jobs_Deque* Deque = lluna_Jobs_Deque_Create(4);
+        struct lluna_Jobs_Job Jobs[3];
+
+        lluna_TestHelper_CheckTrue(lluna_Jobs_Deque_Empty(Deque), &SessionState, "New deque is not empty.");
+        lluna_TestHelper_CheckTrue(lluna_Jobs_Deque_Pop(Deque) == NULL, &SessionState, "Popped from an empty deque.");
+
+        for (uint32 Index = 0; Index < 3; ++Index)
+        {
+                lluna_Jobs_Deque_Push(Deque, &Jobs[Index]);
+        }
+        lluna_TestHelper_CheckFalse(lluna_Jobs_Deque_Empty(Deque), &SessionState, "Deque with jobs is empty.");
+
+        for (uint32 Index = 3; Index > 0; --Index)
+        {
+                lluna_TestHelper_CheckTrue(lluna_Jobs_Deque_Pop(Deque) == &Jobs[Index - 1], &SessionState, "Pop didn't return the newest job.");
+        }
+        lluna_TestHelper_CheckTrue(lluna_Jobs_Deque_Pop(Deque) == NULL, &SessionState, "Popped more jobs than pushed.");
+
+        lluna_Jobs_Deque_Destroy(Deque);
+}
+
+static void Steal()
+{
+        struct lluna_Jobs_Deque* Deque = lluna_Jobs_Deque_Create(4);
+        struct lluna_Jobs_Job Jobs[3];
+        struct lluna_Jobs_Job* Job;
+
+        for (uint32 Index = 0; Index < 3; ++Index)
+        {
+                lluna_Jobs_Deque_Push(Deque, &Jobs[Index]);
+        }
+
+        lluna_TestHelper_CheckTrue(lluna_Jobs_Deque_Steal(Deque, &Job) && Job == &Jobs[0], &SessionState, "Steal didn't return the oldest job.");
+        lluna_TestHelper_CheckTrue(lluna_Jobs_Deque_Pop(Deque) == &Jobs[2], &SessionState, "Pop after steal is wrong.");
+        lluna_TestHelper_CheckTrue(lluna_Jobs_Deque_Steal(Deque, &Job) && Job == &Jobs[1], &SessionState, "Second steal is wrong.");
+        lluna_TestHelper_CheckTrue(lluna_Jobs_Deque_Steal(Deque, &Job) && Job == NULL, &SessionState, "Stole from an empty deque.");
+
+        lluna_Jobs_Deque_Destroy(Deque);
+}
+
+static void Grow()
+{
+        struct lluna_Jobs_Deque* Deque = lluna_Jobs_Deque_Create(2);
+        static struct lluna_Jobs_Job Jobs[1000];
+        struct lluna_Jobs_Job* Job;
+
+        for (uint32 Index = 0; Index < 1000; ++Index)
+        {
+                lluna_Jobs_Deque_Push(Deque, &Jobs[Index]);
+        }
+
+        lluna_TestHelper_CheckTrue(lluna_Jobs_Deque_Steal(Deque, &Job) && Job == &Jobs[0], &SessionState, "Growing lost the oldest job.");
+        for (uint32 Index = 1000; Index > 1; --Index)
+        {
+                lluna_TestHelper_CheckTrue(lluna_Jobs_Deque_Pop(Deque) == &Jobs[Index - 1], &SessionState, "Growing reordered jobs.");
+        }
+        lluna_TestHelper_CheckTrue(lluna_Jobs_Deque_Empty(Deque), &SessionState, "Deque is not empty after taking every job.");
+
+        lluna_Jobs_Deque_Destroy(Deque);
+}
+
+#define StressJobCount 200000
+#define ThiefCount 3
+
+static struct lluna_Jobs_Job StressJobs[StressJobCount];
+static uint32 TakenCounts[StressJobCount];
+static uint32 StressDone;
+
+static void Take(struct lluna_Jobs_Job* Job)
+{
+        lluna_Core_Atomics_FetchAddUint32(&TakenCounts[Job - StressJobs], 1, lluna_Core_Atomics_Relaxed);
+}
+
+static void* Thief(void* Argument)
+{
+        struct lluna_Jobs_Deque* Deque = (struct lluna_Jobs_Deque*)Argument;
+        struct lluna_Jobs_Job* Job;
+
+        while (!lluna_Core_Atomics_LoadUint32(&StressDone, lluna_Core_Atomics_Acquire) || !lluna_Jobs_Deque_Empty(Deque))
+        {
+                if (lluna_Jobs_Deque_Steal(Deque, &Job) && Job)
+                {
+                        Take(Job);
+                }
+        }
+
+        return NULL;
+}
+
+static void ConcurrentSteal()
+{
+        // Small initial capacity so thieves race with the ring growing.
+        struct lluna_Jobs_Deque* Deque = lluna_Jobs_Deque_Create(2);
+        pthread_t Thieves[ThiefCount];
+
+        for (uint32 Index = 0; Index < ThiefCount; ++Index)
+        {
+                pthread_create(&Thieves[Index], NULL, Thief, Deque);
+        }
+
+        // The owner pushes in bursts and pops some back, racing thieves for the last job.
+        for (uint32 Index = 0; Index < StressJobCount; ++Index)
+        {
+                lluna_Jobs_Deque_Push(Deque, &StressJobs[Index]);
+                if (Index % 3 == 0)
+                {
+                        struct lluna_Jobs_Job* Job = lluna_Jobs_Deque_Pop(Deque);
+                        if (Job)
+                        {
+                                Take(Job);
+                        }
+                }
+        }
+        lluna_Core_Atomics_StoreUint32(&StressDone, true, lluna_Core_Atomics_Release);
+
+        struct lluna_Jobs_Job* Job;
+        while ((Job = lluna_Jobs_Deque_Pop(Deque)))
+        {
+                Take(Job);
+        }
+
+        for (uint32 Index = 0; Index < ThiefCount; ++Index)
+        {
+                pthread_join(Thieves[Index], NULL);
+        }
+
+        for (uint32 Index = 0; Index < StressJobCount; ++Index)
+        {
+                lluna_TestHelper_CheckEqual(TakenCounts[Index], 1, &SessionState, "A job was lost or taken twice.");
+        }
+
+        lluna_Jobs_Deque_Destroy(Deque);
+}
@@ -0,0 +1,300 @@
+#include <TestHelper.h>
+
+#include <Engine/Core/Public/Atomics.h>
+#include <Engine/Jobs/Public/Graph.h>
+
+#include <pthread.h>
+
+#define FrameCount 200
+#define WorkerCount 4
+
+struct lluna_TestHelper_Session SessionState;
+
+static void ResourceOrder();
+static void ReadWriteMerge();
+static void ExplicitDependencies();
+static void CriticalPath();
+static void ReuseAcrossFrames();
+static void OutsideWorkers();
+static void EmptyGraph();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Jobs_Graph");
+
+        lluna_TestHelper_RunTest(&SessionState, ResourceOrder);
+        lluna_TestHelper_RunTest(&SessionState, ReadWriteMerge);
+        lluna_TestHelper_RunTest(&SessionState, ExplicitDependencies);
+        lluna_TestHelper_RunTest(&SessionState, CriticalPath);
+        lluna_TestHelper_RunTest(&SessionState, ReuseAcrossFrames);
+        lluna_TestHelper_RunTest(&SessionState, OutsideWorkers);
+        lluna_TestHelper_RunTest(&SessionState, EmptyGraph);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+// Tasks stamp when they start and finish, so every dependency can be checked after a run.
+struct Timeline
+{
+        uint32 Clock;
+        uint32 Starts[16];
+        uint32 Ends[16];
+        uint32 Runs[16];
+};
+
+struct Stamp
+{
+        struct Timeline* Timeline;
+        uint32 Task;
+};
+
+static void Record(void* Data)
+{
+        struct Stamp* Stamp = Data;
+        struct Timeline* Timeline = Stamp->Timeline;
+
+        Timeline->Starts[Stamp->Task] = lluna_Core_Atomics_FetchAddUint32(&Timeline->Clock, 1, lluna_Core_Atomics_SequentiallyConsistent);
+        ++Timeline->Runs[Stamp->Task];
+        Timeline->Ends[Stamp->Task] = lluna_Core_Atomics_FetchAddUint32(&Timeline->Clock, 1, lluna_Core_Atomics_SequentiallyConsistent);
+}
+
+static void AddStamps(struct lluna_Jobs_Graph* Graph, struct Timeline* Timeline, struct Stamp* Stamps, uint32 Count, const uint64* Costs)
+{
+        for (uint32 Task = 0; Task < Count; ++Task)
+        {
+                Stamps[Task].Timeline = Timeline;
+                Stamps[Task].Task = Task;
+                lluna_Jobs_Graph_AddTask(Graph, Record, &Stamps[Task], Costs ? Costs[Task] : 1);
+        }
+}
+
+static boolean RanBefore(struct Timeline* Timeline, uint32 First, uint32 Second)
+{
+        return Timeline->Ends[First] < Timeline->Starts[Second];
+}
+
+static void ResourceOrder()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(WorkerCount);
+        struct lluna_Jobs_Graph* Graph = lluna_Jobs_Graph_Create();
+        struct Timeline Timeline = { 0 };
+        struct Stamp Stamps[6];
+        uint32 Resource = 0;
+        uint32 Unrelated = 0;
+
+        // 0 writes, 1 and 2 read, 3 writes, 4 reads, 5 only touches another resource.
+        AddStamps(Graph, &Timeline, Stamps, 6, NULL);
+        lluna_Jobs_Graph_Write(Graph, 0, &Resource);
+        lluna_Jobs_Graph_Read(Graph, 1, &Resource);
+        lluna_Jobs_Graph_Read(Graph, 2, &Resource);
+        lluna_Jobs_Graph_Write(Graph, 3, &Resource);
+        lluna_Jobs_Graph_Read(Graph, 4, &Resource);
+        lluna_Jobs_Graph_Write(Graph, 5, &Unrelated);
+
+        for (uint32 Frame = 0; Frame < FrameCount; ++Frame)
+        {
+                lluna_Jobs_Graph_Run(Graph, Scheduler);
+
+                lluna_TestHelper_CheckTrue(RanBefore(&Timeline, 0, 1) && RanBefore(&Timeline, 0, 2), &SessionState, "Reader ran before the writer.");
+                lluna_TestHelper_CheckTrue(RanBefore(&Timeline, 1, 3) && RanBefore(&Timeline, 2, 3), &SessionState, "Writer ran before a reader.");
+                lluna_TestHelper_CheckTrue(RanBefore(&Timeline, 3, 4), &SessionState, "Reader ran before the second writer.");
+        }
+
+        for (uint32 Task = 0; Task < 6; ++Task)
+        {
+                lluna_TestHelper_CheckEqual(Timeline.Runs[Task], FrameCount, &SessionState, "Task did not run once per frame.");
+        }
+        lluna_TestHelper_CheckEqual(lluna_Jobs_Graph_CriticalPathCost(Graph), 4, &SessionState, "Wrong critical path.");
+
+        lluna_Jobs_Graph_Destroy(Graph);
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}
+
+static void ReadWriteMerge()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(WorkerCount);
+        struct lluna_Jobs_Graph* Graph = lluna_Jobs_Graph_Create();
+        struct Timeline Timeline = { 0 };
+        struct Stamp Stamps[3];
+        uint32 Resource = 0;
+
+        // A task both reading and writing is a writer, so the readers around it can't overlap with it.
+        AddStamps(Graph, &Timeline, Stamps, 3, NULL);
+        lluna_Jobs_Graph_Read(Graph, 0, &Resource);
+        lluna_Jobs_Graph_Read(Graph, 1, &Resource);
+        lluna_Jobs_Graph_Write(Graph, 1, &Resource);
+        lluna_Jobs_Graph_Read(Graph, 1, &Resource);
+        lluna_Jobs_Graph_Read(Graph, 2, &Resource);
+
+        for (uint32 Frame = 0; Frame < FrameCount; ++Frame)
+        {
+                lluna_Jobs_Graph_Run(Graph, Scheduler);
+
+                lluna_TestHelper_CheckTrue(RanBefore(&Timeline, 0, 1), &SessionState, "Read and write were not merged.");
+                lluna_TestHelper_CheckTrue(RanBefore(&Timeline, 1, 2), &SessionState, "Reader ran before the writer.");
+        }
+        lluna_TestHelper_CheckEqual(lluna_Jobs_Graph_CriticalPathCost(Graph), 3, &SessionState, "Wrong critical path.");
+
+        lluna_Jobs_Graph_Destroy(Graph);
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}
+
+static void ExplicitDependencies()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(WorkerCount);
+        struct lluna_Jobs_Graph* Graph = lluna_Jobs_Graph_Create();
+        struct Timeline Timeline = { 0 };
+        struct Stamp Stamps[4];
+        uint32 Resource = 0;
+
+        // Duplicate edges from a resource and an explicit dependency count once.
+        AddStamps(Graph, &Timeline, Stamps, 4, NULL);
+        lluna_Jobs_Graph_Depend(Graph, 2, 0);
+        lluna_Jobs_Graph_Depend(Graph, 3, 2);
+        lluna_Jobs_Graph_Depend(Graph, 3, 1);
+        lluna_Jobs_Graph_Write(Graph, 1, &Resource);
+        lluna_Jobs_Graph_Read(Graph, 3, &Resource);
+
+        for (uint32 Frame = 0; Frame < FrameCount; ++Frame)
+        {
+                lluna_Jobs_Graph_Run(Graph, Scheduler);
+
+                lluna_TestHelper_CheckTrue(RanBefore(&Timeline, 0, 2) && RanBefore(&Timeline, 2, 3), &SessionState, "Dependency ran late.");
+                lluna_TestHelper_CheckTrue(RanBefore(&Timeline, 1, 3), &SessionState, "Dependency ran late.");
+        }
+        lluna_TestHelper_CheckEqual(Graph->PredecessorCounts[3], 2, &SessionState, "Duplicate dependency was kept.");
+        lluna_TestHelper_CheckEqual(Timeline.Runs[3], FrameCount, &SessionState, "Task did not run once per frame.");
+
+        lluna_Jobs_Graph_Destroy(Graph);
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}
+
+static void CriticalPath()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(1);
+        struct lluna_Jobs_Graph* Graph = lluna_Jobs_Graph_Create();
+        struct Timeline Timeline = { 0 };
+        struct Stamp Stamps[5];
+        uint32 Chain = 0;
+        uint32 Short = 0;
+
+        // 1 -> 2 -> 3 is the longest chain and goes first, the shorter 0 -> 4 fills in between by priority.
+        const uint64 Costs[5] = { 5, 2, 8, 3, 1 };
+        AddStamps(Graph, &Timeline, Stamps, 5, Costs);
+        lluna_Jobs_Graph_Write(Graph, 1, &Chain);
+        lluna_Jobs_Graph_Write(Graph, 2, &Chain);
+        lluna_Jobs_Graph_Read(Graph, 3, &Chain);
+        lluna_Jobs_Graph_Write(Graph, 0, &Short);
+        lluna_Jobs_Graph_Read(Graph, 4, &Short);
+        lluna_Jobs_Graph_Compile(Graph);
+
+        lluna_TestHelper_CheckEqual(lluna_Jobs_Graph_CriticalPathCost(Graph), 13, &SessionState, "Wrong critical path.");
+        lluna_TestHelper_CheckEqual(Graph->Priorities[0], 6, &SessionState, "Wrong priority.");
+        lluna_TestHelper_CheckEqual(Graph->Priorities[2], 11, &SessionState, "Wrong priority.");
+
+        // With a single worker the tasks run one at a time, most critical first.
+        lluna_Jobs_Graph_Run(Graph, Scheduler);
+        const uint32 Expected[5] = { 1, 2, 0, 3, 4 };
+        for (uint32 Position = 0; Position < 5; ++Position)
+        {
+                lluna_TestHelper_CheckEqual(Timeline.Starts[Expected[Position]], Position * 2, &SessionState, "Tasks ran out of priority order.");
+        }
+
+        lluna_Jobs_Graph_Destroy(Graph);
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}
+
+static void ReuseAcrossFrames()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(WorkerCount);
+        struct lluna_Jobs_Graph* Graph = lluna_Jobs_Graph_Create();
+        struct Timeline Timeline = { 0 };
+        struct Stamp Stamps[3];
+        uint32 Resource = 0;
+
+        AddStamps(Graph, &Timeline, Stamps, 2, NULL);
+        lluna_Jobs_Graph_Write(Graph, 0, &Resource);
+        lluna_Jobs_Graph_Read(Graph, 1, &Resource);
+
+        lluna_Jobs_Graph_Run(Graph, Scheduler);
+        uint32* Successors = Graph->Successors;
+        for (uint32 Frame = 1; Frame < FrameCount; ++Frame)
+        {
+                lluna_Jobs_Graph_Run(Graph, Scheduler);
+        }
+        lluna_TestHelper_CheckTrue(Graph->Compiled, &SessionState, "Graph was not kept compiled.");
+        lluna_TestHelper_CheckEqual(Graph->Successors, Successors, &SessionState, "Unchanged graph was recompiled.");
+        lluna_TestHelper_CheckEqual(Timeline.Runs[1], FrameCount, &SessionState, "Task did not run once per frame.");
+
+        // New declarations invalidate the compiled graph, the next run picks them up.
+        Stamps[2].Timeline = &Timeline;
+        Stamps[2].Task = 2;
+        uint32 Task = lluna_Jobs_Graph_AddTask(Graph, Record, &Stamps[2], 1);
+        lluna_Jobs_Graph_Write(Graph, Task, &Resource);
+        lluna_TestHelper_CheckEqual(Task, 2, &SessionState, "Tasks are not indexed in declaration order.");
+        lluna_TestHelper_CheckFalse(Graph->Compiled, &SessionState, "Changed graph stayed compiled.");
+
+        lluna_Jobs_Graph_Run(Graph, Scheduler);
+        lluna_TestHelper_CheckTrue(RanBefore(&Timeline, 1, 2), &SessionState, "New writer ran before the reader.");
+        lluna_TestHelper_CheckEqual(Timeline.Runs[2], 1, &SessionState, "New task did not run.");
+        lluna_TestHelper_CheckEqual(lluna_Jobs_Graph_TaskCount(Graph), 3, &SessionState, "Wrong task count.");
+
+        lluna_Jobs_Graph_Destroy(Graph);
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}
+
+struct Outside
+{
+        struct lluna_Jobs_Scheduler* Scheduler;
+        struct lluna_Jobs_Graph* Graph;
+};
+
+static void* RunOutside(void* Argument)
+{
+        struct Outside* Outside = Argument;
+        lluna_Jobs_Graph_Run(Outside->Graph, Outside->Scheduler);
+
+        return NULL;
+}
+
+static void OutsideWorkers()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(WorkerCount);
+        struct lluna_Jobs_Graph* Graph = lluna_Jobs_Graph_Create();
+        struct Timeline Timeline = { 0 };
+        struct Stamp Stamps[4];
+        uint32 Resource = 0;
+
+        const uint64 Costs[4] = { 1, 1, 4, 1 };
+        AddStamps(Graph, &Timeline, Stamps, 4, Costs);
+        lluna_Jobs_Graph_Write(Graph, 1, &Resource);
+        lluna_Jobs_Graph_Read(Graph, 3, &Resource);
+
+        struct Outside Outside = { Scheduler, Graph };
+        pthread_t Thread;
+        pthread_create(&Thread, NULL, RunOutside, &Outside);
+        pthread_join(Thread, NULL);
+
+        // Runs from other threads stay on the calling thread, so they're serial and in priority order.
+        const uint32 Expected[4] = { 2, 1, 0, 3 };
+        for (uint32 Position = 0; Position < 4; ++Position)
+        {
+                lluna_TestHelper_CheckEqual(Timeline.Starts[Expected[Position]], Position * 2, &SessionState, "Tasks ran out of priority order.");
+        }
+
+        lluna_Jobs_Graph_Destroy(Graph);
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}
+
+static void EmptyGraph()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(WorkerCount);
+        struct lluna_Jobs_Graph* Graph = lluna_Jobs_Graph_Create();
+
+        lluna_Jobs_Graph_Run(Graph, Scheduler);
+        lluna_TestHelper_CheckEqual(lluna_Jobs_Graph_TaskCount(Graph), 0, &SessionState, "Empty graph has tasks.");
+        lluna_TestHelper_CheckEqual(lluna_Jobs_Graph_CriticalPathCost(Graph), 0, &SessionState, "Empty graph has a critical path.");
+
+        lluna_Jobs_Graph_Destroy(Graph);
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}
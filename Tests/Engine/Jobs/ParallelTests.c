@@ -0,0 +1,281 @@
+#include <TestHelper.h>
+
+#include <Engine/Jobs/Public/Parallel.h>
+
+#include <string.h>
+
+struct lluna_TestHelper_Session SessionState;
+
+static void For();
+static void Reduce();
+static void InclusiveScan();
+static void ExclusiveScan();
+static void Sort();
+static void SortGrainSizes();
+static void EmptyArrays();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Jobs_Parallel");
+
+        lluna_TestHelper_RunTest(&SessionState, For);
+        lluna_TestHelper_RunTest(&SessionState, Reduce);
+        lluna_TestHelper_RunTest(&SessionState, InclusiveScan);
+        lluna_TestHelper_RunTest(&SessionState, ExclusiveScan);
+        lluna_TestHelper_RunTest(&SessionState, Sort);
+        lluna_TestHelper_RunTest(&SessionState, SortGrainSizes);
+        lluna_TestHelper_RunTest(&SessionState, EmptyArrays);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+// 2x2 matrices multiply associatively but not commutatively, so any reordering of partial results shows up.
+struct Matrix
+{
+        uint64 Values[4];
+};
+
+static const struct Matrix IdentityMatrix = { { 1, 0, 0, 1 } };
+
+static void Multiply(void* Context, byte* Accumulator, const byte* Element)
+{
+        struct Matrix* Left = (struct Matrix*)Accumulator;
+        const struct Matrix* Right = (const struct Matrix*)Element;
+
+        struct Matrix Product = { {
+                Left->Values[0] * Right->Values[0] + Left->Values[1] * Right->Values[2],
+                Left->Values[0] * Right->Values[1] + Left->Values[1] * Right->Values[3],
+                Left->Values[2] * Right->Values[0] + Left->Values[3] * Right->Values[2],
+                Left->Values[2] * Right->Values[1] + Left->Values[3] * Right->Values[3]
+        } };
+        *Left = Product;
+}
+
+static uint64 NextRandom(uint64* State)
+{
+        *State ^= *State << 13;
+        *State ^= *State >> 7;
+        *State ^= *State << 17;
+
+        return *State;
+}
+
+static struct lluna_Container_DynamicArray* CreateMatrices(uint64 Count)
+{
+        struct lluna_Container_DynamicArray* Array = lluna_Container_DynamicArray_Create(Count, sizeof(struct Matrix));
+        uint64 State = 0x2545F4914F6CDD1DULL;
+
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                struct Matrix Element = { { NextRandom(&State), NextRandom(&State), NextRandom(&State), NextRandom(&State) } };
+                lluna_Container_DynamicArray_Append(Array, (byte*)&Element);
+        }
+
+        return Array;
+}
+
+static void Square(void* Context, byte* Elements, uint64 Index, uint64 Count)
+{
+        uint64* Values = (uint64*)Elements;
+        for (uint64 Offset = 0; Offset < Count; ++Offset)
+        {
+                Values[Offset] = (Index + Offset) * (Index + Offset);
+        }
+}
+
+static void For()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(4);
+        struct lluna_Container_DynamicArray* Array = lluna_Container_DynamicArray_Create(100000, sizeof(uint64));
+        uint64 Zero = 0;
+
+        for (uint64 Index = 0; Index < 100000; ++Index)
+        {
+                lluna_Container_DynamicArray_Append(Array, (byte*)&Zero);
+        }
+
+        lluna_Jobs_Parallel_For(Scheduler, Array, 1000, Square, NULL);
+
+        boolean Correct = true;
+        for (uint64 Index = 0; Index < 100000; ++Index)
+        {
+                Correct &= *(uint64*)lluna_Container_DynamicArray_Get(Array, Index) == Index * Index;
+        }
+        lluna_TestHelper_CheckTrue(Correct, &SessionState, "Not every element was processed exactly once.");
+
+        lluna_Container_DynamicArray_Destroy(Array);
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}
+
+static void Reduce()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(4);
+        struct lluna_Container_DynamicArray* Array = CreateMatrices(50001);
+
+        struct Matrix Serial = IdentityMatrix;
+        for (uint64 Index = 0; Index < 50001; ++Index)
+        {
+                Multiply(NULL, (byte*)&Serial, lluna_Container_DynamicArray_Get(Array, Index));
+        }
+
+        struct Matrix Parallel;
+        lluna_Jobs_Parallel_Reduce(Scheduler, Array, 0, (const byte*)&IdentityMatrix, Multiply, NULL, (byte*)&Parallel);
+        lluna_TestHelper_CheckTrue(memcmp(&Serial, &Parallel, sizeof(struct Matrix)) == 0, &SessionState, "Parallel reduction differs from the serial one.");
+
+        lluna_Jobs_Parallel_Reduce(Scheduler, Array, 777, (const byte*)&IdentityMatrix, Multiply, NULL, (byte*)&Parallel);
+        lluna_TestHelper_CheckTrue(memcmp(&Serial, &Parallel, sizeof(struct Matrix)) == 0, &SessionState, "Reduction with a grain size differs from the serial one.");
+
+        lluna_Container_DynamicArray_Destroy(Array);
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}
+
+static boolean ScanMatches(struct lluna_Jobs_Scheduler* Scheduler, uint64 Count, uint64 GrainSize, boolean Exclusive)
+{
+        struct lluna_Container_DynamicArray* Array = CreateMatrices(Count);
+        struct lluna_Container_DynamicArray* Expected = CreateMatrices(Count);
+
+        struct Matrix Running = IdentityMatrix;
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                struct Matrix* Element = (struct Matrix*)lluna_Container_DynamicArray_Get(Expected, Index);
+                struct Matrix Original = *Element;
+                if (Exclusive)
+                {
+                        *Element = Running;
+                        Multiply(NULL, (byte*)&Running, (const byte*)&Original);
+                }
+                else
+                {
+                        Multiply(NULL, (byte*)&Running, (const byte*)&Original);
+                        *Element = Running;
+                }
+        }
+
+        if (Exclusive)
+        {
+                lluna_Jobs_Parallel_ExclusiveScan(Scheduler, Array, GrainSize, (const byte*)&IdentityMatrix, Multiply, NULL);
+        }
+        else
+        {
+                lluna_Jobs_Parallel_InclusiveScan(Scheduler, Array, GrainSize, (const byte*)&IdentityMatrix, Multiply, NULL);
+        }
+
+        boolean Matches = memcmp(Array->Data, Expected->Data, Count * sizeof(struct Matrix)) == 0;
+
+        lluna_Container_DynamicArray_Destroy(Expected);
+        lluna_Container_DynamicArray_Destroy(Array);
+
+        return Matches;
+}
+
+static void InclusiveScan()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(4);
+
+        lluna_TestHelper_CheckTrue(ScanMatches(Scheduler, 30001, 0, false), &SessionState, "Inclusive scan differs from the serial one.");
+        lluna_TestHelper_CheckTrue(ScanMatches(Scheduler, 1000, 1, false), &SessionState, "Inclusive scan with single element chunks is wrong.");
+        lluna_TestHelper_CheckTrue(ScanMatches(Scheduler, 100, 1000, false), &SessionState, "Inclusive scan with a single chunk is wrong.");
+
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}
+
+static void ExclusiveScan()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(4);
+
+        lluna_TestHelper_CheckTrue(ScanMatches(Scheduler, 30001, 0, true), &SessionState, "Exclusive scan differs from the serial one.");
+        lluna_TestHelper_CheckTrue(ScanMatches(Scheduler, 1000, 1, true), &SessionState, "Exclusive scan with single element chunks is wrong.");
+        lluna_TestHelper_CheckTrue(ScanMatches(Scheduler, 100, 1000, true), &SessionState, "Exclusive scan with a single chunk is wrong.");
+
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}
+
+struct Entry
+{
+        uint32 Key;
+        uint32 Order;
+};
+
+static int32 CompareKeys(void* Context, const byte* Left, const byte* Right)
+{
+        uint32 LeftKey = ((const struct Entry*)Left)->Key;
+        uint32 RightKey = ((const struct Entry*)Right)->Key;
+
+        return (LeftKey > RightKey) - (LeftKey < RightKey);
+}
+
+// Sorts entries with many equal keys and checks they are ordered by key, then by original position.
+static boolean SortIsStable(struct lluna_Jobs_Scheduler* Scheduler, uint64 Count, uint64 GrainSize)
+{
+        struct lluna_Container_DynamicArray* Array = lluna_Container_DynamicArray_Create(Count + 1, sizeof(struct Entry));
+        uint64 State = 0x9E3779B97F4A7C15ULL;
+
+        for (uint64 Index = 0; Index < Count; ++Index)
+        {
+                struct Entry Element = { (uint32)(NextRandom(&State) % 1000), (uint32)Index };
+                lluna_Container_DynamicArray_Append(Array, (byte*)&Element);
+        }
+
+        lluna_Jobs_Parallel_Sort(Scheduler, Array, GrainSize, CompareKeys, NULL);
+
+        boolean Stable = lluna_Container_DynamicArray_Count(Array) == Count;
+        for (uint64 Index = 1; Index < Count; ++Index)
+        {
+                struct Entry* Previous = (struct Entry*)lluna_Container_DynamicArray_Get(Array, Index - 1);
+                struct Entry* Current = (struct Entry*)lluna_Container_DynamicArray_Get(Array, Index);
+                Stable &= Previous->Key < Current->Key || (Previous->Key == Current->Key && Previous->Order < Current->Order);
+        }
+
+        lluna_Container_DynamicArray_Destroy(Array);
+
+        return Stable;
+}
+
+static void Sort()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(4);
+
+        lluna_TestHelper_CheckTrue(SortIsStable(Scheduler, 200000, 0), &SessionState, "Parallel sort is not sorted or not stable.");
+        lluna_TestHelper_CheckTrue(SortIsStable(Scheduler, 2, 0), &SessionState, "Sorting two elements failed.");
+
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}
+
+static void SortGrainSizes()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(3);
+
+        // Odd counts and grain sizes leave runs without a pair and merge pieces crossing run boundaries.
+        lluna_TestHelper_CheckTrue(SortIsStable(Scheduler, 10007, 1), &SessionState, "Sorting with single element chunks failed.");
+        lluna_TestHelper_CheckTrue(SortIsStable(Scheduler, 10007, 17), &SessionState, "Sorting with small chunks failed.");
+        lluna_TestHelper_CheckTrue(SortIsStable(Scheduler, 10007, 3000), &SessionState, "Sorting with an odd number of chunks failed.");
+        lluna_TestHelper_CheckTrue(SortIsStable(Scheduler, 10007, 20000), &SessionState, "Sorting a single chunk failed.");
+
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}
+
+static void CountElements(void* Context, byte* Elements, uint64 Index, uint64 Count)
+{
+        *(uint64*)Context += Count;
+}
+
+static void EmptyArrays()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(2);
+        struct lluna_Container_DynamicArray* Array = lluna_Container_DynamicArray_Create(1, sizeof(struct Matrix));
+
+        uint64 Processed = 0;
+        lluna_Jobs_Parallel_For(Scheduler, Array, 0, CountElements, &Processed);
+        lluna_TestHelper_CheckEqual(Processed, 0, &SessionState, "Processed elements of an empty array.");
+
+        struct Matrix Result = { { 5, 5, 5, 5 } };
+        lluna_Jobs_Parallel_Reduce(Scheduler, Array, 0, (const byte*)&IdentityMatrix, Multiply, NULL, (byte*)&Result);
+        lluna_TestHelper_CheckTrue(memcmp(&Result, &IdentityMatrix, sizeof(struct Matrix)) == 0, &SessionState, "Reducing an empty array didn't return the identity.");
+
+        lluna_Jobs_Parallel_InclusiveScan(Scheduler, Array, 0, (const byte*)&IdentityMatrix, Multiply, NULL);
+        lluna_Jobs_Parallel_Sort(Scheduler, Array, 0, CompareKeys, NULL);
+        lluna_TestHelper_CheckTrue(lluna_Container_DynamicArray_Empty(Array), &SessionState, "Empty array gained elements.");
+
+        lluna_Container_DynamicArray_Destroy(Array);
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}
@@ -0,0 +1,247 @@
+#include <TestHelper.h>
+
+#include <Engine/Core/Public/Atomics.h>
+#include <Engine/Jobs/Public/Scheduler.h>
+
+#include <pthread.h>
+#include <sched.h>
+
+struct lluna_TestHelper_Session SessionState;
+
+static void RunAndWait();
+static void SingleWorker();
+static void NestedJobs();
+static void SuspendedWaits();
+static void RepeatedWaves();
+static void WorkerIndex();
+static void RunFromOtherThread();
+
+int main(int argc, const char* argv[])
+{
+        lluna_TestHelper_StartSession(&SessionState, "lluna_Jobs_Scheduler");
+
+        lluna_TestHelper_RunTest(&SessionState, RunAndWait);
+        lluna_TestHelper_RunTest(&SessionState, SingleWorker);
+        lluna_TestHelper_RunTest(&SessionState, NestedJobs);
+        lluna_TestHelper_RunTest(&SessionState, SuspendedWaits);
+        lluna_TestHelper_RunTest(&SessionState, RepeatedWaves);
+        lluna_TestHelper_RunTest(&SessionState, WorkerIndex);
+        lluna_TestHelper_RunTest(&SessionState, RunFromOtherThread);
+
+        lluna_TestHelper_FinishSession(&SessionState);
+}
+
+static void AddOne(void* Data)
+{
+        lluna_Core_Atomics_FetchAddInt64((int64*)Data, 1, lluna_Core_Atomics_Relaxed);
+}
+
+static boolean RunAdds(struct lluna_Jobs_Scheduler* Scheduler, uint32 Count)
+{
+        static struct lluna_Jobs_Job Jobs[10000];
+        int64 Sum = 0;
+        struct lluna_Jobs_Counter Counter = { 0 };
+
+        for (uint32 Index = 0; Index < Count; ++Index)
+        {
+                Jobs[Index].Function = AddOne;
+                Jobs[Index].Data = &Sum;
+        }
+
+        lluna_Jobs_Scheduler_Run(Scheduler, Jobs, Count, &Counter);
+        lluna_Jobs_Scheduler_Wait(Scheduler, &Counter);
+
+        return lluna_Jobs_Scheduler_Done(&Counter) && lluna_Core_Atomics_LoadInt64(&Sum, lluna_Core_Atomics_Relaxed) == Count;
+}
+
+static void RunAndWait()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(4);
+
+        lluna_TestHelper_CheckEqual(lluna_Jobs_Scheduler_WorkerCount(Scheduler), 4, &SessionState, "Wrong number of workers.");
+        lluna_TestHelper_CheckTrue(RunAdds(Scheduler, 10000), &SessionState, "Not every job ran exactly once before the wait returned.");
+
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}
+
+static void SingleWorker()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(1);
+
+        lluna_TestHelper_CheckTrue(RunAdds(Scheduler, 1000), &SessionState, "Jobs didn't run on the waiting thread.");
+
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}
+
+struct FibonacciJob
+{
+        struct lluna_Jobs_Scheduler* Scheduler;
+        uint32 Input;
+        uint64 Output;
+};
+
+// Spawns both halves and waits on them from inside a job, which only completes if waiting runs other jobs.
+static void Fibonacci(void* Data)
+{
+        struct FibonacciJob* Task = (struct FibonacciJob*)Data;
+        if (Task->Input < 2)
+        {
+                Task->Output = Task->Input;
+                return;
+        }
+
+        struct FibonacciJob Children[2] = {
+                { Task->Scheduler, Task->Input - 1, 0 },
+                { Task->Scheduler, Task->Input - 2, 0 }
+        };
+        struct lluna_Jobs_Job Jobs[2] = { { Fibonacci, &Children[0], NULL }, { Fibonacci, &Children[1], NULL } };
+        struct lluna_Jobs_Counter Counter = { 0 };
+
+        lluna_Jobs_Scheduler_Run(Task->Scheduler, Jobs, 2, &Counter);
+        lluna_Jobs_Scheduler_Wait(Task->Scheduler, &Counter);
+
+        Task->Output = Children[0].Output + Children[1].Output;
+}
+
+static void NestedJobs()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(4);
+
+        struct FibonacciJob Root = { Scheduler, 20, 0 };
+        struct lluna_Jobs_Job Job = { Fibonacci, &Root, NULL };
+        struct lluna_Jobs_Counter Counter = { 0 };
+
+        lluna_Jobs_Scheduler_Run(Scheduler, &Job, 1, &Counter);
+        lluna_Jobs_Scheduler_Wait(Scheduler, &Counter);
+
+        lluna_TestHelper_CheckEqual(Root.Output, 6765, &SessionState, "Nested jobs computed the wrong result.");
+
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}
+
+#define WaiterCount 64
+
+struct Gate
+{
+        struct lluna_Jobs_Scheduler* Scheduler;
+        struct lluna_Jobs_Counter Counter;
+        uint32 Open;
+        int64 Started;
+        int64 Finished;
+};
+
+static void Hold(void* Data)
+{
+        struct Gate* Gate = (struct Gate*)Data;
+        while (!lluna_Core_Atomics_LoadUint32(&Gate->Open, lluna_Core_Atomics_Acquire))
+        {
+                sched_yield();
+        }
+}
+
+static void PassGate(void* Data)
+{
+        struct Gate* Gate = (struct Gate*)Data;
+        lluna_Core_Atomics_FetchAddInt64(&Gate->Started, 1, lluna_Core_Atomics_Relaxed);
+        lluna_Jobs_Scheduler_Wait(Gate->Scheduler, &Gate->Counter);
+        if (lluna_Jobs_Scheduler_Done(&Gate->Counter))
+        {
+                lluna_Core_Atomics_FetchAddInt64(&Gate->Finished, 1, lluna_Core_Atomics_Relaxed);
+        }
+}
+
+// More jobs wait on the gate than there are workers, and the job holding it only lets go once all of them started.
+static void SuspendedWaits()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(4);
+
+        struct Gate Gate = { Scheduler, { 0 }, false, 0, 0 };
+        struct lluna_Jobs_Job HoldJob = { Hold, &Gate, NULL };
+        lluna_Jobs_Scheduler_Run(Scheduler, &HoldJob, 1, &Gate.Counter);
+
+        struct lluna_Jobs_Job Jobs[WaiterCount];
+        struct lluna_Jobs_Counter Counter = { 0 };
+        for (uint32 Index = 0; Index < WaiterCount; ++Index)
+        {
+                Jobs[Index].Function = PassGate;
+                Jobs[Index].Data = &Gate;
+        }
+        lluna_Jobs_Scheduler_Run(Scheduler, Jobs, WaiterCount, &Counter);
+
+        while (lluna_Core_Atomics_LoadInt64(&Gate.Started, lluna_Core_Atomics_Relaxed) < WaiterCount)
+        {
+                sched_yield();
+        }
+        lluna_Core_Atomics_StoreUint32(&Gate.Open, true, lluna_Core_Atomics_Release);
+
+        lluna_Jobs_Scheduler_Wait(Scheduler, &Counter);
+
+        lluna_TestHelper_CheckEqual(Gate.Finished, WaiterCount, &SessionState, "Waiting jobs continued before their counter was done.");
+        lluna_TestHelper_CheckEqual(Scheduler->WaitingCount, 0, &SessionState, "Suspended jobs were left behind.");
+
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}
+
+static void RepeatedWaves()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(0);
+
+        // Small waves separated by waits let workers fall asleep and wake up again.
+        for (uint32 Wave = 0; Wave < 500; ++Wave)
+        {
+                lluna_TestHelper_CheckTrue(RunAdds(Scheduler, 1 + Wave % 7), &SessionState, "A wave of jobs didn't complete.");
+        }
+
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}
+
+struct WorkerIndexJob
+{
+        struct lluna_Jobs_Scheduler* Scheduler;
+        uint32 Index;
+};
+
+static void RecordWorkerIndex(void* Data)
+{
+        struct WorkerIndexJob* Task = (struct WorkerIndexJob*)Data;
+        Task->Index = lluna_Jobs_Scheduler_WorkerIndex(Task->Scheduler);
+}
+
+static void WorkerIndex()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(3);
+
+        lluna_TestHelper_CheckEqual(lluna_Jobs_Scheduler_WorkerIndex(Scheduler), 0, &SessionState, "Creating thread is not worker 0.");
+
+        struct WorkerIndexJob Result = { Scheduler, 99 };
+        struct lluna_Jobs_Job Job = { RecordWorkerIndex, &Result, NULL };
+        struct lluna_Jobs_Counter Counter = { 0 };
+
+        lluna_Jobs_Scheduler_Run(Scheduler, &Job, 1, &Counter);
+        lluna_Jobs_Scheduler_Wait(Scheduler, &Counter);
+
+        lluna_TestHelper_CheckTrue(Result.Index < 3, &SessionState, "Job didn't run on a worker.");
+
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}
+
+static void* RunOnOtherThread(void* Argument)
+{
+        struct lluna_Jobs_Scheduler* Scheduler = (struct lluna_Jobs_Scheduler*)Argument;
+
+        return lluna_Jobs_Scheduler_WorkerIndex(Scheduler) == lluna_Jobs_Scheduler_WorkerCount(Scheduler) && RunAdds(Scheduler, 10) ? Argument : NULL;
+}
+
+static void RunFromOtherThread()
+{
+        struct lluna_Jobs_Scheduler* Scheduler = lluna_Jobs_Scheduler_Create(2);
+
+        pthread_t Thread;
+        void* Result;
+        pthread_create(&Thread, NULL, RunOnOtherThread, Scheduler);
+        pthread_join(Thread, &Result);
+
+        lluna_TestHelper_CheckTrue(Result == Scheduler, &SessionState, "Jobs run from a thread that isn't a worker didn't complete.");
+
+        lluna_Jobs_Scheduler_Destroy(Scheduler);
+}